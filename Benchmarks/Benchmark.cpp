@@ -0,0 +1,352 @@
+// Include Files
+//==============
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	struct sBenchmark
+	{
+		std::string name;
+		eae6320::Benchmarks::fBenchmark function;
+		std::vector<int64_t> parameters;
+	};
+
+	// This is a function so that benchmarks can be registered from any file during static initialization
+	std::vector<sBenchmark>& GetBenchmarks()
+	{
+		static std::vector<sBenchmark> benchmarks;
+		return benchmarks;
+	}
+
+	struct sResult
+	{
+		std::string name;
+		int64_t parameter = 0;
+		bool hasParameter = false;
+		uint64_t iterationCount = 0;
+		double nanosecondsPerIteration = 0.0;
+		uint64_t itemCountPerIteration = 0;
+		std::vector<std::pair<std::string, double>> counters;
+	};
+
+	struct sOptions
+	{
+		const char* filter = nullptr;
+		const char* csvPath = nullptr;
+		double minimumTimeToMeasure_inNanoseconds = 100.0 * 1000.0 * 1000.0;
+		unsigned int sampleCount = 5;
+		// Every benchmark is run for a single iteration with only its first parameter
+		// (this is used by the tests to make sure that every benchmark still works)
+		bool isSmokeTest = false;
+	};
+
+	bool ParseOptions( const int i_argumentCount, char** const i_arguments, sOptions& o_options );
+	void OutputResult( const sResult& i_result, FILE* const io_csvFile );
+}
+
+namespace eae6320
+{
+	namespace Benchmarks
+	{
+		struct sRunner
+		{
+			static bool Run( const fBenchmark i_function, const int64_t i_parameter, const uint64_t i_iterationCount, sResult& o_result )
+			{
+				cState state( i_parameter, i_iterationCount );
+				i_function( state );
+				if ( !state.m_hasFinished )
+				{
+					fprintf( stderr, "The benchmark %s didn't run its loop until KeepRunning() returned false\n", o_result.name.c_str() );
+					return false;
+				}
+				o_result.iterationCount = i_iterationCount;
+				o_result.nanosecondsPerIteration =
+					static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( state.m_elapsedDuration ).count() )
+					/ static_cast<double>( i_iterationCount );
+				o_result.itemCountPerIteration = state.m_itemCountPerIteration;
+				o_result.counters = std::move( state.m_counters );
+				return true;
+			}
+		};
+	}
+}
+
+// Interface
+//==========
+
+void eae6320::Benchmarks::cState::PauseTiming()
+{
+	m_pauseTime = clock_t::now();
+}
+
+void eae6320::Benchmarks::cState::ResumeTiming()
+{
+	m_pausedDuration += clock_t::now() - m_pauseTime;
+}
+
+void eae6320::Benchmarks::cState::SetCounter( const char* const i_name, const double i_value )
+{
+	for ( auto& counter : m_counters )
+	{
+		if ( counter.first == i_name )
+		{
+			counter.second = i_value;
+			return;
+		}
+	}
+	m_counters.emplace_back( i_name, i_value );
+}
+
+bool eae6320::Benchmarks::Register( const char* const i_name, const fBenchmark i_function, const std::initializer_list<int64_t> i_parameters )
+{
+	GetBenchmarks().push_back( sBenchmark{ i_name, i_function, i_parameters } );
+	return true;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Benchmarks::cState::cState( const int64_t i_parameter, const uint64_t i_iterationCount )
+	:
+	m_parameter( i_parameter ), m_iterationCount( i_iterationCount )
+{
+
+}
+
+// Implementation
+//===============
+
+bool eae6320::Benchmarks::cState::StartOrFinish()
+{
+	if ( !m_hasStarted )
+	{
+		m_hasStarted = true;
+		m_remainingIterationCount = m_iterationCount - 1;
+		m_startTime = clock_t::now();
+		return true;
+	}
+	else
+	{
+		const auto endTime = clock_t::now();
+		if ( !m_hasFinished )
+		{
+			m_hasFinished = true;
+			m_elapsedDuration = ( endTime - m_startTime ) - m_pausedDuration;
+		}
+		return false;
+	}
+}
+
+// Entry Point
+//============
+
+int main( int i_argumentCount, char** i_arguments )
+{
+	sOptions options;
+	if ( !ParseOptions( i_argumentCount, i_arguments, options ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	std::unique_ptr<FILE, int (*)( FILE* )> csvFile( nullptr, fclose );
+	if ( options.csvPath )
+	{
+		csvFile.reset( fopen( options.csvPath, "w" ) );
+		if ( !csvFile )
+		{
+			fprintf( stderr, "The CSV file \"%s\" couldn't be opened\n", options.csvPath );
+			return EXIT_FAILURE;
+		}
+		fprintf( csvFile.get(), "benchmark,parameter,iterations,ns_per_op,ops_per_second,ns_per_item,items_per_second,counters\n" );
+	}
+	printf( "%-80s %12s %12s %14s %12s %14s  %s\n", "Benchmark", "Iterations", "ns/op", "ops/s", "ns/item", "items/s", "Counters" );
+
+	auto benchmarks = GetBenchmarks();
+	std::sort( benchmarks.begin(), benchmarks.end(),
+		[]( const sBenchmark& i_lhs, const sBenchmark& i_rhs ) { return i_lhs.name < i_rhs.name; } );
+	auto haveAllSucceeded = true;
+	for ( const auto& benchmark : benchmarks )
+	{
+		if ( options.filter && ( benchmark.name.find( options.filter ) == std::string::npos ) )
+		{
+			continue;
+		}
+		auto parameters = benchmark.parameters;
+		const auto hasParameters = !parameters.empty();
+		if ( !hasParameters )
+		{
+			parameters.push_back( 0 );
+		}
+		else if ( options.isSmokeTest )
+		{
+			parameters.resize( 1 );
+		}
+		for ( const auto parameter : parameters )
+		{
+			sResult result;
+			result.name = benchmark.name;
+			result.parameter = parameter;
+			result.hasParameter = hasParameters;
+			if ( options.isSmokeTest )
+			{
+				if ( !eae6320::Benchmarks::sRunner::Run( benchmark.function, parameter, 1, result ) )
+				{
+					haveAllSucceeded = false;
+					continue;
+				}
+			}
+			else
+			{
+				// Find how many iterations are needed for a single run to take the minimum time
+				uint64_t iterationCount = 1;
+				while ( true )
+				{
+					if ( !eae6320::Benchmarks::sRunner::Run( benchmark.function, parameter, iterationCount, result ) )
+					{
+						haveAllSucceeded = false;
+						break;
+					}
+					const auto elapsedTime = result.nanosecondsPerIteration * static_cast<double>( iterationCount );
+					if ( elapsedTime >= options.minimumTimeToMeasure_inNanoseconds )
+					{
+						break;
+					}
+					// Aim slightly past the minimum, but don't grow by too much at once in case the first iterations were unusually fast
+					const auto multiplier = ( elapsedTime > 0.0 ) ?
+						std::min( std::max( 1.25 * options.minimumTimeToMeasure_inNanoseconds / elapsedTime, 2.0 ), 10.0 ) : 10.0;
+					iterationCount = static_cast<uint64_t>( static_cast<double>( iterationCount ) * multiplier );
+				}
+				if ( result.iterationCount != iterationCount )
+				{
+					continue;
+				}
+				// Report the median of several runs
+				// (the first runs have already warmed up the caches and the processor's clock speed)
+				std::vector<double> nanosecondsPerIteration;
+				for ( unsigned int i = 0; i < options.sampleCount; ++i )
+				{
+					if ( !eae6320::Benchmarks::sRunner::Run( benchmark.function, parameter, iterationCount, result ) )
+					{
+						haveAllSucceeded = false;
+						break;
+					}
+					nanosecondsPerIteration.push_back( result.nanosecondsPerIteration );
+				}
+				if ( nanosecondsPerIteration.size() != options.sampleCount )
+				{
+					continue;
+				}
+				std::sort( nanosecondsPerIteration.begin(), nanosecondsPerIteration.end() );
+				result.nanosecondsPerIteration = nanosecondsPerIteration[nanosecondsPerIteration.size() / 2];
+			}
+			OutputResult( result, csvFile.get() );
+		}
+	}
+
+	return haveAllSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	bool ParseOptions( const int i_argumentCount, char** const i_arguments, sOptions& o_options )
+	{
+		for ( int i = 1; i < i_argumentCount; ++i )
+		{
+			const char* const argument = i_arguments[i];
+			const auto hasValue = ( i + 1 ) < i_argumentCount;
+			if ( ( std::strcmp( argument, "--filter" ) == 0 ) && hasValue )
+			{
+				o_options.filter = i_arguments[++i];
+			}
+			else if ( ( std::strcmp( argument, "--csv" ) == 0 ) && hasValue )
+			{
+				o_options.csvPath = i_arguments[++i];
+			}
+			else if ( ( std::strcmp( argument, "--min-time-ms" ) == 0 ) && hasValue )
+			{
+				o_options.minimumTimeToMeasure_inNanoseconds = std::atof( i_arguments[++i] ) * 1000.0 * 1000.0;
+			}
+			else if ( ( std::strcmp( argument, "--samples" ) == 0 ) && hasValue )
+			{
+				o_options.sampleCount = static_cast<unsigned int>( std::max( std::atoi( i_arguments[++i] ), 1 ) );
+			}
+			else if ( std::strcmp( argument, "--quick" ) == 0 )
+			{
+				o_options.minimumTimeToMeasure_inNanoseconds = 10.0 * 1000.0 * 1000.0;
+				o_options.sampleCount = 3;
+			}
+			else if ( std::strcmp( argument, "--smoke" ) == 0 )
+			{
+				o_options.isSmokeTest = true;
+			}
+			else
+			{
+				fprintf( stderr,
+					"Usage: %s [--filter <substring>] [--csv <path>] [--min-time-ms <milliseconds>] [--samples <count>] [--quick] [--smoke]\n",
+					i_arguments[0] );
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void OutputResult( const sResult& i_result, FILE* const io_csvFile )
+	{
+		const auto nanosecondsPerItem = ( i_result.itemCountPerIteration > 0 ) ?
+			( i_result.nanosecondsPerIteration / static_cast<double>( i_result.itemCountPerIteration ) ) : 0.0;
+		const auto iterationsPerSecond = ( i_result.nanosecondsPerIteration > 0.0 ) ? ( 1.0e9 / i_result.nanosecondsPerIteration ) : 0.0;
+		const auto itemsPerSecond = ( nanosecondsPerItem > 0.0 ) ? ( 1.0e9 / nanosecondsPerItem ) : 0.0;
+		std::string counters;
+		for ( const auto& counter : i_result.counters )
+		{
+			char buffer[128];
+			snprintf( buffer, sizeof( buffer ), "%s%s=%.10g", counters.empty() ? "" : " ", counter.first.c_str(), counter.second );
+			counters += buffer;
+		}
+
+		const auto name = i_result.hasParameter ? ( i_result.name + "/" + std::to_string( i_result.parameter ) ) : i_result.name;
+		if ( i_result.itemCountPerIteration > 0 )
+		{
+			printf( "%-80s %12llu %12.2f %14.4g %12.3f %14.4g  %s\n", name.c_str(),
+				static_cast<unsigned long long>( i_result.iterationCount ), i_result.nanosecondsPerIteration, iterationsPerSecond,
+				nanosecondsPerItem, itemsPerSecond, counters.c_str() );
+		}
+		else
+		{
+			printf( "%-80s %12llu %12.2f %14.4g %12s %14s  %s\n", name.c_str(),
+				static_cast<unsigned long long>( i_result.iterationCount ), i_result.nanosecondsPerIteration, iterationsPerSecond,
+				"", "", counters.c_str() );
+		}
+		fflush( stdout );
+
+		if ( io_csvFile )
+		{
+			fprintf( io_csvFile, "%s,%s,%llu,%.3f,%.6g,", i_result.name.c_str(),
+				i_result.hasParameter ? std::to_string( i_result.parameter ).c_str() : "",
+				static_cast<unsigned long long>( i_result.iterationCount ), i_result.nanosecondsPerIteration, iterationsPerSecond );
+			if ( i_result.itemCountPerIteration > 0 )
+			{
+				fprintf( io_csvFile, "%.4f,%.6g,", nanosecondsPerItem, itemsPerSecond );
+			}
+			else
+			{
+				fprintf( io_csvFile, ",," );
+			}
+			fprintf( io_csvFile, "\"%s\"\n", counters.c_str() );
+			fflush( io_csvFile );
+		}
+	}
+}
@@ -0,0 +1,156 @@
+/*
+	This file provides a minimal framework for measuring how long engine code takes
+
+	A benchmark is a function that runs the code being measured once for every iteration of a loop:
+		void MyBenchmark( eae6320::Benchmarks::cState& io_state )
+		{
+			// Anything before the loop isn't measured
+			while ( io_state.KeepRunning() )
+			{
+				// The code being measured
+			}
+		}
+		EAE6320_BENCHMARK( "Module/MyBenchmark", MyBenchmark );
+
+	The framework decides how many iterations to run
+	(enough that timing a single run takes at least the minimum time)
+	and then reports the median of several runs as nanoseconds per iteration and iterations per second.
+	A benchmark that processes many items in each iteration (e.g. a batch of vectors)
+	can tell the framework how many, and then the time per item and items per second are also reported.
+
+	A benchmark can be registered with a list of parameters (e.g. different numbers of objects)
+	and is then run once for each of them.
+*/
+
+#ifndef EAE6320_BENCHMARKS_BENCHMARK_H
+#define EAE6320_BENCHMARKS_BENCHMARK_H
+
+// Include Files
+//==============
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Benchmarks
+	{
+		class cState
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// This must be the condition of the loop that runs the code being measured
+			inline bool KeepRunning();
+
+			// The parameter that the benchmark was registered with (or zero if it has none)
+			int64_t GetParameter() const { return m_parameter; }
+
+			// These let a benchmark exclude work that it must do between iterations from the time
+			void PauseTiming();
+			void ResumeTiming();
+
+			// If every iteration processes the same number of items then the time per item is also reported
+			void SetItemCountPerIteration( const uint64_t i_itemCount ) { m_itemCountPerIteration = i_itemCount; }
+			// Any other value that a benchmark wants to report (e.g. bytes uploaded per frame)
+			void SetCounter( const char* const i_name, const double i_value );
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			cState( const int64_t i_parameter, const uint64_t i_iterationCount );
+
+			// Data
+			//=====
+
+		private:
+
+			using clock_t = std::chrono::steady_clock;
+
+			clock_t::time_point m_startTime;
+			clock_t::duration m_pausedDuration = clock_t::duration::zero();
+			clock_t::time_point m_pauseTime;
+			clock_t::duration m_elapsedDuration = clock_t::duration::zero();
+			std::vector<std::pair<std::string, double>> m_counters;
+			const int64_t m_parameter;
+			const uint64_t m_iterationCount;
+			uint64_t m_remainingIterationCount = 0;
+			uint64_t m_itemCountPerIteration = 0;
+			bool m_hasStarted = false;
+			bool m_hasFinished = false;
+
+			// Implementation
+			//===============
+
+		private:
+
+			// This is called when the loop starts and when it finishes
+			bool StartOrFinish();
+
+			// Friends
+			//========
+
+			friend struct sRunner;
+		};
+
+		using fBenchmark = void (*)( cState& io_state );
+
+		// The name should start with the name of the module being measured (e.g. "Math/sVector/Normalize")
+		bool Register( const char* const i_name, const fBenchmark i_function, const std::initializer_list<int64_t> i_parameters = {} );
+
+		// These keep the compiler from optimizing away a calculation whose result isn't otherwise used
+		// (or from moving a calculation out of the loop because its input never changes).
+		// Passing a pointer means that the memory it points to could be read or written by anything
+		// every time ClobberMemory() is called.
+		template<typename tValue> inline void DoNotOptimize( const tValue& i_value );
+		template<typename tValue> inline void DoNotOptimize( tValue& io_value );
+		// This forces every write to memory to actually happen
+		inline void ClobberMemory();
+	}
+}
+
+// These register a benchmark when the program starts
+#define EAE6320_BENCHMARK( i_name, i_function )	\
+	static const bool s_isRegistered_ ## i_function = eae6320::Benchmarks::Register( i_name, i_function )
+#define EAE6320_BENCHMARK_WITHPARAMETERS( i_name, i_function, ... )	\
+	static const bool s_isRegistered_ ## i_function = eae6320::Benchmarks::Register( i_name, i_function, { __VA_ARGS__ } )
+
+// Inline Implementation
+//======================
+
+inline bool eae6320::Benchmarks::cState::KeepRunning()
+{
+	// The only work done for an iteration in the middle of the loop is a single decrement and comparison
+	if ( m_remainingIterationCount > 0 )
+	{
+		--m_remainingIterationCount;
+		return true;
+	}
+	return StartOrFinish();
+}
+
+template<typename tValue> inline void eae6320::Benchmarks::DoNotOptimize( const tValue& i_value )
+{
+	asm volatile( "" : : "m"( i_value ) : "memory" );
+}
+
+template<typename tValue> inline void eae6320::Benchmarks::DoNotOptimize( tValue& io_value )
+{
+	asm volatile( "" : "+m"( io_value ) : : "memory" );
+}
+
+inline void eae6320::Benchmarks::ClobberMemory()
+{
+	asm volatile( "" : : : "memory" );
+}
+
+#endif	// EAE6320_BENCHMARKS_BENCHMARK_H
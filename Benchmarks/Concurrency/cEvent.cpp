@@ -0,0 +1,84 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/cThread.h>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// These are the two events that the application thread and the render thread hand frames back and forth with
+	struct sPingPong
+	{
+		// The application thread signals this when it has submitted a frame
+		Concurrency::cEvent whenAllDataHasBeenSubmitted;
+		// The render thread signals this when it has finished with a frame
+		Concurrency::cEvent whenDataForANewFrameCanBeSubmitted;
+		std::atomic<bool> shouldStop{ false };
+	};
+
+	// This plays the part of the render thread:
+	// it waits for a frame and then immediately signals that it has finished with it
+	void RenderThread( void* const io_userData )
+	{
+		auto& pingPong = *static_cast<sPingPong*>( io_userData );
+		while ( true )
+		{
+			if ( !Concurrency::WaitForEvent( pingPong.whenAllDataHasBeenSubmitted ) )
+			{
+				fprintf( stderr, "The render thread couldn't wait for a frame\n" );
+				std::exit( EXIT_FAILURE );
+			}
+			if ( pingPong.shouldStop.load() )
+			{
+				return;
+			}
+			pingPong.whenDataForANewFrameCanBeSubmitted.Signal();
+		}
+	}
+}
+
+// Benchmarks
+//===========
+
+namespace
+{
+	// Each iteration is a single round trip from the application thread to the render thread and back
+	// (neither thread does any work, and so this is the latency of handing off a frame in each direction)
+	void PingPong( cState& io_state )
+	{
+		sPingPong pingPong;
+		if ( !pingPong.whenAllDataHasBeenSubmitted.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled )
+			|| !pingPong.whenDataForANewFrameCanBeSubmitted.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) )
+		{
+			fprintf( stderr, "The events couldn't be initialized\n" );
+			std::exit( EXIT_FAILURE );
+		}
+		Concurrency::cThread renderThread;
+		if ( !renderThread.Start( RenderThread, &pingPong ) )
+		{
+			fprintf( stderr, "The render thread couldn't be started\n" );
+			std::exit( EXIT_FAILURE );
+		}
+		while ( io_state.KeepRunning() )
+		{
+			pingPong.whenAllDataHasBeenSubmitted.Signal();
+			Concurrency::WaitForEvent( pingPong.whenDataForANewFrameCanBeSubmitted );
+		}
+		pingPong.shouldStop.store( true );
+		pingPong.whenAllDataHasBeenSubmitted.Signal();
+		Concurrency::WaitForThreadToStop( renderThread );
+		pingPong.whenAllDataHasBeenSubmitted.CleanUp();
+		pingPong.whenDataForANewFrameCanBeSubmitted.CleanUp();
+	}
+	EAE6320_BENCHMARK( "Concurrency/cEvent/PingPong", PingPong );
+}
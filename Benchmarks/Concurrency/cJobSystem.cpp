@@ -0,0 +1,159 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <Engine/Concurrency/cJobSystem.h>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// Every iteration runs this many jobs and waits for all of them
+	constexpr size_t s_jobCountPerIteration = 2048;
+	// A fine-grained job sums this many floats
+	// (which takes tens of nanoseconds, about the same as the cost of running a job)
+	constexpr size_t s_valueCountPerJob = 64;
+
+	struct sSumJob
+	{
+		const float* values = nullptr;
+		float sum = 0.0f;
+	};
+
+	void Sum( void* const io_userData )
+	{
+		auto& job = *static_cast<sSumJob*>( io_userData );
+		auto sum = 0.0f;
+		for ( size_t i = 0; i < s_valueCountPerJob; ++i )
+		{
+			sum += job.values[i];
+		}
+		job.sum = sum;
+	}
+
+	void DoNothing( void* const )
+	{
+
+	}
+
+	void InitializeJobSystem( Concurrency::cJobSystem& io_jobSystem, cState& io_state )
+	{
+		const auto workerThreadCount = static_cast<unsigned int>( io_state.GetParameter() );
+		if ( !io_jobSystem.Initialize( workerThreadCount ) )
+		{
+			fprintf( stderr, "The job system couldn't be initialized with %u worker threads\n", workerThreadCount );
+			std::exit( EXIT_FAILURE );
+		}
+		io_state.SetCounter( "threads", static_cast<double>( workerThreadCount + 1 ) );
+	}
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of worker threads
+// (the thread that runs the benchmark also runs jobs,
+// and so a parameter of zero measures the overhead of the job system without any other threads)
+
+namespace
+{
+	void FineGrainedJobs( cState& io_state )
+	{
+		Concurrency::cJobSystem jobSystem;
+		InitializeJobSystem( jobSystem, io_state );
+		std::vector<float> values( s_jobCountPerIteration * s_valueCountPerJob, 1.0f );
+		std::vector<sSumJob> sumJobs( s_jobCountPerIteration );
+		std::vector<Concurrency::cJobSystem::sJob> jobs( s_jobCountPerIteration );
+		for ( size_t i = 0; i < s_jobCountPerIteration; ++i )
+		{
+			sumJobs[i].values = values.data() + ( i * s_valueCountPerJob );
+			jobs[i].function = Sum;
+			jobs[i].userData = &sumJobs[i];
+		}
+		io_state.SetItemCountPerIteration( s_jobCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			Concurrency::cJobSystem::cCounter counter;
+			jobSystem.Run( jobs.data(), s_jobCountPerIteration, &counter );
+			jobSystem.WaitForCounter( counter );
+		}
+		jobSystem.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Concurrency/cJobSystem/FineGrainedJobs", FineGrainedJobs, 0, 1, 2, 3, 7, 15 );
+
+	// This is the same work without the job system
+	void FineGrainedJobs_serial( cState& io_state )
+	{
+		std::vector<float> values( s_jobCountPerIteration * s_valueCountPerJob, 1.0f );
+		std::vector<sSumJob> sumJobs( s_jobCountPerIteration );
+		for ( size_t i = 0; i < s_jobCountPerIteration; ++i )
+		{
+			sumJobs[i].values = values.data() + ( i * s_valueCountPerJob );
+		}
+		DoNotOptimize( sumJobs.data() );
+		io_state.SetItemCountPerIteration( s_jobCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			for ( auto& sumJob : sumJobs )
+			{
+				Sum( &sumJob );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Concurrency/cJobSystem/FineGrainedJobs_serial", FineGrainedJobs_serial );
+
+	// This measures only the cost of running a job
+	void EmptyJobs( cState& io_state )
+	{
+		Concurrency::cJobSystem jobSystem;
+		InitializeJobSystem( jobSystem, io_state );
+		std::vector<Concurrency::cJobSystem::sJob> jobs( s_jobCountPerIteration );
+		for ( auto& job : jobs )
+		{
+			job.function = DoNothing;
+		}
+		io_state.SetItemCountPerIteration( s_jobCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			Concurrency::cJobSystem::cCounter counter;
+			jobSystem.Run( jobs.data(), s_jobCountPerIteration, &counter );
+			jobSystem.WaitForCounter( counter );
+		}
+		jobSystem.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Concurrency/cJobSystem/EmptyJobs", EmptyJobs, 0, 1, 2, 3, 7, 15 );
+
+	// Each range of the loop is as small as a fine-grained job
+	void ParallelFor( cState& io_state )
+	{
+		Concurrency::cJobSystem jobSystem;
+		InitializeJobSystem( jobSystem, io_state );
+		std::vector<float> values( s_jobCountPerIteration * s_valueCountPerJob, 1.0f );
+		std::vector<float> sums( s_jobCountPerIteration );
+		io_state.SetItemCountPerIteration( s_jobCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			jobSystem.ParallelFor( 0, values.size(), s_valueCountPerJob,
+				[&values, &sums]( const size_t i_index_begin, const size_t i_index_end )
+				{
+					auto sum = 0.0f;
+					for ( auto i = i_index_begin; i < i_index_end; ++i )
+					{
+						sum += values[i];
+					}
+					sums[i_index_begin / s_valueCountPerJob] = sum;
+				} );
+			ClobberMemory();
+		}
+		jobSystem.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Concurrency/cJobSystem/ParallelFor", ParallelFor, 0, 1, 2, 3, 7, 15 );
+}
@@ -0,0 +1,345 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <Engine/Assets/ReferenceCountedAssets.h>
+#include <Engine/Graphics/cConstantBuffer.h>
+#include <Engine/Graphics/cEffect.h>
+#include <Engine/Graphics/cMesh.h>
+#include <Engine/Graphics/cRenderState.h>
+#include <Engine/Graphics/ConstantBufferFormats.h>
+#include <Engine/Graphics/cTexture.h>
+#include <Engine/Graphics/Graphics.h>
+#include <Engine/Graphics/Null/NullDevice.h>
+#include <Engine/Graphics/TextureFormats.h>
+#include <Engine/Graphics/VertexFormats.h>
+#include <Engine/Platform/Platform.h>
+#include <Engine/Time/Time.h>
+#include <string>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+// Every benchmark renders with the null device
+// (nothing is drawn, but every API call and every uploaded byte is counted)
+// and reports what a frame asked of the driver as counters along with the time
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// The assets are written to the working directory while a benchmark runs
+	constexpr auto* const s_path_shader = "Benchmarks_Graphics.shd";
+	constexpr auto* const s_path_texture = "Benchmarks_Graphics.tex";
+	constexpr auto* const s_path_mesh = "Benchmarks_Graphics.mesh";
+
+	template <typename tData>
+	void Append( const tData& i_data, std::vector<uint8_t>& io_file )
+	{
+		const auto* const bytes = reinterpret_cast<const uint8_t*>( &i_data );
+		io_file.insert( io_file.end(), bytes, bytes + sizeof( i_data ) );
+	}
+
+	bool WriteAssetFiles()
+	{
+		// Shader
+		{
+			const std::vector<uint8_t> file( 64, 0 );
+			if ( !Platform::WriteBinaryFile( s_path_shader, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		// Texture (a single 4x4 block)
+		{
+			std::vector<uint8_t> file;
+			Graphics::TextureFormats::sTextureInfo textureInfo;
+			textureInfo.width = textureInfo.height = 4;
+			textureInfo.mipMapCount = 1;
+			textureInfo.compressionType = Graphics::TextureFormats::Compression::BC1;
+			Append( textureInfo, file );
+			file.resize( file.size() + Graphics::TextureFormats::Compression::GetSizeOfBlock( textureInfo.compressionType ), 0 );
+			if ( !Platform::WriteBinaryFile( s_path_texture, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		// Mesh (a single triangle inside of a unit sphere)
+		{
+			std::vector<uint8_t> file;
+			Graphics::sMeshBounds bounds;
+			bounds.sphereRadius = 1.0f;
+			for ( size_t i = 0; i < 3; ++i )
+			{
+				bounds.boxMinimum[i] = -1.0f;
+				bounds.boxMaximum[i] = 1.0f;
+			}
+			Append( bounds, file );
+			constexpr size_t vertexCount = 3;
+			Append( vertexCount, file );
+			for ( size_t i = 0; i < vertexCount; ++i )
+			{
+				Graphics::VertexFormats::sMesh vertex;
+				vertex.x = ( i == 1 ) ? 1.0f : 0.0f;
+				vertex.y = ( i == 2 ) ? 1.0f : 0.0f;
+				vertex.z = 0.0f;
+				vertex.u = vertex.v = 0.0f;
+				Append( vertex, file );
+			}
+			constexpr size_t indexCount = 3;
+			Append( indexCount, file );
+			for ( uint16_t i = 0; i < indexCount; ++i )
+			{
+				Append( i, file );
+			}
+			if ( !Platform::WriteBinaryFile( s_path_mesh, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// This initializes the graphics system and creates the resources that are submitted
+	struct sScene
+	{
+		cEffect* effect = nullptr;
+		Graphics::cTexture* texture = nullptr;
+		cMesh* mesh = nullptr;
+
+		void Initialize()
+		{
+			if ( !WriteAssetFiles() || !Time::Initialize() || !Graphics::Initialize( Graphics::sInitializationParameters() ) )
+			{
+				fprintf( stderr, "The graphics system couldn't be initialized\n" );
+				std::exit( EXIT_FAILURE );
+			}
+			std::string path_vertex( s_path_shader );
+			if ( !cEffect::CreateEffect( effect, &path_vertex[0], s_path_shader, Graphics::RenderStates::DepthBuffering )
+				|| !Graphics::cTexture::Load( s_path_texture, texture ) || !cMesh::Load( s_path_mesh, mesh ) )
+			{
+				fprintf( stderr, "The graphics resources couldn't be loaded\n" );
+				std::exit( EXIT_FAILURE );
+			}
+		}
+
+		void CleanUp()
+		{
+			effect->DecrementReferenceCount();
+			texture->DecrementReferenceCount();
+			mesh->DecrementReferenceCount();
+			Graphics::CleanUp();
+			Time::CleanUp();
+			std::remove( s_path_shader );
+			std::remove( s_path_texture );
+			std::remove( s_path_mesh );
+		}
+	};
+
+	// Every mesh is in front of the camera and so none of them are culled
+	Physics::sRigidBodyState CreateRigidBodyState( const size_t i_meshIndex )
+	{
+		Physics::sRigidBodyState rigidBodyState;
+		rigidBodyState.position = Math::sVector( 0.0f, 0.0f, -10.0f - static_cast<float>( i_meshIndex % 50 ) );
+		return rigidBodyState;
+	}
+
+	void RenderFrame( const sScene& i_scene, const size_t i_meshCount )
+	{
+		Graphics::WaitUntilDataForANewFrameCanBeSubmitted( 0 );
+		Graphics::SubmitElapsedTime( 0.0f, 0.0f );
+		Graphics::SubmitBackgroundColor( 0.0f, 0.0f, 0.0f, 1.0f );
+		{
+			// The camera is at the origin looking down negative Z
+			Graphics::cCamera camera;
+			camera.m_verticalFieldOfView_inRadians = 1.0f;
+			camera.m_aspectRatio = 1.0f;
+			camera.m_z_nearPlane = 0.1f;
+			camera.m_z_farPlane = 100.0f;
+			Graphics::SubmitCamera( camera );
+		}
+		Graphics::meshData meshData( i_scene.effect, i_scene.mesh, i_scene.texture );
+		for ( size_t i = 0; i < i_meshCount; ++i )
+		{
+			auto rigidBodyState = CreateRigidBodyState( i );
+			Graphics::SubmitEffectAndMesh( meshData, rigidBodyState );
+		}
+		Graphics::SignalThatAllDataForAFrameHasBeenSubmitted();
+		// The frame was already submitted and so rendering it on this thread doesn't wait
+		Graphics::RenderFrame();
+	}
+
+	// The counters are what the null device recorded since its statistics were reset, averaged over the frames
+	void SetDeviceCounters( const uint64_t i_frameCount, cState& io_state )
+	{
+		const auto statistics = Graphics::NullDevice::GetStatistics();
+		const auto frameCount = static_cast<double>( ( i_frameCount > 0 ) ? i_frameCount : 1 );
+		uint64_t apiCallCount = 0;
+		for ( const auto callCount : statistics.callCounts )
+		{
+			apiCallCount += callCount;
+		}
+		using namespace Graphics::NullDevice::ApiCalls;
+		io_state.SetCounter( "apiCallsPerFrame", static_cast<double>( apiCallCount ) / frameCount );
+		io_state.SetCounter( "bufferUpdatesPerFrame", static_cast<double>( statistics.callCounts[UpdateBuffer] ) / frameCount );
+		io_state.SetCounter( "drawCallsPerFrame",
+			static_cast<double>( statistics.callCounts[Draw] + statistics.callCounts[DrawIndexedInstanced] ) / frameCount );
+		io_state.SetCounter( "uploadedBytesPerFrame", static_cast<double>( statistics.uploadedByteCount ) / frameCount );
+	}
+
+	// The counter is how many times any asset's reference count was incremented or decremented since the specified count, averaged over the frames
+	void SetReferenceCountCounter( const uint64_t i_referenceCountOperationCount_beforeFrames, const uint64_t i_frameCount, cState& io_state )
+	{
+		const auto referenceCountOperationCount = Assets::GetReferenceCountOperationCount().load() - i_referenceCountOperationCount_beforeFrames;
+		const auto frameCount = static_cast<double>( ( i_frameCount > 0 ) ? i_frameCount : 1 );
+		io_state.SetCounter( "referenceCountOperationsPerFrame", static_cast<double>( referenceCountOperationCount ) / frameCount );
+	}
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of meshes drawn every frame
+
+namespace
+{
+	// Uploads
+	//--------
+
+	// Every mesh's transform is written to the instance ring buffer with a single update for the whole frame
+	void RenderFrame_instanceRingBuffer( cState& io_state )
+	{
+		sScene scene;
+		scene.Initialize();
+		const auto meshCount = static_cast<size_t>( io_state.GetParameter() );
+		// The first frames grow the ring buffer and the frame arenas
+		for ( unsigned int i = 0; i < 8; ++i )
+		{
+			RenderFrame( scene, meshCount );
+		}
+		Graphics::NullDevice::ResetStatistics();
+		uint64_t frameCount = 0;
+		io_state.SetItemCountPerIteration( meshCount );
+		while ( io_state.KeepRunning() )
+		{
+			RenderFrame( scene, meshCount );
+			++frameCount;
+		}
+		SetDeviceCounters( frameCount, io_state );
+		scene.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Graphics/RenderFrame/instanceRingBuffer", RenderFrame_instanceRingBuffer, 100, 1000, 10000 );
+
+	// This is how the same meshes were drawn before instancing and the ring buffer:
+	// the per-draw constant buffer is updated with a mesh's transform before every draw call.
+	// Only that draw loop is measured (nothing is submitted, culled, or sorted),
+	// and so its counters rather than its time are what should be compared with RenderFrame/instanceRingBuffer
+	void RenderFrame_perDrawConstantBuffer( cState& io_state )
+	{
+		sScene scene;
+		scene.Initialize();
+		const auto meshCount = static_cast<size_t>( io_state.GetParameter() );
+		Graphics::cConstantBuffer constantBuffer_perFrame( Graphics::ConstantBufferTypes::PerFrame );
+		Graphics::cConstantBuffer constantBuffer_perDraw( Graphics::ConstantBufferTypes::PerDrawCall );
+		if ( !constantBuffer_perFrame.Initialize() || !constantBuffer_perDraw.Initialize() )
+		{
+			fprintf( stderr, "The constant buffers couldn't be initialized\n" );
+			std::exit( EXIT_FAILURE );
+		}
+		std::vector<Physics::sRigidBodyState> rigidBodyStates( meshCount );
+		for ( size_t i = 0; i < meshCount; ++i )
+		{
+			rigidBodyStates[i] = CreateRigidBodyState( i );
+		}
+		Graphics::ConstantBufferFormats::sPerFrame constantData_perFrame;
+		Graphics::ConstantBufferFormats::sPerDrawCall constantData_perDraw;
+		Graphics::NullDevice::ResetStatistics();
+		uint64_t frameCount = 0;
+		io_state.SetItemCountPerIteration( meshCount );
+		while ( io_state.KeepRunning() )
+		{
+			constantBuffer_perFrame.Update( &constantData_perFrame );
+			scene.effect->Bind();
+			scene.mesh->Bind();
+			for ( const auto& rigidBodyState : rigidBodyStates )
+			{
+				constantData_perDraw.g_transform_localToWorld = Math::cMatrix_transformation( rigidBodyState.orientation, rigidBodyState.position );
+				constantBuffer_perDraw.Update( &constantData_perDraw );
+				scene.mesh->DrawMesh( 1, 0 );
+			}
+			++frameCount;
+		}
+		SetDeviceCounters( frameCount, io_state );
+		constantBuffer_perFrame.CleanUp();
+		constantBuffer_perDraw.CleanUp();
+		scene.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Graphics/RenderFrame/perDrawConstantBuffer", RenderFrame_perDrawConstantBuffer, 100, 1000, 10000 );
+
+	// Reference Counting
+	//-------------------
+
+	// Each of the frame's resources is pinned once when it is first submitted and released once when the frame has been rendered
+	void RenderFrame_pinnedResources( cState& io_state )
+	{
+		sScene scene;
+		scene.Initialize();
+		const auto meshCount = static_cast<size_t>( io_state.GetParameter() );
+		// The first frames grow the ring buffer and the frame arenas
+		for ( unsigned int i = 0; i < 8; ++i )
+		{
+			RenderFrame( scene, meshCount );
+		}
+		const auto referenceCountOperationCount_beforeFrames = Assets::GetReferenceCountOperationCount().load();
+		uint64_t frameCount = 0;
+		io_state.SetItemCountPerIteration( meshCount );
+		while ( io_state.KeepRunning() )
+		{
+			RenderFrame( scene, meshCount );
+			++frameCount;
+		}
+		SetReferenceCountCounter( referenceCountOperationCount_beforeFrames, frameCount, io_state );
+		scene.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Graphics/RenderFrame/pinnedResources", RenderFrame_pinnedResources, 100, 1000, 10000 );
+
+	// This is how the same meshes were referenced before frames pinned their resources:
+	// submitting a draw incremented the reference counts of its effect, texture, and mesh,
+	// and each was decremented again after the draw had been rendered.
+	// Only the reference counting is measured,
+	// and so its counter rather than its time is what should be compared with RenderFrame/pinnedResources
+	void RenderFrame_perDrawReferenceCounting( cState& io_state )
+	{
+		sScene scene;
+		scene.Initialize();
+		const auto meshCount = static_cast<size_t>( io_state.GetParameter() );
+		const auto referenceCountOperationCount_beforeFrames = Assets::GetReferenceCountOperationCount().load();
+		uint64_t frameCount = 0;
+		io_state.SetItemCountPerIteration( meshCount );
+		while ( io_state.KeepRunning() )
+		{
+			// Submission
+			for ( size_t i = 0; i < meshCount; ++i )
+			{
+				scene.effect->IncrementReferenceCount();
+				scene.texture->IncrementReferenceCount();
+				scene.mesh->IncrementReferenceCount();
+			}
+			// Clean up after rendering
+			for ( size_t i = 0; i < meshCount; ++i )
+			{
+				scene.effect->DecrementReferenceCount();
+				scene.texture->DecrementReferenceCount();
+				scene.mesh->DecrementReferenceCount();
+			}
+			++frameCount;
+		}
+		SetReferenceCountCounter( referenceCountOperationCount_beforeFrames, frameCount, io_state );
+		scene.CleanUp();
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Graphics/RenderFrame/perDrawReferenceCounting", RenderFrame_perDrawReferenceCounting, 100, 1000, 10000 );
+}
@@ -0,0 +1,128 @@
+// Include Files
+//==============
+
+#include "RandomValues.h"
+
+#include <Benchmarks/Benchmark.h>
+#include <cmath>
+#include <Engine/Math/Functions.h>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// Every input is given to the function and its result is stored
+	// (the loop is the same for each fast function and the standard library function that it is compared with)
+	template<typename tFunction>
+		void CalculateBatched( cState& io_state, const std::vector<float>& i_inputs, const tFunction& i_function )
+	{
+		std::vector<float> results( i_inputs.size() );
+		DoNotOptimize( i_inputs.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( i_inputs.size() );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < i_inputs.size(); ++i )
+			{
+				results[i] = i_function( i_inputs[i] );
+			}
+			ClobberMemory();
+		}
+	}
+
+	// The angles are the range that orientations are usually calculated in
+	// (the fast functions cost the same for any angle within their valid range,
+	// but the standard library's functions get more expensive for much bigger angles)
+	std::vector<float> CreateRandomAngles()
+	{
+		return CreateRandomFloats( BatchSize, -6.28318531f, 6.28318531f, 0 );
+	}
+}
+
+// Benchmarks
+//===========
+
+namespace
+{
+	// Reciprocal Square Root
+	//-----------------------
+
+	void ReciprocalSqrt( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomFloats( BatchSize, 1.0e-3f, 1.0e3f, 0 ),
+			[]( const float i_value ) { return 1.0f / std::sqrt( i_value ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/ReciprocalSqrt", ReciprocalSqrt );
+
+	void ReciprocalSqrt_fast( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomFloats( BatchSize, 1.0e-3f, 1.0e3f, 0 ),
+			[]( const float i_value ) { return Math::ReciprocalSqrt_fast( i_value ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/ReciprocalSqrt_fast", ReciprocalSqrt_fast );
+
+	// Sine and Cosine
+	//----------------
+
+	void Sin( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle ) { return std::sin( i_angle ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Sin", Sin );
+
+	void Sin_fast( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle ) { return Math::Sin_fast( i_angle ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Sin_fast", Sin_fast );
+
+	void Cos( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle ) { return std::cos( i_angle ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Cos", Cos );
+
+	void Cos_fast( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle ) { return Math::Cos_fast( i_angle ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Cos_fast", Cos_fast );
+
+	// The results are added together so that both have to be calculated
+	void SinCos( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle ) { return std::sin( i_angle ) + std::cos( i_angle ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/SinCos", SinCos );
+
+	void SinCos_fast( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomAngles(), []( const float i_angle )
+			{
+				float sin, cos;
+				Math::SinCos_fast( i_angle, sin, cos );
+				return sin + cos;
+			} );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/SinCos_fast", SinCos_fast );
+
+	// Arc Cosine
+	//-----------
+
+	void Acos( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomFloats( BatchSize, -1.0f, 1.0f, 0 ), []( const float i_value ) { return std::acos( i_value ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Acos", Acos );
+
+	void Acos_fast( cState& io_state )
+	{
+		CalculateBatched( io_state, CreateRandomFloats( BatchSize, -1.0f, 1.0f, 0 ),
+			[]( const float i_value ) { return Math::Acos_fast( i_value ); } );
+	}
+	EAE6320_BENCHMARK( "Math/Functions/Acos_fast", Acos_fast );
+}
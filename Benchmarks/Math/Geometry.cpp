@@ -0,0 +1,188 @@
+// Include Files
+//==============
+
+#include "RandomValues.h"
+
+#include <Benchmarks/Benchmark.h>
+#include <cmath>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Geometry.h>
+#include <memory>
+#include <vector>
+
+// Benchmarks
+//===========
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// The shapes are spread out in a cube around a camera at the origin,
+	// and so some are inside of the frustum and most are outside of it
+	// (the way that they would be when culling a scene)
+	Math::sFrustum CreateFrustum()
+	{
+		return Math::sFrustum::CreateFromTransform(
+			Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective( 1.0f, 1.5f, 0.1f, 1000.0f ) );
+	}
+
+	struct sVectorSpans
+	{
+		std::vector<float> x, y, z;
+
+		explicit sVectorSpans( const std::vector<Math::sVector>& i_vectors )
+		{
+			for ( const auto& vector : i_vectors )
+			{
+				x.push_back( vector.x );
+				y.push_back( vector.y );
+				z.push_back( vector.z );
+			}
+		}
+		Math::BatchTransforms::sConstVectorSpans GetSpans() const { return { x.data(), y.data(), z.data() }; }
+	};
+
+	// Frustum Culling
+	//----------------
+
+	void TestOverlaps_spheres( cState& io_state )
+	{
+		const auto frustum = CreateFrustum();
+		const sVectorSpans centers( CreateRandomVectors( BatchSize, 0 ) );
+		const auto radii = CreateRandomFloats( BatchSize, 0.5f, 5.0f, 1 );
+		std::unique_ptr<bool[]> areOverlapping( new bool[BatchSize] );
+		DoNotOptimize( areOverlapping.get() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::TestOverlaps( frustum, centers.GetSpans(), radii.data(), BatchSize, areOverlapping.get() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/TestOverlaps_spheres", TestOverlaps_spheres );
+
+	void IsOverlapping_spheres( cState& io_state )
+	{
+		const auto frustum = CreateFrustum();
+		const auto centers = CreateRandomVectors( BatchSize, 0 );
+		const auto radii = CreateRandomFloats( BatchSize, 0.5f, 5.0f, 1 );
+		std::unique_ptr<bool[]> areOverlapping( new bool[BatchSize] );
+		DoNotOptimize( areOverlapping.get() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				Math::sSphere sphere;
+				sphere.center = centers[i];
+				sphere.radius = radii[i];
+				areOverlapping[i] = Math::IsOverlapping( frustum, sphere );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/IsOverlapping_spheres", IsOverlapping_spheres );
+
+	void TestOverlaps_boxes( cState& io_state )
+	{
+		const auto frustum = CreateFrustum();
+		const auto minimums_vectors = CreateRandomVectors( BatchSize, 0 );
+		const auto sizes = CreateRandomVectors( BatchSize, 1 );
+		std::vector<Math::sVector> maximums_vectors( BatchSize );
+		for ( size_t i = 0; i < BatchSize; ++i )
+		{
+			maximums_vectors[i] = minimums_vectors[i] + Math::sVector( std::abs( sizes[i].x ), std::abs( sizes[i].y ), std::abs( sizes[i].z ) ) * 0.05f;
+		}
+		const sVectorSpans minimums( minimums_vectors ), maximums( maximums_vectors );
+		std::unique_ptr<bool[]> areOverlapping( new bool[BatchSize] );
+		DoNotOptimize( areOverlapping.get() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::TestOverlaps( frustum, minimums.GetSpans(), maximums.GetSpans(), BatchSize, areOverlapping.get() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/TestOverlaps_boxes", TestOverlaps_boxes );
+
+	void IsOverlapping_boxes( cState& io_state )
+	{
+		const auto frustum = CreateFrustum();
+		const auto minimums = CreateRandomVectors( BatchSize, 0 );
+		const auto sizes = CreateRandomVectors( BatchSize, 1 );
+		std::vector<Math::sAxisAlignedBox> boxes( BatchSize );
+		for ( size_t i = 0; i < BatchSize; ++i )
+		{
+			boxes[i].minimum = minimums[i];
+			boxes[i].maximum = minimums[i] + Math::sVector( std::abs( sizes[i].x ), std::abs( sizes[i].y ), std::abs( sizes[i].z ) ) * 0.05f;
+		}
+		std::unique_ptr<bool[]> areOverlapping( new bool[BatchSize] );
+		DoNotOptimize( areOverlapping.get() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				areOverlapping[i] = Math::IsOverlapping( frustum, boxes[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/IsOverlapping_boxes", IsOverlapping_boxes );
+
+	// Raycasting
+	//-----------
+
+	// A packet of rays starts near a corner of the box and points roughly at it
+	// (the way that the rays through neighboring pixels would),
+	// and so most of the rays hit it
+	const Math::sAxisAlignedBox s_box{ Math::sVector( -10.0f, -10.0f, -10.0f ), Math::sVector( 10.0f, 10.0f, 10.0f ) };
+	constexpr float s_maximumRayDistance = 1000.0f;
+
+	std::vector<Math::sVector> CreateRayDirections()
+	{
+		auto directions = CreateRandomVectors( BatchSize, 1 );
+		for ( auto& direction : directions )
+		{
+			direction = ( Math::sVector( -100.0f, -100.0f, -100.0f ) + ( direction * 0.3f ) ).GetNormalized();
+		}
+		return directions;
+	}
+
+	void Raycast_packet( cState& io_state )
+	{
+		const sVectorSpans origins( std::vector<Math::sVector>( BatchSize, Math::sVector( 50.0f, 50.0f, 50.0f ) ) );
+		const sVectorSpans directions( CreateRayDirections() );
+		std::vector<float> hitDistances( BatchSize );
+		DoNotOptimize( hitDistances.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::Raycast( origins.GetSpans(), directions.GetSpans(), BatchSize, s_box, s_maximumRayDistance, hitDistances.data() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/Raycast_packet", Raycast_packet );
+
+	void Raycast_single( cState& io_state )
+	{
+		const auto directions = CreateRayDirections();
+		std::vector<float> hitDistances( BatchSize );
+		DoNotOptimize( hitDistances.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				Math::sRay ray;
+				ray.origin = Math::sVector( 50.0f, 50.0f, 50.0f );
+				ray.direction = directions[i];
+				float hitDistance;
+				hitDistances[i] = Math::Raycast( ray, s_box, s_maximumRayDistance, hitDistance ) ? hitDistance : -1.0f;
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/Geometry/Raycast_single", Raycast_single );
+}
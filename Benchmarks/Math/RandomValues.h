@@ -0,0 +1,69 @@
+/*
+	These create the inputs for the math benchmarks
+
+	The values are random (so that the compiler can't calculate any results ahead of time)
+	but the same every time the benchmarks run.
+*/
+
+#ifndef EAE6320_BENCHMARKS_MATH_RANDOMVALUES_H
+#define EAE6320_BENCHMARKS_MATH_RANDOMVALUES_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <random>
+#include <vector>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Benchmarks
+	{
+		// The number of objects that every batched benchmark processes in each iteration
+		// (small enough that the inputs and outputs stay in the L1 or L2 cache)
+		constexpr size_t BatchSize = 1024;
+
+		inline std::vector<float> CreateRandomFloats( const size_t i_count, const float i_min, const float i_max, const unsigned int i_seed )
+		{
+			std::mt19937 randomNumberGenerator( i_seed );
+			std::uniform_real_distribution<float> distribution( i_min, i_max );
+			std::vector<float> values( i_count );
+			for ( auto& value : values )
+			{
+				value = distribution( randomNumberGenerator );
+			}
+			return values;
+		}
+
+		inline std::vector<Math::sVector> CreateRandomVectors( const size_t i_count, const unsigned int i_seed )
+		{
+			const auto values = CreateRandomFloats( i_count * 3, -100.0f, 100.0f, i_seed );
+			std::vector<Math::sVector> vectors( i_count );
+			for ( size_t i = 0; i < i_count; ++i )
+			{
+				vectors[i] = Math::sVector( values[( i * 3 ) + 0], values[( i * 3 ) + 1], values[( i * 3 ) + 2] );
+			}
+			return vectors;
+		}
+
+		// The quaternions are normalized
+		inline std::vector<Math::cQuaternion> CreateRandomRotations( const size_t i_count, const unsigned int i_seed )
+		{
+			const auto angles = CreateRandomFloats( i_count, -3.14159265f, 3.14159265f, i_seed );
+			auto axes = CreateRandomVectors( i_count, i_seed + 1 );
+			std::vector<Math::cQuaternion> rotations( i_count );
+			for ( size_t i = 0; i < i_count; ++i )
+			{
+				rotations[i] = Math::cQuaternion( angles[i], axes[i].GetNormalized() );
+			}
+			return rotations;
+		}
+	}
+}
+
+#endif	// EAE6320_BENCHMARKS_MATH_RANDOMVALUES_H
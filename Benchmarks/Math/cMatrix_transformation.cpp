@@ -0,0 +1,280 @@
+// Include Files
+//==============
+
+#include "RandomValues.h"
+
+#include <Benchmarks/Benchmark.h>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// The rotations and translations of many objects,
+	// both as arrays of objects and as a structure of arrays (for BatchTransforms)
+	struct sTransformInputs
+	{
+		std::vector<Math::cQuaternion> rotations;
+		std::vector<Math::sVector> translations;
+		std::vector<float> rotations_w, rotations_x, rotations_y, rotations_z;
+		std::vector<float> translations_x, translations_y, translations_z;
+
+		Math::BatchTransforms::sConstQuaternionSpans GetRotationSpans() const
+		{
+			return Math::BatchTransforms::sConstQuaternionSpans( rotations_w.data(), rotations_x.data(), rotations_y.data(), rotations_z.data() );
+		}
+		Math::BatchTransforms::sConstVectorSpans GetTranslationSpans() const
+		{
+			return Math::BatchTransforms::sConstVectorSpans( translations_x.data(), translations_y.data(), translations_z.data() );
+		}
+
+		sTransformInputs()
+			:
+			rotations( CreateRandomRotations( BatchSize, 0 ) ), translations( CreateRandomVectors( BatchSize, 2 ) ),
+			rotations_w( BatchSize ), rotations_x( BatchSize ), rotations_y( BatchSize ), rotations_z( BatchSize ),
+			translations_x( BatchSize ), translations_y( BatchSize ), translations_z( BatchSize )
+		{
+			Math::BatchTransforms::CopyToSpans( rotations.data(), BatchSize,
+				Math::BatchTransforms::sQuaternionSpans{ rotations_w.data(), rotations_x.data(), rotations_y.data(), rotations_z.data() } );
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				translations_x[i] = translations[i].x;
+				translations_y[i] = translations[i].y;
+				translations_z[i] = translations[i].z;
+			}
+			DoNotOptimize( rotations.data() );
+			DoNotOptimize( translations.data() );
+		}
+	};
+}
+
+// Benchmarks
+//===========
+
+namespace
+{
+	// Quaternion to Matrix
+	//---------------------
+
+	void CreateFromQuaternion( cState& io_state )
+	{
+		auto rotation = CreateRandomRotations( 1, 0 )[0];
+		auto translation = CreateRandomVectors( 1, 1 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( rotation );
+			DoNotOptimize( translation );
+			Math::cMatrix_transformation result( rotation, translation );
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateFromQuaternion", CreateFromQuaternion );
+
+	void CreateFromQuaternion_batched( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<Math::cMatrix_transformation> results( BatchSize );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cMatrix_transformation( inputs.rotations[i], inputs.translations[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateFromQuaternion_batched", CreateFromQuaternion_batched );
+
+	void CreateFromQuaternion_batchTransforms( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<Math::cMatrix_transformation> results( BatchSize );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::CreateTransforms( inputs.GetRotationSpans(), inputs.GetTranslationSpans(), BatchSize, results.data() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateFromQuaternion_batchTransforms", CreateFromQuaternion_batchTransforms );
+
+	void CreateFromQuaternion_batchTransforms_3x4( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<float> results( BatchSize * 12 );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::CreateTransforms_3x4( inputs.GetRotationSpans(), inputs.GetTranslationSpans(), BatchSize, results.data() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateFromQuaternion_batchTransforms_3x4", CreateFromQuaternion_batchTransforms_3x4 );
+
+	// Camera
+	//-------
+
+	void CreateWorldToCameraTransform( cState& io_state )
+	{
+		auto orientation = CreateRandomRotations( 1, 0 )[0];
+		auto position = CreateRandomVectors( 1, 1 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( orientation );
+			DoNotOptimize( position );
+			auto result = Math::cMatrix_transformation::CreateWorldToCameraTransform( orientation, position );
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateWorldToCameraTransform", CreateWorldToCameraTransform );
+
+	void CreateWorldToCameraTransform_batched( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<Math::cMatrix_transformation> results( BatchSize );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cMatrix_transformation::CreateWorldToCameraTransform( inputs.rotations[i], inputs.translations[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateWorldToCameraTransform_batched", CreateWorldToCameraTransform_batched );
+
+	void CreateCameraToProjectedTransform_perspective( cState& io_state )
+	{
+		auto verticalFieldOfView = 1.0f, aspectRatio = 16.0f / 9.0f, z_nearPlane = 0.1f, z_farPlane = 100.0f;
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( verticalFieldOfView );
+			DoNotOptimize( aspectRatio );
+			DoNotOptimize( z_nearPlane );
+			DoNotOptimize( z_farPlane );
+			auto result = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
+				verticalFieldOfView, aspectRatio, z_nearPlane, z_farPlane );
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateCameraToProjectedTransform_perspective",
+		CreateCameraToProjectedTransform_perspective );
+
+	void CreateCameraToProjectedTransform_perspective_batched( cState& io_state )
+	{
+		// Every projection has a different field of view (e.g. a zoom that is being animated)
+		const auto verticalFieldsOfView = CreateRandomFloats( BatchSize, 0.2f, 2.0f, 0 );
+		std::vector<Math::cMatrix_transformation> results( BatchSize );
+		DoNotOptimize( verticalFieldsOfView.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
+					verticalFieldsOfView[i], 16.0f / 9.0f, 0.1f, 100.0f );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/CreateCameraToProjectedTransform_perspective_batched",
+		CreateCameraToProjectedTransform_perspective_batched );
+
+	// Multiplication
+	//---------------
+
+	void ConcatenateAffine( cState& io_state )
+	{
+		const auto rotations = CreateRandomRotations( 2, 0 );
+		const auto translations = CreateRandomVectors( 2, 1 );
+		Math::cMatrix_transformation lhs( rotations[0], translations[0] ), rhs( rotations[1], translations[1] );
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( lhs );
+			DoNotOptimize( rhs );
+			auto result = Math::cMatrix_transformation::ConcatenateAffine( lhs, rhs );
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/ConcatenateAffine", ConcatenateAffine );
+
+	void ConcatenateAffine_batched( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<Math::cMatrix_transformation> transforms( BatchSize ), results( BatchSize );
+		Math::BatchTransforms::CreateTransforms( inputs.GetRotationSpans(), inputs.GetTranslationSpans(), BatchSize, transforms.data() );
+		const auto worldToCamera = Math::cMatrix_transformation::CreateWorldToCameraTransform( inputs.rotations[0], inputs.translations[0] );
+		DoNotOptimize( transforms.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cMatrix_transformation::ConcatenateAffine( worldToCamera, transforms[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/ConcatenateAffine_batched", ConcatenateAffine_batched );
+
+	void ConcatenateAffine_batchTransforms( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		std::vector<Math::cMatrix_transformation> transforms( BatchSize ), results( BatchSize );
+		Math::BatchTransforms::CreateTransforms( inputs.GetRotationSpans(), inputs.GetTranslationSpans(), BatchSize, transforms.data() );
+		const auto worldToCamera = Math::cMatrix_transformation::CreateWorldToCameraTransform( inputs.rotations[0], inputs.translations[0] );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::ConcatenateAffine( worldToCamera, transforms.data(), BatchSize, results.data() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/ConcatenateAffine_batchTransforms", ConcatenateAffine_batchTransforms );
+
+	void TransformPoints_batched( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		const Math::cMatrix_transformation transform( inputs.rotations[0], inputs.translations[0] );
+		std::vector<Math::sVector> results( BatchSize );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = transform * inputs.translations[i];
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/TransformPoints_batched", TransformPoints_batched );
+
+	void TransformPoints_batchTransforms( cState& io_state )
+	{
+		const sTransformInputs inputs;
+		const Math::cMatrix_transformation transform( inputs.rotations[0], inputs.translations[0] );
+		std::vector<float> results_x( BatchSize ), results_y( BatchSize ), results_z( BatchSize );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::TransformPoints( transform, inputs.GetTranslationSpans(), BatchSize,
+				Math::BatchTransforms::sVectorSpans{ results_x.data(), results_y.data(), results_z.data() } );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cMatrix_transformation/TransformPoints_batchTransforms", TransformPoints_batchTransforms );
+}
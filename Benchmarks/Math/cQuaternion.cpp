@@ -0,0 +1,243 @@
+// Include Files
+//==============
+
+#include "RandomValues.h"
+
+#include <Benchmarks/Benchmark.h>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/cQuaternion.h>
+
+// Benchmarks
+//===========
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// Multiplication
+	//---------------
+
+	void Multiply( cState& io_state )
+	{
+		const auto rotations = CreateRandomRotations( 2, 0 );
+		auto lhs = rotations[0], rhs = rotations[1];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( lhs );
+			DoNotOptimize( rhs );
+			auto result = lhs * rhs;
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Multiply", Multiply );
+
+	void Multiply_batched( cState& io_state )
+	{
+		const auto lhs = CreateRandomRotations( BatchSize, 0 );
+		const auto rhs = CreateRandomRotations( BatchSize, 2 );
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( lhs.data() );
+		DoNotOptimize( rhs.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = lhs[i] * rhs[i];
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Multiply_batched", Multiply_batched );
+
+	// Inversion
+	//----------
+
+	void GetInverse( cState& io_state )
+	{
+		auto rotation = CreateRandomRotations( 1, 0 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( rotation );
+			auto result = rotation.GetInverse();
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/GetInverse", GetInverse );
+
+	void GetInverse_batched( cState& io_state )
+	{
+		const auto rotations = CreateRandomRotations( BatchSize, 0 );
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( rotations.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = rotations[i].GetInverse();
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/GetInverse_batched", GetInverse_batched );
+
+	// Normalization
+	//--------------
+
+	void Normalize( cState& io_state )
+	{
+		auto rotation = CreateRandomRotations( 1, 0 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( rotation );
+			auto result = rotation.GetNormalized();
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Normalize", Normalize );
+
+	void Normalize_fast( cState& io_state )
+	{
+		auto rotation = CreateRandomRotations( 1, 0 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( rotation );
+			auto result = rotation.GetNormalized_fast();
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Normalize_fast", Normalize_fast );
+
+	void Normalize_batched( cState& io_state )
+	{
+		const auto rotations = CreateRandomRotations( BatchSize, 0 );
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( rotations.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = rotations[i].GetNormalized();
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Normalize_batched", Normalize_batched );
+
+	void Normalize_fast_batched( cState& io_state )
+	{
+		const auto rotations = CreateRandomRotations( BatchSize, 0 );
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( rotations.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = rotations[i].GetNormalized_fast();
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Normalize_fast_batched", Normalize_fast_batched );
+
+	// Interpolation
+	//--------------
+
+	// The batched versions compare calling the single-object function for every object
+	// with the BatchTransforms version (which calculates four objects at once)
+
+	struct sInterpolationInputs
+	{
+		std::vector<float> from_w, from_x, from_y, from_z;
+		std::vector<float> to_w, to_x, to_y, to_z;
+		std::vector<float> ts;
+		std::vector<Math::cQuaternion> from, to;
+
+		sInterpolationInputs()
+			:
+			from_w( BatchSize ), from_x( BatchSize ), from_y( BatchSize ), from_z( BatchSize ),
+			to_w( BatchSize ), to_x( BatchSize ), to_y( BatchSize ), to_z( BatchSize ),
+			ts( CreateRandomFloats( BatchSize, 0.0f, 1.0f, 4 ) ),
+			from( CreateRandomRotations( BatchSize, 0 ) ), to( CreateRandomRotations( BatchSize, 2 ) )
+		{
+			Math::BatchTransforms::CopyToSpans( from.data(), BatchSize,
+				Math::BatchTransforms::sQuaternionSpans{ from_w.data(), from_x.data(), from_y.data(), from_z.data() } );
+			Math::BatchTransforms::CopyToSpans( to.data(), BatchSize,
+				Math::BatchTransforms::sQuaternionSpans{ to_w.data(), to_x.data(), to_y.data(), to_z.data() } );
+		}
+	};
+
+	void Slerp_batched( cState& io_state )
+	{
+		const sInterpolationInputs inputs;
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cQuaternion::Slerp( inputs.from[i], inputs.to[i], inputs.ts[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Slerp_batched", Slerp_batched );
+
+	void Slerp_batchTransforms( cState& io_state )
+	{
+		const sInterpolationInputs inputs;
+		std::vector<float> results_w( BatchSize ), results_x( BatchSize ), results_y( BatchSize ), results_z( BatchSize );
+		const Math::BatchTransforms::sQuaternionSpans results{ results_w.data(), results_x.data(), results_y.data(), results_z.data() };
+		const Math::BatchTransforms::sConstQuaternionSpans from( inputs.from_w.data(), inputs.from_x.data(), inputs.from_y.data(), inputs.from_z.data() );
+		const Math::BatchTransforms::sConstQuaternionSpans to( inputs.to_w.data(), inputs.to_x.data(), inputs.to_y.data(), inputs.to_z.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::Slerp( from, to, inputs.ts.data(), BatchSize, results );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Slerp_batchTransforms", Slerp_batchTransforms );
+
+	void Nlerp_batched( cState& io_state )
+	{
+		const sInterpolationInputs inputs;
+		std::vector<Math::cQuaternion> results( BatchSize );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::cQuaternion::Nlerp( inputs.from[i], inputs.to[i], inputs.ts[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Nlerp_batched", Nlerp_batched );
+
+	void Nlerp_batchTransforms( cState& io_state )
+	{
+		const sInterpolationInputs inputs;
+		std::vector<float> results_w( BatchSize ), results_x( BatchSize ), results_y( BatchSize ), results_z( BatchSize );
+		const Math::BatchTransforms::sQuaternionSpans results{ results_w.data(), results_x.data(), results_y.data(), results_z.data() };
+		const Math::BatchTransforms::sConstQuaternionSpans from( inputs.from_w.data(), inputs.from_x.data(), inputs.from_y.data(), inputs.from_z.data() );
+		const Math::BatchTransforms::sConstQuaternionSpans to( inputs.to_w.data(), inputs.to_x.data(), inputs.to_y.data(), inputs.to_z.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			Math::BatchTransforms::Nlerp( from, to, inputs.ts.data(), BatchSize, results );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/cQuaternion/Nlerp_batchTransforms", Nlerp_batchTransforms );
+}
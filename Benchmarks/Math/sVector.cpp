@@ -0,0 +1,116 @@
+// Include Files
+//==============
+
+#include "RandomValues.h"
+
+#include <Benchmarks/Benchmark.h>
+#include <Engine/Math/sVector.h>
+
+// Benchmarks
+//===========
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// Normalization
+	//--------------
+
+	void Normalize( cState& io_state )
+	{
+		auto vector = CreateRandomVectors( 1, 0 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( vector );
+			auto result = vector.GetNormalized();
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Normalize", Normalize );
+
+	void Normalize_fast( cState& io_state )
+	{
+		auto vector = CreateRandomVectors( 1, 0 )[0];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( vector );
+			auto result = vector.GetNormalized_fast();
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Normalize_fast", Normalize_fast );
+
+	void Normalize_batched( cState& io_state )
+	{
+		const auto vectors = CreateRandomVectors( BatchSize, 0 );
+		std::vector<Math::sVector> results( BatchSize );
+		DoNotOptimize( vectors.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = vectors[i].GetNormalized();
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Normalize_batched", Normalize_batched );
+
+	void Normalize_fast_batched( cState& io_state )
+	{
+		const auto vectors = CreateRandomVectors( BatchSize, 0 );
+		std::vector<Math::sVector> results( BatchSize );
+		DoNotOptimize( vectors.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = vectors[i].GetNormalized_fast();
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Normalize_fast_batched", Normalize_fast_batched );
+
+	// Products
+	//---------
+
+	void Cross( cState& io_state )
+	{
+		const auto vectors = CreateRandomVectors( 2, 0 );
+		auto lhs = vectors[0], rhs = vectors[1];
+		while ( io_state.KeepRunning() )
+		{
+			DoNotOptimize( lhs );
+			DoNotOptimize( rhs );
+			auto result = Math::Cross( lhs, rhs );
+			DoNotOptimize( result );
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Cross", Cross );
+
+	void Cross_batched( cState& io_state )
+	{
+		const auto lhs = CreateRandomVectors( BatchSize, 0 );
+		const auto rhs = CreateRandomVectors( BatchSize, 1 );
+		std::vector<Math::sVector> results( BatchSize );
+		DoNotOptimize( lhs.data() );
+		DoNotOptimize( rhs.data() );
+		DoNotOptimize( results.data() );
+		io_state.SetItemCountPerIteration( BatchSize );
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < BatchSize; ++i )
+			{
+				results[i] = Math::Cross( lhs[i], rhs[i] );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK( "Math/sVector/Cross_batched", Cross_batched );
+}
@@ -0,0 +1,218 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cmath>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Physics/cBoundingVolumeHierarchy.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// Every iteration of a query benchmark runs this many queries
+	constexpr size_t s_queryCountPerIteration = 1024;
+
+	struct sScene
+	{
+		std::vector<float> minimum_x, minimum_y, minimum_z;
+		std::vector<float> maximum_x, maximum_y, maximum_z;
+		// The objects are spread out so that their density is the same for any count
+		float extent = 0.0f;
+		std::mt19937 randomNumberGenerator;
+
+		Math::BatchTransforms::sConstVectorSpans GetMinimums() const { return { minimum_x.data(), minimum_y.data(), minimum_z.data() }; }
+		Math::BatchTransforms::sConstVectorSpans GetMaximums() const { return { maximum_x.data(), maximum_y.data(), maximum_z.data() }; }
+		Math::sVector GetRandomPosition()
+		{
+			std::uniform_real_distribution<float> distribution( -extent, extent );
+			return Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ), distribution( randomNumberGenerator ) );
+		}
+
+		sScene( const size_t i_count )
+			:
+			extent( std::cbrt( static_cast<float>( i_count ) ) * 4.0f )
+		{
+			std::uniform_real_distribution<float> distribution_size( 0.2f, 2.0f );
+			for ( size_t i = 0; i < i_count; ++i )
+			{
+				const auto position = GetRandomPosition();
+				minimum_x.push_back( position.x );
+				minimum_y.push_back( position.y );
+				minimum_z.push_back( position.z );
+				maximum_x.push_back( position.x + distribution_size( randomNumberGenerator ) );
+				maximum_y.push_back( position.y + distribution_size( randomNumberGenerator ) );
+				maximum_z.push_back( position.z + distribution_size( randomNumberGenerator ) );
+			}
+		}
+	};
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of objects
+
+namespace
+{
+	// Building
+	//---------
+
+	void Build( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		const sScene scene( count );
+		Physics::cBoundingVolumeHierarchy tree;
+		io_state.SetItemCountPerIteration( count );
+		while ( io_state.KeepRunning() )
+		{
+			tree.Build( scene.GetMinimums(), scene.GetMaximums(), count );
+			ClobberMemory();
+		}
+		io_state.SetCounter( "nodes", static_cast<double>( tree.GetNodeCount() ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cBoundingVolumeHierarchy/Build", Build, 10000, 100000 );
+
+	// Every object has moved since the tree was built
+	void Refit( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		sScene scene( count );
+		Physics::cBoundingVolumeHierarchy tree;
+		tree.Build( scene.GetMinimums(), scene.GetMaximums(), count );
+		{
+			std::uniform_real_distribution<float> distribution( -1.0f, 1.0f );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				const auto offset_x = distribution( scene.randomNumberGenerator );
+				const auto offset_y = distribution( scene.randomNumberGenerator );
+				const auto offset_z = distribution( scene.randomNumberGenerator );
+				scene.minimum_x[i] += offset_x; scene.minimum_y[i] += offset_y; scene.minimum_z[i] += offset_z;
+				scene.maximum_x[i] += offset_x; scene.maximum_y[i] += offset_y; scene.maximum_z[i] += offset_z;
+			}
+		}
+		io_state.SetItemCountPerIteration( count );
+		while ( io_state.KeepRunning() )
+		{
+			tree.Refit( scene.GetMinimums(), scene.GetMaximums() );
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cBoundingVolumeHierarchy/Refit", Refit, 10000, 100000 );
+
+	// Queries
+	//--------
+
+	// The items are the queries
+	// (and so the items per second is the number of queries per second)
+
+	void Raycast( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		sScene scene( count );
+		Physics::cBoundingVolumeHierarchy tree;
+		tree.Build( scene.GetMinimums(), scene.GetMaximums(), count );
+		std::vector<Math::sRay> rays( s_queryCountPerIteration );
+		{
+			std::uniform_real_distribution<float> distribution( -1.0f, 1.0f );
+			for ( auto& ray : rays )
+			{
+				ray.origin = scene.GetRandomPosition();
+				ray.direction = Math::sVector( distribution( scene.randomNumberGenerator ), distribution( scene.randomNumberGenerator ),
+					distribution( scene.randomNumberGenerator ) ).GetNormalized();
+			}
+		}
+		const auto maximumDistance = scene.extent;
+		size_t hitCount = 0;
+		io_state.SetItemCountPerIteration( s_queryCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			hitCount = 0;
+			for ( const auto& ray : rays )
+			{
+				uint32_t objectId;
+				float hitDistance;
+				hitCount += tree.Raycast( ray, maximumDistance, objectId, hitDistance ) ? 1 : 0;
+			}
+			DoNotOptimize( hitCount );
+		}
+		io_state.SetCounter( "hitRatio", static_cast<double>( hitCount ) / static_cast<double>( s_queryCountPerIteration ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cBoundingVolumeHierarchy/Raycast", Raycast, 10000, 100000 );
+
+	void FindOverlaps_sphere( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		sScene scene( count );
+		Physics::cBoundingVolumeHierarchy tree;
+		tree.Build( scene.GetMinimums(), scene.GetMaximums(), count );
+		std::vector<Math::sSphere> spheres( s_queryCountPerIteration );
+		{
+			std::uniform_real_distribution<float> distribution( 1.0f, 10.0f );
+			for ( auto& sphere : spheres )
+			{
+				sphere.center = scene.GetRandomPosition();
+				sphere.radius = distribution( scene.randomNumberGenerator );
+			}
+		}
+		std::vector<uint32_t> objectIds;
+		size_t objectCount = 0;
+		io_state.SetItemCountPerIteration( s_queryCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			objectCount = 0;
+			for ( const auto& sphere : spheres )
+			{
+				tree.FindOverlaps( sphere, objectIds );
+				objectCount += objectIds.size();
+			}
+			DoNotOptimize( objectCount );
+		}
+		io_state.SetCounter( "objectsPerQuery", static_cast<double>( objectCount ) / static_cast<double>( s_queryCountPerIteration ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cBoundingVolumeHierarchy/FindOverlaps_sphere", FindOverlaps_sphere, 10000, 100000 );
+
+	// Each frustum is a camera's view at a random place in the scene
+	void FindOverlaps_frustum( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		sScene scene( count );
+		Physics::cBoundingVolumeHierarchy tree;
+		tree.Build( scene.GetMinimums(), scene.GetMaximums(), count );
+		std::vector<Math::sFrustum> frustums( s_queryCountPerIteration );
+		{
+			const auto transform_cameraToProjected = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
+				1.0f, 16.0f / 9.0f, 0.1f, 50.0f );
+			std::uniform_real_distribution<float> distribution( -3.14159f, 3.14159f );
+			for ( auto& frustum : frustums )
+			{
+				const Math::cMatrix_transformation transform_cameraToWorld(
+					Math::cQuaternion( distribution( scene.randomNumberGenerator ), Math::sVector( 0.0f, 1.0f, 0.0f ) ), scene.GetRandomPosition() );
+				frustum = Math::sFrustum::CreateFromTransform(
+					transform_cameraToProjected * Math::cMatrix_transformation::CreateWorldToCameraTransform( transform_cameraToWorld ) );
+			}
+		}
+		std::vector<uint32_t> objectIds;
+		size_t objectCount = 0;
+		io_state.SetItemCountPerIteration( s_queryCountPerIteration );
+		while ( io_state.KeepRunning() )
+		{
+			objectCount = 0;
+			for ( const auto& frustum : frustums )
+			{
+				tree.FindOverlaps( frustum, objectIds );
+				objectCount += objectIds.size();
+			}
+			DoNotOptimize( objectCount );
+		}
+		io_state.SetCounter( "objectsPerQuery", static_cast<double>( objectCount ) / static_cast<double>( s_queryCountPerIteration ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cBoundingVolumeHierarchy/FindOverlaps_frustum", FindOverlaps_frustum, 10000, 100000 );
+}
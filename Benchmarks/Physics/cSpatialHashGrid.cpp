@@ -0,0 +1,96 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cmath>
+#include <Engine/Physics/cSpatialHashGrid.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	constexpr auto s_cellSize = 2.0f;
+
+	struct sBounds
+	{
+		std::vector<float> minimum_x, minimum_y, minimum_z;
+		std::vector<float> maximum_x, maximum_y, maximum_z;
+
+		Math::BatchTransforms::sConstVectorSpans GetMinimums() const { return { minimum_x.data(), minimum_y.data(), minimum_z.data() }; }
+		Math::BatchTransforms::sConstVectorSpans GetMaximums() const { return { maximum_x.data(), maximum_y.data(), maximum_z.data() }; }
+	};
+
+	// The objects are spread out so that the average number of objects per cell is the same for any count
+	// (and each object overlaps less than one other on average).
+	// If there is an oversized interval then every object whose index is a multiple of it
+	// touches many more cells than the maximum.
+	sBounds CreateBounds( const size_t i_count, const size_t i_oversizedInterval = 0 )
+	{
+		std::mt19937 randomNumberGenerator( 0 );
+		const auto extent = std::cbrt( static_cast<float>( i_count ) ) * s_cellSize * 0.5f;
+		std::uniform_real_distribution<float> distribution_position( -extent, extent );
+		std::uniform_real_distribution<float> distribution_size( 0.2f, 1.5f );
+		std::uniform_real_distribution<float> distribution_size_oversized( 20.0f, 40.0f );
+		sBounds bounds;
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			const auto isOversized = ( i_oversizedInterval > 0 ) && ( ( i % i_oversizedInterval ) == 0 );
+			auto& distribution_size_object = isOversized ? distribution_size_oversized : distribution_size;
+			bounds.minimum_x.push_back( distribution_position( randomNumberGenerator ) );
+			bounds.minimum_y.push_back( distribution_position( randomNumberGenerator ) );
+			bounds.minimum_z.push_back( distribution_position( randomNumberGenerator ) );
+			bounds.maximum_x.push_back( bounds.minimum_x.back() + distribution_size_object( randomNumberGenerator ) );
+			bounds.maximum_y.push_back( bounds.minimum_y.back() + distribution_size_object( randomNumberGenerator ) );
+			bounds.maximum_z.push_back( bounds.minimum_z.back() + distribution_size_object( randomNumberGenerator ) );
+		}
+		return bounds;
+	}
+
+	// The items are the overlapping pairs that are found
+	// (and so the items per second is the pair throughput)
+	void FindOverlappingPairs( cState& io_state, const sBounds& i_bounds )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		Physics::cSpatialHashGrid grid( s_cellSize );
+		std::vector<Physics::sOverlappingPair> pairs;
+		// The first search allocates the memory that the others reuse
+		grid.FindOverlappingPairs( i_bounds.GetMinimums(), i_bounds.GetMaximums(), count, pairs );
+		io_state.SetItemCountPerIteration( pairs.size() );
+		io_state.SetCounter( "pairs", static_cast<double>( pairs.size() ) );
+		while ( io_state.KeepRunning() )
+		{
+			grid.FindOverlappingPairs( i_bounds.GetMinimums(), i_bounds.GetMaximums(), count, pairs );
+			ClobberMemory();
+		}
+	}
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of objects
+
+namespace
+{
+	void FindOverlappingPairs( cState& io_state )
+	{
+		FindOverlappingPairs( io_state, CreateBounds( static_cast<size_t>( io_state.GetParameter() ) ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cSpatialHashGrid/FindOverlappingPairs", FindOverlappingPairs, 10000, 30000, 100000 );
+
+	// A few objects (e.g. the ground or big triggers) are oversized
+	void FindOverlappingPairs_oversizedObjects( cState& io_state )
+	{
+		constexpr size_t oversizedCount = 16;
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		FindOverlappingPairs( io_state, CreateBounds( count, count / oversizedCount ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cSpatialHashGrid/FindOverlappingPairs_oversizedObjects", FindOverlappingPairs_oversizedObjects,
+		10000, 30000, 100000 );
+}
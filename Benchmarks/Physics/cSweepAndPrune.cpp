@@ -0,0 +1,146 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cmath>
+#include <Engine/Physics/cSweepAndPrune.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	// This is the same as the cell size of the cSpatialHashGrid benchmarks
+	// so that the objects are spread out the same way
+	constexpr auto s_cellSize = 2.0f;
+
+	// The objects are spread out so that the average number of objects in any volume is the same for any count
+	// (and each object overlaps less than one other on average)
+	std::vector<Math::sAxisAlignedBox> CreateBounds( const size_t i_count )
+	{
+		std::mt19937 randomNumberGenerator( 0 );
+		const auto extent = std::cbrt( static_cast<float>( i_count ) ) * s_cellSize * 0.5f;
+		std::uniform_real_distribution<float> distribution_position( -extent, extent );
+		std::uniform_real_distribution<float> distribution_size( 0.2f, 1.5f );
+		std::vector<Math::sAxisAlignedBox> bounds( i_count );
+		for ( auto& bounds_object : bounds )
+		{
+			bounds_object.minimum = Math::sVector( distribution_position( randomNumberGenerator ),
+				distribution_position( randomNumberGenerator ), distribution_position( randomNumberGenerator ) );
+			bounds_object.maximum = bounds_object.minimum + Math::sVector( distribution_size( randomNumberGenerator ),
+				distribution_size( randomNumberGenerator ), distribution_size( randomNumberGenerator ) );
+		}
+		return bounds;
+	}
+
+	// Every object whose index is a multiple of the given interval is moved a small random distance
+	// (about as far as an object moves in a frame, and so past only a few neighbors)
+	std::vector<Math::sAxisAlignedBox> CreateMovedBounds( const std::vector<Math::sAxisAlignedBox>& i_bounds, const size_t i_movingInterval )
+	{
+		std::mt19937 randomNumberGenerator( 1 );
+		std::uniform_real_distribution<float> distribution_offset( -0.1f, 0.1f );
+		auto bounds = i_bounds;
+		for ( size_t i = 0; i < bounds.size(); i += i_movingInterval )
+		{
+			const Math::sVector offset( distribution_offset( randomNumberGenerator ), distribution_offset( randomNumberGenerator ),
+				distribution_offset( randomNumberGenerator ) );
+			bounds[i].minimum += offset;
+			bounds[i].maximum += offset;
+		}
+		return bounds;
+	}
+
+	// The items are the objects
+	// (and so the items per second is the object throughput)
+	void FindOverlappingPairs_incremental( cState& io_state, const size_t i_movingInterval )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		const auto bounds_initial = CreateBounds( count );
+		const auto bounds_moved = CreateMovedBounds( bounds_initial, i_movingInterval );
+		Physics::cSweepAndPrune broadphase;
+		std::vector<Physics::cSweepAndPrune::tProxyId> proxyIds( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			proxyIds[i] = broadphase.AddProxy( bounds_initial[i], static_cast<uint32_t>( i ) );
+		}
+		std::vector<Physics::sOverlappingPair> pairs;
+		// The first search does the full sort and allocates the memory that the others reuse
+		broadphase.FindOverlappingPairs( pairs );
+		io_state.SetItemCountPerIteration( count );
+		io_state.SetCounter( "pairs", static_cast<double>( pairs.size() ) );
+		// The moving objects go back and forth between their two positions every frame
+		// (and so every frame has the same amount of work)
+		auto* bounds_current = &bounds_moved;
+		auto* bounds_next = &bounds_initial;
+		while ( io_state.KeepRunning() )
+		{
+			for ( size_t i = 0; i < count; i += i_movingInterval )
+			{
+				broadphase.UpdateProxy( proxyIds[i], ( *bounds_current )[i] );
+			}
+			broadphase.FindOverlappingPairs( pairs );
+			ClobberMemory();
+			std::swap( bounds_current, bounds_next );
+		}
+	}
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of objects
+
+namespace
+{
+	// The first search after the objects are added sorts every entry from scratch
+	// (adding the objects isn't timed)
+	void FindOverlappingPairs_first( cState& io_state )
+	{
+		const auto count = static_cast<size_t>( io_state.GetParameter() );
+		const auto bounds = CreateBounds( count );
+		std::vector<Physics::sOverlappingPair> pairs;
+		io_state.SetItemCountPerIteration( count );
+		while ( io_state.KeepRunning() )
+		{
+			io_state.PauseTiming();
+			{
+				Physics::cSweepAndPrune broadphase;
+				for ( size_t i = 0; i < count; ++i )
+				{
+					broadphase.AddProxy( bounds[i], static_cast<uint32_t>( i ) );
+				}
+				io_state.ResumeTiming();
+				broadphase.FindOverlappingPairs( pairs );
+				ClobberMemory();
+				io_state.PauseTiming();
+			}
+			io_state.ResumeTiming();
+		}
+		io_state.SetCounter( "pairs", static_cast<double>( pairs.size() ) );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cSweepAndPrune/FindOverlappingPairs_first", FindOverlappingPairs_first, 10000, 30000, 100000 );
+
+	// A tenth of the objects move each frame
+	// (which is the mostly-static scene that sweep and prune is meant for)
+	void FindOverlappingPairs_incremental( cState& io_state )
+	{
+		FindOverlappingPairs_incremental( io_state, 10 );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cSweepAndPrune/FindOverlappingPairs_incremental", FindOverlappingPairs_incremental,
+		10000, 30000, 100000 );
+
+	// Every object moves each frame
+	// (which can be compared with the cSpatialHashGrid benchmark with the same objects)
+	void FindOverlappingPairs_incremental_everythingMoves( cState& io_state )
+	{
+		FindOverlappingPairs_incremental( io_state, 1 );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cSweepAndPrune/FindOverlappingPairs_incremental_everythingMoves",
+		FindOverlappingPairs_incremental_everythingMoves, 10000, 30000, 100000 );
+}
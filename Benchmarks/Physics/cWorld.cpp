@@ -0,0 +1,247 @@
+// Include Files
+//==============
+
+#include <Benchmarks/Benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <Engine/Physics/cWorld.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using namespace eae6320::Benchmarks;
+
+	constexpr auto s_secondCountPerUpdate = 1.0f / 60.0f;
+
+	// A quarter of the bodies are moving and the rest are still
+	Physics::sRigidBodyState CreateBodyState( const size_t i_bodyIndex, std::mt19937& io_randomNumberGenerator )
+	{
+		std::uniform_real_distribution<float> distribution( -100.0f, 100.0f );
+		Physics::sRigidBodyState state;
+		state.position = Math::sVector( distribution( io_randomNumberGenerator ), distribution( io_randomNumberGenerator ),
+			distribution( io_randomNumberGenerator ) );
+		if ( ( i_bodyIndex % 4 ) == 0 )
+		{
+			state.velocity = Math::sVector( distribution( io_randomNumberGenerator ), distribution( io_randomNumberGenerator ),
+				distribution( io_randomNumberGenerator ) ) * 0.01f;
+			state.acceleration = Math::sVector( 0.0f, -9.8f, 0.0f );
+			state.angularSpeed = 1.0f;
+		}
+		return state;
+	}
+
+	// If the still bodies should be asleep then they are simulated long enough to go to sleep
+	void CreateWorld( const size_t i_bodyCount, const unsigned int i_workerThreadCount, const bool i_shouldStillBodiesBeAsleep,
+		Physics::cWorld& o_world, std::vector<Physics::cWorld::cBodyHandle>& o_handles )
+	{
+		if ( !o_world.Initialize( i_workerThreadCount ) )
+		{
+			fprintf( stderr, "The physics world couldn't be initialized\n" );
+			std::exit( EXIT_FAILURE );
+		}
+		if ( !i_shouldStillBodiesBeAsleep )
+		{
+			auto sleepSettings = o_world.GetSleepSettings();
+			sleepSettings.isEnabled = false;
+			o_world.SetSleepSettings( sleepSettings );
+		}
+		std::mt19937 randomNumberGenerator( 0 );
+		o_handles.resize( i_bodyCount );
+		for ( size_t i = 0; i < i_bodyCount; ++i )
+		{
+			o_world.AddBody( CreateBodyState( i, randomNumberGenerator ), o_handles[i] );
+		}
+		if ( i_shouldStillBodiesBeAsleep )
+		{
+			const auto secondCountUntilSleep = o_world.GetSleepSettings().secondCountUntilSleep;
+			for ( auto secondCount = 0.0f; secondCount <= secondCountUntilSleep; secondCount += s_secondCountPerUpdate )
+			{
+				o_world.Update( s_secondCountPerUpdate );
+			}
+		}
+	}
+
+	void CleanUpWorld( Physics::cWorld& io_world, std::vector<Physics::cWorld::cBodyHandle>& io_handles )
+	{
+		for ( auto& handle : io_handles )
+		{
+			io_world.RemoveBody( handle );
+		}
+		io_world.CleanUp();
+	}
+}
+
+// Benchmarks
+//===========
+
+// The parameter of each is the number of bodies (unless it says otherwise)
+
+namespace
+{
+	// Simulation
+	//-----------
+
+	// Every body is awake
+	void Update( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		const auto bodyCount = static_cast<size_t>( io_state.GetParameter() );
+		CreateWorld( bodyCount, 0, false, world, handles );
+		io_state.SetItemCountPerIteration( bodyCount );
+		while ( io_state.KeepRunning() )
+		{
+			world.Update( s_secondCountPerUpdate );
+		}
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/Update", Update, 10000, 100000, 1000000 );
+
+	// The three quarters of the bodies that are still are asleep
+	void Update_stillBodiesAsleep( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		const auto bodyCount = static_cast<size_t>( io_state.GetParameter() );
+		CreateWorld( bodyCount, 0, true, world, handles );
+		io_state.SetItemCountPerIteration( bodyCount );
+		while ( io_state.KeepRunning() )
+		{
+			world.Update( s_secondCountPerUpdate );
+		}
+		io_state.SetCounter( "awakeBodies", static_cast<double>( world.GetAwakeBodyCount() ) );
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/Update_stillBodiesAsleep", Update_stillBodiesAsleep, 10000, 100000, 1000000 );
+
+	// The parameter is the number of worker threads
+	// (the thread that calls Update() also integrates a range of bodies,
+	// and so a parameter of zero is the single-threaded simulation)
+	void Update_workerThreads( cState& io_state )
+	{
+		constexpr size_t bodyCount = 1000000;
+		const auto workerThreadCount = static_cast<unsigned int>( io_state.GetParameter() );
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		CreateWorld( bodyCount, workerThreadCount, false, world, handles );
+		io_state.SetItemCountPerIteration( bodyCount );
+		io_state.SetCounter( "threads", static_cast<double>( workerThreadCount + 1 ) );
+		while ( io_state.KeepRunning() )
+		{
+			world.Update( s_secondCountPerUpdate );
+		}
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/Update_workerThreads", Update_workerThreads, 0, 1, 2, 3, 7, 15 );
+
+	// This is the same simulation as Update() with every body's state stored in its own struct
+	void Update_sRigidBodyState( cState& io_state )
+	{
+		const auto bodyCount = static_cast<size_t>( io_state.GetParameter() );
+		std::vector<Physics::sRigidBodyState> states( bodyCount );
+		{
+			std::mt19937 randomNumberGenerator( 0 );
+			for ( size_t i = 0; i < bodyCount; ++i )
+			{
+				states[i] = CreateBodyState( i, randomNumberGenerator );
+			}
+		}
+		DoNotOptimize( states.data() );
+		io_state.SetItemCountPerIteration( bodyCount );
+		while ( io_state.KeepRunning() )
+		{
+			for ( auto& state : states )
+			{
+				state.Update( s_secondCountPerUpdate );
+			}
+			ClobberMemory();
+		}
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/sRigidBodyState/Update", Update_sRigidBodyState, 10000, 100000, 1000000 );
+
+	// Snapshots
+	//----------
+
+	void TakeSnapshot( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		CreateWorld( static_cast<size_t>( io_state.GetParameter() ), 0, true, world, handles );
+		std::vector<uint8_t> snapshot( world.GetSnapshotSize() );
+		io_state.SetCounter( "bytes", static_cast<double>( snapshot.size() ) );
+		while ( io_state.KeepRunning() )
+		{
+			world.TakeSnapshot( snapshot.data(), snapshot.size() );
+			ClobberMemory();
+		}
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/TakeSnapshot", TakeSnapshot, 1000, 10000, 100000 );
+
+	void RestoreSnapshot( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		CreateWorld( static_cast<size_t>( io_state.GetParameter() ), 0, true, world, handles );
+		std::vector<uint8_t> snapshot( world.GetSnapshotSize() );
+		world.TakeSnapshot( snapshot.data(), snapshot.size() );
+		io_state.SetCounter( "bytes", static_cast<double>( snapshot.size() ) );
+		while ( io_state.KeepRunning() )
+		{
+			world.RestoreSnapshot( snapshot.data(), snapshot.size() );
+			ClobberMemory();
+		}
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/RestoreSnapshot", RestoreSnapshot, 1000, 10000, 100000 );
+
+	// The delta is between two snapshots that are a single update apart
+	void EncodeSnapshotDelta( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		CreateWorld( static_cast<size_t>( io_state.GetParameter() ), 0, true, world, handles );
+		std::vector<uint8_t> snapshot_base( world.GetSnapshotSize() );
+		world.TakeSnapshot( snapshot_base.data(), snapshot_base.size() );
+		world.Update( s_secondCountPerUpdate );
+		std::vector<uint8_t> snapshot( world.GetSnapshotSize() );
+		world.TakeSnapshot( snapshot.data(), snapshot.size() );
+		std::vector<uint8_t> delta;
+		while ( io_state.KeepRunning() )
+		{
+			Physics::cWorld::EncodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(), snapshot.data(), snapshot.size(), delta );
+			ClobberMemory();
+		}
+		io_state.SetCounter( "bytes", static_cast<double>( snapshot.size() ) );
+		io_state.SetCounter( "deltaBytes", static_cast<double>( delta.size() ) );
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/EncodeSnapshotDelta", EncodeSnapshotDelta, 1000, 10000, 100000 );
+
+	void DecodeSnapshotDelta( cState& io_state )
+	{
+		Physics::cWorld world;
+		std::vector<Physics::cWorld::cBodyHandle> handles;
+		CreateWorld( static_cast<size_t>( io_state.GetParameter() ), 0, true, world, handles );
+		std::vector<uint8_t> snapshot_base( world.GetSnapshotSize() );
+		world.TakeSnapshot( snapshot_base.data(), snapshot_base.size() );
+		world.Update( s_secondCountPerUpdate );
+		std::vector<uint8_t> snapshot( world.GetSnapshotSize() );
+		world.TakeSnapshot( snapshot.data(), snapshot.size() );
+		std::vector<uint8_t> delta, snapshot_decoded;
+		Physics::cWorld::EncodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(), snapshot.data(), snapshot.size(), delta );
+		io_state.SetCounter( "deltaBytes", static_cast<double>( delta.size() ) );
+		while ( io_state.KeepRunning() )
+		{
+			Physics::cWorld::DecodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(), delta.data(), delta.size(), snapshot_decoded );
+			ClobberMemory();
+		}
+		CleanUpWorld( world, handles );
+	}
+	EAE6320_BENCHMARK_WITHPARAMETERS( "Physics/cWorld/DecodeSnapshotDelta", DecodeSnapshotDelta, 1000, 10000, 100000 );
+}
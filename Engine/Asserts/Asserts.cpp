@@ -35,7 +35,7 @@ bool eae6320::Asserts::ShowMessageIfAssertionIsFalseAndReturnWhetherToBreak( con
 			if ( formattingResult > 0 )
 			{
 				message << buffer;
-				if ( formattingResult >= bufferSize )
+				if ( static_cast<size_t>( formattingResult ) >= bufferSize )
 				{
 					message << "\n\n"
 						"(The internal buffer of size " << bufferSize
@@ -26,6 +26,8 @@
 
 	#ifdef EAE6320_PLATFORM_WINDOWS
 		#include <intrin.h>
+	#else
+		#include <csignal>
 	#endif
 
 #endif
@@ -55,7 +57,8 @@
 	#if defined( EAE6320_PLATFORM_WINDOWS )
 		#define EAE6320_ASSERTS_BREAK __debugbreak()
 	#else
-		#error "No implementation exists for breaking in the debugger when an assert fails"
+		// This stops in the debugger if one is attached (and otherwise ends the program)
+		#define EAE6320_ASSERTS_BREAK std::raise( SIGTRAP )
 	#endif
 
 	#define EAE6320_ASSERT( i_assertion )	\
@@ -67,12 +70,15 @@
 			EAE6320_ASSERTS_BREAK;	\
 		}	\
 	}
-	#define EAE6320_ASSERTF( i_assertion, i_messageToDisplayWhenAssertionIsFalse, ... )	\
+	// The message is part of the variable arguments
+	// so that a message without any insertions doesn't leave a trailing comma
+	// (which only some compilers remove)
+	#define EAE6320_ASSERTF( i_assertion, ... )	\
 	{	\
 		static bool shouldThisAssertBeIgnored = false;	\
 		if ( !shouldThisAssertBeIgnored && !static_cast<bool>( i_assertion ) \
 			&& eae6320::Asserts::ShowMessageIfAssertionIsFalseAndReturnWhetherToBreak( __LINE__, __FILE__,	\
-				shouldThisAssertBeIgnored, i_messageToDisplayWhenAssertionIsFalse, __VA_ARGS__ ) )	\
+				shouldThisAssertBeIgnored, __VA_ARGS__ ) )	\
 		{	\
 			EAE6320_ASSERTS_BREAK;	\
 		}	\
@@ -80,7 +86,7 @@
 #else
 	// The macros do nothing when asserts aren't enabled
 	#define EAE6320_ASSERT( i_assertion )
-	#define EAE6320_ASSERTF( i_assertion, i_messageToDisplayWhenAssertionIsFalse, ... )
+	#define EAE6320_ASSERTF( i_assertion, ... )
 #endif
 
 #endif	// EAE6320_ASSERTS_H
@@ -0,0 +1,25 @@
+// Include Files
+//==============
+
+#include "../Asserts.h"
+
+#ifdef EAE6320_ASSERTS_AREENABLED
+	#include <iostream>
+#endif
+
+// Helper Function Definitions
+//============================
+
+#ifdef EAE6320_ASSERTS_AREENABLED
+
+bool eae6320::Asserts::ShowMessageIfAssertionIsFalseAndReturnWhetherToBreak_platformSpecific(
+	std::ostringstream& io_message, bool& io_shouldThisAssertBeIgnoredInTheFuture )
+{
+	// There is no message box to ask the user what to do,
+	// and so the message is written to standard error and the code always breaks
+	// (a program that isn't being debugged ends, which is what a test should do when an assert fails)
+	std::cerr << io_message.str() << std::endl;
+	return true;
+}
+
+#endif	// EAE6320_ASSERTS_AREENABLED
@@ -25,6 +25,44 @@
 	#include <Engine/Windows/Includes.h>
 #endif
 
+// Configuration
+//==============
+
+// Every increment and decrement can be counted so that the number of atomic operations a frame makes can be measured.
+// Counting is itself another atomic operation,
+// and so it is only done on the null graphics platform (where frames are measured headless)
+#ifdef EAE6320_PLATFORM_NULL
+	#define EAE6320_ASSETS_AREREFERENCECOUNTOPERATIONSCOUNTED
+#endif
+
+#ifdef EAE6320_ASSETS_AREREFERENCECOUNTOPERATIONSCOUNTED
+	#include <atomic>
+#endif
+
+// Interface
+//==========
+
+#ifdef EAE6320_ASSETS_AREREFERENCECOUNTOPERATIONSCOUNTED
+
+namespace eae6320
+{
+	namespace Assets
+	{
+		// This is the number of times that any reference-counted asset's count has been incremented or decremented
+		// (from every thread since the program started)
+		inline std::atomic<uint64_t>& GetReferenceCountOperationCount()
+		{
+			static std::atomic<uint64_t> s_referenceCountOperationCount( 0 );
+			return s_referenceCountOperationCount;
+		}
+	}
+}
+
+	#define EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION() eae6320::Assets::GetReferenceCountOperationCount().fetch_add( 1, std::memory_order_relaxed )
+#else
+	#define EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION()
+#endif
+
 // Reference Counting
 //-------------------
 
@@ -47,6 +85,7 @@
 			EAE6320_ASSERT( ( reinterpret_cast<uintptr_t>( &m_referenceCount ) % 2 ) == 0 );	\
 			auto* const referenceCount_asSigned = reinterpret_cast<short*>( &m_referenceCount );	\
 			InterlockedIncrementNoFence16( referenceCount_asSigned );	\
+			EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION();	\
 		}	\
 		uint16_t DecrementReferenceCount()	\
 		{	\
@@ -54,6 +93,28 @@
 			EAE6320_ASSERT( ( reinterpret_cast<uintptr_t>( &m_referenceCount ) % 2 ) == 0 );	\
 			auto* const referenceCount_asSigned = reinterpret_cast<short*>( &m_referenceCount );	\
 			const auto newReferenceCount = InterlockedDecrementNoFence16( referenceCount_asSigned );	\
+			EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION();	\
+			if ( newReferenceCount == 0 ) delete this;	\
+			return newReferenceCount;	\
+		}
+
+#elif defined( __GNUC__ )
+
+	// GCC and Clang have atomic built-ins that behave the same way as the Windows "interlocked" functions above
+	// (this is used by platforms without Windows, like the null graphics platform running headless)
+
+	#define EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS()	\
+		void IncrementReferenceCount()	\
+		{	\
+			EAE6320_ASSERT( m_referenceCount > 0 );	\
+			__atomic_add_fetch( &m_referenceCount, 1, __ATOMIC_RELAXED );	\
+			EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION();	\
+		}	\
+		uint16_t DecrementReferenceCount()	\
+		{	\
+			EAE6320_ASSERT( m_referenceCount > 0 );	\
+			const uint16_t newReferenceCount = __atomic_sub_fetch( &m_referenceCount, 1, __ATOMIC_ACQ_REL );	\
+			EAE6320_ASSETS_COUNTREFERENCECOUNTOPERATION();	\
 			if ( newReferenceCount == 0 ) delete this;	\
 			return newReferenceCount;	\
 		}
@@ -86,7 +86,7 @@ namespace eae6320
 			uint_fast32_t GetIndex() const { return static_cast<uint_fast32_t>( value & EAE6320_ASSETS_INDEX_MASK ); }
 
 #define EAE6320_ASSETS_ID_SHIFT 20	// The remaining high bits
-#define EAE6320_ASSETS_ID_MAX ( 1 << ( ( sizeof( cHandle<void*> ) * 8 ) - EAE6320_ASSETS_ID_SHIFT ) ) - 1
+#define EAE6320_ASSETS_ID_MAX ( ( 1 << ( ( sizeof( cHandle<void*> ) * 8 ) - EAE6320_ASSETS_ID_SHIFT ) ) - 1 )
 
 			uint_fast16_t GetId() const { return static_cast<uint_fast16_t>( value >> EAE6320_ASSETS_ID_SHIFT ); }
 
@@ -116,7 +116,7 @@ namespace eae6320
 			//========
 
 			// Nothing should ever worry about the IDs except asset managers
-			template <class tAsset> friend class cManager;
+			template <class> friend class cManager;
 		};
 	}
 };
@@ -103,7 +103,7 @@ template <class tAsset> template <typename... tConstructorArguments>
 	auto result = Results::Success;
 
 	tAsset* newAsset;
-	if ( result = tAsset::Load( i_path, newAsset, std::forward<tConstructorArguments>( i_constructorArguments )... ) )
+	if ( ( result = tAsset::Load( i_path, newAsset, std::forward<tConstructorArguments>( i_constructorArguments )... ) ) )
 	{
 		// Lock the collections
 		Concurrency::cMutex::cScopeLock autoLock( m_mutex );
@@ -0,0 +1,16 @@
+/*
+	This file provides configurable settings
+	that can be used to modify the concurrency project
+*/
+
+#ifndef EAE6320_CONCURRENCY_CONFIGURATION_H
+#define EAE6320_CONCURRENCY_CONFIGURATION_H
+
+// cMutex and cEvent are built on a value in user space that threads can sleep on (see Futex.h)
+// on platforms whose kernel supports that,
+// and other POSIX platforms use pthread mutexes and condition variables instead
+#if defined( EAE6320_PLATFORM_WINDOWS ) || defined( __linux__ )
+	#define EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+#endif
+
+#endif	// EAE6320_CONCURRENCY_CONFIGURATION_H
@@ -0,0 +1,67 @@
+/*
+	These functions let a thread sleep until the value at an address changes
+	(this is what a "futex" is on Linux, and Windows calls it WaitOnAddress())
+
+	They are what cMutex and cEvent are built on:
+	The state of a mutex or event is a single value in user space
+	that is changed with atomic instructions,
+	and the kernel is only involved when a thread actually has to sleep or be woken up.
+	A thread that would have to wait first spins for a short time
+	because the thread it is waiting for is often about to finish
+	(e.g. the application and render threads handing a frame to each other),
+	and sleeping and waking up costs much more than that.
+
+	These are only used by the other classes in this library
+	(and only on platforms that have futexes; see Configuration.h).
+*/
+
+#ifndef EAE6320_CONCURRENCY_FUTEX_H
+#define EAE6320_CONCURRENCY_FUTEX_H
+
+// Include Files
+//==============
+
+#include "Configuration.h"
+#include "Constants.h"
+
+#include <atomic>
+#include <cstdint>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Concurrency
+	{
+		namespace Futex
+		{
+			// The atomic is passed to the operating system as the plain value that it contains
+			static_assert( sizeof( std::atomic<uint32_t> ) == sizeof( uint32_t ), "A futex must be the size of a 32-bit value" );
+
+			// A thread that would have to wait spins this many times before it sleeps
+			// (if there is only a single processor then the thread being waited for can't run while this one spins,
+			// and so the count is zero)
+			unsigned int GetSpinCountBeforeWaiting();
+			constexpr unsigned int SpinCountBeforeWaiting_multipleProcessors = 128;
+
+			// This puts the calling thread to sleep if the value is the expected one
+			// and returns when it is woken up or the time-out period elapses.
+			// It can also return for no reason,
+			// and so the caller must always check the value again.
+			void Wait( const std::atomic<uint32_t>& i_address, const uint32_t i_expectedValue,
+				const unsigned int i_timeToWait_inMilliseconds = Constants::DontTimeOut );
+			// These wake threads that are waiting on the address.
+			// The value must be changed before calling them (or a waiting thread could go back to sleep).
+			void WakeOne( const std::atomic<uint32_t>& i_address );
+			void WakeAll( const std::atomic<uint32_t>& i_address );
+
+			// This should be called in every iteration of a loop that spins
+			// (it tells the processor that the thread is spinning,
+			// which saves power and lets another hyperthread on the same core run)
+			void Pause();
+		}
+	}
+}
+
+#endif	// EAE6320_CONCURRENCY_FUTEX_H
@@ -0,0 +1,69 @@
+// Include Files
+//==============
+
+#include "../Futex.h"
+
+// Other POSIX platforms don't have futexes
+// (and cMutex and cEvent use pthreads instead)
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <Engine/Asserts/Asserts.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::Futex::Wait( const std::atomic<uint32_t>& i_address, const uint32_t i_expectedValue,
+	const unsigned int i_timeToWait_inMilliseconds )
+{
+	// A futex's time-out is relative (and measured with the monotonic clock)
+	timespec timeToWait;
+	timespec* timeToWait_optional = nullptr;
+	if ( i_timeToWait_inMilliseconds != Constants::DontTimeOut )
+	{
+		timeToWait.tv_sec = static_cast<time_t>( i_timeToWait_inMilliseconds / 1000 );
+		timeToWait.tv_nsec = static_cast<long>( i_timeToWait_inMilliseconds % 1000 ) * ( 1000 * 1000 );
+		timeToWait_optional = &timeToWait;
+	}
+	// The kernel only puts the thread to sleep if the value is still the expected one
+	// (the value being different, the time-out period elapsing, and a signal interrupting the wait
+	// all mean that the caller should check the value again)
+	if ( ( syscall( SYS_futex, &i_address, FUTEX_WAIT_PRIVATE, i_expectedValue, timeToWait_optional, nullptr, 0 ) != 0 )
+		&& ( errno != EAGAIN ) && ( errno != ETIMEDOUT ) && ( errno != EINTR ) )
+	{
+		EAE6320_ASSERTF( false, "Failed to wait on a futex: %s", std::strerror( errno ) );
+	}
+}
+
+void eae6320::Concurrency::Futex::WakeOne( const std::atomic<uint32_t>& i_address )
+{
+	syscall( SYS_futex, &i_address, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0 );
+}
+
+void eae6320::Concurrency::Futex::WakeAll( const std::atomic<uint32_t>& i_address )
+{
+	constexpr int wakeEveryThread = 0x7fffffff;
+	syscall( SYS_futex, &i_address, FUTEX_WAKE_PRIVATE, wakeEveryThread, nullptr, nullptr, 0 );
+}
+
+unsigned int eae6320::Concurrency::Futex::GetSpinCountBeforeWaiting()
+{
+	static const auto spinCount = ( sysconf( _SC_NPROCESSORS_ONLN ) > 1 ) ? SpinCountBeforeWaiting_multipleProcessors : 0u;
+	return spinCount;
+}
+
+void eae6320::Concurrency::Futex::Pause()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+	__builtin_ia32_pause();
+#elif defined( __aarch64__ ) || defined( __arm__ )
+	__asm__ __volatile__( "yield" );
+#endif
+}
+
+#endif	// EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
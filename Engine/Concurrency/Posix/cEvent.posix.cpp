@@ -0,0 +1,170 @@
+// Include Files
+//==============
+
+#include "../cEvent.h"
+
+// Platforms with futexes use the implementation in ../cEvent.cpp
+#ifndef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Concurrency::WaitForEvent( const eae6320::Concurrency::cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds )
+{
+	if ( i_event.m_isInitialized )
+	{
+		// The time-out is measured with the monotonic clock (which the condition variable was created to use)
+		// so that changing the system time doesn't change how long the wait is
+		timespec timeToStopWaiting;
+		if ( i_timeToWait_inMilliseconds != eae6320::Concurrency::Constants::DontTimeOut )
+		{
+			clock_gettime( CLOCK_MONOTONIC, &timeToStopWaiting );
+			constexpr long nanosecondCountPerSecond = 1000 * 1000 * 1000;
+			timeToStopWaiting.tv_sec += static_cast<time_t>( i_timeToWait_inMilliseconds / 1000 );
+			timeToStopWaiting.tv_nsec += static_cast<long>( i_timeToWait_inMilliseconds % 1000 ) * ( 1000 * 1000 );
+			if ( timeToStopWaiting.tv_nsec >= nanosecondCountPerSecond )
+			{
+				++timeToStopWaiting.tv_sec;
+				timeToStopWaiting.tv_nsec -= nanosecondCountPerSecond;
+			}
+		}
+
+		auto result = eae6320::Results::Success;
+		pthread_mutex_lock( &i_event.m_mutex );
+		{
+			while ( !i_event.m_isSignaled )
+			{
+				int errorCode;
+				if ( i_timeToWait_inMilliseconds == eae6320::Concurrency::Constants::DontTimeOut )
+				{
+					errorCode = pthread_cond_wait( &i_event.m_condition, &i_event.m_mutex );
+				}
+				else if ( i_timeToWait_inMilliseconds == 0 )
+				{
+					errorCode = ETIMEDOUT;
+				}
+				else
+				{
+					errorCode = pthread_cond_timedwait( &i_event.m_condition, &i_event.m_mutex, &timeToStopWaiting );
+				}
+				if ( errorCode == ETIMEDOUT )
+				{
+					result = eae6320::Results::TimeOut;
+					break;
+				}
+				else if ( errorCode != 0 )
+				{
+					EAE6320_ASSERTF( false, "Failed to wait for an event: %s", std::strerror( errorCode ) );
+					eae6320::Logging::OutputError( "POSIX failed waiting for an event: %s", std::strerror( errorCode ) );
+					result = eae6320::Results::Failure;
+					break;
+				}
+			}
+			if ( result && i_event.m_shouldResetAutomatically )
+			{
+				i_event.m_isSignaled = false;
+			}
+		}
+		pthread_mutex_unlock( &i_event.m_mutex );
+		return result;
+	}
+	else
+	{
+		EAE6320_ASSERTF( false, "An event can't be waited for until it has been initialized" );
+		eae6320::Logging::OutputError( "An attempt was made to wait for an event that hadn't been initialized" );
+		return eae6320::Results::Failure;
+	}
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::Signal()
+{
+	EAE6320_ASSERTF( m_isInitialized, "An event can't be signaled until it has been initialized" );
+	pthread_mutex_lock( &m_mutex );
+	{
+		m_isSignaled = true;
+		// An automatically-resetting event only lets a single waiting thread return
+		if ( m_shouldResetAutomatically )
+		{
+			pthread_cond_signal( &m_condition );
+		}
+		else
+		{
+			pthread_cond_broadcast( &m_condition );
+		}
+	}
+	pthread_mutex_unlock( &m_mutex );
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::ResetToUnsignaled()
+{
+	EAE6320_ASSERTF( m_isInitialized, "An event can't be reset until it has been initialized" );
+	pthread_mutex_lock( &m_mutex );
+	{
+		m_isSignaled = false;
+	}
+	pthread_mutex_unlock( &m_mutex );
+	return Results::Success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cEvent::Initialize( const EventType i_type, const EventState i_initialState )
+{
+	EAE6320_ASSERTF( !m_isInitialized, "An event can't be initialized more than once" );
+	{
+		const auto errorCode = pthread_mutex_init( &m_mutex, nullptr );
+		if ( errorCode != 0 )
+		{
+			EAE6320_ASSERTF( false, "Couldn't create event mutex: %s", std::strerror( errorCode ) );
+			Logging::OutputError( "POSIX failed to create an event's mutex: %s", std::strerror( errorCode ) );
+			return Results::Failure;
+		}
+	}
+	{
+		pthread_condattr_t attributes;
+		pthread_condattr_init( &attributes );
+		pthread_condattr_setclock( &attributes, CLOCK_MONOTONIC );
+		const auto errorCode = pthread_cond_init( &m_condition, &attributes );
+		pthread_condattr_destroy( &attributes );
+		if ( errorCode != 0 )
+		{
+			pthread_mutex_destroy( &m_mutex );
+			EAE6320_ASSERTF( false, "Couldn't create event condition variable: %s", std::strerror( errorCode ) );
+			Logging::OutputError( "POSIX failed to create an event's condition variable: %s", std::strerror( errorCode ) );
+			return Results::Failure;
+		}
+	}
+	m_isSignaled = i_initialState == EventState::Signaled;
+	m_shouldResetAutomatically = i_type == EventType::ResetAutomaticallyAfterBeingSignaled;
+	m_isInitialized = true;
+	return Results::Success;
+}
+
+eae6320::Concurrency::cEvent::cEvent()
+{
+
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::CleanUp()
+{
+	auto result = Results::Success;
+
+	if ( m_isInitialized )
+	{
+		pthread_cond_destroy( &m_condition );
+		pthread_mutex_destroy( &m_mutex );
+		m_isInitialized = false;
+	}
+
+	return result;
+}
+
+#endif	// EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
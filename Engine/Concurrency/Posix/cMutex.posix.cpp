@@ -0,0 +1,42 @@
+// Include Files
+//==============
+
+#include "../cMutex.h"
+
+// Platforms with futexes use the implementation in ../cMutex.cpp
+#ifndef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cMutex::Lock()
+{
+	pthread_mutex_lock( &m_mutex );
+}
+
+eae6320::cResult eae6320::Concurrency::cMutex::LockIfPossible()
+{
+	return ( pthread_mutex_trylock( &m_mutex ) == 0 ) ? Results::Success : Results::Failure;
+}
+
+void eae6320::Concurrency::cMutex::Unlock()
+{
+	pthread_mutex_unlock( &m_mutex );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cMutex::cMutex()
+	:
+	m_mutex( PTHREAD_MUTEX_INITIALIZER )
+{
+
+}
+
+eae6320::Concurrency::cMutex::~cMutex()
+{
+	pthread_mutex_destroy( &m_mutex );
+}
+
+#endif	// EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
@@ -0,0 +1,39 @@
+// Include Files
+//==============
+
+#include "../cMutex_recursive.h"
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cMutex_recursive::Lock()
+{
+	pthread_mutex_lock( &m_mutex );
+}
+
+eae6320::cResult eae6320::Concurrency::cMutex_recursive::LockIfPossible()
+{
+	return ( pthread_mutex_trylock( &m_mutex ) == 0 ) ? Results::Success : Results::Failure;
+}
+
+void eae6320::Concurrency::cMutex_recursive::Unlock()
+{
+	pthread_mutex_unlock( &m_mutex );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cMutex_recursive::cMutex_recursive()
+{
+	pthread_mutexattr_t attributes;
+	pthread_mutexattr_init( &attributes );
+	pthread_mutexattr_settype( &attributes, PTHREAD_MUTEX_RECURSIVE );
+	pthread_mutex_init( &m_mutex, &attributes );
+	pthread_mutexattr_destroy( &attributes );
+}
+
+eae6320::Concurrency::cMutex_recursive::~cMutex_recursive()
+{
+	pthread_mutex_destroy( &m_mutex );
+}
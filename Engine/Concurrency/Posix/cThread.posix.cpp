@@ -0,0 +1,152 @@
+// Include Files
+//==============
+
+#include "../cThread.h"
+
+#include "../cEvent.h"
+
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <pthread.h>
+
+// Class Definition
+//=================
+
+struct eae6320::Concurrency::cThread::sState
+{
+	pthread_t thread;
+	fThreadFunction threadFunction;
+	void* userData = nullptr;
+	// POSIX can only wait for a thread to stop without a time-out,
+	// and so the thread signals this when it stops
+	cEvent whenThreadHasStopped;
+};
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Concurrency::cThread::Start( fThreadFunction const i_threadFunction, void* const io_userData )
+{
+	auto result = Results::Success;
+
+	if ( !m_state )
+	{
+		m_state = std::make_shared<sState>();
+		m_state->threadFunction = i_threadFunction;
+		m_state->userData = io_userData;
+		if ( !( result = m_state->whenThreadHasStopped.Initialize( EventType::RemainSignaledUntilReset ) ) )
+		{
+			EAE6320_ASSERTF( false, "A thread can't be started with no event to signal when it stops" );
+			Logging::OutputError( "A thread couldn't be started because its stop event couldn't be created" );
+			m_state.reset();
+			goto OnExit;
+		}
+		// Start the new thread
+		{
+			// The new thread gets its own reference to the state
+			// (which it releases when it stops)
+			auto* const state_thread = new std::shared_ptr<sState>( m_state );
+			const auto errorCode = pthread_create( &m_state->thread, nullptr,
+				[]( void* io_state ) -> void*
+				{
+					std::unique_ptr<std::shared_ptr<sState>> state( static_cast<std::shared_ptr<sState>*>( io_state ) );
+					// Call the user-provided function with the user-provided data
+					( *state )->threadFunction( ( *state )->userData );
+					const auto result = ( *state )->whenThreadHasStopped.Signal();
+					EAE6320_ASSERT( result );
+					return nullptr;
+				},
+				state_thread );
+			if ( errorCode != 0 )
+			{
+				delete state_thread;
+				EAE6320_ASSERTF( false, "Couldn't start a thread: %s", std::strerror( errorCode ) );
+				Logging::OutputError( "POSIX failed to start a thread: %s", std::strerror( errorCode ) );
+				m_state.reset();
+				result = Results::Failure;
+				goto OnExit;
+			}
+		}
+	}
+	else
+	{
+		result = Results::Failure;
+		EAE6320_ASSERTF( false, "A thread can't be started if it is already running" );
+		eae6320::Logging::OutputError( "An attempt was made to start a thread that was already running" );
+		goto OnExit;
+	}
+
+OnExit:
+
+	return result;
+}
+
+eae6320::cResult eae6320::Concurrency::WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds )
+{
+	if ( io_thread.m_state )
+	{
+		const auto result = WaitForEvent( io_thread.m_state->whenThreadHasStopped, i_timeToWait_inMilliseconds );
+		if ( result )
+		{
+			// The thread has finished its function and so joining it won't block for long
+			const auto errorCode = pthread_join( io_thread.m_state->thread, nullptr );
+			if ( errorCode == 0 )
+			{
+				// The state is released so that this thread object could be reused if desired
+				io_thread.m_state.reset();
+				return eae6320::Results::Success;
+			}
+			else
+			{
+				EAE6320_ASSERTF( false, "Failed to wait for a thread to exit: %s", std::strerror( errorCode ) );
+				eae6320::Logging::OutputError( "POSIX failed waiting for a thread to exit: %s", std::strerror( errorCode ) );
+				return eae6320::Results::Failure;
+			}
+		}
+		return result;
+	}
+	else
+	{
+		EAE6320_ASSERTF( false, "A thread can't be waited on to exit if it hasn't been started" );
+		// Even calling the function with no thread is probably a user error,
+		// the thread isn't running (assuming the user didn't call CleanUp() prematurely)
+		// and so success is returned
+		return eae6320::Results::Success;
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cThread::cThread()
+{
+
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cThread::CleanUp()
+{
+	cResult result = eae6320::Results::Success;
+
+	if ( m_state )
+	{
+		// A thread that is still running is detached so that its resources are released when it stops
+		// (in the same way that closing a Windows thread handle doesn't stop the thread)
+		const auto errorCode = pthread_detach( m_state->thread );
+		if ( errorCode != 0 )
+		{
+			EAE6320_ASSERTF( false, "Couldn't detach thread: %s", std::strerror( errorCode ) );
+			Logging::OutputError( "POSIX failed to detach a thread: %s", std::strerror( errorCode ) );
+			result = eae6320::Results::Failure;
+		}
+		m_state.reset();
+	}
+
+	return result;
+}
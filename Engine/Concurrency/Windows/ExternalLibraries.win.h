@@ -8,3 +8,5 @@
 //===================
 
 #pragma comment( lib, "Kernel32.lib" )
+// WaitOnAddress() (which cMutex and cEvent are built on)
+#pragma comment( lib, "Synchronization.lib" )
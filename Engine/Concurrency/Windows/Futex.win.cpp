@@ -0,0 +1,48 @@
+// Include Files
+//==============
+
+#include "../Futex.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Windows/Includes.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::Futex::Wait( const std::atomic<uint32_t>& i_address, const uint32_t i_expectedValue,
+	const unsigned int i_timeToWait_inMilliseconds )
+{
+	auto expectedValue = i_expectedValue;
+	if ( WaitOnAddress( const_cast<std::atomic<uint32_t>*>( &i_address ), &expectedValue, sizeof( expectedValue ),
+		( i_timeToWait_inMilliseconds == Constants::DontTimeOut ) ? INFINITE : static_cast<DWORD>( i_timeToWait_inMilliseconds ) ) == FALSE )
+	{
+		// The caller checks the value again whether or not the time-out period elapsed
+		EAE6320_ASSERTF( GetLastError() == ERROR_TIMEOUT, "Failed to wait on an address" );
+	}
+}
+
+void eae6320::Concurrency::Futex::WakeOne( const std::atomic<uint32_t>& i_address )
+{
+	WakeByAddressSingle( const_cast<std::atomic<uint32_t>*>( &i_address ) );
+}
+
+void eae6320::Concurrency::Futex::WakeAll( const std::atomic<uint32_t>& i_address )
+{
+	WakeByAddressAll( const_cast<std::atomic<uint32_t>*>( &i_address ) );
+}
+
+unsigned int eae6320::Concurrency::Futex::GetSpinCountBeforeWaiting()
+{
+	static const auto spinCount = []
+	{
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo( &systemInfo );
+		return ( systemInfo.dwNumberOfProcessors > 1 ) ? SpinCountBeforeWaiting_multipleProcessors : 0u;
+	}();
+	return spinCount;
+}
+
+void eae6320::Concurrency::Futex::Pause()
+{
+	YieldProcessor();
+}
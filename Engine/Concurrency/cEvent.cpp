@@ -5,6 +5,13 @@
 
 #include <Engine/Asserts/Asserts.h>
 
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+	#include "Futex.h"
+
+	#include <chrono>
+	#include <Engine/Logging/Logging.h>
+#endif
+
 // Interface
 //==========
 
@@ -16,3 +23,172 @@ eae6320::Concurrency::cEvent::~cEvent()
 	const auto result = CleanUp();
 	EAE6320_ASSERT( result );
 }
+
+// The other platforms' implementations are in Posix/cEvent.posix.cpp
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+
+eae6320::cResult eae6320::Concurrency::WaitForEvent( const eae6320::Concurrency::cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds )
+{
+	if ( !i_event.m_isInitialized )
+	{
+		EAE6320_ASSERTF( false, "An event can't be waited for until it has been initialized" );
+		eae6320::Logging::OutputError( "An attempt was made to wait for an event that hadn't been initialized" );
+		return eae6320::Results::Failure;
+	}
+
+	const auto state_whenWaitStarted = i_event.m_state.load( std::memory_order_acquire );
+	// If the event is already signaled the wait is a single atomic operation
+	{
+		auto state = state_whenWaitStarted;
+		if ( i_event.TryToEndWait( state_whenWaitStarted, state ) )
+		{
+			return eae6320::Results::Success;
+		}
+	}
+	if ( i_timeToWait_inMilliseconds == 0 )
+	{
+		return eae6320::Results::TimeOut;
+	}
+	const auto shouldTimeOut = i_timeToWait_inMilliseconds != eae6320::Concurrency::Constants::DontTimeOut;
+	const auto time_waitStart = shouldTimeOut ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+	// The thread that will signal the event is often about to do so
+	// (e.g. when two threads hand work back and forth),
+	// and spinning for a short time is much faster than sleeping and being woken up
+	const auto spinCount = eae6320::Concurrency::Futex::GetSpinCountBeforeWaiting();
+	for ( unsigned int i = 0; i < spinCount; ++i )
+	{
+		eae6320::Concurrency::Futex::Pause();
+		auto state = i_event.m_state.load( std::memory_order_acquire );
+		if ( i_event.TryToEndWait( state_whenWaitStarted, state ) )
+		{
+			return eae6320::Results::Success;
+		}
+	}
+	// Sleep until the event is signaled.
+	// The waiting thread count is incremented before the state is checked
+	// and a signaling thread changes the state before it checks the waiting thread count
+	// (all with sequentially-consistent operations),
+	// and so either this thread will see the signaled state or the signaling thread will see this thread waiting and wake it.
+	auto result = eae6320::Results::TimeOut;
+	i_event.m_waitingThreadCount.fetch_add( 1 );
+	while ( true )
+	{
+		auto state = i_event.m_state.load();
+		if ( i_event.TryToEndWait( state_whenWaitStarted, state ) )
+		{
+			result = eae6320::Results::Success;
+			break;
+		}
+		auto timeToWait_inMilliseconds = eae6320::Concurrency::Constants::DontTimeOut;
+		if ( shouldTimeOut )
+		{
+			const auto elapsedTime_inMilliseconds = static_cast<unsigned int>(
+				std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - time_waitStart ).count() );
+			if ( elapsedTime_inMilliseconds >= i_timeToWait_inMilliseconds )
+			{
+				break;
+			}
+			timeToWait_inMilliseconds = i_timeToWait_inMilliseconds - elapsedTime_inMilliseconds;
+		}
+		eae6320::Concurrency::Futex::Wait( i_event.m_state, state, timeToWait_inMilliseconds );
+	}
+	i_event.m_waitingThreadCount.fetch_sub( 1, std::memory_order_relaxed );
+	return result;
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::Signal()
+{
+	EAE6320_ASSERTF( m_isInitialized, "An event can't be signaled until it has been initialized" );
+	auto state = m_state.load( std::memory_order_relaxed );
+	while ( ( state & IsSignaledBit ) == 0 )
+	{
+		if ( m_state.compare_exchange_weak( state, ( state + SignalCountIncrement ) | IsSignaledBit ) )
+		{
+			// The kernel is only involved if a thread is sleeping
+			if ( m_waitingThreadCount.load() != 0 )
+			{
+				// An automatically-resetting event only lets a single waiting thread return
+				if ( m_shouldResetAutomatically )
+				{
+					Futex::WakeOne( m_state );
+				}
+				else
+				{
+					Futex::WakeAll( m_state );
+				}
+			}
+			break;
+		}
+	}
+	// If the event was already signaled then signaling it again doesn't change anything
+	// (and the thread that signaled it has already woken any sleeping threads)
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::ResetToUnsignaled()
+{
+	EAE6320_ASSERTF( m_isInitialized, "An event can't be reset until it has been initialized" );
+	m_state.fetch_and( ~IsSignaledBit, std::memory_order_relaxed );
+	return Results::Success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cEvent::Initialize( const EventType i_type, const EventState i_initialState )
+{
+	EAE6320_ASSERTF( !m_isInitialized, "An event can't be initialized more than once" );
+	m_state.store( ( i_initialState == EventState::Signaled ) ? uint32_t( IsSignaledBit ) : uint32_t( 0 ), std::memory_order_relaxed );
+	m_waitingThreadCount.store( 0, std::memory_order_relaxed );
+	m_shouldResetAutomatically = i_type == EventType::ResetAutomaticallyAfterBeingSignaled;
+	m_isInitialized = true;
+	return Results::Success;
+}
+
+eae6320::Concurrency::cEvent::cEvent()
+	:
+	m_state( 0 ), m_waitingThreadCount( 0 )
+{
+
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::CleanUp()
+{
+	auto result = Results::Success;
+
+	if ( m_isInitialized )
+	{
+		EAE6320_ASSERTF( m_waitingThreadCount.load( std::memory_order_relaxed ) == 0, "An event can't be cleaned up while threads are waiting for it" );
+		m_isInitialized = false;
+	}
+
+	return result;
+}
+
+// Implementation
+//===============
+
+bool eae6320::Concurrency::cEvent::TryToEndWait( const uint32_t i_state_whenWaitStarted, uint32_t& io_state ) const
+{
+	if ( m_shouldResetAutomatically )
+	{
+		// Only one thread can change the state back to unsignaled,
+		// and that is the only thread that returns
+		while ( ( io_state & IsSignaledBit ) != 0 )
+		{
+			if ( m_state.compare_exchange_weak( io_state, io_state & ~IsSignaledBit, std::memory_order_acquire, std::memory_order_relaxed ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	else
+	{
+		// If the signal count has changed then the event was signaled after the wait started
+		// (even if it has been reset since then)
+		return ( ( io_state & IsSignaledBit ) != 0 ) || ( io_state != i_state_whenWaitStarted );
+	}
+}
+
+#endif	// EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
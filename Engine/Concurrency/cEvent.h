@@ -6,6 +6,12 @@
 		* When an event is signaled it means that the event has happened
 		* (Note that an event's state can change from signaled back to unsignaled;
 			this happens when an event repeats)
+
+	Where futexes are available (see Configuration.h) the state is a single value in user space (see Futex.h):
+	Signaling an event that no thread is waiting for
+	and waiting for an event that is already signaled
+	don't involve the kernel,
+	and a thread that waits for an event that isn't signaled yet spins for a short time before it sleeps.
 */
 
 #ifndef EAE6320_CONCURRENCY_CEVENT_H
@@ -14,12 +20,16 @@
 // Include Files
 //==============
 
+#include "Configuration.h"
 #include "Constants.h"
 
 #include <Engine/Results/Results.h>
 
-#if defined( EAE6320_PLATFORM_WINDOWS )
-	#include <Engine/Windows/Includes.h>
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+	#include <atomic>
+	#include <cstdint>
+#else
+	#include <pthread.h>
 #endif
 
 // Forward Declarations
@@ -78,7 +88,8 @@ namespace eae6320
 			//	* The specified time-out period elapses
 			//		* If the caller doesn't specify a time-out period then the function will never return until the event happens
 			//		* If the caller specifies a time-out period of zero then the function will return immediately
-			friend cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds = Constants::DontTimeOut );
+			// (the default time-out period is declared after the class)
+			friend cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds );
 
 			// This function should be called when an event happens
 			// (which "signals" the event happening to any waiting threads)
@@ -101,10 +112,44 @@ namespace eae6320
 
 		private:
 
-#if defined( EAE6320_PLATFORM_WINDOWS )
-			HANDLE m_handle = NULL;
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+			// The lowest bit of the state is whether the event is signaled
+			// and the other bits count how many times it has been signaled
+			// (a thread waiting for an event that remains signaled until reset returns if the count changes,
+			// and so it can't miss the event if it is reset again before the thread wakes up).
+			// Waiting changes the state of an automatically-resetting event,
+			// and so everything that a wait uses is mutable.
+			mutable std::atomic<uint32_t> m_state;
+			mutable std::atomic<uint32_t> m_waitingThreadCount;
+			bool m_shouldResetAutomatically = false;
+			bool m_isInitialized = false;
+
+			// Implementation
+			//===============
+
+		private:
+
+			static constexpr uint32_t IsSignaledBit = 0x1;
+			static constexpr uint32_t SignalCountIncrement = 0x2;
+
+			// This returns true if a waiting thread can return
+			// (and changes the state back to unsignaled if the event resets automatically).
+			// If it returns false the state that was passed in has been updated to the latest state.
+			bool TryToEndWait( const uint32_t i_state_whenWaitStarted, uint32_t& io_state ) const;
+#else
+			// Waiting changes the state of an automatically-resetting event,
+			// and so everything that a wait uses is mutable
+			mutable pthread_mutex_t m_mutex;
+			mutable pthread_cond_t m_condition;
+			mutable bool m_isSignaled = false;
+			bool m_shouldResetAutomatically = false;
+			bool m_isInitialized = false;
 #endif
 		};
+
+		// A default argument can only be given in a friend declaration if the friend is defined there,
+		// and so it is given here instead
+		cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds = Constants::DontTimeOut );
 	}
 }
 
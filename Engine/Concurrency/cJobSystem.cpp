@@ -0,0 +1,558 @@
+// Include Files
+//==============
+
+#include "cJobSystem.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <new>
+#include <thread>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// Each thread that runs jobs remembers which job system it belongs to and which queue is its own
+	thread_local const eae6320::Concurrency::cJobSystem* s_jobSystem_currentThread = nullptr;
+	thread_local unsigned int s_threadIndex_currentThread = 0;
+
+	// A thread that can't find a job tries again this many times before it waits
+	// (jobs are often added in quick succession, and waking a thread up takes much longer than this)
+	constexpr unsigned int s_attemptCountBeforeWaiting = 64;
+
+	// The queues' indices wrap around this many jobs
+	static_assert( ( eae6320::Concurrency::cJobSystem::MaximumJobCountPerQueue & ( eae6320::Concurrency::cJobSystem::MaximumJobCountPerQueue - 1 ) ) == 0,
+		"The maximum number of jobs in a queue must be a power of two" );
+	constexpr int64_t s_jobIndexMask = static_cast<int64_t>( eae6320::Concurrency::cJobSystem::MaximumJobCountPerQueue - 1 );
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// This chooses which queue to try stealing from first
+	// (so that threads that are out of jobs don't all steal from the same queue)
+	uint32_t GenerateRandomNumber( uint32_t& io_state );
+
+	struct sParallelForRanges
+	{
+		const std::function<void( const size_t, const size_t )>* function;
+		size_t index_end;
+		size_t indexCountPerRange;
+		std::atomic<size_t> index_nextRange;
+	};
+	void RunParallelForRanges( void* const io_ranges );
+}
+
+// Interface
+//==========
+
+// Running
+//--------
+
+void eae6320::Concurrency::cJobSystem::Run( const sJob& i_job, cCounter* const io_counter )
+{
+	Run( &i_job, 1, io_counter );
+}
+
+void eae6320::Concurrency::cJobSystem::Run( const sJob* const i_jobs, const size_t i_jobCount, cCounter* const io_counter )
+{
+	EAE6320_ASSERTF( m_jobQueues, "Jobs can't be run until the job system has been initialized" );
+	if ( i_jobCount == 0 )
+	{
+		return;
+	}
+	// The counter is incremented before any of the jobs can run
+	// (adding a job to a queue releases this to the thread that takes it)
+	if ( io_counter )
+	{
+		io_counter->m_unfinishedJobCount.fetch_add( i_jobCount, std::memory_order_relaxed );
+	}
+	unsigned int threadIndex;
+	if ( GetCurrentThreadIndex( threadIndex ) )
+	{
+		for ( size_t i = 0; i < i_jobCount; ++i )
+		{
+			AddJob( threadIndex, i_jobs[i], io_counter );
+		}
+	}
+	else
+	{
+		Concurrency::cMutex::cScopeLock scopeLock( m_sharedJobsMutex );
+		for ( size_t i = 0; i < i_jobCount; ++i )
+		{
+			m_sharedJobs.push_back( sQueuedJob{ i_jobs[i], io_counter } );
+		}
+		m_sharedJobCount.store( m_sharedJobs.size(), std::memory_order_release );
+	}
+	WakeWaitingWorkerThread();
+}
+
+void eae6320::Concurrency::cJobSystem::WaitForCounter( const cCounter& i_counter )
+{
+	unsigned int threadIndex;
+	const auto canRunJobs = GetCurrentThreadIndex( threadIndex );
+	EAE6320_ASSERTF( canRunJobs, "Only a thread that runs jobs can wait for a counter" );
+	uint32_t randomState = threadIndex + 1;
+	while ( !i_counter.IsDone() )
+	{
+		if ( !canRunJobs || !RunJob( threadIndex, randomState ) )
+		{
+			// The jobs that are left are running on other threads
+			std::this_thread::yield();
+		}
+	}
+}
+
+void eae6320::Concurrency::cJobSystem::ParallelFor( const size_t i_index_begin, const size_t i_index_end, const size_t i_indexCountPerRange,
+	const std::function<void( const size_t i_index_begin, const size_t i_index_end )>& i_function )
+{
+	EAE6320_ASSERTF( i_indexCountPerRange > 0, "A range must have at least one index" );
+	if ( i_index_end <= i_index_begin )
+	{
+		return;
+	}
+	sParallelForRanges ranges;
+	ranges.function = &i_function;
+	ranges.index_end = i_index_end;
+	ranges.indexCountPerRange = std::max( i_indexCountPerRange, static_cast<size_t>( 1 ) );
+	ranges.index_nextRange = i_index_begin;
+	// Rather than running a job for every range
+	// a job is run for every thread that could help,
+	// and each job keeps taking the next range until there are none left
+	// (so that the cost of a job is only paid once per thread).
+	// The calling thread takes ranges too, and so it needs one fewer job.
+	const auto rangeCount = ( ( i_index_end - i_index_begin ) + ( ranges.indexCountPerRange - 1 ) ) / ranges.indexCountPerRange;
+	const auto jobCount = std::min( rangeCount, static_cast<size_t>( m_jobQueueCount ) ) - 1;
+	cCounter counter;
+	{
+		sJob job;
+		job.function = RunParallelForRanges;
+		job.userData = &ranges;
+		for ( size_t i = 0; i < jobCount; ++i )
+		{
+			Run( job, &counter );
+		}
+	}
+	RunParallelForRanges( &ranges );
+	WaitForCounter( counter );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cJobSystem::Initialize( const unsigned int i_workerThreadCount )
+{
+	auto result = Results::Success;
+
+	EAE6320_ASSERTF( !m_jobQueues, "A job system can't be initialized twice" );
+	EAE6320_ASSERTF( !s_jobSystem_currentThread, "A thread can only run jobs for a single job system" );
+	// Every thread that runs jobs has a queue
+	{
+		const auto jobQueueCount = i_workerThreadCount + 1;
+		m_jobQueues.reset( new ( std::nothrow ) sJobQueue[jobQueueCount] );
+		if ( !m_jobQueues )
+		{
+			result = Results::OutOfMemory;
+			EAE6320_ASSERTF( false, "Couldn't allocate %u job queues", jobQueueCount );
+			Logging::OutputError( "Failed to allocate %u job queues", jobQueueCount );
+			goto OnExit;
+		}
+		for ( unsigned int i = 0; i < jobQueueCount; ++i )
+		{
+			auto& jobQueue = m_jobQueues[i];
+			jobQueue.jobs.reset( new ( std::nothrow ) sJobQueue::sStoredJob[MaximumJobCountPerQueue] );
+			if ( !jobQueue.jobs )
+			{
+				result = Results::OutOfMemory;
+				EAE6320_ASSERTF( false, "Couldn't allocate a job queue" );
+				Logging::OutputError( "Failed to allocate a job queue with room for %u jobs", MaximumJobCountPerQueue );
+				goto OnExit;
+			}
+		}
+		m_jobQueueCount = jobQueueCount;
+	}
+	if ( !( result = m_whenJobsAreAvailable.Initialize( EventType::ResetAutomaticallyAfterBeingSignaled ) ) )
+	{
+		EAE6320_ASSERTF( false, "Couldn't initialize the event that wakes up worker threads" );
+		goto OnExit;
+	}
+	// The calling thread uses the first queue
+	s_jobSystem_currentThread = this;
+	s_threadIndex_currentThread = 0;
+	// Start the worker threads
+	if ( i_workerThreadCount > 0 )
+	{
+		m_workerThreads.reset( new ( std::nothrow ) sWorkerThread[i_workerThreadCount] );
+		if ( !m_workerThreads )
+		{
+			result = Results::OutOfMemory;
+			EAE6320_ASSERTF( false, "Couldn't allocate %u job worker threads", i_workerThreadCount );
+			Logging::OutputError( "Failed to allocate %u job worker threads", i_workerThreadCount );
+			goto OnExit;
+		}
+		for ( unsigned int i = 0; i < i_workerThreadCount; ++i )
+		{
+			auto& workerThread = m_workerThreads[i];
+			workerThread.jobSystem = this;
+			workerThread.threadIndex = i + 1;
+			if ( !( result = workerThread.thread.Start( WorkerThreadFunction, &workerThread ) ) )
+			{
+				EAE6320_ASSERTF( false, "Couldn't start a job worker thread" );
+				goto OnExit;
+			}
+			// The worker thread is only counted once it has started
+			// so that CleanUp() only stops threads that exist
+			m_workerThreadCount = i + 1;
+		}
+	}
+
+OnExit:
+
+	if ( !result )
+	{
+		const auto result_cleanUp = CleanUp();
+		EAE6320_ASSERT( result_cleanUp );
+	}
+
+	return result;
+}
+
+eae6320::cResult eae6320::Concurrency::cJobSystem::CleanUp()
+{
+	auto result = Results::Success;
+
+	// Tell every worker thread to exit and wait for it
+	m_shouldWorkerThreadsExit.store( true );
+	for ( unsigned int i = 0; i < m_workerThreadCount; ++i )
+	{
+		auto& workerThread = m_workerThreads[i];
+		// An automatically-resetting event only remembers a single signal,
+		// and so it is signaled again until this worker thread is the one that wakes up
+		constexpr unsigned int timeToWaitBetweenSignals_inMilliseconds = 1;
+		cResult result_wait;
+		do
+		{
+			const auto result_signal = m_whenJobsAreAvailable.Signal();
+			if ( !result_signal )
+			{
+				EAE6320_ASSERTF( false, "Couldn't tell a job worker thread to stop" );
+				result_wait = result_signal;
+				break;
+			}
+			result_wait = WaitForThreadToStop( workerThread.thread, timeToWaitBetweenSignals_inMilliseconds );
+		} while ( result_wait == Results::TimeOut );
+		if ( !result_wait )
+		{
+			EAE6320_ASSERTF( false, "Couldn't stop a job worker thread" );
+			if ( result )
+			{
+				result = result_wait;
+			}
+		}
+	}
+	m_workerThreadCount = 0;
+	m_workerThreads.reset();
+	m_shouldWorkerThreadsExit.store( false );
+
+	if ( s_jobSystem_currentThread == this )
+	{
+		s_jobSystem_currentThread = nullptr;
+	}
+	{
+		const auto result_event = m_whenJobsAreAvailable.CleanUp();
+		if ( !result_event )
+		{
+			EAE6320_ASSERT( false );
+			if ( result )
+			{
+				result = result_event;
+			}
+		}
+	}
+	EAE6320_ASSERTF( m_sharedJobCount.load() == 0, "A job system was cleaned up with jobs that never ran" );
+	m_sharedJobs.clear();
+	m_sharedJobCount.store( 0 );
+	m_jobQueueCount = 0;
+	m_jobQueues.reset();
+
+	return result;
+}
+
+eae6320::Concurrency::cJobSystem::~cJobSystem()
+{
+	const auto result = CleanUp();
+	EAE6320_ASSERT( result );
+}
+
+// Implementation
+//===============
+
+bool eae6320::Concurrency::cJobSystem::GetCurrentThreadIndex( unsigned int& o_threadIndex ) const
+{
+	if ( s_jobSystem_currentThread == this )
+	{
+		o_threadIndex = s_threadIndex_currentThread;
+		return true;
+	}
+	o_threadIndex = 0;
+	return false;
+}
+
+// The queues are the lock-free work-stealing deque described by Chase and Lev
+// with the memory orderings from "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al.)
+
+void eae6320::Concurrency::cJobSystem::AddJob( const unsigned int i_threadIndex, const sJob& i_job, cCounter* const io_counter )
+{
+	auto& jobQueue = m_jobQueues[i_threadIndex];
+	const auto bottom = jobQueue.bottom.load( std::memory_order_relaxed );
+	const auto top = jobQueue.top.load( std::memory_order_acquire );
+	if ( ( bottom - top ) >= static_cast<int64_t>( MaximumJobCountPerQueue ) )
+	{
+		// There is no room for the job and so it is run now
+		// (which is slower than letting other threads steal it but is always correct)
+		RunJob( i_job, io_counter );
+		return;
+	}
+	auto& storedJob = jobQueue.jobs[bottom & s_jobIndexMask];
+	storedJob.function.store( i_job.function, std::memory_order_relaxed );
+	storedJob.userData.store( i_job.userData, std::memory_order_relaxed );
+	storedJob.counter.store( io_counter, std::memory_order_relaxed );
+	// Moving the bottom releases the job (and anything that was written before it was added)
+	// to the thread that takes it
+	jobQueue.bottom.store( bottom + 1, std::memory_order_release );
+}
+
+bool eae6320::Concurrency::cJobSystem::TakeJob( const unsigned int i_threadIndex, sJob& o_job, cCounter*& o_counter )
+{
+	auto& jobQueue = m_jobQueues[i_threadIndex];
+	// The bottom is moved before the top is read
+	// so that a thread stealing at the same time sees that the job might be taken
+	const auto bottom = jobQueue.bottom.load( std::memory_order_relaxed ) - 1;
+	jobQueue.bottom.store( bottom, std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_seq_cst );
+	auto top = jobQueue.top.load( std::memory_order_relaxed );
+	if ( top <= bottom )
+	{
+		const auto& storedJob = jobQueue.jobs[bottom & s_jobIndexMask];
+		o_job.function = storedJob.function.load( std::memory_order_relaxed );
+		o_job.userData = storedJob.userData.load( std::memory_order_relaxed );
+		o_counter = storedJob.counter.load( std::memory_order_relaxed );
+		if ( top != bottom )
+		{
+			return true;
+		}
+		// This is the last job in the queue,
+		// and so this thread has to race any thread that is stealing it
+		const auto wasJobTaken = jobQueue.top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+		jobQueue.bottom.store( bottom + 1, std::memory_order_relaxed );
+		return wasJobTaken;
+	}
+	else
+	{
+		// The queue was empty
+		jobQueue.bottom.store( bottom + 1, std::memory_order_relaxed );
+		return false;
+	}
+}
+
+bool eae6320::Concurrency::cJobSystem::StealJob( const unsigned int i_threadIndex_victim, sJob& o_job, cCounter*& o_counter )
+{
+	auto& jobQueue = m_jobQueues[i_threadIndex_victim];
+	auto top = jobQueue.top.load( std::memory_order_acquire );
+	std::atomic_thread_fence( std::memory_order_seq_cst );
+	const auto bottom = jobQueue.bottom.load( std::memory_order_acquire );
+	if ( top < bottom )
+	{
+		// The job is read before it is claimed,
+		// and it is only used if no other thread claimed it first
+		const auto& storedJob = jobQueue.jobs[top & s_jobIndexMask];
+		o_job.function = storedJob.function.load( std::memory_order_relaxed );
+		o_job.userData = storedJob.userData.load( std::memory_order_relaxed );
+		o_counter = storedJob.counter.load( std::memory_order_relaxed );
+		return jobQueue.top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+	}
+	return false;
+}
+
+bool eae6320::Concurrency::cJobSystem::TakeSharedJob( sJob& o_job, cCounter*& o_counter )
+{
+	// The count is checked first so that the mutex isn't locked when there are no shared jobs (which is usual)
+	if ( m_sharedJobCount.load( std::memory_order_acquire ) == 0 )
+	{
+		return false;
+	}
+	Concurrency::cMutex::cScopeLock scopeLock( m_sharedJobsMutex );
+	if ( m_sharedJobs.empty() )
+	{
+		return false;
+	}
+	const auto& sharedJob = m_sharedJobs.back();
+	o_job = sharedJob.job;
+	o_counter = sharedJob.counter;
+	m_sharedJobs.pop_back();
+	m_sharedJobCount.store( m_sharedJobs.size(), std::memory_order_release );
+	return true;
+}
+
+bool eae6320::Concurrency::cJobSystem::AreJobsAvailable() const
+{
+	if ( m_sharedJobCount.load( std::memory_order_acquire ) > 0 )
+	{
+		return true;
+	}
+	for ( unsigned int i = 0; i < m_jobQueueCount; ++i )
+	{
+		const auto& jobQueue = m_jobQueues[i];
+		if ( jobQueue.bottom.load( std::memory_order_acquire ) > jobQueue.top.load( std::memory_order_acquire ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void eae6320::Concurrency::cJobSystem::WakeWaitingWorkerThread()
+{
+	// A worker thread counts itself as waiting before it checks for jobs a final time,
+	// and this checks for waiting worker threads after the jobs were added,
+	// and so either the worker thread will see the jobs or this will see the worker thread
+	std::atomic_thread_fence( std::memory_order_seq_cst );
+	if ( m_waitingWorkerThreadCount.load( std::memory_order_relaxed ) > 0 )
+	{
+		const auto result = m_whenJobsAreAvailable.Signal();
+		EAE6320_ASSERT( result );
+	}
+}
+
+bool eae6320::Concurrency::cJobSystem::RunJob( const unsigned int i_threadIndex, uint32_t& io_randomState )
+{
+	sJob job;
+	cCounter* counter;
+	if ( TakeJob( i_threadIndex, job, counter ) )
+	{
+		RunJob( job, counter );
+		return true;
+	}
+	auto wasJobFound = TakeSharedJob( job, counter );
+	if ( !wasJobFound && ( m_jobQueueCount > 1 ) )
+	{
+		// Try every other thread's queue, starting at a random one
+		const auto threadIndex_first = GenerateRandomNumber( io_randomState ) % m_jobQueueCount;
+		for ( unsigned int i = 0; ( i < m_jobQueueCount ) && !wasJobFound; ++i )
+		{
+			const auto threadIndex_victim = ( threadIndex_first + i ) % m_jobQueueCount;
+			if ( threadIndex_victim != i_threadIndex )
+			{
+				wasJobFound = StealJob( threadIndex_victim, job, counter );
+			}
+		}
+	}
+	if ( wasJobFound )
+	{
+		// A single signal only wakes up a single worker thread,
+		// and so if there are more jobs then another worker thread is woken up to help
+		if ( ( m_waitingWorkerThreadCount.load( std::memory_order_relaxed ) > 0 ) && AreJobsAvailable() )
+		{
+			WakeWaitingWorkerThread();
+		}
+		RunJob( job, counter );
+	}
+	return wasJobFound;
+}
+
+void eae6320::Concurrency::cJobSystem::RunJob( const sJob& i_job, cCounter* const io_counter )
+{
+	EAE6320_ASSERT( i_job.function );
+	i_job.function( i_job.userData );
+	if ( io_counter )
+	{
+		// Anything that the job wrote is released to the thread that sees the counter reach zero
+		io_counter->m_unfinishedJobCount.fetch_sub( 1, std::memory_order_release );
+	}
+}
+
+void eae6320::Concurrency::cJobSystem::WorkerThreadFunction( void* const io_workerThread )
+{
+	auto& workerThread = *static_cast<sWorkerThread*>( io_workerThread );
+	auto& jobSystem = *workerThread.jobSystem;
+	const auto threadIndex = workerThread.threadIndex;
+	s_jobSystem_currentThread = &jobSystem;
+	s_threadIndex_currentThread = threadIndex;
+	uint32_t randomState = threadIndex + 1;
+	while ( true )
+	{
+		// Look for a job a few times before waiting
+		{
+			auto wasJobRun = false;
+			for ( unsigned int i = 0; ( i < s_attemptCountBeforeWaiting ) && !wasJobRun; ++i )
+			{
+				wasJobRun = jobSystem.RunJob( threadIndex, randomState );
+				if ( !wasJobRun )
+				{
+					std::this_thread::yield();
+				}
+			}
+			if ( wasJobRun )
+			{
+				continue;
+			}
+		}
+		// Wait until more jobs are available
+		{
+			jobSystem.m_waitingWorkerThreadCount.fetch_add( 1, std::memory_order_seq_cst );
+			std::atomic_thread_fence( std::memory_order_seq_cst );
+			if ( !jobSystem.m_shouldWorkerThreadsExit.load() && !jobSystem.AreJobsAvailable() )
+			{
+				const auto result = WaitForEvent( jobSystem.m_whenJobsAreAvailable );
+				if ( !result )
+				{
+					EAE6320_ASSERTF( false, "A job worker thread couldn't wait for jobs" );
+					Logging::OutputError( "A job worker thread failed to wait for jobs and will exit" );
+					jobSystem.m_waitingWorkerThreadCount.fetch_sub( 1 );
+					break;
+				}
+			}
+			jobSystem.m_waitingWorkerThreadCount.fetch_sub( 1 );
+		}
+		if ( jobSystem.m_shouldWorkerThreadsExit.load() )
+		{
+			break;
+		}
+	}
+	s_jobSystem_currentThread = nullptr;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	uint32_t GenerateRandomNumber( uint32_t& io_state )
+	{
+		// xorshift32
+		auto x = io_state;
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		io_state = x;
+		return x;
+	}
+
+	void RunParallelForRanges( void* const io_ranges )
+	{
+		auto& ranges = *static_cast<sParallelForRanges*>( io_ranges );
+		while ( true )
+		{
+			const auto index_begin = ranges.index_nextRange.fetch_add( ranges.indexCountPerRange, std::memory_order_relaxed );
+			if ( index_begin >= ranges.index_end )
+			{
+				break;
+			}
+			( *ranges.function )( index_begin, std::min( index_begin + ranges.indexCountPerRange, ranges.index_end ) );
+		}
+	}
+}
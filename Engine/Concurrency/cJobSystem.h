@@ -0,0 +1,207 @@
+/*
+	A job system runs many small pieces of work (jobs) on a fixed set of worker threads
+
+	Each thread that runs jobs has its own queue (a double-ended queue):
+	A thread adds jobs to and takes jobs from the back of its own queue,
+	which keeps the work that it just created in its cache,
+	and a thread that runs out of jobs steals from the front of another thread's queue,
+	which takes the oldest (and usually biggest) work that hasn't been started yet.
+	Taking from its own queue almost never conflicts with another thread,
+	and so fine-grained jobs are cheap.
+
+	Jobs report when they finish with a counter:
+	Every job that is run with a counter increments it,
+	and the counter is decremented when the job finishes.
+	A thread that waits for a counter runs other jobs until the counter reaches zero
+	instead of blocking,
+	which is how a job that depends on other jobs waits for them
+	(and it means that waiting can't deadlock even if every thread is waiting).
+
+	The thread that initializes the job system is one of the threads that runs jobs
+	(e.g. the application thread can run jobs while it waits for them).
+*/
+
+#ifndef EAE6320_CONCURRENCY_CJOBSYSTEM_H
+#define EAE6320_CONCURRENCY_CJOBSYSTEM_H
+
+// Include Files
+//==============
+
+#include "cEvent.h"
+#include "cMutex.h"
+#include "cThread.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Results/Results.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Concurrency
+	{
+		class cJobSystem
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// A job is a function and the data to call it with
+			// (a plain function pointer is used rather than a std::function
+			// so that running a job never allocates memory)
+			using fJobFunction = void(*)( void* const io_userData );
+			struct sJob
+			{
+				fJobFunction function = nullptr;
+				void* userData = nullptr;
+			};
+
+			// A counter tracks how many jobs that were run with it haven't finished yet
+			class cCounter
+			{
+			public:
+
+				bool IsDone() const { return m_unfinishedJobCount.load( std::memory_order_acquire ) == 0; }
+
+				cCounter() = default;
+				cCounter( const cCounter& ) = delete;
+				cCounter& operator =( const cCounter& ) = delete;
+
+			private:
+
+				std::atomic<size_t> m_unfinishedJobCount{ 0 };
+
+				friend class cJobSystem;
+			};
+
+			// Running
+			//--------
+
+			// These can be called from any thread (including from inside of a job).
+			// If a counter is provided it must stay alive until the jobs have finished.
+			void Run( const sJob& i_job, cCounter* const io_counter = nullptr );
+			void Run( const sJob* const i_jobs, const size_t i_jobCount, cCounter* const io_counter = nullptr );
+
+			// This runs other jobs until every job that was run with the counter has finished.
+			// It can only be called from a thread that runs jobs
+			// (the thread that initialized the job system or from inside of a job).
+			void WaitForCounter( const cCounter& i_counter );
+
+			// This calls the function with ranges of indices that cover [i_index_begin, i_index_end) once each
+			// (every range except for possibly the last has i_indexCountPerRange indices)
+			// and returns when all of them have finished.
+			// Ranges are given out to threads as they ask for more work,
+			// and so threads that finish early take more ranges.
+			// It can only be called from a thread that runs jobs.
+			void ParallelFor( const size_t i_index_begin, const size_t i_index_end, const size_t i_indexCountPerRange,
+				const std::function<void( const size_t i_index_begin, const size_t i_index_end )>& i_function );
+
+			// The total number of threads that run jobs is one more than the number of worker threads
+			unsigned int GetWorkerThreadCount() const { return m_workerThreadCount; }
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			// The calling thread becomes one of the threads that runs jobs
+			cResult Initialize( const unsigned int i_workerThreadCount );
+			// This must be called from the thread that initialized the job system
+			// after every job has finished
+			cResult CleanUp();
+
+			cJobSystem() = default;
+			~cJobSystem();
+
+			cJobSystem( const cJobSystem& ) = delete;
+			cJobSystem& operator =( const cJobSystem& ) = delete;
+
+			// A thread's queue can hold this many jobs
+			// (if a thread adds a job when its queue is full the job is run immediately instead)
+			static constexpr size_t MaximumJobCountPerQueue = 4096;
+
+			// Data
+			//=====
+
+		private:
+
+			// A thread only adds and takes jobs from the back of its own queue (the "bottom"),
+			// and other threads only steal from the front (the "top").
+			// Each job's members are stored as atomics
+			// so that a thread that reads a job while it is being stolen by another thread doesn't cause a data race
+			// (the stealing thread only uses the job if it wins the race to move the top).
+			struct sJobQueue
+			{
+				// The top and bottom are changed by different threads
+				// and so they are kept in different cache lines
+				std::atomic<int64_t> top{ 0 };
+				uint8_t padding[64 - sizeof( std::atomic<int64_t> )];
+				std::atomic<int64_t> bottom{ 0 };
+				struct sStoredJob
+				{
+					std::atomic<fJobFunction> function;
+					std::atomic<void*> userData;
+					std::atomic<cCounter*> counter;
+				};
+				std::unique_ptr<sStoredJob[]> jobs;
+			};
+			struct sWorkerThread
+			{
+				cJobSystem* jobSystem = nullptr;
+				unsigned int threadIndex = 0;
+				cThread thread;
+			};
+
+			// Queue 0 is for the thread that initialized the job system
+			// and queue i is for worker thread i - 1
+			std::unique_ptr<sJobQueue[]> m_jobQueues;
+			unsigned int m_jobQueueCount = 0;
+			std::unique_ptr<sWorkerThread[]> m_workerThreads;
+			unsigned int m_workerThreadCount = 0;	// Only worker threads that have started are counted
+
+			// Threads that don't run jobs can't add to a queue,
+			// and so their jobs are added to a single shared queue instead
+			struct sQueuedJob
+			{
+				sJob job;
+				cCounter* counter;
+			};
+			std::vector<sQueuedJob> m_sharedJobs;
+			cMutex m_sharedJobsMutex;
+			std::atomic<size_t> m_sharedJobCount{ 0 };
+
+			// Worker threads that can't find any jobs wait for this to be signaled
+			cEvent m_whenJobsAreAvailable;
+			std::atomic<unsigned int> m_waitingWorkerThreadCount{ 0 };
+			std::atomic<bool> m_shouldWorkerThreadsExit{ false };
+
+			// Implementation
+			//===============
+
+		private:
+
+			// This returns the index of the calling thread's queue if it runs jobs for this job system
+			bool GetCurrentThreadIndex( unsigned int& o_threadIndex ) const;
+
+			void AddJob( const unsigned int i_threadIndex, const sJob& i_job, cCounter* const io_counter );
+			bool TakeJob( const unsigned int i_threadIndex, sJob& o_job, cCounter*& o_counter );
+			bool StealJob( const unsigned int i_threadIndex_victim, sJob& o_job, cCounter*& o_counter );
+			bool TakeSharedJob( sJob& o_job, cCounter*& o_counter );
+			bool AreJobsAvailable() const;
+			void WakeWaitingWorkerThread();
+
+			// This runs a single job if one can be found
+			bool RunJob( const unsigned int i_threadIndex, uint32_t& io_randomState );
+			static void RunJob( const sJob& i_job, cCounter* const io_counter );
+
+			static void WorkerThreadFunction( void* const io_workerThread );
+		};
+	}
+}
+
+#endif	// EAE6320_CONCURRENCY_CJOBSYSTEM_H
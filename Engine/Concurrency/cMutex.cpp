@@ -0,0 +1,79 @@
+// Include Files
+//==============
+
+#include "cMutex.h"
+
+// The other platforms' implementations are in Posix/cMutex.posix.cpp
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+
+#include "Futex.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cMutex::Lock()
+{
+	auto state = static_cast<uint32_t>( Unlocked );
+	if ( m_state.compare_exchange_strong( state, Locked, std::memory_order_acquire, std::memory_order_relaxed ) )
+	{
+		return;
+	}
+	// The lock is usually only held for a short time,
+	// and so it is worth spinning to see if it is released before sleeping
+	// (unless other threads are already sleeping, which means that it isn't being released quickly)
+	const auto spinCount = Futex::GetSpinCountBeforeWaiting();
+	for ( unsigned int i = 0; ( i < spinCount ) && ( state != Locked_threadsAreWaiting ); ++i )
+	{
+		Futex::Pause();
+		state = m_state.load( std::memory_order_relaxed );
+		if ( ( state == Unlocked )
+			&& m_state.compare_exchange_weak( state, Locked, std::memory_order_acquire, std::memory_order_relaxed ) )
+		{
+			return;
+		}
+	}
+	// Sleep until the lock is released.
+	// A thread that acquires the lock after sleeping can't know whether there are still other threads sleeping,
+	// and so it always marks that there are
+	// (which only costs an unnecessary wake when the lock is released).
+	while ( m_state.exchange( Locked_threadsAreWaiting, std::memory_order_acquire ) != Unlocked )
+	{
+		Futex::Wait( m_state, Locked_threadsAreWaiting );
+	}
+}
+
+eae6320::cResult eae6320::Concurrency::cMutex::LockIfPossible()
+{
+	auto state = static_cast<uint32_t>( Unlocked );
+	return m_state.compare_exchange_strong( state, Locked, std::memory_order_acquire, std::memory_order_relaxed ) ?
+		Results::Success : Results::Failure;
+}
+
+void eae6320::Concurrency::cMutex::Unlock()
+{
+	const auto state_previous = m_state.exchange( Unlocked, std::memory_order_release );
+	EAE6320_ASSERTF( state_previous != Unlocked, "A mutex can't be unlocked if it isn't locked" );
+	if ( state_previous == Locked_threadsAreWaiting )
+	{
+		Futex::WakeOne( m_state );
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cMutex::cMutex()
+	:
+	m_state( Unlocked )
+{
+
+}
+
+eae6320::Concurrency::cMutex::~cMutex()
+{
+	EAE6320_ASSERTF( m_state.load( std::memory_order_relaxed ) == Unlocked, "A mutex can't be destroyed while it is locked" );
+}
+
+#endif	// EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
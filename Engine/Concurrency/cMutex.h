@@ -4,6 +4,11 @@
 	The name comes from "mutual exclusion".
 	A mutex provides a locking mechanism,
 	and the mutually-exclusive lock can only be acquired by a single thread at any one time.
+
+	Where futexes are available (see Configuration.h) the lock is a single value in user space (see Futex.h):
+	Acquiring a lock that isn't held and releasing a lock that no other thread is waiting for
+	are each a single atomic instruction,
+	and a thread that can't acquire the lock spins for a short time before it sleeps.
 */
 
 #ifndef EAE6320_CONCURRENCY_CMUTEX_H
@@ -12,10 +17,15 @@
 // Include Files
 //==============
 
+#include "Configuration.h"
+
 #include <Engine/Results/Results.h>
 
-#if defined( EAE6320_PLATFORM_WINDOWS )
-	#include <Engine/Windows/Includes.h>
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+	#include <atomic>
+	#include <cstdint>
+#else
+	#include <pthread.h>
 #endif
 
 // Class Declaration
@@ -69,8 +79,17 @@ namespace eae6320
 
 		private:
 
-#if defined( EAE6320_PLATFORM_WINDOWS )
-			SRWLOCK m_srwLock;
+#ifdef EAE6320_CONCURRENCY_AREFUTEXESAVAILABLE
+			enum eState : uint32_t
+			{
+				Unlocked,
+				Locked,
+				// A thread that releases the lock in this state must wake a waiting thread
+				Locked_threadsAreWaiting,
+			};
+			std::atomic<uint32_t> m_state;
+#else
+			pthread_mutex_t m_mutex;
 #endif
 		};
 	}
@@ -17,6 +17,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
 	#include <Engine/Windows/Includes.h>
+#else
+	#include <memory>
 #endif
 
 // Forward Declarations
@@ -60,7 +62,8 @@ namespace eae6320
 			//	* The specified time-out period elapses
 			//		* If the caller doesn't specify a time-out period then the function will never return until the thread stops
 			//		* If the caller specifies a time-out period of zero then the function will return immediately
-			friend cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds = Constants::DontTimeOut );
+			// (the default time-out period is declared after the class)
+			friend cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds );
 
 			// Initialization / Clean Up
 			//--------------------------
@@ -75,6 +78,11 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
 			HANDLE m_handle = NULL;
+#else
+			// The state is shared with the new thread
+			// so that it stays valid for as long as the thread is running even if this object is destroyed first
+			struct sState;
+			std::shared_ptr<sState> m_state;
 #endif
 
 			// Implementation
@@ -85,6 +93,10 @@ namespace eae6320
 
 			cResult CleanUp();
 		};
+
+		// A default argument can only be given in a friend declaration if the friend is defined there,
+		// and so it is given here instead
+		cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds = Constants::DontTimeOut );
 	}
 }
 
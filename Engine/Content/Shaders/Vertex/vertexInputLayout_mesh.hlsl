@@ -22,6 +22,11 @@ void main(
 
 	in const float2 i_texture : TEXCOORD0,
 
+	in const float4 i_transform_localToWorld_column0 : TRANSFORM0,
+	in const float4 i_transform_localToWorld_column1 : TRANSFORM1,
+	in const float4 i_transform_localToWorld_column2 : TRANSFORM2,
+	in const float4 i_transform_localToWorld_column3 : TRANSFORM3,
+
 
 	// Output
 	//=======
@@ -39,7 +44,8 @@ void main(
 {
 	// The shader program is only used to generate a vertex input layout object;
 	// the actual shading code is never used
-	o_position = float4(i_position, 1.0);
+	o_position = mul( MatrixFromColumns( i_transform_localToWorld_column0, i_transform_localToWorld_column1,
+		i_transform_localToWorld_column2, i_transform_localToWorld_column3 ), float4(i_position, 1.0) );
 	o_color = i_color;
 	o_texture = i_texture;
 }
@@ -12,7 +12,7 @@
 //==============
 
 #include "Configuration.h"
-#include "Engine\Math\cMatrix_transformation.h"
+#include "Engine/Math/cMatrix_transformation.h"
 
 // Format Definitions
 //===================
@@ -0,0 +1,58 @@
+// Include Files
+//==============
+
+#include "Culling.h"
+
+#include <cmath>
+
+// Interface
+//==========
+
+eae6320::Math::sFrustum eae6320::Graphics::Culling::CreateFrustum( const Math::cMatrix_transformation& i_transform_worldToCamera,
+	const Math::cMatrix_transformation& i_transform_cameraToProjected )
+{
+	return Math::sFrustum::CreateFromTransform( i_transform_cameraToProjected * i_transform_worldToCamera );
+}
+
+bool eae6320::Graphics::Culling::IsVisible( const Math::sFrustum& i_frustum,
+	const Math::cMatrix_transformation& i_transform_localToWorld, const sMeshBounds& i_bounds )
+{
+	// In our class local-to-world transforms only rotate and translate,
+	// and so a sphere stays the same size
+	{
+		Math::sSphere sphere_world;
+		sphere_world.center = i_transform_localToWorld * Math::sVector(
+			i_bounds.sphereCenter[0], i_bounds.sphereCenter[1], i_bounds.sphereCenter[2] );
+		sphere_world.radius = i_bounds.sphereRadius;
+		if ( !Math::IsOverlapping( i_frustum, sphere_world ) )
+		{
+			return false;
+		}
+	}
+	// The sphere intersects every plane, but the box might still be outside of one of them
+	{
+		const Math::sVector halfExtents(
+			( i_bounds.boxMaximum[0] - i_bounds.boxMinimum[0] ) * 0.5f,
+			( i_bounds.boxMaximum[1] - i_bounds.boxMinimum[1] ) * 0.5f,
+			( i_bounds.boxMaximum[2] - i_bounds.boxMinimum[2] ) * 0.5f );
+		const auto center_world = i_transform_localToWorld * Math::sVector(
+			( i_bounds.boxMaximum[0] + i_bounds.boxMinimum[0] ) * 0.5f,
+			( i_bounds.boxMaximum[1] + i_bounds.boxMinimum[1] ) * 0.5f,
+			( i_bounds.boxMaximum[2] + i_bounds.boxMinimum[2] ) * 0.5f );
+		const auto& axis_x = i_transform_localToWorld.GetRightDirection();
+		const auto& axis_y = i_transform_localToWorld.GetUpDirection();
+		const auto& axis_z = i_transform_localToWorld.GetBackDirection();
+		for ( const auto& plane : i_frustum.planes )
+		{
+			// This is how far the oriented box reaches along the plane's normal
+			const auto projectedRadius = ( halfExtents.x * std::abs( Dot( plane.normal, axis_x ) ) )
+				+ ( halfExtents.y * std::abs( Dot( plane.normal, axis_y ) ) )
+				+ ( halfExtents.z * std::abs( Dot( plane.normal, axis_z ) ) );
+			if ( plane.GetSignedDistance( center_world ) < -projectedRadius )
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
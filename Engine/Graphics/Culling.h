@@ -0,0 +1,45 @@
+/*
+	This file declares the view-frustum culling that is done on the CPU
+	before submitted meshes are sorted and drawn
+
+	The frustum is extracted from the world-to-projected transform
+	(so it works with whatever projection the camera uses),
+	and each mesh is tested with the bounding volumes that were calculated when it was built.
+*/
+
+#ifndef EAE6320_GRAPHICS_CULLING_H
+#define EAE6320_GRAPHICS_CULLING_H
+
+// Include Files
+//==============
+
+#include "Configuration.h"
+
+#include "sMeshBounds.h"
+
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Geometry.h>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace Culling
+		{
+			// The frustum is in world space
+			Math::sFrustum CreateFrustum( const Math::cMatrix_transformation& i_transform_worldToCamera,
+				const Math::cMatrix_transformation& i_transform_cameraToProjected );
+
+			// The mesh is tested against its bounding sphere first (which is cheap)
+			// and then against its bounding box (which is oriented by the local-to-world transform).
+			// A mesh that might be visible is never culled, but a mesh that isn't visible might not be culled.
+			bool IsVisible( const Math::sFrustum& i_frustum,
+				const Math::cMatrix_transformation& i_transform_localToWorld, const sMeshBounds& i_bounds );
+		}
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CULLING_H
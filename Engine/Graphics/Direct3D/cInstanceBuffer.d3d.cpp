@@ -0,0 +1,145 @@
+// Include Files
+//==============
+
+#include "../cInstanceBuffer.h"
+
+#include "Includes.h"
+#include "../sContext.h"
+
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// Slot 0 is used by the mesh's vertex buffer
+	constexpr unsigned int s_instanceBufferSlot = 1;
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cInstanceBuffer::Bind() const
+{
+	auto* const direct3dImmediateContext = sContext::g_context.direct3dImmediateContext;
+	EAE6320_ASSERT( direct3dImmediateContext );
+
+	EAE6320_ASSERT( m_buffer );
+
+	constexpr unsigned int bufferCount = 1;
+	// The "stride" defines how large a single instance is in the stream of data
+	constexpr unsigned int bufferStride = sizeof( VertexFormats::sMeshInstance );
+	// Instanced draw calls specify which instance to start with,
+	// and so the buffer is always bound from the beginning
+	constexpr unsigned int bufferOffset = 0;
+	direct3dImmediateContext->IASetVertexBuffers( s_instanceBufferSlot, bufferCount, &m_buffer, &bufferStride, &bufferOffset );
+}
+
+void eae6320::Graphics::cInstanceBuffer::FenceLastUpdate()
+{
+	// Direct3D 11 doesn't have fences that the CPU can wait on.
+	// Instead, the buffer is discarded whenever the ring wraps around
+	// (which gives the driver the chance to provide new memory if the GPU is still reading the old memory),
+	// and every update in between promises not to overwrite anything that is in use.
+	m_lastUpdate_instanceCount = 0;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::CleanUp()
+{
+	auto result = Results::Success;
+
+	if ( m_buffer )
+	{
+		m_buffer->Release();
+		m_buffer = nullptr;
+	}
+	m_instanceCapacity = 0;
+
+	return result;
+}
+
+// Implementation
+//===============
+
+// Render
+//-------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Update_platformSpecific( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount,
+	const size_t i_firstInstance )
+{
+	auto* const direct3dImmediateContext = sContext::g_context.direct3dImmediateContext;
+	EAE6320_ASSERT( direct3dImmediateContext );
+
+	EAE6320_ASSERT( m_buffer );
+	EAE6320_ASSERT( ( i_firstInstance + i_instanceCount ) <= m_instanceCapacity );
+
+	// Get a pointer from Direct3D that can be written to
+	D3D11_MAPPED_SUBRESOURCE mappedSubResource;
+	{
+		constexpr unsigned int noSubResources = 0;
+		// The previous contents are discarded when the ring starts over at the beginning;
+		// otherwise the new instances are written after the ones that might still be in use
+		const auto mapType = ( i_firstInstance == 0 ) ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+		constexpr unsigned int noFlags = 0;
+		const auto d3dResult = direct3dImmediateContext->Map( m_buffer, noSubResources, mapType, noFlags, &mappedSubResource );
+		if ( FAILED( d3dResult ) )
+		{
+			EAE6320_ASSERT( false );
+			Logging::OutputError( "Direct3D failed to map the instance buffer (HRESULT %#010x)", d3dResult );
+			return Results::Failure;
+		}
+	}
+	// Copy the new data to the memory that Direct3D has provided
+	memcpy( static_cast<VertexFormats::sMeshInstance*>( mappedSubResource.pData ) + i_firstInstance, i_instances,
+		i_instanceCount * sizeof( VertexFormats::sMeshInstance ) );
+	// Let Direct3D know that the memory contains the data
+	// (the pointer will be invalid after this call)
+	{
+		constexpr unsigned int noSubResources = 0;
+		direct3dImmediateContext->Unmap( m_buffer, noSubResources );
+	}
+
+	return Results::Success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Initialize_platformSpecific()
+{
+	auto* const direct3dDevice = sContext::g_context.direct3dDevice;
+	EAE6320_ASSERT( direct3dDevice );
+
+	D3D11_BUFFER_DESC bufferDescription{};
+	{
+		const auto bufferSize = m_instanceCapacity * sizeof( VertexFormats::sMeshInstance );
+		EAE6320_ASSERT( bufferSize < ( uint64_t( 1u ) << ( sizeof( bufferDescription.ByteWidth ) * 8 ) ) );
+		bufferDescription.ByteWidth = static_cast<unsigned int>( bufferSize );
+		bufferDescription.Usage = D3D11_USAGE_DYNAMIC;	// The CPU must be able to update the buffer every frame
+		bufferDescription.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;	// The CPU must write, but doesn't read
+		bufferDescription.MiscFlags = 0;
+		bufferDescription.StructureByteStride = 0;	// Not used
+	}
+
+	const auto d3dResult = direct3dDevice->CreateBuffer( &bufferDescription, nullptr, &m_buffer );
+	if ( SUCCEEDED( d3dResult ) )
+	{
+		return Results::Success;
+	}
+	else
+	{
+		EAE6320_ASSERTF( false, "Instance buffer creation failed (HRESULT %#010x)", d3dResult );
+		Logging::OutputError( "Direct3D failed to create an instance buffer with HRESULT %#010x", d3dResult );
+		return Results::Failure;
+	}
+}
@@ -18,16 +18,24 @@
 #include "cShader.h"
 #include "cTexture.h"
 #include "cMesh.h"
+#include "cInstanceBuffer.h"
+#include "cFrameArena.h"
 #include "sContext.h"
 #include "VertexFormats.h"
-#include "Engine\Graphics\cEffect.h"
-#include "Engine\Graphics\cSprite.h"
+#include "Engine/Graphics/cEffect.h"
+#include "Engine/Graphics/cSprite.h"
 #include "cView.h"
+#include "RenderSorting.h"
+#include "RenderCommands.h"
+#include "Culling.h"
 
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <Engine/Asserts/Asserts.h>
 #include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/cMutex.h>
 #include <Engine/Logging/Logging.h>
 #include <Engine/Platform/Platform.h>
 #include <Engine/Time/Time.h>
@@ -44,7 +52,10 @@ namespace
 
 	// Constant buffer object
 	eae6320::Graphics::cConstantBuffer s_constantBuffer_perFrame(eae6320::Graphics::ConstantBufferTypes::PerFrame);
-	eae6320::Graphics::cConstantBuffer s_constantBuffer_perDraw(eae6320::Graphics::ConstantBufferTypes::PerDrawCall);
+	// Every mesh's local-to-world transform is written to a single instance buffer each frame
+	eae6320::Graphics::cInstanceBuffer s_instanceBuffer;
+	// This is how many instances the instance buffer can hold before it has to grow
+	constexpr size_t s_initialInstanceCapacity = 1024;
 	// In our class we will only have a single sampler state
 	eae6320::Graphics::cSamplerState s_samplerState;
 
@@ -56,32 +67,108 @@ namespace
 	struct sDataRequiredToRenderAFrame
 	{
 		eae6320::Graphics::ConstantBufferFormats::sPerFrame constantData_perFrame;
-		eae6320::Graphics::ConstantBufferFormats::sPerDrawCall constantData_perDraw;
 		float backgroundColor[4];
-		std::vector<eae6320::Graphics::renderData> renderDataVec;
-		std::vector<eae6320::Graphics::meshData> meshDataVec;
-		std::vector<eae6320::Graphics::meshData> meshTranslucentDataVec;
-
+		// The draw commands are recorded by the application thread in submission order
+		// and are only read by the render thread
+		eae6320::Graphics::cFrameArray<eae6320::Graphics::RenderCommands::sDrawMesh> meshCommands;
+		eae6320::Graphics::cFrameArray<eae6320::Graphics::RenderCommands::sDrawSprite> spriteCommands;
+		// The transforms of the mesh commands (at the same indices as the commands)
+		eae6320::Graphics::RenderCommands::sMeshTransforms meshTransforms;
+		// The commands refer to resources by their index in these tables
+		// (every resource is only in a table once no matter how many commands use it).
+		// Every resource in a table is pinned by the frame:
+		// a reference is added when the resource is added to the table
+		// and released when the frame packet is retired
+		eae6320::Graphics::cFrameArray<cEffect*> effects;
+		eae6320::Graphics::cFrameArray<eae6320::Graphics::cTexture*> textures;
+		eae6320::Graphics::cFrameArray<cMesh*> meshes;
+		eae6320::Graphics::cFrameArray<cSprite*> sprites;
+
+		// How long the application thread waited before it could start submitting to this packet
+		uint64_t tickCount_applicationThreadStall = 0;
+
+		// All of the memory that is needed for the frame comes from this arena:
+		// the lists above while the application thread is submitting,
+		// and the render thread's scratch memory while the frame is being rendered.
+		// It is reset in one step after the frame has been rendered.
+		eae6320::Graphics::cFrameArena frameArena;
+
+		sDataRequiredToRenderAFrame()
+		{
+			meshCommands.SetArena(frameArena);
+			spriteCommands.SetArena(frameArena);
+			meshTransforms.SetArena(frameArena);
+			effects.SetArena(frameArena);
+			textures.SetArena(frameArena);
+			meshes.SetArena(frameArena);
+			sprites.SetArena(frameArena);
+		}
 	};
-	// In our class there will be two copies of the data required to render a frame:
-	//	* One of them will be getting populated by the data currently being submitted by the application loop thread
-	//	* One of them will be fully populated, 
-	sDataRequiredToRenderAFrame s_dataRequiredToRenderAFrame[2];
-	auto* s_dataBeingSubmittedByApplicationThread = &s_dataRequiredToRenderAFrame[0];
-	auto* s_dataBeingRenderedByRenderThread = &s_dataRequiredToRenderAFrame[1];
-	// The following two events work together to make sure that
-	// the main/render thread and the application loop thread can work in parallel but stay in sync:
+	// This is how much memory each frame arena starts with
+	// (an arena grows if a frame needs more, and so this only has to be a reasonable guess)
+	constexpr size_t s_frameArenaInitialCapacity = 256 * 1024;
+	// The data required to render a frame is kept in a ring of frame packets:
+	//	* One of them is being populated by the data currently being submitted by the application loop thread
+	//	* Any number of them can be fully populated and waiting to be rendered
+	//	* One of them is being rendered by the render thread
+	// The ring is allocated once (at initialization) and the packets are re-used
+	std::unique_ptr<sDataRequiredToRenderAFrame[]> s_framePackets;
+	size_t s_framePacketCount = 0;
+	sDataRequiredToRenderAFrame* s_dataBeingSubmittedByApplicationThread = nullptr;
+	sDataRequiredToRenderAFrame* s_dataBeingRenderedByRenderThread = nullptr;
+	// The packets are never accessed by both threads at the same time,
+	// and which thread owns which packet is decided by these counters alone
+	// (a counter's packet is at the index of the counter modulo the number of packets):
+	//	* The application thread is the only thread that changes the submitted count
+	//	* The render thread is the only thread that changes the released count
+	// Neither thread needs a lock because each only reads the other's counter
+	std::atomic<uint64_t> s_submittedFrameCount( 0 );
+	std::atomic<uint64_t> s_releasedFrameCount( 0 );
+	std::atomic<eae6320::Graphics::eFramePipelineMode> s_framePipelineMode( eae6320::Graphics::eFramePipelineMode::Throughput );
+	// The following two events are only used to put a thread to sleep when it can't make progress
+	// (the counters above are always checked first, and again after waking up):
 	// This event is signaled by the application loop thread when it has finished submitting render data for a frame
-	// (the main/render thread waits for the signal)
+	// (the main/render thread waits for the signal when there is no submitted frame to render)
 	eae6320::Concurrency::cEvent s_whenAllDataHasBeenSubmittedFromApplicationThread;
-	// This event is signaled by the main/render thread when it has swapped render data pointers.
-	// This means that the renderer is now working with all the submitted data it needs to render the next frame,
-	// and the application loop thread can start submitting data for the following frame
-	// (the application loop thread waits for the signal)
+	// This event is signaled by the main/render thread when it has finished with a frame packet
+	// and the packet can be re-used by the application loop thread to submit a new frame
+	// (the application loop thread waits for the signal when every packet is in use)
 	eae6320::Concurrency::cEvent s_whenDataForANewFrameCanBeSubmittedFromApplicationThread;
 
 	cView view;
 
+	// Command Recording
+	//------------------
+
+	// These are only used by the application thread
+	// to find a resource's index in the resource tables of the frame being submitted
+	// (they are reset whenever a new frame packet is started,
+	// and an index is also the resource's ID in the sort keys)
+	eae6320::Graphics::RenderSorting::cIdAssigner s_effectIndices;
+	eae6320::Graphics::RenderSorting::cIdAssigner s_textureIndices;
+	eae6320::Graphics::RenderSorting::cIdAssigner s_meshIndices;
+	eae6320::Graphics::RenderSorting::cIdAssigner s_spriteIndices;
+
+	// The statistics are written by the render thread and can be read by any thread
+	eae6320::Graphics::sRenderStatistics s_renderStatistics_lastFrame;
+	eae6320::Concurrency::cMutex s_renderStatisticsMutex;
+
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Returns the resource's index in the table
+	// (adding it to the table and pinning it if this is the first time it has been seen this frame),
+	// or InvalidResourceIndex if the table is full
+	template <typename tResource>
+	eae6320::Graphics::RenderCommands::tResourceIndex GetResourceIndex( tResource* const i_resource,
+		eae6320::Graphics::RenderSorting::cIdAssigner& io_indices, eae6320::Graphics::cFrameArray<tResource*>& io_table );
+	// Releases the frame's pinned resources and clears the frame's lists
+	// (this must be done before the frame's arena is reset)
+	void ReleaseRecordedCommands( sDataRequiredToRenderAFrame& io_frameData );
 }
 
 // Submission
@@ -91,7 +178,6 @@ void eae6320::Graphics::SubmitElapsedTime(const float i_elapsedSecondCount_syste
 {
 	EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
 	auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
-	//auto& constantData_perDraw = s_dataBeingSubmittedByApplicationThread->constantData_perDraw;
 
 	constantData_perFrame.g_elapsedSecondCount_systemTime = i_elapsedSecondCount_systemTime;
 	constantData_perFrame.g_elapsedSecondCount_simulationTime = i_elapsedSecondCount_simulationTime;
@@ -107,32 +193,57 @@ void eae6320::Graphics::SubmitBackgroundColor(const float r, const float g, cons
 }
 void eae6320::Graphics::SubmitEffectAndSprite(eae6320::Graphics::renderData data)
 {
-	data.effect->IncrementReferenceCount();
-	data.sprite->IncrementReferenceCount();
-	data.texture->IncrementReferenceCount();
-	
-	s_dataBeingSubmittedByApplicationThread->renderDataVec.push_back(data);
+	EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+	auto& frameData = *s_dataBeingSubmittedByApplicationThread;
+
+	RenderCommands::sDrawSprite command;
+	command.effectIndex = GetResourceIndex(data.effect, s_effectIndices, frameData.effects);
+	command.textureIndex = GetResourceIndex(data.texture, s_textureIndices, frameData.textures);
+	command.spriteIndex = GetResourceIndex(data.sprite, s_spriteIndices, frameData.sprites);
+	if ((command.effectIndex == RenderCommands::InvalidResourceIndex) || (command.textureIndex == RenderCommands::InvalidResourceIndex)
+		|| (command.spriteIndex == RenderCommands::InvalidResourceIndex)) {
+		Logging::OutputError("A sprite wasn't submitted because too many unique resources have been submitted this frame"
+			" (or there wasn't enough memory to record them)");
+		return;
+	}
+
+	if (!frameData.spriteCommands.push_back(command)) {
+		Logging::OutputError("A sprite wasn't submitted because there wasn't enough memory to record it");
+	}
 }
 
 void eae6320::Graphics::SubmitEffectAndMesh(eae6320::Graphics::meshData & data, eae6320::Physics::sRigidBodyState & rigidBodyState)
 {
 	EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
-	auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
-
-	data.effect->IncrementReferenceCount();
-	data.mesh->IncrementReferenceCount();
-	data.texture->IncrementReferenceCount();
-
-	data.rigidBodyState.orientation = rigidBodyState.PredictFutureOrientation(constantData_perFrame.g_elapsedSecondCount_simulationTime);
-	data.rigidBodyState.position = rigidBodyState.PredictFuturePosition(constantData_perFrame.g_elapsedSecondCount_simulationTime);
+	auto& frameData = *s_dataBeingSubmittedByApplicationThread;
+	const auto& constantData_perFrame = frameData.constantData_perFrame;
+
+	RenderCommands::sDrawMesh command;
+	command.effectIndex = GetResourceIndex(data.effect, s_effectIndices, frameData.effects);
+	command.textureIndex = GetResourceIndex(data.texture, s_textureIndices, frameData.textures);
+	command.meshIndex = GetResourceIndex(data.mesh, s_meshIndices, frameData.meshes);
+	if ((command.effectIndex == RenderCommands::InvalidResourceIndex) || (command.textureIndex == RenderCommands::InvalidResourceIndex)
+		|| (command.meshIndex == RenderCommands::InvalidResourceIndex)) {
+		Logging::OutputError("A mesh wasn't submitted because too many unique resources have been submitted this frame"
+			" (or there wasn't enough memory to record them)");
+		return;
+	}
 
-	// for translucent meshes
-	if (data.effect->s_renderState.IsAlphaTransparencyEnabled()) {
-		s_dataBeingSubmittedByApplicationThread->meshTranslucentDataVec.push_back(data);
+	command.pass = data.effect->s_renderState.IsAlphaTransparencyEnabled() ?
+		RenderSorting::ePass::Translucent : RenderSorting::ePass::Opaque;
+
+	// The transform is calculated once here
+	// rather than every time the render thread needs it
+	// (a command is only recorded if its transform is, so that they always have the same index)
+	if (!frameData.meshTransforms.Add(Math::cMatrix_transformation(
+		rigidBodyState.PredictFutureOrientation(constantData_perFrame.g_elapsedSecondCount_simulationTime),
+		rigidBodyState.PredictFuturePosition(constantData_perFrame.g_elapsedSecondCount_simulationTime)))) {
+		Logging::OutputError("A mesh wasn't submitted because there wasn't enough memory to record it");
+		return;
 	}
-	// for opaque meshes
-	else {
-		s_dataBeingSubmittedByApplicationThread->meshDataVec.push_back(data);
+	if (!frameData.meshCommands.push_back(command)) {
+		frameData.meshTransforms.pop_back();
+		Logging::OutputError("A mesh wasn't submitted because there wasn't enough memory to record it");
 	}
 }
 
@@ -164,48 +275,104 @@ void eae6320::Graphics::SubmitCamera(eae6320::Graphics::cCamera & camera) {
 
 eae6320::cResult eae6320::Graphics::WaitUntilDataForANewFrameCanBeSubmitted(const unsigned int i_timeToWait_inMilliseconds)
 {
-	return Concurrency::WaitForEvent(s_whenDataForANewFrameCanBeSubmittedFromApplicationThread, i_timeToWait_inMilliseconds);
+	EAE6320_ASSERT(s_framePackets);
+
+	const auto framePacketCount = static_cast<uint64_t>(s_framePacketCount);
+	// Only the application thread changes the submitted count
+	const auto submittedFrameCount = s_submittedFrameCount.load(std::memory_order_relaxed);
+	const auto canANewFrameBeSubmitted = [framePacketCount, submittedFrameCount]()
+	{
+		// In latency mode only two packets are used (one being submitted and one being rendered)
+		const auto usablePacketCount = (s_framePipelineMode.load(std::memory_order_relaxed) == eFramePipelineMode::Latency) ?
+			std::min(framePacketCount, uint64_t(2)) : framePacketCount;
+		// Acquiring the released count guarantees that the render thread has completely finished with the packet
+		return (submittedFrameCount - s_releasedFrameCount.load(std::memory_order_acquire)) < usablePacketCount;
+	};
+
+	uint64_t tickCount_stall = 0;
+	if (!canANewFrameBeSubmitted())
+	{
+		const auto tickCount_waitStart = Time::GetCurrentSystemTimeTickCount();
+		do
+		{
+			const auto result = Concurrency::WaitForEvent(s_whenDataForANewFrameCanBeSubmittedFromApplicationThread, i_timeToWait_inMilliseconds);
+			if (!result)
+			{
+				return result;
+			}
+		} while (!canANewFrameBeSubmitted());
+		tickCount_stall = Time::GetCurrentSystemTimeTickCount() - tickCount_waitStart;
+	}
+
+	s_dataBeingSubmittedByApplicationThread = &s_framePackets[static_cast<size_t>(submittedFrameCount % framePacketCount)];
+	s_dataBeingSubmittedByApplicationThread->tickCount_applicationThreadStall = tickCount_stall;
+	// The new packet's resource tables are empty
+	s_effectIndices.Reset();
+	s_textureIndices.Reset();
+	s_meshIndices.Reset();
+	s_spriteIndices.Reset();
+	return Results::Success;
 }
 
 eae6320::cResult eae6320::Graphics::SignalThatAllDataForAFrameHasBeenSubmitted()
 {
+	EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+	s_dataBeingSubmittedByApplicationThread = nullptr;
+	// Releasing the submitted count guarantees that all of the submitted data is visible to the render thread
+	s_submittedFrameCount.fetch_add(1, std::memory_order_release);
 	return s_whenAllDataHasBeenSubmittedFromApplicationThread.Signal();
 }
 
+void eae6320::Graphics::SetFramePipelineMode(const eFramePipelineMode i_mode)
+{
+	s_framePipelineMode.store(i_mode, std::memory_order_relaxed);
+	// If the application is waiting it should re-check whether it can submit
+	s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.Signal();
+}
+
+eae6320::Graphics::eFramePipelineMode eae6320::Graphics::GetFramePipelineMode()
+{
+	return s_framePipelineMode.load(std::memory_order_relaxed);
+}
+
 // Render
 //-------
 
 void eae6320::Graphics::RenderFrame()
 {
+	sRenderStatistics statistics;
+
 	// Wait for the application loop to submit data to be rendered
+	// (the oldest submitted frame that hasn't been rendered yet)
 	{
-		const auto result = Concurrency::WaitForEvent(s_whenAllDataHasBeenSubmittedFromApplicationThread);
-		if (result)
+		// Only the render thread changes the released count
+		const auto releasedFrameCount = s_releasedFrameCount.load(std::memory_order_relaxed);
+		// Acquiring the submitted count guarantees that all of the submitted data is visible
+		auto submittedFrameCount = s_submittedFrameCount.load(std::memory_order_acquire);
+		if (submittedFrameCount == releasedFrameCount)
 		{
-			// Switch the render data pointers so that
-			// the data that the application just submitted becomes the data that will now be rendered
-			std::swap(s_dataBeingSubmittedByApplicationThread, s_dataBeingRenderedByRenderThread);
-			// Once the pointers have been swapped the application loop can submit new data
-			const auto result = s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.Signal();
-			if (!result)
+			const auto tickCount_waitStart = Time::GetCurrentSystemTimeTickCount();
+			do
 			{
-				EAE6320_ASSERTF(false, "Couldn't signal that new graphics data can be submitted");
-				Logging::OutputError("Failed to signal that new render data can be submitted");
-				UserOutput::Print("The renderer failed to signal to the application that new graphics data can be submitted."
-					" The application is probably in a bad state and should be exited");
-				return;
-			}
-		}
-		else
-		{
-			EAE6320_ASSERTF(false, "Waiting for the graphics data to be submitted failed");
-			Logging::OutputError("Waiting for the application loop to submit data to be rendered failed");
-			UserOutput::Print("The renderer failed to wait for the application to submit data to be rendered."
-				" The application is probably in a bad state and should be exited");
-			return;
+				const auto result = Concurrency::WaitForEvent(s_whenAllDataHasBeenSubmittedFromApplicationThread);
+				if (!result)
+				{
+					EAE6320_ASSERTF(false, "Waiting for the graphics data to be submitted failed");
+					Logging::OutputError("Waiting for the application loop to submit data to be rendered failed");
+					UserOutput::Print("The renderer failed to wait for the application to submit data to be rendered."
+						" The application is probably in a bad state and should be exited");
+					return;
+				}
+				submittedFrameCount = s_submittedFrameCount.load(std::memory_order_acquire);
+			} while (submittedFrameCount == releasedFrameCount);
+			statistics.renderThreadStallSecondCount = static_cast<float>(
+				Time::ConvertTicksToSeconds(Time::GetCurrentSystemTimeTickCount() - tickCount_waitStart));
 		}
+		s_dataBeingRenderedByRenderThread = &s_framePackets[static_cast<size_t>(releasedFrameCount % s_framePacketCount)];
+		statistics.queuedFrameCount = static_cast<uint32_t>(submittedFrameCount - releasedFrameCount);
+		statistics.applicationThreadStallSecondCount = static_cast<float>(
+			Time::ConvertTicksToSeconds(s_dataBeingRenderedByRenderThread->tickCount_applicationThreadStall));
 	}
-	
 
 	EAE6320_ASSERT(s_dataBeingRenderedByRenderThread);
 
@@ -222,81 +389,217 @@ void eae6320::Graphics::RenderFrame()
 		s_constantBuffer_perFrame.Update(&constantData_perFrame);
 	}
 
-	// draw all the opaque meshes first
-	for (auto data : s_dataBeingRenderedByRenderThread->meshDataVec) {
+	// The render thread's scratch memory for this frame comes from the frame's arena
+	// (it is released along with the submitted data when the frame packet is reset)
+	auto& frameArena = s_dataBeingRenderedByRenderThread->frameArena;
+	cFrameArray<RenderSorting::sDrawKey> drawKeys;
+	cFrameArray<RenderSorting::sDrawKey> drawKeys_scratch;
+	// The instances are stored in the same order as the sorted keys
+	cFrameArray<VertexFormats::sMeshInstance> meshInstances;
+	drawKeys.SetArena(frameArena);
+	drawKeys_scratch.SetArena(frameArena);
+	meshInstances.SetArena(frameArena);
+
+	auto& frameData = *s_dataBeingRenderedByRenderThread;
+
+	// Cull the recorded meshes that can't be seen
+	// and sort the rest so that draw calls sharing state are drawn together
+	// (all of the memory that this needs is allocated first,
+	// and if there isn't enough then nothing is drawn this frame)
+	cFrameArray<float> cameraSpaceZs;
+	cameraSpaceZs.SetArena(frameArena);
+	const auto meshCommandCount = frameData.meshCommands.size();
+	if (!cameraSpaceZs.resize(meshCommandCount) || !drawKeys.resize(meshCommandCount) || !drawKeys_scratch.resize(meshCommandCount))
+	{
+		EAE6320_ASSERTF(false, "Couldn't allocate the memory to sort the draw calls");
+		Logging::OutputError("There wasn't enough memory to sort the draw calls; no meshes will be drawn this frame");
+		drawKeys.clear();
+	}
+	else
+	{
+		const auto& transform_worldToCamera = frameData.constantData_perFrame.g_transform_worldToCamera;
+		const auto frustum = Culling::CreateFrustum(transform_worldToCamera, frameData.constantData_perFrame.g_transform_cameraToProjected);
 
-		auto& constantData_perDraw = s_dataBeingRenderedByRenderThread->constantData_perDraw;
+		const auto& meshCommands = frameData.meshCommands;
+		const auto& meshTransforms = frameData.meshTransforms;
+		EAE6320_ASSERT(meshTransforms.size() == meshCommands.size());
 
-		constantData_perDraw.g_transform_localToWorld = eae6320::Math::cMatrix_transformation(
-			data.rigidBodyState.orientation, data.rigidBodyState.position);
+		// Only the Z of each object's position in camera space is needed,
+		// which is the dot product of the position with the third row of the world-to-camera transform
+		// (the positions are stored as separate arrays so that this loop only reads the data it needs)
+		{
+			const auto row_x = transform_worldToCamera.GetElement(2, 0);
+			const auto row_y = transform_worldToCamera.GetElement(2, 1);
+			const auto row_z = transform_worldToCamera.GetElement(2, 2);
+			const auto row_w = transform_worldToCamera.GetElement(2, 3);
+			const auto* const position_x = meshTransforms.position_x.begin();
+			const auto* const position_y = meshTransforms.position_y.begin();
+			const auto* const position_z = meshTransforms.position_z.begin();
+			auto* const cameraSpaceZ = cameraSpaceZs.data();
+			for (size_t i = 0; i < cameraSpaceZs.size(); i++) {
+				cameraSpaceZ[i] = (row_x * position_x[i]) + (row_y * position_y[i]) + (row_z * position_z[i]) + row_w;
+			}
+		}
 
-		s_constantBuffer_perDraw.Update(&constantData_perDraw);
+		size_t keyIndex = 0;
+		for (size_t i = 0; i < meshCommands.size(); i++) {
+			const auto& command = meshCommands[i];
+			// Meshes that are completely outside of the view frustum don't get a key and so are never bound or drawn
+			if (!Culling::IsVisible(frustum, meshTransforms.localToWorld[i], frameData.meshes[command.meshIndex]->m_bounds)) {
+				++statistics.culledMeshCount;
+				continue;
+			}
+			auto& drawKey = drawKeys[keyIndex++];
+			// The resource indices are unique within the frame and so they can be used as the IDs
+			// (the quantized depth is also in the key, and so sorting the keys orders translucent draw calls back-to-front)
+			drawKey.value = RenderSorting::CreateKey(command.pass,
+				command.effectIndex, command.textureIndex, command.meshIndex, cameraSpaceZs[i]);
+			drawKey.drawIndex = static_cast<uint32_t>(i);
+		}
+		const auto drawCount = keyIndex;
+		// Shrinking can't fail
+		drawKeys.resize(drawCount);
+		drawKeys_scratch.resize(drawCount);
+		statistics.visibleMeshCount = static_cast<uint32_t>(drawCount);
 
-		data.effect->Bind();
-		data.texture->Bind(0);
-		data.mesh->DrawMesh();
+		RenderSorting::RadixSort(drawKeys.data(), drawKeys_scratch.data(), drawCount);
 	}
-	
-	// sort the for all translucent meshes
-	std::vector<std::pair<float, size_t>> translucentVecToSort;
-	for (size_t i = 0; i < s_dataBeingRenderedByRenderThread->meshTranslucentDataVec.size(); i++) {
-		auto& constantData_perDraw = s_dataBeingRenderedByRenderThread->constantData_perDraw;
-		auto& constantData_perFrame = s_dataBeingRenderedByRenderThread->constantData_perFrame;
-
-		auto& data = s_dataBeingRenderedByRenderThread->meshTranslucentDataVec[i];
 
-		constantData_perDraw.g_transform_localToWorld = eae6320::Math::cMatrix_transformation(
-			data.rigidBodyState.orientation, data.rigidBodyState.position);
-
-		auto dataCameraSpaceTransform = constantData_perFrame.g_transform_worldToCamera * constantData_perDraw.g_transform_localToWorld;
-		float dataZPosition = dataCameraSpaceTransform.GetTranslation().z;
-		translucentVecToSort.push_back(std::make_pair(dataZPosition, i));
+	// Copy every mesh's transform to the GPU at once (in sorted order)
+	// so that meshes with the same state can be drawn as a range of instances
+	// (the instances are written to the next free range of the instance buffer's ring,
+	// and every draw call offsets its first instance by where that range starts)
+	size_t firstInstanceInBuffer = 0;
+	{
+		auto result = meshInstances.resize(drawKeys.size());
+		if (result)
+		{
+			for (size_t i = 0; i < drawKeys.size(); i++) {
+				meshInstances[i].transform_localToWorld = frameData.meshTransforms.localToWorld[drawKeys[i].drawIndex];
+			}
+			result = s_instanceBuffer.Update(meshInstances.data(), meshInstances.size(), firstInstanceInBuffer);
+		}
+		if (result)
+		{
+			if (!meshInstances.empty()) {
+				statistics.instanceBufferUpdateCount = 1;
+				statistics.instanceBufferUploadByteCount = static_cast<uint32_t>(meshInstances.size() * sizeof(VertexFormats::sMeshInstance));
+			}
+		}
+		else
+		{
+			EAE6320_ASSERTF(false, "Couldn't update the instance buffer");
+			Logging::OutputError("The mesh instances couldn't be copied to the instance buffer; no meshes will be drawn this frame");
+			drawKeys.clear();
+		}
 	}
 
-	std::sort(translucentVecToSort.begin(), translucentVecToSort.end());
-
-	for (size_t i = 0; i < translucentVecToSort.size(); i++) {
-		auto& data = s_dataBeingRenderedByRenderThread->meshTranslucentDataVec[translucentVecToSort[i].second];
-
-		auto& constantData_perDraw = s_dataBeingRenderedByRenderThread->constantData_perDraw;
-
-		constantData_perDraw.g_transform_localToWorld = eae6320::Math::cMatrix_transformation(
-			data.rigidBodyState.orientation, data.rigidBodyState.position);
-
-		s_constantBuffer_perDraw.Update(&constantData_perDraw);
+	// Draw the meshes in sorted order, only binding state that is different from what is already bound
+	auto boundEffectIndex = RenderCommands::InvalidResourceIndex;
+	auto boundTextureIndex = RenderCommands::InvalidResourceIndex;
+	auto boundMeshIndex = RenderCommands::InvalidResourceIndex;
+	for (size_t firstInstance = 0; firstInstance < drawKeys.size(); ) {
+		const auto& command = frameData.meshCommands[drawKeys[firstInstance].drawIndex];
+		// Resource indices are never shared within a frame,
+		// and so keys with the same state always refer to the same resources
+		const auto instanceCount = RenderSorting::GetInstanceRunLength(&drawKeys[firstInstance], drawKeys.size() - firstInstance);
+
+		if (command.effectIndex != boundEffectIndex) {
+			frameData.effects[command.effectIndex]->Bind();
+			boundEffectIndex = command.effectIndex;
+			++statistics.effectBindCount;
+		}
+		else {
+			++statistics.effectBindsAvoided;
+		}
+		if (command.textureIndex != boundTextureIndex) {
+			frameData.textures[command.textureIndex]->Bind(0);
+			boundTextureIndex = command.textureIndex;
+			++statistics.textureBindCount;
+		}
+		else {
+			++statistics.textureBindsAvoided;
+		}
+		auto* const mesh = frameData.meshes[command.meshIndex];
+		if (command.meshIndex != boundMeshIndex) {
+			mesh->Bind();
+			// In OpenGL the instance attributes are part of the mesh's vertex array
+			s_instanceBuffer.Bind();
+			boundMeshIndex = command.meshIndex;
+			++statistics.meshBindCount;
+		}
+		else {
+			++statistics.meshBindsAvoided;
+		}
+		mesh->DrawMesh(static_cast<unsigned int>(instanceCount), static_cast<unsigned int>(firstInstanceInBuffer + firstInstance));
+		++statistics.drawCallCount;
+		if (instanceCount > 1) {
+			++statistics.instancedDrawCallCount;
+		}
+		statistics.meshInstanceCount += static_cast<uint32_t>(instanceCount);
+		// Every instance after the first avoids a draw call and its binds
+		statistics.effectBindsAvoided += static_cast<uint32_t>(instanceCount - 1);
+		statistics.textureBindsAvoided += static_cast<uint32_t>(instanceCount - 1);
+		statistics.meshBindsAvoided += static_cast<uint32_t>(instanceCount - 1);
 
-		data.effect->Bind();
-		data.texture->Bind(0);
-		data.mesh->DrawMesh();
+		firstInstance += instanceCount;
 	}
-
-	for (auto data : s_dataBeingRenderedByRenderThread->renderDataVec) {
-		data.effect->Bind();
-		data.texture->Bind(0);
-		data.sprite->Draw();
+	// Every draw call that reads this frame's instances has been made
+	s_instanceBuffer.FenceLastUpdate();
+
+	for (const auto& command : frameData.spriteCommands) {
+		frameData.effects[command.effectIndex]->Bind();
+		frameData.textures[command.textureIndex]->Bind(0);
+		frameData.sprites[command.spriteIndex]->Draw();
+		++statistics.effectBindCount;
+		++statistics.textureBindCount;
+		++statistics.drawCallCount;
 	}
 	view.Buffer();
+
+	statistics.pinnedResourceCount = static_cast<uint32_t>(frameData.effects.size() + frameData.textures.size()
+		+ frameData.meshes.size() + frameData.sprites.size());
+	statistics.frameArenaByteCount = static_cast<uint32_t>(frameArena.GetUsedByteCount());
+	statistics.frameArenaHeapAllocationCount = static_cast<uint32_t>(frameArena.GetHeapAllocationCount());
+
+	{
+		Concurrency::cMutex::cScopeLock scopeLock(s_renderStatisticsMutex);
+		s_renderStatistics_lastFrame = statistics;
+	}
 	// Once everything has been drawn the data that was submitted for this frame
 	// should be cleaned up and cleared.
 	// so that the struct can be re-used (i.e. so that data for a new frame can be submitted to it)
 	{
-		for (auto data : s_dataBeingRenderedByRenderThread->meshDataVec) {
-			data.effect->DecrementReferenceCount();
-			data.mesh->DecrementReferenceCount();
-			data.texture->DecrementReferenceCount();
-		}
-		s_dataBeingRenderedByRenderThread->meshDataVec.clear();
-		
-		for (auto data : s_dataBeingRenderedByRenderThread->renderDataVec) {
-			data.effect->DecrementReferenceCount();
-			data.texture->DecrementReferenceCount();
-			data.sprite->DecrementReferenceCount();
+		ReleaseRecordedCommands(frameData);
+
+		// Everything that was allocated for the frame is released at once
+		// (the lists must be cleared first because their memory is about to become invalid)
+		drawKeys.clear();
+		drawKeys_scratch.clear();
+		meshInstances.clear();
+		frameArena.Reset();
+	}
+	// Once the frame packet has been cleaned up the application loop can re-use it to submit new data
+	{
+		s_dataBeingRenderedByRenderThread = nullptr;
+		s_releasedFrameCount.fetch_add(1, std::memory_order_release);
+		const auto result = s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.Signal();
+		if (!result)
+		{
+			EAE6320_ASSERTF(false, "Couldn't signal that new graphics data can be submitted");
+			Logging::OutputError("Failed to signal that new render data can be submitted");
+			UserOutput::Print("The renderer failed to signal to the application that new graphics data can be submitted."
+				" The application is probably in a bad state and should be exited");
 		}
-
-		s_dataBeingRenderedByRenderThread->renderDataVec.clear();
 	}
 }
 
+eae6320::Graphics::sRenderStatistics eae6320::Graphics::GetRenderStatisticsForLastFrame()
+{
+	Concurrency::cMutex::cScopeLock scopeLock(s_renderStatisticsMutex);
+	return s_renderStatistics_lastFrame;
+}
+
 // Initialization / Clean Up
 //--------------------------
 
@@ -321,7 +624,7 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
 
 	// Initialize the platform-independent graphics objects
 	{
-		if (result = s_constantBuffer_perFrame.Initialize())
+		if ( ( result = s_constantBuffer_perFrame.Initialize() ) )
 		{
 			// There is only a single per-frame constant buffer that is re-used
 			// and so it can be bound at initialization time and never unbound
@@ -334,7 +637,7 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
 			EAE6320_ASSERT(false);
 			goto OnExit;
 		}
-		if (result = s_samplerState.Initialize())
+		if ( ( result = s_samplerState.Initialize() ) )
 		{
 			// There is only a single sampler state that is re-used
 			// and so it can be bound at initialization time and never unbound
@@ -345,22 +648,31 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
 			EAE6320_ASSERT(false);
 			goto OnExit;
 		}
+	}
 
-		if (result = s_constantBuffer_perDraw.Initialize())
-		{
-			// There is only a single per-frame constant buffer that is re-used
-			// and so it can be bound at initialization time and never unbound
-			s_constantBuffer_perDraw.Bind(
-				// In our class both vertex and fragment shaders use per-draw constant data
-				ShaderTypes::Vertex | ShaderTypes::Fragment);
-		}
-		else
+	// Initialize the frame pipeline
+	{
+		if (i_initializationParameters.framePipelineDepth < 2)
 		{
-			EAE6320_ASSERT(false);
+			result = Results::Failure;
+			EAE6320_ASSERTF(false, "The frame pipeline must have at least two frame packets");
+			Logging::OutputError("A frame pipeline depth of %u was requested, but at least two frame packets are required",
+				i_initializationParameters.framePipelineDepth);
 			goto OnExit;
 		}
+		s_framePacketCount = i_initializationParameters.framePipelineDepth;
+		s_framePackets.reset(new sDataRequiredToRenderAFrame[s_framePacketCount]);
+		for (size_t i = 0; i < s_framePacketCount; i++) {
+			if (!(result = s_framePackets[i].frameArena.Initialize(s_frameArenaInitialCapacity)))
+			{
+				EAE6320_ASSERT(false);
+				goto OnExit;
+			}
+		}
+		s_submittedFrameCount.store(0);
+		s_releasedFrameCount.store(0);
+		s_framePipelineMode.store(i_initializationParameters.framePipelineMode);
 	}
-
 	// Initialize the events
 	{
 		if (!(result = s_whenAllDataHasBeenSubmittedFromApplicationThread.Initialize(Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled)))
@@ -368,8 +680,16 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
 			EAE6320_ASSERT(false);
 			goto OnExit;
 		}
-		if (!(result = s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.Initialize(Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled,
-			Concurrency::EventState::Signaled)))
+		if (!(result = s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.Initialize(Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled)))
+		{
+			EAE6320_ASSERT(false);
+			goto OnExit;
+		}
+	}
+
+	// Initialize the instance buffer
+	{
+		if (!(result = s_instanceBuffer.Initialize(s_initialInstanceCapacity)))
 		{
 			EAE6320_ASSERT(false);
 			goto OnExit;
@@ -399,51 +719,38 @@ eae6320::cResult eae6320::Graphics::CleanUp()
 	result = view.CleanUp();
 
 	
-	for (auto data : s_dataBeingRenderedByRenderThread->renderDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
-		data.sprite->DecrementReferenceCount();
-	}
-	s_dataBeingRenderedByRenderThread->renderDataVec.clear();
-
-	for (auto data : s_dataBeingSubmittedByApplicationThread->renderDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
-		data.sprite->DecrementReferenceCount();
-	}
-
-	s_dataBeingSubmittedByApplicationThread->renderDataVec.clear();
-
-	for (auto data : s_dataBeingRenderedByRenderThread->meshDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
-		data.mesh->DecrementReferenceCount();
+	// Any frame packet (whether it was queued, being submitted, or never used) may still hold references
+	for (size_t i = 0; i < s_framePacketCount; i++) {
+		ReleaseRecordedCommands(s_framePackets[i]);
 	}
-	s_dataBeingRenderedByRenderThread->meshDataVec.clear();
-
-	for (auto data : s_dataBeingSubmittedByApplicationThread->meshDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.mesh->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
-	}
-
-	s_dataBeingSubmittedByApplicationThread->meshDataVec.clear();
+	s_framePackets.reset();
+	s_framePacketCount = 0;
+	s_dataBeingSubmittedByApplicationThread = nullptr;
+	s_dataBeingRenderedByRenderThread = nullptr;
 
-	for (auto data : s_dataBeingRenderedByRenderThread->meshTranslucentDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
-		data.mesh->DecrementReferenceCount();
+	{
+		const auto localResult = s_whenAllDataHasBeenSubmittedFromApplicationThread.CleanUp();
+		if (!localResult)
+		{
+			EAE6320_ASSERT(false);
+			if (result)
+			{
+				result = localResult;
+			}
+		}
 	}
-	s_dataBeingRenderedByRenderThread->meshTranslucentDataVec.clear();
-
-	for (auto data : s_dataBeingSubmittedByApplicationThread->meshTranslucentDataVec) {
-		data.effect->DecrementReferenceCount();
-		data.mesh->DecrementReferenceCount();
-		data.texture->DecrementReferenceCount();
+	{
+		const auto localResult = s_whenDataForANewFrameCanBeSubmittedFromApplicationThread.CleanUp();
+		if (!localResult)
+		{
+			EAE6320_ASSERT(false);
+			if (result)
+			{
+				result = localResult;
+			}
+		}
 	}
 
-	s_dataBeingSubmittedByApplicationThread->meshTranslucentDataVec.clear();
-
 	{
 		const auto localResult = s_constantBuffer_perFrame.CleanUp();
 		if (!localResult)
@@ -457,7 +764,7 @@ eae6320::cResult eae6320::Graphics::CleanUp()
 	}
 
 	{
-		const auto localResult = s_constantBuffer_perDraw.CleanUp();
+		const auto localResult = s_instanceBuffer.CleanUp();
 		if (!localResult)
 		{
 			EAE6320_ASSERT(false);
@@ -507,3 +814,64 @@ eae6320::cResult eae6320::Graphics::CleanUp()
 	return result;
 }
 
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	template <typename tResource>
+	eae6320::Graphics::RenderCommands::tResourceIndex GetResourceIndex( tResource* const i_resource,
+		eae6320::Graphics::RenderSorting::cIdAssigner& io_indices, eae6320::Graphics::cFrameArray<tResource*>& io_table )
+	{
+		EAE6320_ASSERT( i_resource );
+		const auto index = io_indices.GetId( i_resource );
+		if ( index == eae6320::Graphics::RenderCommands::InvalidResourceIndex )
+		{
+			return index;
+		}
+		// Indices are assigned in the order that resources are first seen,
+		// and so a new resource's index is the current size of the table
+		if ( index == io_table.size() )
+		{
+			if ( !io_table.push_back( i_resource ) )
+			{
+				return eae6320::Graphics::RenderCommands::InvalidResourceIndex;
+			}
+			// The resource can't be destroyed until the frame has been rendered
+			// no matter how many commands refer to it
+			i_resource->IncrementReferenceCount();
+		}
+		else if ( index > io_table.size() )
+		{
+			// An earlier resource was assigned an index but couldn't be added to the table (because there wasn't enough memory),
+			// and so none of the indices after it are valid
+			return eae6320::Graphics::RenderCommands::InvalidResourceIndex;
+		}
+		EAE6320_ASSERT( io_table[index] == i_resource );
+		return index;
+	}
+
+	void ReleaseRecordedCommands( sDataRequiredToRenderAFrame& io_frameData )
+	{
+		io_frameData.meshCommands.clear();
+		io_frameData.meshTransforms.clear();
+		io_frameData.spriteCommands.clear();
+
+		// Every resource in a table was pinned exactly once
+		const auto releasePinnedResources = []( auto& io_table )
+		{
+			for ( auto* const resource : io_table )
+			{
+				resource->DecrementReferenceCount();
+			}
+		};
+		releasePinnedResources( io_frameData.effects );
+		releasePinnedResources( io_frameData.textures );
+		releasePinnedResources( io_frameData.meshes );
+		releasePinnedResources( io_frameData.sprites );
+		io_frameData.effects.clear();
+		io_frameData.textures.clear();
+		io_frameData.meshes.clear();
+		io_frameData.sprites.clear();
+	}
+}
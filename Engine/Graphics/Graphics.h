@@ -12,8 +12,8 @@
 
 #include <cstdint>
 #include <Engine/Results/Results.h>
-#include <Engine\Math\sVector.h>
-#include <Engine\Physics\sRigidBodyState.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Physics/sRigidBodyState.h>
 #include "cTexture.h"
 #include "cCamera.h"
 #if defined( EAE6320_PLATFORM_WINDOWS )
@@ -53,10 +53,9 @@ namespace eae6320
 
 			meshData() = default;
 			//Math::sVector pos;
-			
-			eae6320::Physics::sRigidBodyState rigidBodyState;
-;			meshData(cEffect * iEffect, cMesh * iMesh, cTexture *iTexture)
-				: effect(iEffect), mesh(iMesh), texture(iTexture) {}
+
+			meshData(cEffect * iEffect, cMesh * iMesh, cTexture *iTexture)
+				: effect(iEffect), texture(iTexture), mesh(iMesh) {}
 
 		};
 
@@ -73,12 +72,29 @@ namespace eae6320
 		// When the application is ready to submit data for a new frame
 		// it should call this before submitting anything
 		// (or, said another way, it is not safe to submit data for a new frame
-		// until this function returns successfully)
+		// until this function returns successfully).
+		// Submitted frames are queued in a ring of frame packets,
+		// and this only waits if every packet is either queued or being rendered
 		cResult WaitUntilDataForANewFrameCanBeSubmitted( const unsigned int i_timeToWait_inMilliseconds );
 		// When the application has finished submitting data for a frame
 		// it must call this function
 		cResult SignalThatAllDataForAFrameHasBeenSubmitted();
 
+		// The frame pipeline mode decides how far ahead of the render thread the application may get:
+		//	* Latency: The application can only submit one frame while another is being rendered
+		//		(this keeps the time between input and display as short as possible)
+		//	* Throughput: The application can submit frames until every packet in the ring is used
+		//		(this lets the simulation run up to N-1 frames ahead of rendering under bursty load)
+		enum class eFramePipelineMode : uint8_t
+		{
+			Latency,
+			Throughput,
+		};
+		// This can be called from any thread once the graphics system has been initialized;
+		// it takes effect the next time the application waits to submit a new frame
+		void SetFramePipelineMode( const eFramePipelineMode i_mode );
+		eFramePipelineMode GetFramePipelineMode();
+
 		// Render
 		//-------
 
@@ -87,6 +103,50 @@ namespace eae6320
 		// (i.e. as soon as SignalThatAllDataForAFrameHasBeenSubmitted() has been called)
 		void RenderFrame();
 
+		// These counters are gathered by RenderFrame() and describe the most recently rendered frame.
+		// Submitted meshes are sorted so that draw calls which share state are next to each other,
+		// and a bind is skipped whenever the state it would set is already bound
+		struct sRenderStatistics
+		{
+			uint32_t drawCallCount = 0;
+			// Submitted meshes whose bounds are completely outside of the view frustum are culled before they are sorted
+			uint32_t visibleMeshCount = 0;
+			uint32_t culledMeshCount = 0;
+			// Meshes that share an effect, texture, and mesh are drawn with a single instanced draw call
+			uint32_t meshInstanceCount = 0;
+			uint32_t instancedDrawCallCount = 0;
+			// Every mesh instance's per-draw data is written to the instance buffer's ring with a single update
+			uint32_t instanceBufferUpdateCount = 0;
+			uint32_t instanceBufferUploadByteCount = 0;
+
+			uint32_t effectBindCount = 0;
+			uint32_t effectBindsAvoided = 0;
+			uint32_t textureBindCount = 0;
+			uint32_t textureBindsAvoided = 0;
+			uint32_t meshBindCount = 0;
+			uint32_t meshBindsAvoided = 0;
+
+			// Every unique resource that a frame uses is pinned (its reference count is incremented) once when it is first submitted
+			// and released once when the frame has been rendered,
+			// rather than every submitted draw incrementing and decrementing the reference counts of its three resources
+			// (on the null platform Assets::GetReferenceCountOperationCount() counts the actual operations)
+			uint32_t pinnedResourceCount = 0;
+
+			// How long the application thread waited for a free frame packet before it could submit this frame
+			float applicationThreadStallSecondCount = 0.0f;
+			// How long the render thread waited for this frame to be submitted
+			float renderThreadStallSecondCount = 0.0f;
+			// How many submitted frames (including this one) were waiting to be rendered when this frame started rendering
+			uint32_t queuedFrameCount = 0;
+
+			// How much memory the frame used from its frame arena (for both submission and rendering)
+			uint32_t frameArenaByteCount = 0;
+			// How many times the frame's arena has allocated from the heap since initialization
+			// (this stops increasing once the amount of memory that frames need stops growing)
+			uint32_t frameArenaHeapAllocationCount = 0;
+		};
+		sRenderStatistics GetRenderStatisticsForLastFrame();
+
 		// Initialization / Clean Up
 		//--------------------------
 
@@ -100,6 +160,11 @@ namespace eae6320
 			HINSTANCE thisInstanceOfTheApplication = NULL;
 	#endif
 #endif
+			// The number of frame packets in the ring
+			// (one is being rendered while the rest can be queued by the application).
+			// Two packets is traditional double buffering.
+			unsigned int framePipelineDepth = 3;
+			eFramePipelineMode framePipelineMode = eFramePipelineMode::Throughput;
 		};
 		void SubmitEffectAndSprite(eae6320::Graphics::renderData);
 		void SubmitEffectAndMesh(eae6320::Graphics::meshData&, eae6320::Physics::sRigidBodyState&);
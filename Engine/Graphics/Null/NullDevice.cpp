@@ -0,0 +1,102 @@
+// Include Files
+//==============
+
+#include "NullDevice.h"
+
+#include <atomic>
+#include <Engine/Asserts/Asserts.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// Resources are loaded on the application thread while the render thread is drawing,
+	// and so every statistic is atomic.
+	// Nothing depends on the order of the increments and so they are all relaxed.
+	std::atomic<uint64_t> s_callCounts[eae6320::Graphics::NullDevice::ApiCalls::Count] = {};
+	std::atomic<uint64_t> s_uploadedByteCount( 0 );
+	std::atomic<uint64_t> s_drawnVertexCount( 0 );
+	std::atomic<uint64_t> s_drawnInstanceCount( 0 );
+	std::atomic<int64_t> s_liveObjectCount( 0 );
+
+	std::atomic<uint32_t> s_previousObjectId( 0 );
+}
+
+// Interface
+//==========
+
+// Access
+//-------
+
+eae6320::Graphics::NullDevice::sStatistics eae6320::Graphics::NullDevice::GetStatistics()
+{
+	sStatistics statistics;
+	for ( size_t i = 0; i < ApiCalls::Count; ++i )
+	{
+		statistics.callCounts[i] = s_callCounts[i].load( std::memory_order_relaxed );
+	}
+	statistics.uploadedByteCount = s_uploadedByteCount.load( std::memory_order_relaxed );
+	statistics.drawnVertexCount = s_drawnVertexCount.load( std::memory_order_relaxed );
+	statistics.drawnInstanceCount = s_drawnInstanceCount.load( std::memory_order_relaxed );
+	statistics.liveObjectCount = s_liveObjectCount.load( std::memory_order_relaxed );
+	return statistics;
+}
+
+void eae6320::Graphics::NullDevice::ResetStatistics()
+{
+	for ( auto& callCount : s_callCounts )
+	{
+		callCount.store( 0, std::memory_order_relaxed );
+	}
+	s_uploadedByteCount.store( 0, std::memory_order_relaxed );
+	s_drawnVertexCount.store( 0, std::memory_order_relaxed );
+	s_drawnInstanceCount.store( 0, std::memory_order_relaxed );
+	// The live object count isn't reset because the objects still exist
+}
+
+// Recording
+//----------
+
+void eae6320::Graphics::NullDevice::RecordCall( const ApiCalls::eApiCall i_call, const size_t i_uploadedByteCount )
+{
+	EAE6320_ASSERT( i_call < ApiCalls::Count );
+	s_callCounts[i_call].fetch_add( 1, std::memory_order_relaxed );
+	if ( i_uploadedByteCount > 0 )
+	{
+		s_uploadedByteCount.fetch_add( i_uploadedByteCount, std::memory_order_relaxed );
+	}
+}
+
+void eae6320::Graphics::NullDevice::RecordDraw( const ApiCalls::eApiCall i_call, const size_t i_vertexCountPerInstance, const size_t i_instanceCount )
+{
+	RecordCall( i_call );
+	s_drawnVertexCount.fetch_add( i_vertexCountPerInstance * i_instanceCount, std::memory_order_relaxed );
+	s_drawnInstanceCount.fetch_add( i_instanceCount, std::memory_order_relaxed );
+}
+
+uint32_t eae6320::Graphics::NullDevice::CreateObject( const ApiCalls::eApiCall i_call, const size_t i_uploadedByteCount )
+{
+	RecordCall( i_call, i_uploadedByteCount );
+	s_liveObjectCount.fetch_add( 1, std::memory_order_relaxed );
+	auto id = s_previousObjectId.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	if ( id == 0 )
+	{
+		// Zero means "no object" and so it is skipped if the IDs ever wrap around
+		id = s_previousObjectId.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	}
+	return id;
+}
+
+void eae6320::Graphics::NullDevice::DestroyObject( const ApiCalls::eApiCall i_call, uint32_t& io_id )
+{
+	if ( io_id != 0 )
+	{
+		RecordCall( i_call );
+		// Any other objects that are being destroyed at the same time must also be live,
+		// and so checking before decrementing can't fail for an object that was actually created
+		EAE6320_ASSERTF( s_liveObjectCount.load( std::memory_order_relaxed ) > 0, "More null device objects have been destroyed than were created" );
+		s_liveObjectCount.fetch_sub( 1, std::memory_order_relaxed );
+		io_id = 0;
+	}
+}
@@ -0,0 +1,118 @@
+/*
+	The null device is a graphics platform that doesn't have a GPU
+
+	When EAE6320_PLATFORM_NULL is defined the *.null.cpp files are compiled
+	instead of the Direct3D or OpenGL ones.
+	Nothing is drawn, but every graphics API call that would have been made is recorded
+	(along with how many bytes would have been sent to the GPU)
+	so that the whole frame path in Graphics.cpp can be run and measured headless.
+*/
+
+#ifndef EAE6320_GRAPHICS_NULL_NULLDEVICE_H
+#define EAE6320_GRAPHICS_NULL_NULLDEVICE_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+
+// API Calls
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace NullDevice
+		{
+			// These are the calls that a real platform would make to the driver
+			// (a single call here might be several calls in a real graphics API)
+			namespace ApiCalls
+			{
+				enum eApiCall : uint8_t
+				{
+					CreateBuffer,
+					DestroyBuffer,
+					UpdateBuffer,
+					BindBuffer,
+					InsertFence,
+
+					CreateShader,
+					DestroyShader,
+					CreateProgram,
+					BindProgram,
+
+					CreateTexture,
+					DestroyTexture,
+					BindTexture,
+
+					CreateSamplerState,
+					DestroySamplerState,
+					BindSamplerState,
+
+					BindRenderState,
+					BindVertexArray,
+
+					Draw,
+					DrawIndexedInstanced,
+
+					Clear,
+					Present,
+
+					Count
+				};
+			}
+		}
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace NullDevice
+		{
+			// Access
+			//-------
+
+			struct sStatistics
+			{
+				uint64_t callCounts[ApiCalls::Count] = {};
+
+				// The number of bytes that would have been copied from CPU memory to GPU memory
+				// (when resources are created and when buffers are updated)
+				uint64_t uploadedByteCount = 0;
+				// The number of vertices (for non-indexed draws) and indices (for indexed draws)
+				// that would have been read, counting every instance
+				uint64_t drawnVertexCount = 0;
+				uint64_t drawnInstanceCount = 0;
+
+				// The number of GPU objects that currently exist
+				// (this should be zero after the graphics system has been cleaned up)
+				int64_t liveObjectCount = 0;
+			};
+
+			// The statistics are accumulated from every thread since the last reset
+			sStatistics GetStatistics();
+			void ResetStatistics();
+
+			// Recording
+			//----------
+
+			// Every call can be recorded from any thread
+			void RecordCall( const ApiCalls::eApiCall i_call, const size_t i_uploadedByteCount = 0 );
+			void RecordDraw( const ApiCalls::eApiCall i_call, const size_t i_vertexCountPerInstance, const size_t i_instanceCount );
+
+			// Objects are given unique non-zero IDs
+			// so that "has this been initialized?" checks work the same way they do on the real platforms
+			uint32_t CreateObject( const ApiCalls::eApiCall i_call, const size_t i_uploadedByteCount = 0 );
+			void DestroyObject( const ApiCalls::eApiCall i_call, uint32_t& io_id );
+		}
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_NULL_NULLDEVICE_H
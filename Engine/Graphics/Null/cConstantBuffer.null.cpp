@@ -0,0 +1,49 @@
+// Include Files
+//==============
+
+#include "../cConstantBuffer.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cConstantBuffer::Bind( const uint_fast8_t ) const
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+	NullDevice::RecordCall( NullDevice::ApiCalls::BindBuffer );
+}
+
+void eae6320::Graphics::cConstantBuffer::Update( const void* const i_data )
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+	EAE6320_ASSERT( i_data );
+	NullDevice::RecordCall( NullDevice::ApiCalls::UpdateBuffer, m_size );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cConstantBuffer::CleanUp()
+{
+	NullDevice::DestroyObject( NullDevice::ApiCalls::DestroyBuffer, m_bufferId );
+	return Results::Success;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cConstantBuffer::Initialize_platformSpecific( const void* const i_initialData )
+{
+	// The initial data is only copied if there is any
+	m_bufferId = NullDevice::CreateObject( NullDevice::ApiCalls::CreateBuffer, i_initialData ? m_size : 0 );
+	return Results::Success;
+}
@@ -0,0 +1,15 @@
+#include "../cEffect.h"
+#include "NullDevice.h"
+
+eae6320::cResult cEffect::Initialize_Platform() {
+	// The shaders have already been loaded;
+	// a real platform would link them together here
+	EAE6320_ASSERT(s_vertexShader && s_fragmentShader);
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::CreateProgram);
+	return eae6320::Results::Success;
+}
+
+void cEffect::Bind_Platform() {
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::BindProgram);
+	s_renderState.Bind();
+}
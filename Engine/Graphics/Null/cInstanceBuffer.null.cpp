@@ -0,0 +1,66 @@
+// Include Files
+//==============
+
+#include "../cInstanceBuffer.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cInstanceBuffer::Bind() const
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+	NullDevice::RecordCall( NullDevice::ApiCalls::BindBuffer );
+}
+
+void eae6320::Graphics::cInstanceBuffer::FenceLastUpdate()
+{
+	if ( m_lastUpdate_instanceCount > 0 )
+	{
+		NullDevice::RecordCall( NullDevice::ApiCalls::InsertFence );
+		m_lastUpdate_instanceCount = 0;
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::CleanUp()
+{
+	NullDevice::DestroyObject( NullDevice::ApiCalls::DestroyBuffer, m_bufferId );
+	m_instanceCapacity = 0;
+	return Results::Success;
+}
+
+// Implementation
+//===============
+
+// Render
+//-------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Update_platformSpecific( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount,
+	const size_t i_firstInstance )
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+	EAE6320_ASSERT( i_instances );
+	EAE6320_ASSERT( ( i_firstInstance + i_instanceCount ) <= m_instanceCapacity );
+	// Only the instances are copied, regardless of where they are written in the ring
+	NullDevice::RecordCall( NullDevice::ApiCalls::UpdateBuffer, i_instanceCount * sizeof( VertexFormats::sMeshInstance ) );
+	return Results::Success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Initialize_platformSpecific()
+{
+	// The buffer is allocated without any initial data
+	m_bufferId = NullDevice::CreateObject( NullDevice::ApiCalls::CreateBuffer );
+	return Results::Success;
+}
@@ -0,0 +1,31 @@
+#include "../cMesh.h"
+#include "NullDevice.h"
+
+eae6320::cResult cMesh::Initialize(eae6320::Graphics::VertexFormats::sMesh *m_vertex,
+	uint16_t  *m_index) {
+	EAE6320_ASSERT(m_vertex && m_index);
+	// The vertex and index data would be copied to the GPU when the buffers are created
+	s_vertexBufferId = eae6320::Graphics::NullDevice::CreateObject(eae6320::Graphics::NullDevice::ApiCalls::CreateBuffer,
+		m_vertexCount * sizeof(eae6320::Graphics::VertexFormats::sMesh));
+	s_indexBufferId = eae6320::Graphics::NullDevice::CreateObject(eae6320::Graphics::NullDevice::ApiCalls::CreateBuffer,
+		m_indexCount * sizeof(uint16_t));
+	return eae6320::Results::Success;
+}
+
+void cMesh::Bind() {
+	EAE6320_ASSERT(s_vertexBufferId != 0 && s_indexBufferId != 0);
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::BindVertexArray);
+}
+
+void cMesh::DrawMesh(const unsigned int i_instanceCount, const unsigned int) {
+	// Every instance draws all of the indices
+	// (the first instance only changes where the instance data is read from)
+	eae6320::Graphics::NullDevice::RecordDraw(eae6320::Graphics::NullDevice::ApiCalls::DrawIndexedInstanced,
+		m_indexCount, i_instanceCount);
+}
+
+eae6320::cResult cMesh::CleanUp() {
+	eae6320::Graphics::NullDevice::DestroyObject(eae6320::Graphics::NullDevice::ApiCalls::DestroyBuffer, s_vertexBufferId);
+	eae6320::Graphics::NullDevice::DestroyObject(eae6320::Graphics::NullDevice::ApiCalls::DestroyBuffer, s_indexBufferId);
+	return eae6320::Results::Success;
+}
@@ -0,0 +1,40 @@
+// Include Files
+//==============
+
+#include "../cRenderState.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cRenderState::Bind() const
+{
+	EAE6320_ASSERTF( m_bits != 0xff, "This render state hasn't been initialized" );
+	NullDevice::RecordCall( NullDevice::ApiCalls::BindRenderState );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cRenderState::CleanUp()
+{
+	return Results::Success;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cRenderState::InitializeFromBits()
+{
+	// Like OpenGL, the null platform uses the bits directly at binding time
+	return Results::Success;
+}
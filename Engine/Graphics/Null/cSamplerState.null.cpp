@@ -0,0 +1,35 @@
+// Include Files
+//==============
+
+#include "../cSamplerState.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSamplerState::Bind() const
+{
+	EAE6320_ASSERT( m_samplerStateId != 0 );
+	NullDevice::RecordCall( NullDevice::ApiCalls::BindSamplerState );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSamplerState::Initialize()
+{
+	m_samplerStateId = NullDevice::CreateObject( NullDevice::ApiCalls::CreateSamplerState );
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Graphics::cSamplerState::CleanUp()
+{
+	NullDevice::DestroyObject( NullDevice::ApiCalls::DestroySamplerState, m_samplerStateId );
+	return Results::Success;
+}
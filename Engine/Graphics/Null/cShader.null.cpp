@@ -0,0 +1,30 @@
+// Include Files
+//==============
+
+#include "../cShader.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Platform/Platform.h>
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cShader::Initialize( const char* const, const Platform::sDataFromFile& i_loadedShader )
+{
+	EAE6320_ASSERT( ( m_type == ShaderTypes::Vertex ) || ( m_type == ShaderTypes::Fragment ) );
+	// The compiled shader is still loaded from disk so that a missing or empty shader file fails the same way it would on a real platform
+	EAE6320_ASSERT( i_loadedShader.data && ( i_loadedShader.size > 0 ) );
+	m_shaderId = NullDevice::CreateObject( NullDevice::ApiCalls::CreateShader, i_loadedShader.size );
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Graphics::cShader::CleanUp()
+{
+	NullDevice::DestroyObject( NullDevice::ApiCalls::DestroyShader, m_shaderId );
+	return Results::Success;
+}
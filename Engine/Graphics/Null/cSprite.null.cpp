@@ -0,0 +1,41 @@
+#include "../cSprite.h"
+#include "NullDevice.h"
+
+namespace {
+	// A sprite is a quad made of two triangles
+	constexpr unsigned int s_vertexCount = 6;
+}
+
+eae6320::cResult cSprite::CreateSprite(cSprite *& sprite, float p1, float p2, float p3, float p4) {
+	auto result = eae6320::Results::Success;
+	sprite = new cSprite();
+	result = sprite->Initialize(p1, p2, p3, p4);
+	if (result) {
+		goto OnExit;
+	}
+	else {
+		EAE6320_ASSERT(false);
+	}
+OnExit:
+
+	return result;
+}
+
+eae6320::cResult cSprite::Initialize(float, float, float, float) {
+	// The vertex data would be copied to the GPU when the buffer is created
+	s_vertexBufferId = eae6320::Graphics::NullDevice::CreateObject(eae6320::Graphics::NullDevice::ApiCalls::CreateBuffer,
+		s_vertexCount * sizeof(eae6320::Graphics::VertexFormats::sGeometry));
+	return eae6320::Results::Success;
+}
+
+void cSprite::Draw() {
+	EAE6320_ASSERT(s_vertexBufferId != 0);
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::BindVertexArray);
+	constexpr unsigned int instanceCount = 1;
+	eae6320::Graphics::NullDevice::RecordDraw(eae6320::Graphics::NullDevice::ApiCalls::Draw, s_vertexCount, instanceCount);
+}
+
+eae6320::cResult cSprite::CleanUp() {
+	eae6320::Graphics::NullDevice::DestroyObject(eae6320::Graphics::NullDevice::ApiCalls::DestroyBuffer, s_vertexBufferId);
+	return eae6320::Results::Success;
+}
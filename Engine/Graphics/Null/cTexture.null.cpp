@@ -0,0 +1,36 @@
+// Include Files
+//==============
+
+#include "../cTexture.h"
+
+#include "NullDevice.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cTexture::Bind( const unsigned int ) const
+{
+	EAE6320_ASSERT( m_textureId != 0 );
+	NullDevice::RecordCall( NullDevice::ApiCalls::BindTexture );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cTexture::Initialize( const char* const, const void* const i_textureData, const size_t i_textureDataSize )
+{
+	EAE6320_ASSERT( i_textureData && ( i_textureDataSize > 0 ) );
+	m_textureId = NullDevice::CreateObject( NullDevice::ApiCalls::CreateTexture, i_textureDataSize );
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Graphics::cTexture::CleanUp()
+{
+	NullDevice::DestroyObject( NullDevice::ApiCalls::DestroyTexture, m_textureId );
+	return Results::Success;
+}
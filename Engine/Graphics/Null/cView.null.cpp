@@ -0,0 +1,17 @@
+#include "../cView.h"
+#include "NullDevice.h"
+
+void cView::Clear(float, float, float, float) {
+	// Both the color and the depth buffers would be cleared
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::Clear);
+}
+
+void cView::Buffer() {
+	eae6320::Graphics::NullDevice::RecordCall(eae6320::Graphics::NullDevice::ApiCalls::Present);
+}
+
+eae6320::cResult cView::CleanUp() {
+	auto result = eae6320::Results::Success;
+
+	return result;
+}
@@ -0,0 +1,21 @@
+// Include Files
+//==============
+
+#include "../sContext.h"
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::sContext::Initialize( const sInitializationParameters& )
+{
+	// There is no device or window to create
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Graphics::sContext::CleanUp()
+{
+	return Results::Success;
+}
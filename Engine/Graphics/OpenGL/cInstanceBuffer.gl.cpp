@@ -0,0 +1,290 @@
+// Include Files
+//==============
+
+#include "../cInstanceBuffer.h"
+
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The local-to-world transform is a mat4 in GLSL,
+	// and a matrix vertex attribute takes up one location per column
+	constexpr GLuint s_firstTransformLocation = 3;
+	constexpr GLuint s_transformColumnCount = 4;
+
+	// A fence is waited on in short intervals so that a lost device can't hang the render thread forever
+	// (the timeout is in nanoseconds)
+	constexpr GLuint64 s_fenceWaitTimeout = 1000 * 1000;
+	constexpr unsigned int s_maxFenceWaitCount = 1000;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Blocks until the GPU has signaled the fence and then deletes it
+	void WaitForAndDeleteFence( const GLsync i_fence );
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cInstanceBuffer::Bind() const
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+
+	// The vertex attribute pointers are taken from whichever buffer is bound to GL_ARRAY_BUFFER
+	// and they are stored in the currently-bound vertex array
+	{
+		glBindBuffer( GL_ARRAY_BUFFER, m_bufferId );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+	constexpr auto stride = static_cast<GLsizei>( sizeof( VertexFormats::sMeshInstance ) );
+	for ( GLuint i = 0; i < s_transformColumnCount; ++i )
+	{
+		const auto vertexElementLocation = s_firstTransformLocation + i;
+		constexpr GLint elementCount = 4;
+		constexpr GLboolean notNormalized = GL_FALSE;	// The given floats should be used as-is
+		glVertexAttribPointer( vertexElementLocation, elementCount, GL_FLOAT, notNormalized, stride,
+			reinterpret_cast<GLvoid*>( offsetof( VertexFormats::sMeshInstance, transform_localToWorld ) + ( i * sizeof( float ) * 4 ) ) );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		glEnableVertexAttribArray( vertexElementLocation );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		// Advance to the next element once per instance rather than once per vertex
+		constexpr GLuint advanceOncePerInstance = 1;
+		glVertexAttribDivisor( vertexElementLocation, advanceOncePerInstance );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+}
+
+void eae6320::Graphics::cInstanceBuffer::FenceLastUpdate()
+{
+	if ( m_lastUpdate_instanceCount == 0 )
+	{
+		return;
+	}
+	if ( m_fenceCount == s_maxFenceCount )
+	{
+		// There are too many frames in flight;
+		// the oldest one must be finished before another can be fenced
+		WaitForAndDeleteFence( m_fences[0].sync );
+		std::memmove( m_fences, m_fences + 1, sizeof( m_fences[0] ) * ( m_fenceCount - 1 ) );
+		--m_fenceCount;
+	}
+	auto& fence = m_fences[m_fenceCount];
+	constexpr GLbitfield noFlags = 0;
+	fence.sync = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, noFlags );
+	if ( fence.sync )
+	{
+		fence.firstInstance = m_lastUpdate_firstInstance;
+		fence.instanceCount = m_lastUpdate_instanceCount;
+		++m_fenceCount;
+	}
+	else
+	{
+		// Without a fence there is no way to know when the range can be re-used,
+		// and so the GPU is waited on immediately
+		EAE6320_ASSERTF( false, "Couldn't create a fence for the instance buffer" );
+		Logging::OutputError( "OpenGL failed to create a fence for the instance buffer: %s",
+			reinterpret_cast<const char*>( gluErrorString( glGetError() ) ) );
+		glFinish();
+	}
+	m_lastUpdate_instanceCount = 0;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::CleanUp()
+{
+	auto result = Results::Success;
+
+	// The buffer is about to be deleted and so it doesn't matter whether the GPU has finished with it
+	for ( size_t i = 0; i < m_fenceCount; ++i )
+	{
+		glDeleteSync( m_fences[i].sync );
+		m_fences[i].sync = nullptr;
+	}
+	m_fenceCount = 0;
+	if ( m_bufferId != 0 )
+	{
+		constexpr GLsizei bufferCount = 1;
+		glDeleteBuffers( bufferCount, &m_bufferId );
+		const auto errorCode = glGetError();
+		if ( errorCode != GL_NO_ERROR )
+		{
+			result = Results::Failure;
+			EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			Logging::OutputError( "OpenGL failed to delete the instance buffer: %s",
+				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+		}
+		m_bufferId = 0;
+	}
+	m_instanceCapacity = 0;
+
+	return result;
+}
+
+// Implementation
+//===============
+
+// Render
+//-------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Update_platformSpecific( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount,
+	const size_t i_firstInstance )
+{
+	EAE6320_ASSERT( m_bufferId != 0 );
+	EAE6320_ASSERT( ( i_firstInstance + i_instanceCount ) <= m_instanceCapacity );
+
+	// The range might still be being read by a frame that the GPU hasn't finished yet
+	WaitForFences( i_firstInstance, i_instanceCount );
+
+	glBindBuffer( GL_ARRAY_BUFFER, m_bufferId );
+	EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	// Map only the range that is being written.
+	// The fences guarantee that the GPU isn't using it,
+	// and so the driver is told not to synchronize (which would stall until every previous draw call had finished)
+	constexpr auto instanceSize = sizeof( VertexFormats::sMeshInstance );
+	auto* const mappedMemory = glMapBufferRange( GL_ARRAY_BUFFER,
+		static_cast<GLintptr>( i_firstInstance * instanceSize ), static_cast<GLsizeiptr>( i_instanceCount * instanceSize ),
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+	if ( !mappedMemory )
+	{
+		const auto errorCode = glGetError();
+		EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+		Logging::OutputError( "OpenGL failed to map the instance buffer: %s",
+			reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+		return Results::Failure;
+	}
+	std::memcpy( mappedMemory, i_instances, i_instanceCount * instanceSize );
+	// The contents of a buffer can be lost (e.g. if the display mode changes) while it is mapped
+	if ( glUnmapBuffer( GL_ARRAY_BUFFER ) == GL_FALSE )
+	{
+		EAE6320_ASSERTF( false, "The instance buffer's contents were lost while it was mapped" );
+		Logging::OutputError( "OpenGL lost the contents of the instance buffer while it was mapped" );
+		return Results::Failure;
+	}
+
+	return Results::Success;
+}
+
+void eae6320::Graphics::cInstanceBuffer::WaitForFences( const size_t i_firstInstance, const size_t i_instanceCount )
+{
+	// Find the newest fence that overlaps the range
+	// (the GPU finishes commands in order, and so once it has been signaled every older fence has been too)
+	size_t fenceToWaitForCount = 0;
+	for ( size_t i = 0; i < m_fenceCount; ++i )
+	{
+		const auto& fence = m_fences[i];
+		const auto doRangesOverlap = ( i_firstInstance < ( fence.firstInstance + fence.instanceCount ) )
+			&& ( fence.firstInstance < ( i_firstInstance + i_instanceCount ) );
+		if ( doRangesOverlap )
+		{
+			fenceToWaitForCount = i + 1;
+		}
+	}
+	if ( fenceToWaitForCount > 0 )
+	{
+		WaitForAndDeleteFence( m_fences[fenceToWaitForCount - 1].sync );
+		for ( size_t i = 0; i < ( fenceToWaitForCount - 1 ); ++i )
+		{
+			glDeleteSync( m_fences[i].sync );
+		}
+		m_fenceCount -= fenceToWaitForCount;
+		std::memmove( m_fences, m_fences + fenceToWaitForCount, sizeof( m_fences[0] ) * m_fenceCount );
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Initialize_platformSpecific()
+{
+	auto result = Results::Success;
+
+	// Create a vertex buffer object and make it active
+	{
+		constexpr GLsizei bufferCount = 1;
+		glGenBuffers( bufferCount, &m_bufferId );
+		const auto errorCode = glGetError();
+		if ( errorCode == GL_NO_ERROR )
+		{
+			glBindBuffer( GL_ARRAY_BUFFER, m_bufferId );
+			const auto errorCode = glGetError();
+			if ( errorCode != GL_NO_ERROR )
+			{
+				result = Results::Failure;
+				EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+				Logging::OutputError( "OpenGL failed to bind the new instance buffer %u: %s",
+					m_bufferId, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+				goto OnExit;
+			}
+		}
+		else
+		{
+			result = Results::Failure;
+			EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			Logging::OutputError( "OpenGL failed to get an unused instance buffer ID: %s",
+				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			goto OnExit;
+		}
+	}
+	// Allocate space
+	{
+		constexpr GLenum usage = GL_STREAM_DRAW;	// Parts of the buffer will be re-written every frame and used to draw
+		glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>( m_instanceCapacity * sizeof( VertexFormats::sMeshInstance ) ),
+			nullptr, usage );
+		const auto errorCode = glGetError();
+		if ( errorCode != GL_NO_ERROR )
+		{
+			result = Results::Failure;
+			EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			Logging::OutputError( "OpenGL failed to allocate the new instance buffer %u: %s",
+				m_bufferId, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			goto OnExit;
+		}
+	}
+
+OnExit:
+
+	return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void WaitForAndDeleteFence( const GLsync i_fence )
+	{
+		// The first wait makes sure that the fence has actually been sent to the GPU
+		GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		for ( unsigned int i = 0; i < s_maxFenceWaitCount; ++i )
+		{
+			const auto waitResult = glClientWaitSync( i_fence, flags, s_fenceWaitTimeout );
+			if ( ( waitResult == GL_ALREADY_SIGNALED ) || ( waitResult == GL_CONDITION_SATISFIED ) )
+			{
+				break;
+			}
+			else if ( waitResult == GL_WAIT_FAILED )
+			{
+				EAE6320_ASSERTF( false, "Waiting for an instance buffer fence failed" );
+				eae6320::Logging::OutputError( "OpenGL failed to wait for an instance buffer fence: %s",
+					reinterpret_cast<const char*>( gluErrorString( glGetError() ) ) );
+				break;
+			}
+			flags = 0;
+		}
+		glDeleteSync( i_fence );
+	}
+}
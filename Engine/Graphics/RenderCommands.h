@@ -0,0 +1,94 @@
+/*
+	This file declares the commands that the application thread records for a frame
+	and that the render thread replays
+
+	Every command is a small fixed-size struct of plain data:
+		* Anything that can be calculated when the draw is submitted (like the local-to-world transform)
+			is calculated once on the application thread rather than every time the command is read
+		* Resources are referred to by an index into the frame's resource tables rather than by a pointer,
+			and the same index is used as the resource's ID in the draw's sort key
+		* A mesh command's transform isn't stored in the command itself
+			but in the frame's transform arrays (at the same index as the command; see sMeshTransforms),
+			so that the render thread's per-draw passes only read the data they need
+
+	Because the commands don't contain pointers a frame's command lists can be copied as raw memory
+	(e.g. to capture a frame and replay it later);
+	only the resource tables need to be resolved again.
+*/
+
+#ifndef EAE6320_GRAPHICS_RENDERCOMMANDS_H
+#define EAE6320_GRAPHICS_RENDERCOMMANDS_H
+
+// Include Files
+//==============
+
+#include "cFrameArena.h"
+#include "RenderSorting.h"
+
+#include <cstdint>
+#include <type_traits>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Results/Results.h>
+
+// Command Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace RenderCommands
+		{
+			// An index into one of a frame's resource tables
+			// (the tables can't be bigger than the number of IDs that a sort key can hold)
+			using tResourceIndex = uint16_t;
+			constexpr tResourceIndex InvalidResourceIndex = RenderSorting::cIdAssigner::InvalidId;
+
+			struct sDrawMesh
+			{
+				tResourceIndex effectIndex;
+				tResourceIndex textureIndex;
+				tResourceIndex meshIndex;
+				// This is decided when the command is recorded (from the effect's render state)
+				RenderSorting::ePass pass;
+			};
+
+			struct sDrawSprite
+			{
+				tResourceIndex effectIndex;
+				tResourceIndex textureIndex;
+				tResourceIndex spriteIndex;
+			};
+
+			static_assert( std::is_trivially_copyable<sDrawMesh>::value, "Render commands must be plain data" );
+			static_assert( std::is_trivially_copyable<sDrawSprite>::value, "Render commands must be plain data" );
+
+			// The transforms of a frame's mesh commands are stored as a structure of arrays
+			// (element i of every array belongs to mesh command i):
+			//	* The full local-to-world transforms are only read for culling and when the instances are copied
+			//	* The positions are also stored as separate X, Y, and Z arrays
+			//		so that every draw's camera-space depth can be calculated in a single tight loop
+			// The transforms are predicted for the time that the frame will be rendered
+			struct sMeshTransforms
+			{
+				cFrameArray<Math::cMatrix_transformation> localToWorld;
+				cFrameArray<float> position_x;
+				cFrameArray<float> position_y;
+				cFrameArray<float> position_z;
+
+				// If any of the arrays can't grow then nothing is added
+				// (every array always has the same number of elements)
+				cResult Add( const Math::cMatrix_transformation& i_transform_localToWorld );
+				void pop_back();
+				size_t size() const { return localToWorld.size(); }
+
+				void SetArena( cFrameArena& io_arena );
+				void clear();
+			};
+		}
+	}
+}
+
+#include "RenderCommands.inl"
+
+#endif	// EAE6320_GRAPHICS_RENDERCOMMANDS_H
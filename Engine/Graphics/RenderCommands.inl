@@ -0,0 +1,69 @@
+#ifndef EAE6320_GRAPHICS_RENDERCOMMANDS_INL
+#define EAE6320_GRAPHICS_RENDERCOMMANDS_INL
+
+// Include Files
+//==============
+
+#include "RenderCommands.h"
+
+// Interface
+//==========
+
+// sMeshTransforms
+//----------------
+
+inline eae6320::cResult eae6320::Graphics::RenderCommands::sMeshTransforms::Add( const Math::cMatrix_transformation& i_transform_localToWorld )
+{
+	const auto& position = i_transform_localToWorld.GetTranslation();
+	auto result = localToWorld.push_back( i_transform_localToWorld );
+	if ( !result )
+	{
+		return result;
+	}
+	// Any array that has already grown is shrunk back if a later one can't
+	if ( !( result = position_x.push_back( position.x ) ) )
+	{
+		localToWorld.pop_back();
+		return result;
+	}
+	if ( !( result = position_y.push_back( position.y ) ) )
+	{
+		localToWorld.pop_back();
+		position_x.pop_back();
+		return result;
+	}
+	if ( !( result = position_z.push_back( position.z ) ) )
+	{
+		localToWorld.pop_back();
+		position_x.pop_back();
+		position_y.pop_back();
+		return result;
+	}
+	return Results::Success;
+}
+
+inline void eae6320::Graphics::RenderCommands::sMeshTransforms::pop_back()
+{
+	localToWorld.pop_back();
+	position_x.pop_back();
+	position_y.pop_back();
+	position_z.pop_back();
+}
+
+inline void eae6320::Graphics::RenderCommands::sMeshTransforms::SetArena( cFrameArena& io_arena )
+{
+	localToWorld.SetArena( io_arena );
+	position_x.SetArena( io_arena );
+	position_y.SetArena( io_arena );
+	position_z.SetArena( io_arena );
+}
+
+inline void eae6320::Graphics::RenderCommands::sMeshTransforms::clear()
+{
+	localToWorld.clear();
+	position_x.clear();
+	position_y.clear();
+	position_z.clear();
+}
+
+#endif	// EAE6320_GRAPHICS_RENDERCOMMANDS_INL
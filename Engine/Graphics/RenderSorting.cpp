@@ -0,0 +1,214 @@
+// Include Files
+//==============
+
+#include "RenderSorting.h"
+
+#include <cstring>
+#include <utility>
+#include <Engine/Asserts/Asserts.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// Key Layout
+	//-----------
+
+	//	Opaque:			| pass (2) | effect (12) | texture (12) | mesh (12) | front-to-back depth (24) | unused (2) |
+	//	Translucent:	| pass (2) | back-to-front depth (24) | effect (12) | texture (12) | mesh (12) | unused (2) |
+
+	constexpr unsigned int s_passShift = 62;
+	constexpr unsigned int s_depthBitCount = 24;
+	constexpr uint32_t s_depthMask = ( 1u << s_depthBitCount ) - 1;
+	constexpr uint64_t s_idMask = eae6320::Graphics::RenderSorting::MaxIdCount - 1;
+	constexpr uint64_t s_stateMask = ( uint64_t( 1u ) << ( eae6320::Graphics::RenderSorting::IdBitCount * 3 ) ) - 1;
+
+	// Radix Sort
+	//-----------
+
+	constexpr unsigned int s_radixBitCount = 8;
+	constexpr size_t s_bucketCount = size_t( 1u ) << s_radixBitCount;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	uint32_t QuantizeDistance( const float i_cameraSpaceZ );
+}
+
+// Interface
+//==========
+
+uint64_t eae6320::Graphics::RenderSorting::CreateKey( const ePass i_pass, const uint16_t i_effectId, const uint16_t i_textureId, const uint16_t i_meshId,
+	const float i_cameraSpaceZ )
+{
+	EAE6320_ASSERT( i_effectId < MaxIdCount );
+	EAE6320_ASSERT( i_textureId < MaxIdCount );
+	EAE6320_ASSERT( i_meshId < MaxIdCount );
+
+	const auto distance = QuantizeDistance( i_cameraSpaceZ );
+	const auto state = ( ( i_effectId & s_idMask ) << ( IdBitCount * 2 ) )
+		| ( ( i_textureId & s_idMask ) << IdBitCount )
+		| ( i_meshId & s_idMask );
+	auto key = uint64_t( i_pass ) << s_passShift;
+	if ( i_pass == ePass::Opaque )
+	{
+		// Closer objects are drawn first so that hidden fragments can be rejected by the depth test
+		key |= ( state << ( s_depthBitCount + 2 ) ) | ( uint64_t( distance ) << 2 );
+	}
+	else
+	{
+		// Farther objects must be drawn first so that closer objects blend over them
+		const auto inverseDistance = s_depthMask - distance;
+		key |= ( uint64_t( inverseDistance ) << ( IdBitCount * 3 + 2 ) ) | ( state << 2 );
+	}
+	return key;
+}
+
+eae6320::Graphics::RenderSorting::ePass eae6320::Graphics::RenderSorting::GetPass( const uint64_t i_key )
+{
+	return static_cast<ePass>( i_key >> s_passShift );
+}
+
+size_t eae6320::Graphics::RenderSorting::GetInstanceRunLength( const sDrawKey* const i_keys, const size_t i_keyCount )
+{
+	if ( i_keyCount == 0 )
+	{
+		return 0;
+	}
+	EAE6320_ASSERT( i_keys );
+
+	const auto getPassAndState = []( const uint64_t i_key )
+	{
+		const auto pass = GetPass( i_key );
+		const auto state = ( pass == ePass::Opaque ) ? ( ( i_key >> ( s_depthBitCount + 2 ) ) & s_stateMask ) : ( ( i_key >> 2 ) & s_stateMask );
+		return ( uint64_t( pass ) << s_passShift ) | state;
+	};
+	const auto firstPassAndState = getPassAndState( i_keys[0].value );
+	size_t runLength = 1;
+	while ( ( runLength < i_keyCount ) && ( getPassAndState( i_keys[runLength].value ) == firstPassAndState ) )
+	{
+		++runLength;
+	}
+	return runLength;
+}
+
+void eae6320::Graphics::RenderSorting::RadixSort( sDrawKey* const io_keys, sDrawKey* const io_scratch, const size_t i_keyCount )
+{
+	if ( i_keyCount < 2 )
+	{
+		return;
+	}
+	EAE6320_ASSERT( io_keys && io_scratch );
+
+	// A least-significant-digit radix sort with 8 bit digits takes 8 passes over the keys;
+	// since the number of passes is even the sorted keys end up back in the input array
+	auto* source = io_keys;
+	auto* destination = io_scratch;
+	for ( unsigned int shift = 0; shift < 64; shift += s_radixBitCount )
+	{
+		size_t bucketOffsets[s_bucketCount] = {};
+		for ( size_t i = 0; i < i_keyCount; ++i )
+		{
+			++bucketOffsets[( source[i].value >> shift ) & ( s_bucketCount - 1 )];
+		}
+		// A pass can be skipped entirely if every key has the same digit
+		// (this is common because many bits of a key are usually zero)
+		if ( bucketOffsets[( source[0].value >> shift ) & ( s_bucketCount - 1 )] == i_keyCount )
+		{
+			continue;
+		}
+		{
+			size_t total = 0;
+			for ( size_t i = 0; i < s_bucketCount; ++i )
+			{
+				const auto count = bucketOffsets[i];
+				bucketOffsets[i] = total;
+				total += count;
+			}
+		}
+		for ( size_t i = 0; i < i_keyCount; ++i )
+		{
+			destination[bucketOffsets[( source[i].value >> shift ) & ( s_bucketCount - 1 )]++] = source[i];
+		}
+		std::swap( source, destination );
+	}
+	// If an odd number of passes were skipped the sorted keys are in the scratch memory
+	if ( source != io_keys )
+	{
+		std::memcpy( io_keys, source, sizeof( sDrawKey ) * i_keyCount );
+	}
+}
+
+// cIdAssigner
+//------------
+
+uint16_t eae6320::Graphics::RenderSorting::cIdAssigner::GetId( const void* const i_pointer )
+{
+	// Pointers are hashed by dropping the low bits (which are the same because of alignment)
+	// and mixing the rest with a multiplicative hash
+	auto hash = static_cast<uint64_t>( reinterpret_cast<uintptr_t>( i_pointer ) >> 4 ) * 0x9E3779B97F4A7C15ull;
+	auto slotIndex = static_cast<size_t>( hash >> 32 ) & ( s_slotCount - 1 );
+	while ( true )
+	{
+		auto& slot = m_slots[slotIndex];
+		if ( slot.generation != m_generation )
+		{
+			if ( m_idCount < MaxIdCount )
+			{
+				slot.pointer = i_pointer;
+				slot.generation = m_generation;
+				slot.id = m_idCount++;
+				return slot.id;
+			}
+			else
+			{
+				// IDs are used as indices into a frame's resource tables and so they can't be shared;
+				// the caller must drop whatever needed the new ID
+				EAE6320_ASSERTF( false, "More than %u unique resources were submitted in a single frame", MaxIdCount );
+				return InvalidId;
+			}
+		}
+		else if ( slot.pointer == i_pointer )
+		{
+			return slot.id;
+		}
+		slotIndex = ( slotIndex + 1 ) & ( s_slotCount - 1 );
+	}
+}
+
+void eae6320::Graphics::RenderSorting::cIdAssigner::Reset()
+{
+	m_idCount = 0;
+	++m_generation;
+	if ( m_generation == 0 )
+	{
+		// When the generation wraps around every slot must be explicitly invalidated
+		for ( auto& slot : m_slots )
+		{
+			slot.generation = 0;
+		}
+		m_generation = 1;
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	uint32_t QuantizeDistance( const float i_cameraSpaceZ )
+	{
+		// The camera looks down negative Z, and anything behind the camera is treated as being at the camera
+		const auto distance = ( i_cameraSpaceZ < 0.0f ) ? -i_cameraSpaceZ : 0.0f;
+		// The bit patterns of non-negative floats sort in the same order as their values,
+		// and so keeping the most significant bits (the exponent and the top of the mantissa)
+		// gives a quantized distance that doesn't depend on knowing the near and far planes
+		uint32_t bits;
+		std::memcpy( &bits, &distance, sizeof( bits ) );
+		return ( bits >> ( 31 - s_depthBitCount ) ) & s_depthMask;
+	}
+}
@@ -0,0 +1,113 @@
+/*
+	This file declares the sort keys that are used to order submitted draw calls
+
+	Every draw call that is submitted gets a single 64-bit key.
+	Sorting the keys puts draw calls that share the same state next to each other
+	(so that redundant binds can be skipped)
+	and also orders them by depth within each render pass:
+		* Opaque draw calls are sorted by effect, then texture, then mesh, and then front-to-back
+		* Translucent draw calls are sorted back-to-front first (so that blending is correct),
+			and then by effect, texture, and mesh
+*/
+
+#ifndef EAE6320_GRAPHICS_RENDERSORTING_H
+#define EAE6320_GRAPHICS_RENDERSORTING_H
+
+// Include Files
+//==============
+
+#include "Configuration.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace RenderSorting
+		{
+			// The pass is stored in the most significant bits of a key
+			// and so every draw call in an earlier pass is drawn before any draw call in a later pass
+			enum class ePass : uint8_t
+			{
+				Opaque = 0,
+				Translucent = 1,
+			};
+
+			// Effects, textures, and meshes are identified in a key with a small ID
+			// (see cIdAssigner below) rather than with a pointer
+			constexpr unsigned int IdBitCount = 12;
+			constexpr uint16_t MaxIdCount = uint16_t( 1u ) << IdBitCount;
+
+			struct sDrawKey
+			{
+				uint64_t value;
+				// This is an index into the list of recorded draw commands that the key was created from
+				uint32_t drawIndex;
+			};
+
+			// The camera-space Z is the Z component of the object's position after it has been transformed by the world-to-camera transform
+			// (in our class the camera looks down negative Z and so objects in front of the camera have negative Z values)
+			uint64_t CreateKey( const ePass i_pass, const uint16_t i_effectId, const uint16_t i_textureId, const uint16_t i_meshId,
+				const float i_cameraSpaceZ );
+			ePass GetPass( const uint64_t i_key );
+
+			// Returns how many keys at the beginning of the (sorted) list can be drawn with a single instanced draw call:
+			// a run of consecutive keys in the same pass with the same effect, texture, and mesh
+			// (drawing the run as instances keeps the sorted order because instances are drawn in order)
+			size_t GetInstanceRunLength( const sDrawKey* const i_keys, const size_t i_keyCount );
+
+			// Sorts the keys in ascending order.
+			// The sort is stable (draw calls with equal keys stay in submission order),
+			// and the scratch memory must have room for at least as many keys as are being sorted
+			void RadixSort( sDrawKey* const io_keys, sDrawKey* const io_scratch, const size_t i_keyCount );
+
+			// This assigns a small ID to every unique pointer that it sees during a single frame.
+			// IDs are assigned in the order that pointers are first seen
+			// (and so a new pointer's ID is always the number of IDs that were assigned before it),
+			// and it doesn't allocate any memory.
+			class cIdAssigner
+			{
+				// Interface
+				//==========
+
+			public:
+
+				// This is returned instead of an ID when more than MaxIdCount unique pointers are seen in a single frame
+				static constexpr uint16_t InvalidId = MaxIdCount;
+
+				uint16_t GetId( const void* const i_pointer );
+				// This must be called once per frame before any IDs are requested
+				void Reset();
+
+				uint16_t GetIdCount() const { return m_idCount; }
+
+				// Data
+				//=====
+
+			private:
+
+				// The table is twice as large as the maximum number of IDs so that it never gets too full
+				static constexpr size_t s_slotCount = size_t( MaxIdCount ) * 2;
+
+				struct sSlot
+				{
+					const void* pointer = nullptr;
+					uint32_t generation = 0;
+					uint16_t id = 0;
+				};
+
+				sSlot m_slots[s_slotCount];
+				// Rather than clearing every slot each frame a slot is only considered valid if its generation matches the current one
+				uint32_t m_generation = 1;
+				uint16_t m_idCount = 0;
+			};
+		}
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_RENDERSORTING_H
@@ -11,6 +11,9 @@
 
 #include "Configuration.h"
 
+#include <cstdint>
+#include <Engine/Math/cMatrix_transformation.h>
+
 // Vertex Formats
 //===============
 
@@ -52,6 +55,17 @@ namespace eae6320
 
 				sMesh() : r(0), g(0), b(0), a(255) {}
 			};
+
+			// This is per-instance data rather than per-vertex data:
+			// it is stored in a separate vertex buffer
+			// and every vertex of a single instance of a mesh reads the same one
+			struct sMeshInstance
+			{
+				// TRANSFORM0 - TRANSFORM3
+				// 4 columns of 4 floats == 64 bytes
+				// Offset = 0
+				Math::cMatrix_transformation transform_localToWorld;
+			};
 		}
 	}
 }
@@ -15,10 +15,10 @@
 //#endif
 
 #include <Engine/Physics/sRigidBodyState.h>
-#include <Engine\Math\cMatrix_transformation.h>
-#include <Engine\Math\cQuaternion.h>
-#include <Engine\Math\sVector.h>
-#include <Engine\Math\Constants.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Math/Constants.h>
 
 //#include <Engine/Asserts/Asserts.h>
 //#include <Engine/Concurrency/cEvent.h>
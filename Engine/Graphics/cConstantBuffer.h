@@ -23,6 +23,7 @@
 
 #include "Configuration.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <Engine/Results/Results.h>
 
@@ -127,6 +128,8 @@ namespace eae6320
 			ID3D11Buffer* m_buffer = nullptr;
 #elif defined( EAE6320_PLATFORM_GL )
 			GLuint m_bufferId = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_bufferId = 0;
 #endif
 			
 			// The constant buffer type defines the size of the constant data
@@ -0,0 +1,185 @@
+// Include Files
+//==============
+
+#include "cFrameArena.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	uintptr_t AlignUp( const uintptr_t i_address, const size_t i_alignment );
+}
+
+// Interface
+//==========
+
+// Allocation
+//-----------
+
+void* eae6320::Graphics::cFrameArena::Allocate( const size_t i_byteCount, const size_t i_alignment )
+{
+	EAE6320_ASSERTF( ( i_alignment != 0 ) && ( ( i_alignment & ( i_alignment - 1 ) ) == 0 ), "Alignment must be a power of two" );
+
+	// Try the main block first
+	// (the remaining space is compared so that a huge request can't overflow the used byte count)
+	if ( m_memory )
+	{
+		const auto start = reinterpret_cast<uintptr_t>( m_memory );
+		const auto alignedAddress = AlignUp( start + m_mainBlockUsedByteCount, i_alignment );
+		const auto alignedByteCount = static_cast<size_t>( alignedAddress - start );
+		if ( ( alignedByteCount <= m_capacity ) && ( i_byteCount <= ( m_capacity - alignedByteCount ) ) )
+		{
+			const auto newUsedByteCount = alignedByteCount + i_byteCount;
+			m_usedByteCount += newUsedByteCount - m_mainBlockUsedByteCount;
+			m_mainBlockUsedByteCount = newUsedByteCount;
+			return reinterpret_cast<void*>( alignedAddress );
+		}
+	}
+	return AllocateFromOverflowBlock( i_byteCount, i_alignment );
+}
+
+void eae6320::Graphics::cFrameArena::Reset()
+{
+	if ( m_overflowBlocks )
+	{
+		// The main block wasn't big enough for this frame,
+		// and so it is replaced with a single block that would have been
+		// (with some extra room so that slow growth doesn't cause a heap allocation every frame)
+		const auto newCapacity = m_usedByteCount + ( m_usedByteCount / 2 );
+		FreeOverflowBlocks();
+		std::free( m_memory );
+		m_memory = static_cast<uint8_t*>( std::malloc( newCapacity ) );
+		if ( m_memory )
+		{
+			m_capacity = newCapacity;
+			++m_heapAllocationCount;
+		}
+		else
+		{
+			// Allocations will keep using overflow blocks until a reset succeeds in growing the main block
+			m_capacity = 0;
+			EAE6320_ASSERTF( false, "Couldn't grow a frame arena to %zu bytes", newCapacity );
+			Logging::OutputError( "Failed to allocate %zu bytes for a frame arena", newCapacity );
+		}
+	}
+	m_mainBlockUsedByteCount = 0;
+	m_usedByteCount = 0;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cFrameArena::Initialize( const size_t i_initialCapacity )
+{
+	EAE6320_ASSERT( !m_memory && !m_overflowBlocks );
+
+	if ( i_initialCapacity > 0 )
+	{
+		m_memory = static_cast<uint8_t*>( std::malloc( i_initialCapacity ) );
+		if ( !m_memory )
+		{
+			EAE6320_ASSERTF( false, "Couldn't allocate %zu bytes for a frame arena", i_initialCapacity );
+			Logging::OutputError( "Failed to allocate %zu bytes for a frame arena", i_initialCapacity );
+			return Results::OutOfMemory;
+		}
+		++m_heapAllocationCount;
+	}
+	m_capacity = i_initialCapacity;
+	m_mainBlockUsedByteCount = 0;
+	m_usedByteCount = 0;
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Graphics::cFrameArena::CleanUp()
+{
+	FreeOverflowBlocks();
+	std::free( m_memory );
+	m_memory = nullptr;
+	m_capacity = 0;
+	m_mainBlockUsedByteCount = 0;
+	m_usedByteCount = 0;
+
+	return Results::Success;
+}
+
+eae6320::Graphics::cFrameArena::~cFrameArena()
+{
+	const auto result = CleanUp();
+	EAE6320_ASSERT( result );
+}
+
+// Implementation
+//===============
+
+void* eae6320::Graphics::cFrameArena::AllocateFromOverflowBlock( const size_t i_byteCount, const size_t i_alignment )
+{
+	// Try the most recent overflow block
+	if ( m_overflowBlocks )
+	{
+		const auto start = reinterpret_cast<uintptr_t>( m_overflowBlocks + 1 );
+		const auto alignedAddress = AlignUp( start + m_overflowBlocks->usedByteCount, i_alignment );
+		const auto alignedByteCount = static_cast<size_t>( alignedAddress - start );
+		if ( ( alignedByteCount <= m_overflowBlocks->capacity ) && ( i_byteCount <= ( m_overflowBlocks->capacity - alignedByteCount ) ) )
+		{
+			const auto newUsedByteCount = alignedByteCount + i_byteCount;
+			m_usedByteCount += newUsedByteCount - m_overflowBlocks->usedByteCount;
+			m_overflowBlocks->usedByteCount = newUsedByteCount;
+			return reinterpret_cast<void*>( alignedAddress );
+		}
+	}
+	// Otherwise start a new one that is at least as big as everything that has been allocated so far
+	// (so that the number of overflow blocks in a single frame stays small)
+	{
+		constexpr size_t minimumCapacity = 4 * 1024;
+		if ( i_byteCount > ( SIZE_MAX - sizeof( sOverflowBlock ) - i_alignment ) )
+		{
+			EAE6320_ASSERTF( false, "A frame arena can't allocate %zu bytes", i_byteCount );
+			Logging::OutputError( "A frame arena can't allocate %zu bytes", i_byteCount );
+			return nullptr;
+		}
+		auto capacity = i_byteCount + i_alignment;
+		capacity = ( capacity > m_usedByteCount ) ? capacity : m_usedByteCount;
+		capacity = ( capacity > minimumCapacity ) ? capacity : minimumCapacity;
+		auto* const newBlock = static_cast<sOverflowBlock*>( std::malloc( sizeof( sOverflowBlock ) + capacity ) );
+		if ( !newBlock )
+		{
+			EAE6320_ASSERTF( false, "Couldn't allocate a %zu byte overflow block for a frame arena", capacity );
+			Logging::OutputError( "Failed to allocate %zu bytes for a frame arena overflow block", capacity );
+			return nullptr;
+		}
+		++m_heapAllocationCount;
+		newBlock->previous = m_overflowBlocks;
+		newBlock->capacity = capacity;
+		newBlock->usedByteCount = 0;
+		m_overflowBlocks = newBlock;
+	}
+	return AllocateFromOverflowBlock( i_byteCount, i_alignment );
+}
+
+void eae6320::Graphics::cFrameArena::FreeOverflowBlocks()
+{
+	while ( m_overflowBlocks )
+	{
+		auto* const previous = m_overflowBlocks->previous;
+		std::free( m_overflowBlocks );
+		m_overflowBlocks = previous;
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	uintptr_t AlignUp( const uintptr_t i_address, const size_t i_alignment )
+	{
+		return ( i_address + ( i_alignment - 1 ) ) & ~static_cast<uintptr_t>( i_alignment - 1 );
+	}
+}
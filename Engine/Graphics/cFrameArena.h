@@ -0,0 +1,174 @@
+/*
+	A frame arena is a linear ("bump") allocator for memory that only needs to live for a single frame
+
+	Allocating is just moving a pointer forward,
+	nothing is freed individually,
+	and everything that was allocated is released in one step by calling Reset().
+
+	Every frame packet owns an arena:
+	the application thread allocates its submission data from it,
+	the render thread allocates its scratch memory from it while rendering,
+	and the render thread resets it once the frame has been rendered.
+
+	If a frame needs more memory than the arena has then overflow blocks are allocated from the heap,
+	and the next Reset() replaces everything with a single block that is large enough.
+	This means that once the amount of memory that frames need stops growing
+	there are no more heap allocations.
+*/
+
+#ifndef EAE6320_GRAPHICS_CFRAMEARENA_H
+#define EAE6320_GRAPHICS_CFRAMEARENA_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Results/Results.h>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cFrameArena
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Allocation
+			//-----------
+
+			// The returned memory is uninitialized and is valid until the next Reset()
+			// (or null if the heap is out of memory)
+			void* Allocate( const size_t i_byteCount, const size_t i_alignment = alignof( std::max_align_t ) );
+			template <typename tElement>
+				tElement* Allocate( const size_t i_count );
+
+			// Releases everything that has been allocated since the last reset
+			void Reset();
+
+			// Access
+			//-------
+
+			// The number of bytes allocated since the last reset
+			size_t GetUsedByteCount() const { return m_usedByteCount; }
+			size_t GetCapacity() const { return m_capacity; }
+			// The number of times that the arena has had to allocate memory from the heap
+			// (this should stop increasing once the amount of memory that frames need stops growing)
+			uint64_t GetHeapAllocationCount() const { return m_heapAllocationCount; }
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			cResult Initialize( const size_t i_initialCapacity );
+			cResult CleanUp();
+
+			cFrameArena() = default;
+			~cFrameArena();
+
+			// Data
+			//=====
+
+		private:
+
+			// When the main block is full extra memory is allocated in a linked list of overflow blocks
+			struct sOverflowBlock
+			{
+				sOverflowBlock* previous;
+				size_t capacity;
+				size_t usedByteCount;
+			};
+
+			uint8_t* m_memory = nullptr;
+			size_t m_capacity = 0;
+			size_t m_mainBlockUsedByteCount = 0;
+			sOverflowBlock* m_overflowBlocks = nullptr;
+
+			size_t m_usedByteCount = 0;
+			uint64_t m_heapAllocationCount = 0;
+
+			// Implementation
+			//===============
+
+		private:
+
+			void* AllocateFromOverflowBlock( const size_t i_byteCount, const size_t i_alignment );
+			void FreeOverflowBlocks();
+
+			cFrameArena( const cFrameArena& i_arenaToBeCopied ) = delete;
+			cFrameArena& operator =( const cFrameArena& i_arenaToBeCopied ) = delete;
+			cFrameArena( cFrameArena&& i_arenaToBeMoved ) = delete;
+			cFrameArena& operator =( cFrameArena&& i_arenaToBeMoved ) = delete;
+		};
+
+		// A frame array is a growable list whose memory comes from a frame arena.
+		// When it grows the old memory is simply abandoned (it will be released when the arena is reset),
+		// and so it can only hold elements that can be copied with memcpy and don't need to be destroyed
+		template <typename tElement>
+			class cFrameArray
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Access
+			//-------
+
+			tElement* begin() { return m_elements; }
+			tElement* end() { return m_elements + m_count; }
+			const tElement* begin() const { return m_elements; }
+			const tElement* end() const { return m_elements + m_count; }
+			tElement& operator []( const size_t i_index );
+			const tElement& operator []( const size_t i_index ) const;
+			tElement* data() { return m_elements; }
+			size_t size() const { return m_count; }
+			bool empty() const { return m_count == 0; }
+
+			// Modification
+			//-------------
+
+			// If the array can't grow (because its arena is out of memory) then these fail
+			// and the array keeps its existing elements
+			cResult push_back( const tElement& i_element );
+			// The new elements are uninitialized
+			cResult resize( const size_t i_count );
+			void pop_back();
+			// This must be called before the arena is reset
+			// (the memory is forgotten rather than re-used, and it is released by the reset)
+			void clear();
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			// The array must be attached to an arena before anything is added
+			void SetArena( cFrameArena& io_arena ) { m_arena = &io_arena; }
+
+			// Data
+			//=====
+
+		private:
+
+			cFrameArena* m_arena = nullptr;
+			tElement* m_elements = nullptr;
+			size_t m_count = 0;
+			size_t m_capacity = 0;
+
+			// Implementation
+			//===============
+
+		private:
+
+			cResult Grow( const size_t i_minimumCapacity );
+		};
+	}
+}
+
+#include "cFrameArena.inl"
+
+#endif	// EAE6320_GRAPHICS_CFRAMEARENA_H
@@ -0,0 +1,122 @@
+#ifndef EAE6320_GRAPHICS_CFRAMEARENA_INL
+#define EAE6320_GRAPHICS_CFRAMEARENA_INL
+
+// Include Files
+//==============
+
+#include "cFrameArena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// cFrameArena
+//------------
+
+template <typename tElement>
+	tElement* eae6320::Graphics::cFrameArena::Allocate( const size_t i_count )
+{
+	static_assert( std::is_trivially_destructible<tElement>::value, "Objects in a frame arena are never destroyed" );
+	if ( i_count > ( std::numeric_limits<size_t>::max() / sizeof( tElement ) ) )
+	{
+		EAE6320_ASSERTF( false, "Too many elements were requested from a frame arena" );
+		return nullptr;
+	}
+	return static_cast<tElement*>( Allocate( sizeof( tElement ) * i_count, alignof( tElement ) ) );
+}
+
+// cFrameArray
+//------------
+
+template <typename tElement>
+	tElement& eae6320::Graphics::cFrameArray<tElement>::operator []( const size_t i_index )
+{
+	EAE6320_ASSERT( i_index < m_count );
+	return m_elements[i_index];
+}
+
+template <typename tElement>
+	const tElement& eae6320::Graphics::cFrameArray<tElement>::operator []( const size_t i_index ) const
+{
+	EAE6320_ASSERT( i_index < m_count );
+	return m_elements[i_index];
+}
+
+template <typename tElement>
+	eae6320::cResult eae6320::Graphics::cFrameArray<tElement>::push_back( const tElement& i_element )
+{
+	if ( m_count == m_capacity )
+	{
+		const auto result = Grow( m_count + 1 );
+		if ( !result )
+		{
+			return result;
+		}
+	}
+	m_elements[m_count++] = i_element;
+	return Results::Success;
+}
+
+template <typename tElement>
+	eae6320::cResult eae6320::Graphics::cFrameArray<tElement>::resize( const size_t i_count )
+{
+	if ( i_count > m_capacity )
+	{
+		const auto result = Grow( i_count );
+		if ( !result )
+		{
+			return result;
+		}
+	}
+	m_count = i_count;
+	return Results::Success;
+}
+
+template <typename tElement>
+	void eae6320::Graphics::cFrameArray<tElement>::pop_back()
+{
+	EAE6320_ASSERT( m_count > 0 );
+	--m_count;
+}
+
+template <typename tElement>
+	void eae6320::Graphics::cFrameArray<tElement>::clear()
+{
+	m_elements = nullptr;
+	m_count = 0;
+	m_capacity = 0;
+}
+
+// Implementation
+//===============
+
+template <typename tElement>
+	eae6320::cResult eae6320::Graphics::cFrameArray<tElement>::Grow( const size_t i_minimumCapacity )
+{
+	static_assert( std::is_trivially_copyable<tElement>::value, "Elements of a frame array are moved with memcpy" );
+	EAE6320_ASSERTF( m_arena, "A frame array must be attached to an arena before it can grow" );
+
+	// The capacity grows geometrically so that the memory abandoned in the arena is at most the size of the final array
+	constexpr size_t minimumCapacity = 16;
+	const auto newCapacity = std::max( { i_minimumCapacity, m_capacity * 2, minimumCapacity } );
+	auto* const newElements = m_arena->Allocate<tElement>( newCapacity );
+	if ( !newElements )
+	{
+		// The existing elements are still valid in their old memory
+		return Results::OutOfMemory;
+	}
+	if ( m_count > 0 )
+	{
+		std::memcpy( newElements, m_elements, sizeof( tElement ) * m_count );
+	}
+	m_elements = newElements;
+	m_capacity = newCapacity;
+	return Results::Success;
+}
+
+#endif	// EAE6320_GRAPHICS_CFRAMEARENA_INL
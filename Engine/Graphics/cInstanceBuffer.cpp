@@ -0,0 +1,90 @@
+// Include Files
+//==============
+
+#include "cInstanceBuffer.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The ring should be able to hold this many frames of instances
+	// so that writing a new frame doesn't have to wait for the GPU to finish reading a recent one
+	constexpr size_t s_frameCountInRing = 3;
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Update( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount,
+	size_t& o_firstInstance )
+{
+	auto result = Results::Success;
+
+	o_firstInstance = 0;
+	if ( ( i_instanceCount * s_frameCountInRing ) > m_instanceCapacity )
+	{
+		// Grow geometrically so that a slowly increasing instance count doesn't re-create the buffer every frame
+		const auto newInstanceCapacity = std::max( i_instanceCount * s_frameCountInRing, m_instanceCapacity * 2 );
+		if ( !( result = CleanUp() ) )
+		{
+			EAE6320_ASSERT( false );
+			return result;
+		}
+		if ( !( result = Initialize( newInstanceCapacity ) ) )
+		{
+			EAE6320_ASSERTF( false, "Couldn't grow the instance buffer to %u instances", newInstanceCapacity );
+			Logging::OutputError( "The instance buffer couldn't be re-created with room for %u instances", newInstanceCapacity );
+			return result;
+		}
+	}
+
+	if ( i_instanceCount > 0 )
+	{
+		// The instances of a single update are contiguous,
+		// and so if they don't fit at the end of the ring they start over at the beginning
+		auto firstInstance = m_nextInstance;
+		if ( ( firstInstance + i_instanceCount ) > m_instanceCapacity )
+		{
+			firstInstance = 0;
+		}
+		if ( !( result = Update_platformSpecific( i_instances, i_instanceCount, firstInstance ) ) )
+		{
+			return result;
+		}
+		o_firstInstance = firstInstance;
+		m_nextInstance = firstInstance + i_instanceCount;
+		m_lastUpdate_firstInstance = firstInstance;
+		m_lastUpdate_instanceCount = i_instanceCount;
+	}
+
+	return result;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cInstanceBuffer::Initialize( const size_t i_initialInstanceCapacity )
+{
+	// A buffer can't be empty
+	m_instanceCapacity = std::max( i_initialInstanceCapacity, size_t( 1 ) );
+	m_nextInstance = 0;
+	m_lastUpdate_firstInstance = 0;
+	m_lastUpdate_instanceCount = 0;
+	const auto result = Initialize_platformSpecific();
+	EAE6320_ASSERT( result );
+	return result;
+}
+
+eae6320::Graphics::cInstanceBuffer::~cInstanceBuffer()
+{
+	const auto result = CleanUp();
+	EAE6320_ASSERT( result );
+}
@@ -0,0 +1,149 @@
+/*
+	An instance buffer is a vertex buffer that holds per-instance data
+	(rather than per-vertex data)
+
+	When a mesh is drawn with instancing the same vertices are drawn many times in a single draw call,
+	and each instance reads a different element from the instance buffer
+	(in our class this is the local-to-world transform of each instance).
+
+	The contents of the instance buffer are re-written every frame,
+	and so a single instance buffer can be shared by every mesh:
+	each instanced draw call specifies which range of instances it uses.
+
+	The buffer is used as a ring:
+	each frame's instances are written after the previous frame's,
+	and so the CPU can write a new frame while the GPU is still reading older ones
+	without the driver having to either stall or allocate new memory.
+	A range is only re-used once the GPU has finished reading it
+	(OpenGL waits on a fence; Direct3D discards the whole buffer when the ring wraps around).
+*/
+
+#ifndef EAE6320_GRAPHICS_CINSTANCEBUFFER_H
+#define EAE6320_GRAPHICS_CINSTANCEBUFFER_H
+
+// Include Files
+//==============
+
+#include "Configuration.h"
+
+#include "VertexFormats.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Results/Results.h>
+
+#ifdef EAE6320_PLATFORM_GL
+	#include "OpenGL/Includes.h"
+#endif
+
+// Forward Declarations
+//=====================
+
+#ifdef EAE6320_PLATFORM_D3D
+	struct ID3D11Buffer;
+#endif
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cInstanceBuffer
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Render
+			//-------
+
+			// After the instance buffer is bound every instanced draw call will read per-instance data from it.
+			// In OpenGL the vertex array of the mesh that will be drawn must already be bound
+			// (the instance attributes are stored in the currently-bound vertex array).
+			void Bind() const;
+
+			// Copies the specified instances to the next free range of the ring.
+			// The instances start at o_firstInstance in the buffer,
+			// and so instanced draw calls that use them must add that to the first instance that they draw.
+			// If the ring doesn't have room for several frames of this many instances it is re-created with a larger capacity.
+			cResult Update( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount, size_t& o_firstInstance );
+			// This must be called after every draw call that uses the most recent update has been made;
+			// the instances of that update won't be overwritten until the GPU has finished those draw calls
+			void FenceLastUpdate();
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			cResult Initialize( const size_t i_initialInstanceCapacity );
+			cResult CleanUp();
+
+			cInstanceBuffer() = default;
+			~cInstanceBuffer();
+
+			// Data
+			//=====
+
+		private:
+
+			// The number of instances that the GPU buffer has room for
+			size_t m_instanceCapacity = 0;
+			// The next update is written here unless it would go past the end of the ring
+			size_t m_nextInstance = 0;
+			// The range of the most recent update (it hasn't been fenced yet)
+			size_t m_lastUpdate_firstInstance = 0;
+			size_t m_lastUpdate_instanceCount = 0;
+
+#if defined( EAE6320_PLATFORM_D3D )
+			ID3D11Buffer* m_buffer = nullptr;
+#elif defined( EAE6320_PLATFORM_GL )
+			GLuint m_bufferId = 0;
+			// Each fence is signaled when the GPU has finished reading a range of the ring
+			// (the oldest fence is first)
+			struct sFence
+			{
+				GLsync sync = nullptr;
+				size_t firstInstance = 0;
+				size_t instanceCount = 0;
+			};
+			static constexpr size_t s_maxFenceCount = 8;
+			sFence m_fences[s_maxFenceCount];
+			size_t m_fenceCount = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_bufferId = 0;
+#endif
+
+			// Implementation
+			//===============
+
+		private:
+
+			// Render
+			//-------
+
+			// The instances are guaranteed to fit in the buffer starting at i_firstInstance when this is called
+			cResult Update_platformSpecific( const VertexFormats::sMeshInstance* const i_instances, const size_t i_instanceCount,
+				const size_t i_firstInstance );
+#if defined( EAE6320_PLATFORM_GL )
+			// Waits for every fence whose range overlaps the specified range
+			// (and for every older fence, since the GPU finishes them in order)
+			void WaitForFences( const size_t i_firstInstance, const size_t i_instanceCount );
+#endif
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			// Creates a GPU buffer with room for m_instanceCapacity instances
+			cResult Initialize_platformSpecific();
+
+			cInstanceBuffer( const cInstanceBuffer& i_instanceToBeCopied ) = delete;
+			cInstanceBuffer& operator =( const cInstanceBuffer& i_instanceToBeCopied ) = delete;
+			cInstanceBuffer( cInstanceBuffer&& i_instanceToBeMoved ) = delete;
+			cInstanceBuffer& operator =( cInstanceBuffer&& i_instanceToBeMoved ) = delete;
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CINSTANCEBUFFER_H
@@ -37,8 +37,12 @@ eae6320::cResult cMesh::CreateMesh(cMesh *& mesh, const char* const i_path,
 
 	eae6320::Platform::sDataFromFile dataFromFile;
 	std::string errorMessage;
-	if (result = eae6320::Platform::LoadBinaryFile(i_path, dataFromFile, &errorMessage)) {
+	if ((result = eae6320::Platform::LoadBinaryFile(i_path, dataFromFile, &errorMessage))) {
 		uintptr_t ptr = reinterpret_cast<uintptr_t>(dataFromFile.data);
+		std::memcpy(&mesh->m_bounds, reinterpret_cast<void*>(ptr), sizeof(mesh->m_bounds));
+
+		ptr += sizeof(mesh->m_bounds);
+
 		mesh->m_vertexCount = *reinterpret_cast<size_t*>(ptr);
 
 		ptr += sizeof(size_t);
@@ -40,7 +40,7 @@ eae6320::cResult cMesh::Initialize(eae6320::Graphics::VertexFormats::sMesh *m_ve
 			// (by using so-called "semantic" names so that, for example,
 			// "POSITION" here matches with "POSITION" in shader code).
 			// Note that OpenGL uses arbitrarily assignable number IDs to do the same thing.
-			constexpr unsigned int vertexElementCount = 3;
+			constexpr unsigned int vertexElementCount = 7;
 			D3D11_INPUT_ELEMENT_DESC layoutDescription[vertexElementCount] = {};
 			{
 				// Slot 0
@@ -89,6 +89,25 @@ eae6320::cResult cMesh::Initialize(eae6320::Graphics::VertexFormats::sMesh *m_ve
 					positionElement.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
 					positionElement.InstanceDataStepRate = 0;	// (Must be zero for per-vertex data)
 				}
+
+				// Slot 1 (the instance buffer)
+
+				// TRANSFORM
+				// A 4x4 matrix is 4 columns of 4 floats == 4 x 16 bytes
+				// Offset = 0, 16, 32, 48
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					auto& transformElement = layoutDescription[3 + i];
+
+					transformElement.SemanticName = "TRANSFORM";
+					transformElement.SemanticIndex = i;	// (Each column of the matrix is a separate element)
+					transformElement.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+					transformElement.InputSlot = 1;
+					transformElement.AlignedByteOffset = static_cast<unsigned int>(
+						offsetof(eae6320::Graphics::VertexFormats::sMeshInstance, transform_localToWorld) + (i * sizeof(float) * 4));
+					transformElement.InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+					transformElement.InstanceDataStepRate = 1;	// (Advance to the next transform once per instance)
+				}
 			}
 
 			const auto d3dResult = direct3dDevice->CreateInputLayout(layoutDescription, vertexElementCount,
@@ -205,7 +224,7 @@ OnExit:
 	return result;
 }
 
-void cMesh::DrawMesh() {
+void cMesh::Bind() {
 	EAE6320_ASSERT(s_vertexBuffer);
 	constexpr unsigned int startingSlot = 0;
 	constexpr unsigned int vertexBufferCount = 1;
@@ -235,6 +254,11 @@ void cMesh::DrawMesh() {
 		// (meaning that every primitive is a triangle and will be defined by three vertices)
 		direct3dImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	}
+}
+
+void cMesh::DrawMesh(const unsigned int i_instanceCount, const unsigned int i_firstInstance) {
+	auto* const direct3dImmediateContext = eae6320::Graphics::sContext::g_context.direct3dImmediateContext;
+
 	/*
 	// Render triangles from the currently-bound vertex buffer
 	{
@@ -252,7 +276,10 @@ void cMesh::DrawMesh() {
 	// It's possible to start rendering primitives in the middle of the stream
 	const unsigned int indexOfFirstIndexToUse = 0;
 	const unsigned int offsetToAddToEachIndex = 0;
-	direct3dImmediateContext->DrawIndexed(static_cast<unsigned int>(m_indexCount), indexOfFirstIndexToUse, offsetToAddToEachIndex);
+	// Every instance draws all of the indices,
+	// and the start instance is where the first instance's data is in the instance buffer
+	direct3dImmediateContext->DrawIndexedInstanced(static_cast<unsigned int>(m_indexCount), i_instanceCount,
+		indexOfFirstIndexToUse, offsetToAddToEachIndex, i_firstInstance);
 }
 
 //eae6320::cResult cMesh::CleanUpMesh(cMesh *& mesh) {
@@ -287,12 +287,15 @@ OnExit:
 
 }
 
-void cMesh::DrawMesh() {
+void cMesh::Bind() {
 	// Bind a specific vertex buffer to the device as a data source
 	{
 		glBindVertexArray(s_vertexArrayId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 	}
+}
+
+void cMesh::DrawMesh(const unsigned int i_instanceCount, const unsigned int i_firstInstance) {
 	// Render triangles from the currently-bound vertex buffer
 	{
 		// The mode defines how to interpret multiple vertices as a single "primitive";
@@ -301,9 +304,10 @@ void cMesh::DrawMesh() {
 		constexpr GLenum mode = GL_TRIANGLES;
 		// It's possible to start rendering primitives in the middle of the stream
 		const GLvoid* const offset = 0;
-		// As of this comment we are only drawing a single triangle
-		// (you will have to update this code in future assignments!)
-		glDrawElements(mode, static_cast<GLsizei>(m_indexCount), GL_UNSIGNED_SHORT, offset);
+		// Every instance draws all of the indices,
+		// and the base instance is where the first instance's data is in the instance buffer
+		glDrawElementsInstancedBaseInstance(mode, static_cast<GLsizei>(m_indexCount), GL_UNSIGNED_SHORT, offset,
+			static_cast<GLsizei>(i_instanceCount), static_cast<GLuint>(i_firstInstance));
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 	}
 }
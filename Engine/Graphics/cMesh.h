@@ -4,6 +4,7 @@
 #include "cShader.h"
 #include "sContext.h"
 #include "VertexFormats.h"
+#include "sMeshBounds.h"
 
 
 #if defined( EAE6320_PLATFORM_GL )
@@ -21,7 +22,7 @@
 #include <Engine/Time/Time.h>
 #include <Engine/UserOutput/UserOutput.h>
 #include <Engine/Assets/ReferenceCountedAssets.h>
-#include <External\Lua\Includes.h>
+#include <External/Lua/Includes.h>
 #include <utility>
 
 #include <Engine/Assets/cHandle.h>
@@ -49,6 +50,11 @@ public:
 	// with the input from a vertex shader
 	ID3D11InputLayout* s_vertexInputLayout = nullptr;
 #endif
+
+#if defined( EAE6320_PLATFORM_NULL )
+	uint32_t s_vertexBufferId = 0;
+	uint32_t s_indexBufferId = 0;
+#endif
 	EAE6320_ASSETS_DECLAREREFERENCECOUNT();
 	EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS();
 	EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cMesh);
@@ -80,7 +86,15 @@ public:
 	eae6320::Graphics::VertexFormats::sMesh *m_vertex;
 	uint16_t  *m_index;
 
-	void DrawMesh();
+	// These are calculated when the mesh is built and are used to cull meshes that can't be seen
+	eae6320::Graphics::sMeshBounds m_bounds;
+
+	// Binding only needs to happen when a different mesh was drawn last;
+	// DrawMesh() draws whichever mesh is currently bound.
+	// Every mesh is drawn with instancing: the instance buffer must also be bound,
+	// and each instance reads its local-to-world transform from it starting at i_firstInstance
+	void Bind();
+	void DrawMesh(const unsigned int i_instanceCount, const unsigned int i_firstInstance);
 	~cMesh() {
 		CleanUp();
 	}
@@ -58,8 +58,10 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_D3D )
 			ID3D11SamplerState* m_samplerState = nullptr;
-#else
+#elif defined( EAE6320_PLATFORM_GL )
 			GLuint m_samplerStateId = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_samplerStateId = 0;
 #endif
 
 		};
@@ -116,6 +116,8 @@ namespace eae6320
 			} m_shaderObject;
 #elif defined( EAE6320_PLATFORM_GL )
 			GLuint m_shaderId = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_shaderId = 0;
 #endif
 			EAE6320_ASSETS_DECLAREREFERENCECOUNT();
 			const ShaderTypes::eType m_type = ShaderTypes::Unknown;
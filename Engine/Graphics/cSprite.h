@@ -39,6 +39,10 @@ public:
 	// with the input from a vertex shader
 	ID3D11InputLayout* s_vertexInputLayout = nullptr;
 #endif
+
+#if defined( EAE6320_PLATFORM_NULL )
+	uint32_t s_vertexBufferId = 0;
+#endif
 	EAE6320_ASSETS_DECLAREREFERENCECOUNT();
 	EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS();
 	EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cSprite);
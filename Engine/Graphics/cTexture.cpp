@@ -39,6 +39,8 @@ eae6320::cResult eae6320::Graphics::cTexture::Load( const char* const i_path, cT
 
 	Platform::sDataFromFile dataFromFile;
 	cTexture* newTexture = nullptr;
+	// The offsets are declared before anything can jump to OnExit
+	uintptr_t currentOffset, finalOffset;
 
 	// Load the binary data
 	{
@@ -52,8 +54,8 @@ eae6320::cResult eae6320::Graphics::cTexture::Load( const char* const i_path, cT
 	}
 
 	// Extract data from the file
-	auto currentOffset = reinterpret_cast<uintptr_t>( dataFromFile.data );
-	const auto finalOffset = currentOffset + dataFromFile.size;
+	currentOffset = reinterpret_cast<uintptr_t>( dataFromFile.data );
+	finalOffset = currentOffset + dataFromFile.size;
 
 	// The file starts with information about the texture
 	{
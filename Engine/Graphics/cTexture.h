@@ -86,6 +86,8 @@ namespace eae6320
 			ID3D11ShaderResourceView* m_textureView = nullptr;
 #elif defined( EAE6320_PLATFORM_GL )
 			GLuint m_textureId = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_textureId = 0;
 #endif
 
 			EAE6320_ASSETS_DECLAREREFERENCECOUNT();
@@ -0,0 +1,33 @@
+/*
+	The bounding volumes of a mesh are calculated when the mesh is built
+	and stored at the beginning of the mesh's binary file
+
+	Both volumes are in the mesh's local space:
+		* The sphere is cheap to test and doesn't change when the mesh is rotated
+		* The box is tighter for long or flat meshes
+*/
+
+#ifndef EAE6320_GRAPHICS_SMESHBOUNDS_H
+#define EAE6320_GRAPHICS_SMESHBOUNDS_H
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		// This struct is written directly to a mesh's binary file,
+		// and so it only contains floats (which are the same on every platform)
+		struct sMeshBounds
+		{
+			float sphereCenter[3] = { 0.0f, 0.0f, 0.0f };
+			float sphereRadius = 0.0f;
+
+			float boxMinimum[3] = { 0.0f, 0.0f, 0.0f };
+			float boxMaximum[3] = { 0.0f, 0.0f, 0.0f };
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_SMESHBOUNDS_H
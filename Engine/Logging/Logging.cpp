@@ -5,8 +5,10 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <Engine/Asserts/Asserts.h>
 #include <fstream>
+#include <new>
 #include <sstream>
 #include <string>
 
@@ -254,14 +256,14 @@ namespace
 		const auto formattingResult = vsnprintf( buffer, bufferSize, i_message, io_insertions );
 		if ( formattingResult >= 0 )
 		{
-			if ( formattingResult < bufferSize )
+			if ( static_cast<size_t>( formattingResult ) < bufferSize )
 			{
 				return s_logger.OutputMessage( buffer );
 			}
 			else
 			{
 				EAE6320_ASSERTF( false, "The internal logging buffer of size %u was not big enough to hold the formatted message of length %i",
-					bufferSize, formattingResult + 1 );
+					static_cast<unsigned int>( bufferSize ), formattingResult + 1 );
 				std::ostringstream errorMessage;
 				errorMessage << "FORMATTING ERROR! (The internal logging buffer of size " << bufferSize
 					<< " was not big enough to hold the formatted message of length " << ( formattingResult + 1 ) << ".)"
@@ -0,0 +1,715 @@
+// Include Files
+//==============
+
+#include "BatchTransforms.h"
+
+#include "cMatrix_transformation.h"
+#include "Configuration.h"
+#include "Constants.h"
+#include "cQuaternion.h"
+#include "Functions.h"
+
+#include <cmath>
+#include <type_traits>
+#include <Engine/Asserts/Asserts.h>
+
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	#include <emmintrin.h>
+#endif
+
+// A matrix is written as 16 column-major floats
+// (the same way that cMatrix_transformation::GetElement() reads it)
+static_assert( std::is_standard_layout<eae6320::Math::cMatrix_transformation>::value
+	&& ( sizeof( eae6320::Math::cMatrix_transformation ) == ( sizeof( float ) * 16 ) ),
+	"A matrix must be 16 contiguous floats" );
+// A quaternion is read and written as [w, x, y, z]
+// (the order of cQuaternion's members)
+static_assert( std::is_standard_layout<eae6320::Math::cQuaternion>::value
+	&& ( sizeof( eae6320::Math::cQuaternion ) == ( sizeof( float ) * 4 ) ),
+	"A quaternion must be 4 contiguous floats" );
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// These calculate a single object with the same operations (in the same order) as the single-object functions,
+	// and are used for the objects that don't fill a group of four (or for every object if SIMD isn't enabled)
+	void CreateTransform( const float i_w, const float i_x, const float i_y, const float i_z,
+		const float i_translation_x, const float i_translation_y, const float i_translation_z,
+		float* const o_transform );
+	void TransformPoint( const eae6320::Math::cMatrix_transformation& i_transform,
+		const float i_x, const float i_y, const float i_z,
+		float& o_x, float& o_y, float& o_z );
+	// The quaternions are stored as [w, x, y, z]
+	void CalculateNlerp( const float ( &i_from )[4], const float ( &i_to )[4], const float i_t, float ( &o_result )[4] );
+	void CalculateSlerp( const float ( &i_from )[4], const float ( &i_to )[4], const float i_t, float ( &o_result )[4] );
+	void CalculateRotation( float ( &io_orientation )[4], const float i_angularSpeed,
+		const float i_axis_x, const float i_axis_y, const float i_axis_z, const float i_secondCount );
+
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	// These calculate four objects with the same operations (in the same order) as the scalar functions
+	void CalculateRotationElements( const __m128 i_w, const __m128 i_x, const __m128 i_y, const __m128 i_z,
+		// Each element holds the element at [row][column] for all four objects
+		__m128 ( &o_elements )[3][3] );
+	void NormalizeQuaternions( __m128& io_w, __m128& io_x, __m128& io_y, __m128& io_z );
+	void CalculateSinCos_fast( const __m128 i_anglesInRadians, __m128& o_sin, __m128& o_cos );
+	__m128 CalculateSin_fast( const __m128 i_anglesInRadians );
+	__m128 CalculateAcos_fast( const __m128 i_values );
+	__m128 Select( const __m128 i_mask, const __m128 i_ifTrue, const __m128 i_ifFalse );
+#endif
+}
+
+// Interface
+//==========
+
+void eae6320::Math::BatchTransforms::CreateTransforms( const sConstQuaternionSpans& i_rotations, const sConstVectorSpans& i_translations, const size_t i_count,
+	cMatrix_transformation* const o_transforms )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_transforms );
+	auto* const transforms = reinterpret_cast<float*>( o_transforms );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto one = _mm_set1_ps( 1.0f );
+		const auto zero = _mm_setzero_ps();
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			__m128 rotation[3][3];
+			CalculateRotationElements( _mm_loadu_ps( i_rotations.w + i ), _mm_loadu_ps( i_rotations.x + i ),
+				_mm_loadu_ps( i_rotations.y + i ), _mm_loadu_ps( i_rotations.z + i ),
+				rotation );
+
+			// Each of these holds one element for four different objects
+			auto m_00 = rotation[0][0], m_01 = rotation[0][1], m_02 = rotation[0][2];
+			auto m_10 = rotation[1][0], m_11 = rotation[1][1], m_12 = rotation[1][2];
+			auto m_20 = rotation[2][0], m_21 = rotation[2][1], m_22 = rotation[2][2];
+
+			auto m_03 = _mm_loadu_ps( i_translations.x + i );
+			auto m_13 = _mm_loadu_ps( i_translations.y + i );
+			auto m_23 = _mm_loadu_ps( i_translations.z + i );
+
+			// Transposing each group of four elements results in one column for each of the four objects
+			auto m_30 = zero, m_31 = zero, m_32 = zero, m_33 = one;
+			_MM_TRANSPOSE4_PS( m_00, m_10, m_20, m_30 );
+			_MM_TRANSPOSE4_PS( m_01, m_11, m_21, m_31 );
+			_MM_TRANSPOSE4_PS( m_02, m_12, m_22, m_32 );
+			_MM_TRANSPOSE4_PS( m_03, m_13, m_23, m_33 );
+			const __m128 columns[4][4] =
+			{
+				{ m_00, m_01, m_02, m_03 },
+				{ m_10, m_11, m_12, m_13 },
+				{ m_20, m_21, m_22, m_23 },
+				{ m_30, m_31, m_32, m_33 },
+			};
+			for ( size_t j = 0; j < 4; ++j )
+			{
+				auto* const transform = transforms + ( ( i + j ) * 16 );
+				for ( size_t c = 0; c < 4; ++c )
+				{
+					_mm_storeu_ps( transform + ( c * 4 ), columns[j][c] );
+				}
+			}
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		CreateTransform( i_rotations.w[i], i_rotations.x[i], i_rotations.y[i], i_rotations.z[i],
+			i_translations.x[i], i_translations.y[i], i_translations.z[i],
+			transforms + ( i * 16 ) );
+	}
+}
+
+void eae6320::Math::BatchTransforms::CreateTransforms_3x4( const sConstQuaternionSpans& i_rotations, const sConstVectorSpans& i_translations, const size_t i_count,
+	float* const o_transforms )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_transforms );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	for ( ; ( i + 4 ) <= i_count; i += 4 )
+	{
+		__m128 rotation[3][3];
+		CalculateRotationElements( _mm_loadu_ps( i_rotations.w + i ), _mm_loadu_ps( i_rotations.x + i ),
+			_mm_loadu_ps( i_rotations.y + i ), _mm_loadu_ps( i_rotations.z + i ),
+			rotation );
+		const float* const translations[] = { i_translations.x, i_translations.y, i_translations.z };
+		for ( unsigned int r = 0; r < 3; ++r )
+		{
+			// Transposing one row of four objects results in that row for each of the four objects
+			auto row_0 = rotation[r][0];
+			auto row_1 = rotation[r][1];
+			auto row_2 = rotation[r][2];
+			auto row_3 = _mm_loadu_ps( translations[r] + i );
+			_MM_TRANSPOSE4_PS( row_0, row_1, row_2, row_3 );
+			_mm_storeu_ps( o_transforms + ( ( i + 0 ) * 12 ) + ( r * 4 ), row_0 );
+			_mm_storeu_ps( o_transforms + ( ( i + 1 ) * 12 ) + ( r * 4 ), row_1 );
+			_mm_storeu_ps( o_transforms + ( ( i + 2 ) * 12 ) + ( r * 4 ), row_2 );
+			_mm_storeu_ps( o_transforms + ( ( i + 3 ) * 12 ) + ( r * 4 ), row_3 );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		float transform[16];
+		CreateTransform( i_rotations.w[i], i_rotations.x[i], i_rotations.y[i], i_rotations.z[i],
+			i_translations.x[i], i_translations.y[i], i_translations.z[i],
+			transform );
+		// The full transform is stored as columns
+		auto* const transform_3x4 = o_transforms + ( i * 12 );
+		for ( unsigned int r = 0; r < 3; ++r )
+		{
+			for ( unsigned int c = 0; c < 4; ++c )
+			{
+				transform_3x4[( r * 4 ) + c] = transform[( c * 4 ) + r];
+			}
+		}
+	}
+}
+
+void eae6320::Math::BatchTransforms::TransformPoints( const cMatrix_transformation& i_transform, const sConstVectorSpans& i_points, const size_t i_count,
+	const sVectorSpans& o_points )
+{
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto m_00 = _mm_set1_ps( i_transform.GetElement( 0, 0 ) );
+		const auto m_01 = _mm_set1_ps( i_transform.GetElement( 0, 1 ) );
+		const auto m_02 = _mm_set1_ps( i_transform.GetElement( 0, 2 ) );
+		const auto m_03 = _mm_set1_ps( i_transform.GetElement( 0, 3 ) );
+		const auto m_10 = _mm_set1_ps( i_transform.GetElement( 1, 0 ) );
+		const auto m_11 = _mm_set1_ps( i_transform.GetElement( 1, 1 ) );
+		const auto m_12 = _mm_set1_ps( i_transform.GetElement( 1, 2 ) );
+		const auto m_13 = _mm_set1_ps( i_transform.GetElement( 1, 3 ) );
+		const auto m_20 = _mm_set1_ps( i_transform.GetElement( 2, 0 ) );
+		const auto m_21 = _mm_set1_ps( i_transform.GetElement( 2, 1 ) );
+		const auto m_22 = _mm_set1_ps( i_transform.GetElement( 2, 2 ) );
+		const auto m_23 = _mm_set1_ps( i_transform.GetElement( 2, 3 ) );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto x = _mm_loadu_ps( i_points.x + i );
+			const auto y = _mm_loadu_ps( i_points.y + i );
+			const auto z = _mm_loadu_ps( i_points.z + i );
+			_mm_storeu_ps( o_points.x + i,
+				_mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( m_00, x ), _mm_mul_ps( m_01, y ) ), _mm_mul_ps( m_02, z ) ), m_03 ) );
+			_mm_storeu_ps( o_points.y + i,
+				_mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( m_10, x ), _mm_mul_ps( m_11, y ) ), _mm_mul_ps( m_12, z ) ), m_13 ) );
+			_mm_storeu_ps( o_points.z + i,
+				_mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( m_20, x ), _mm_mul_ps( m_21, y ) ), _mm_mul_ps( m_22, z ) ), m_23 ) );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		TransformPoint( i_transform, i_points.x[i], i_points.y[i], i_points.z[i], o_points.x[i], o_points.y[i], o_points.z[i] );
+	}
+}
+
+void eae6320::Math::BatchTransforms::ConcatenateAffine( const cMatrix_transformation& i_nextTransform,
+	const cMatrix_transformation* const i_firstTransforms, const size_t i_count,
+	cMatrix_transformation* const o_transforms )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || ( i_firstTransforms && o_transforms ) );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto* const firstTransforms = reinterpret_cast<const float*>( i_firstTransforms );
+		auto* const transforms = reinterpret_cast<float*>( o_transforms );
+		// Only the top three rows of the next transform are needed
+		// because the bottom row of an affine transform is known
+		__m128 next[3][4];
+		for ( unsigned int r = 0; r < 3; ++r )
+		{
+			for ( unsigned int c = 0; c < 4; ++c )
+			{
+				next[r][c] = _mm_set1_ps( i_nextTransform.GetElement( r, c ) );
+			}
+		}
+		const auto zero = _mm_setzero_ps();
+		const auto one = _mm_set1_ps( 1.0f );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto* const first = firstTransforms + ( i * 16 );
+			// Every column of the four results is calculated before anything is stored
+			// so that the output list can be the same as the input list
+			__m128 results[4][4];
+			for ( unsigned int c = 0; c < 4; ++c )
+			{
+				// Transposing the same column of four objects results in one row of that column for all four objects
+				auto first_0 = _mm_loadu_ps( first + ( c * 4 ) );
+				auto first_1 = _mm_loadu_ps( first + 16 + ( c * 4 ) );
+				auto first_2 = _mm_loadu_ps( first + 32 + ( c * 4 ) );
+				auto first_3 = _mm_loadu_ps( first + 48 + ( c * 4 ) );
+				_MM_TRANSPOSE4_PS( first_0, first_1, first_2, first_3 );
+
+				__m128 result[4];
+				for ( unsigned int r = 0; r < 3; ++r )
+				{
+					result[r] = _mm_add_ps( _mm_add_ps( _mm_mul_ps( next[r][0], first_0 ), _mm_mul_ps( next[r][1], first_1 ) ),
+						_mm_mul_ps( next[r][2], first_2 ) );
+					if ( c == 3 )
+					{
+						result[r] = _mm_add_ps( result[r], next[r][3] );
+					}
+				}
+				result[3] = ( c == 3 ) ? one : zero;
+				// Transposing back results in the column for each of the four objects
+				_MM_TRANSPOSE4_PS( result[0], result[1], result[2], result[3] );
+				for ( unsigned int j = 0; j < 4; ++j )
+				{
+					results[j][c] = result[j];
+				}
+			}
+			for ( unsigned int j = 0; j < 4; ++j )
+			{
+				auto* const transform = transforms + ( ( i + j ) * 16 );
+				for ( unsigned int c = 0; c < 4; ++c )
+				{
+					_mm_storeu_ps( transform + ( c * 4 ), results[j][c] );
+				}
+			}
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		o_transforms[i] = cMatrix_transformation::ConcatenateAffine( i_nextTransform, i_firstTransforms[i] );
+	}
+}
+
+// Interpolation
+//--------------
+
+void eae6320::Math::BatchTransforms::Nlerp( const sConstQuaternionSpans& i_from, const sConstQuaternionSpans& i_to, const float* const i_ts, const size_t i_count,
+	const sQuaternionSpans& o_results )
+{
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto zero = _mm_setzero_ps();
+		const auto signBit = _mm_set1_ps( -0.0f );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto from_w = _mm_loadu_ps( i_from.w + i );
+			const auto from_x = _mm_loadu_ps( i_from.x + i );
+			const auto from_y = _mm_loadu_ps( i_from.y + i );
+			const auto from_z = _mm_loadu_ps( i_from.z + i );
+			auto to_w = _mm_loadu_ps( i_to.w + i );
+			auto to_x = _mm_loadu_ps( i_to.x + i );
+			auto to_y = _mm_loadu_ps( i_to.y + i );
+			auto to_z = _mm_loadu_ps( i_to.z + i );
+			const auto t = _mm_loadu_ps( i_ts + i );
+
+			// Negating the destinations with a negative dot product interpolates along the shortest path
+			const auto dot = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( from_w, to_w ), _mm_mul_ps( from_x, to_x ) ),
+				_mm_mul_ps( from_y, to_y ) ), _mm_mul_ps( from_z, to_z ) );
+			const auto negation = _mm_and_ps( _mm_cmplt_ps( dot, zero ), signBit );
+			to_w = _mm_xor_ps( to_w, negation );
+			to_x = _mm_xor_ps( to_x, negation );
+			to_y = _mm_xor_ps( to_y, negation );
+			to_z = _mm_xor_ps( to_z, negation );
+
+			auto result_w = _mm_add_ps( from_w, _mm_mul_ps( _mm_sub_ps( to_w, from_w ), t ) );
+			auto result_x = _mm_add_ps( from_x, _mm_mul_ps( _mm_sub_ps( to_x, from_x ), t ) );
+			auto result_y = _mm_add_ps( from_y, _mm_mul_ps( _mm_sub_ps( to_y, from_y ), t ) );
+			auto result_z = _mm_add_ps( from_z, _mm_mul_ps( _mm_sub_ps( to_z, from_z ), t ) );
+			NormalizeQuaternions( result_w, result_x, result_y, result_z );
+			_mm_storeu_ps( o_results.w + i, result_w );
+			_mm_storeu_ps( o_results.x + i, result_x );
+			_mm_storeu_ps( o_results.y + i, result_y );
+			_mm_storeu_ps( o_results.z + i, result_z );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		const float from[] = { i_from.w[i], i_from.x[i], i_from.y[i], i_from.z[i] };
+		const float to[] = { i_to.w[i], i_to.x[i], i_to.y[i], i_to.z[i] };
+		float result[4];
+		CalculateNlerp( from, to, i_ts[i], result );
+		o_results.w[i] = result[0];
+		o_results.x[i] = result[1];
+		o_results.y[i] = result[2];
+		o_results.z[i] = result[3];
+	}
+}
+
+void eae6320::Math::BatchTransforms::Slerp( const sConstQuaternionSpans& i_from, const sConstQuaternionSpans& i_to, const float* const i_ts, const size_t i_count,
+	const sQuaternionSpans& o_results )
+{
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto zero = _mm_setzero_ps();
+		const auto one = _mm_set1_ps( 1.0f );
+		const auto signBit = _mm_set1_ps( -0.0f );
+		const auto nlerpThreshold = _mm_set1_ps( cQuaternion::NlerpThreshold_cosAngle );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto from_w = _mm_loadu_ps( i_from.w + i );
+			const auto from_x = _mm_loadu_ps( i_from.x + i );
+			const auto from_y = _mm_loadu_ps( i_from.y + i );
+			const auto from_z = _mm_loadu_ps( i_from.z + i );
+			auto to_w = _mm_loadu_ps( i_to.w + i );
+			auto to_x = _mm_loadu_ps( i_to.x + i );
+			auto to_y = _mm_loadu_ps( i_to.y + i );
+			auto to_z = _mm_loadu_ps( i_to.z + i );
+			const auto t = _mm_loadu_ps( i_ts + i );
+
+			// Negating the destinations with a negative dot product interpolates along the shortest path
+			const auto dot = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( from_w, to_w ), _mm_mul_ps( from_x, to_x ) ),
+				_mm_mul_ps( from_y, to_y ) ), _mm_mul_ps( from_z, to_z ) );
+			const auto negation = _mm_and_ps( _mm_cmplt_ps( dot, zero ), signBit );
+			const auto cosAngle = _mm_xor_ps( dot, negation );
+			to_w = _mm_xor_ps( to_w, negation );
+			to_x = _mm_xor_ps( to_x, negation );
+			to_y = _mm_xor_ps( to_y, negation );
+			to_z = _mm_xor_ps( to_z, negation );
+
+			// Both interpolations are calculated for all four objects and then the right one is chosen for each
+			// (the slerp of rotations that are nearly the same divides by nearly zero, but its result isn't used)
+			auto nlerp_w = _mm_add_ps( from_w, _mm_mul_ps( _mm_sub_ps( to_w, from_w ), t ) );
+			auto nlerp_x = _mm_add_ps( from_x, _mm_mul_ps( _mm_sub_ps( to_x, from_x ), t ) );
+			auto nlerp_y = _mm_add_ps( from_y, _mm_mul_ps( _mm_sub_ps( to_y, from_y ), t ) );
+			auto nlerp_z = _mm_add_ps( from_z, _mm_mul_ps( _mm_sub_ps( to_z, from_z ), t ) );
+			NormalizeQuaternions( nlerp_w, nlerp_x, nlerp_y, nlerp_z );
+
+			const auto angle = CalculateAcos_fast( cosAngle );
+			const auto sinAngle_reciprocal = _mm_div_ps( one, CalculateSin_fast( angle ) );
+			const auto fromScale = _mm_mul_ps( CalculateSin_fast( _mm_mul_ps( _mm_sub_ps( one, t ), angle ) ), sinAngle_reciprocal );
+			const auto toScale = _mm_mul_ps( CalculateSin_fast( _mm_mul_ps( t, angle ) ), sinAngle_reciprocal );
+
+			const auto shouldNlerp = _mm_cmpgt_ps( cosAngle, nlerpThreshold );
+			_mm_storeu_ps( o_results.w + i, Select( shouldNlerp, nlerp_w, _mm_add_ps( _mm_mul_ps( from_w, fromScale ), _mm_mul_ps( to_w, toScale ) ) ) );
+			_mm_storeu_ps( o_results.x + i, Select( shouldNlerp, nlerp_x, _mm_add_ps( _mm_mul_ps( from_x, fromScale ), _mm_mul_ps( to_x, toScale ) ) ) );
+			_mm_storeu_ps( o_results.y + i, Select( shouldNlerp, nlerp_y, _mm_add_ps( _mm_mul_ps( from_y, fromScale ), _mm_mul_ps( to_y, toScale ) ) ) );
+			_mm_storeu_ps( o_results.z + i, Select( shouldNlerp, nlerp_z, _mm_add_ps( _mm_mul_ps( from_z, fromScale ), _mm_mul_ps( to_z, toScale ) ) ) );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		const float from[] = { i_from.w[i], i_from.x[i], i_from.y[i], i_from.z[i] };
+		const float to[] = { i_to.w[i], i_to.x[i], i_to.y[i], i_to.z[i] };
+		float result[4];
+		CalculateSlerp( from, to, i_ts[i], result );
+		o_results.w[i] = result[0];
+		o_results.x[i] = result[1];
+		o_results.y[i] = result[2];
+		o_results.z[i] = result[3];
+	}
+}
+
+// Rotation
+//---------
+
+void eae6320::Math::BatchTransforms::Rotate( const sQuaternionSpans& io_orientations, const float* const i_angularSpeeds, const sConstVectorSpans& i_axesOfRotation_local,
+	const size_t i_count, const float i_secondCount )
+{
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto secondCount = _mm_set1_ps( i_secondCount );
+		const auto half = _mm_set1_ps( 0.5f );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			// The rotation for the elapsed time
+			__m128 rotation_w, sin_angle_half;
+			CalculateSinCos_fast( _mm_mul_ps( _mm_mul_ps( _mm_loadu_ps( i_angularSpeeds + i ), secondCount ), half ), sin_angle_half, rotation_w );
+			const auto rotation_x = _mm_mul_ps( _mm_loadu_ps( i_axesOfRotation_local.x + i ), sin_angle_half );
+			const auto rotation_y = _mm_mul_ps( _mm_loadu_ps( i_axesOfRotation_local.y + i ), sin_angle_half );
+			const auto rotation_z = _mm_mul_ps( _mm_loadu_ps( i_axesOfRotation_local.z + i ), sin_angle_half );
+
+			// The orientation multiplied by the rotation
+			const auto orientation_w = _mm_loadu_ps( io_orientations.w + i );
+			const auto orientation_x = _mm_loadu_ps( io_orientations.x + i );
+			const auto orientation_y = _mm_loadu_ps( io_orientations.y + i );
+			const auto orientation_z = _mm_loadu_ps( io_orientations.z + i );
+			auto result_w = _mm_sub_ps( _mm_mul_ps( orientation_w, rotation_w ),
+				_mm_add_ps( _mm_add_ps( _mm_mul_ps( orientation_x, rotation_x ), _mm_mul_ps( orientation_y, rotation_y ) ), _mm_mul_ps( orientation_z, rotation_z ) ) );
+			auto result_x = _mm_add_ps( _mm_add_ps( _mm_mul_ps( orientation_w, rotation_x ), _mm_mul_ps( orientation_x, rotation_w ) ),
+				_mm_sub_ps( _mm_mul_ps( orientation_y, rotation_z ), _mm_mul_ps( orientation_z, rotation_y ) ) );
+			auto result_y = _mm_add_ps( _mm_add_ps( _mm_mul_ps( orientation_w, rotation_y ), _mm_mul_ps( orientation_y, rotation_w ) ),
+				_mm_sub_ps( _mm_mul_ps( orientation_z, rotation_x ), _mm_mul_ps( orientation_x, rotation_z ) ) );
+			auto result_z = _mm_add_ps( _mm_add_ps( _mm_mul_ps( orientation_w, rotation_z ), _mm_mul_ps( orientation_z, rotation_w ) ),
+				_mm_sub_ps( _mm_mul_ps( orientation_x, rotation_y ), _mm_mul_ps( orientation_y, rotation_x ) ) );
+			NormalizeQuaternions( result_w, result_x, result_y, result_z );
+			_mm_storeu_ps( io_orientations.w + i, result_w );
+			_mm_storeu_ps( io_orientations.x + i, result_x );
+			_mm_storeu_ps( io_orientations.y + i, result_y );
+			_mm_storeu_ps( io_orientations.z + i, result_z );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		float orientation[] = { io_orientations.w[i], io_orientations.x[i], io_orientations.y[i], io_orientations.z[i] };
+		CalculateRotation( orientation, i_angularSpeeds[i],
+			i_axesOfRotation_local.x[i], i_axesOfRotation_local.y[i], i_axesOfRotation_local.z[i], i_secondCount );
+		io_orientations.w[i] = orientation[0];
+		io_orientations.x[i] = orientation[1];
+		io_orientations.y[i] = orientation[2];
+		io_orientations.z[i] = orientation[3];
+	}
+}
+
+// Conversion
+//-----------
+
+void eae6320::Math::BatchTransforms::CopyToSpans( const cQuaternion* const i_quaternions, const size_t i_count, const sQuaternionSpans& o_spans )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || i_quaternions );
+	const auto* const quaternions = reinterpret_cast<const float*>( i_quaternions );
+	for ( size_t i = 0; i < i_count; ++i )
+	{
+		const auto* const quaternion = quaternions + ( i * 4 );
+		o_spans.w[i] = quaternion[0];
+		o_spans.x[i] = quaternion[1];
+		o_spans.y[i] = quaternion[2];
+		o_spans.z[i] = quaternion[3];
+	}
+}
+
+void eae6320::Math::BatchTransforms::CopyFromSpans( const sConstQuaternionSpans& i_spans, const size_t i_count, cQuaternion* const o_quaternions )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_quaternions );
+	auto* const quaternions = reinterpret_cast<float*>( o_quaternions );
+	for ( size_t i = 0; i < i_count; ++i )
+	{
+		auto* const quaternion = quaternions + ( i * 4 );
+		quaternion[0] = i_spans.w[i];
+		quaternion[1] = i_spans.x[i];
+		quaternion[2] = i_spans.y[i];
+		quaternion[3] = i_spans.z[i];
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void CreateTransform( const float i_w, const float i_x, const float i_y, const float i_z,
+		const float i_translation_x, const float i_translation_y, const float i_translation_z,
+		float* const o_transform )
+	{
+		const auto _2x = i_x + i_x;
+		const auto _2y = i_y + i_y;
+		const auto _2z = i_z + i_z;
+		const auto _2xx = i_x * _2x;
+		const auto _2xy = _2x * i_y;
+		const auto _2xz = _2x * i_z;
+		const auto _2xw = _2x * i_w;
+		const auto _2yy = _2y * i_y;
+		const auto _2yz = _2y * i_z;
+		const auto _2yw = _2y * i_w;
+		const auto _2zz = _2z * i_z;
+		const auto _2zw = _2z * i_w;
+
+		// The floats are stored as columns
+		o_transform[0] = 1.0f - _2yy - _2zz;
+		o_transform[1] = _2xy + _2zw;
+		o_transform[2] = _2xz - _2yw;
+		o_transform[3] = 0.0f;
+
+		o_transform[4] = _2xy - _2zw;
+		o_transform[5] = 1.0f - _2xx - _2zz;
+		o_transform[6] = _2yz + _2xw;
+		o_transform[7] = 0.0f;
+
+		o_transform[8] = _2xz + _2yw;
+		o_transform[9] = _2yz - _2xw;
+		o_transform[10] = 1.0f - _2xx - _2yy;
+		o_transform[11] = 0.0f;
+
+		o_transform[12] = i_translation_x;
+		o_transform[13] = i_translation_y;
+		o_transform[14] = i_translation_z;
+		o_transform[15] = 1.0f;
+	}
+
+	void TransformPoint( const eae6320::Math::cMatrix_transformation& i_transform,
+		const float i_x, const float i_y, const float i_z,
+		float& o_x, float& o_y, float& o_z )
+	{
+		// The output might be the same as the input
+		// and so every component is calculated before any is written
+		const auto x = ( i_transform.GetElement( 0, 0 ) * i_x ) + ( i_transform.GetElement( 0, 1 ) * i_y ) + ( i_transform.GetElement( 0, 2 ) * i_z )
+			+ i_transform.GetElement( 0, 3 );
+		const auto y = ( i_transform.GetElement( 1, 0 ) * i_x ) + ( i_transform.GetElement( 1, 1 ) * i_y ) + ( i_transform.GetElement( 1, 2 ) * i_z )
+			+ i_transform.GetElement( 1, 3 );
+		const auto z = ( i_transform.GetElement( 2, 0 ) * i_x ) + ( i_transform.GetElement( 2, 1 ) * i_y ) + ( i_transform.GetElement( 2, 2 ) * i_z )
+			+ i_transform.GetElement( 2, 3 );
+		o_x = x;
+		o_y = y;
+		o_z = z;
+	}
+
+	void CalculateNlerp( const float ( &i_from )[4], const float ( &i_to )[4], const float i_t, float ( &o_result )[4] )
+	{
+		const auto dot = ( i_from[0] * i_to[0] ) + ( i_from[1] * i_to[1] ) + ( i_from[2] * i_to[2] ) + ( i_from[3] * i_to[3] );
+		const auto toScale = ( dot < 0.0f ) ? -1.0f : 1.0f;
+		float result[4];
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			result[i] = i_from[i] + ( ( ( i_to[i] * toScale ) - i_from[i] ) * i_t );
+		}
+		const auto length = std::sqrt( ( result[0] * result[0] ) + ( result[1] * result[1] ) + ( result[2] * result[2] ) + ( result[3] * result[3] ) );
+		EAE6320_ASSERTF( length > 0.0f, "Can't divide by zero" );
+		const auto length_reciprocal = 1.0f / length;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			o_result[i] = result[i] * length_reciprocal;
+		}
+	}
+
+	void CalculateSlerp( const float ( &i_from )[4], const float ( &i_to )[4], const float i_t, float ( &o_result )[4] )
+	{
+		auto cosAngle = ( i_from[0] * i_to[0] ) + ( i_from[1] * i_to[1] ) + ( i_from[2] * i_to[2] ) + ( i_from[3] * i_to[3] );
+		auto toScale = 1.0f;
+		if ( cosAngle < 0.0f )
+		{
+			cosAngle = -cosAngle;
+			toScale = -1.0f;
+		}
+		if ( cosAngle > eae6320::Math::cQuaternion::NlerpThreshold_cosAngle )
+		{
+			CalculateNlerp( i_from, i_to, i_t, o_result );
+			return;
+		}
+		const auto angle = eae6320::Math::Acos_fast( cosAngle );
+		const auto sinAngle_reciprocal = 1.0f / eae6320::Math::Sin_fast( angle );
+		const auto fromScale = eae6320::Math::Sin_fast( ( 1.0f - i_t ) * angle ) * sinAngle_reciprocal;
+		toScale *= eae6320::Math::Sin_fast( i_t * angle ) * sinAngle_reciprocal;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			o_result[i] = ( i_from[i] * fromScale ) + ( i_to[i] * toScale );
+		}
+	}
+
+	void CalculateRotation( float ( &io_orientation )[4], const float i_angularSpeed,
+		const float i_axis_x, const float i_axis_y, const float i_axis_z, const float i_secondCount )
+	{
+		float sin_angle_half, cos_angle_half;
+		eae6320::Math::SinCos_fast( ( i_angularSpeed * i_secondCount ) * 0.5f, sin_angle_half, cos_angle_half );
+		const float rotation[] = { cos_angle_half, i_axis_x * sin_angle_half, i_axis_y * sin_angle_half, i_axis_z * sin_angle_half };
+		const auto& orientation = io_orientation;
+		const float result[] =
+		{
+			( orientation[0] * rotation[0] ) - ( ( orientation[1] * rotation[1] ) + ( orientation[2] * rotation[2] ) + ( orientation[3] * rotation[3] ) ),
+			( orientation[0] * rotation[1] ) + ( orientation[1] * rotation[0] ) + ( ( orientation[2] * rotation[3] ) - ( orientation[3] * rotation[2] ) ),
+			( orientation[0] * rotation[2] ) + ( orientation[2] * rotation[0] ) + ( ( orientation[3] * rotation[1] ) - ( orientation[1] * rotation[3] ) ),
+			( orientation[0] * rotation[3] ) + ( orientation[3] * rotation[0] ) + ( ( orientation[1] * rotation[2] ) - ( orientation[2] * rotation[1] ) ),
+		};
+		const auto length = std::sqrt( ( result[0] * result[0] ) + ( result[1] * result[1] ) + ( result[2] * result[2] ) + ( result[3] * result[3] ) );
+		EAE6320_ASSERTF( length > 0.0f, "Can't divide by zero" );
+		const auto length_reciprocal = 1.0f / length;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			io_orientation[i] = result[i] * length_reciprocal;
+		}
+	}
+
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+
+	void CalculateRotationElements( const __m128 i_w, const __m128 i_x, const __m128 i_y, const __m128 i_z,
+		__m128 ( &o_elements )[3][3] )
+	{
+		const auto one = _mm_set1_ps( 1.0f );
+
+		const auto _2x = _mm_add_ps( i_x, i_x );
+		const auto _2y = _mm_add_ps( i_y, i_y );
+		const auto _2z = _mm_add_ps( i_z, i_z );
+		const auto _2xx = _mm_mul_ps( i_x, _2x );
+		const auto _2xy = _mm_mul_ps( _2x, i_y );
+		const auto _2xz = _mm_mul_ps( _2x, i_z );
+		const auto _2xw = _mm_mul_ps( _2x, i_w );
+		const auto _2yy = _mm_mul_ps( _2y, i_y );
+		const auto _2yz = _mm_mul_ps( _2y, i_z );
+		const auto _2yw = _mm_mul_ps( _2y, i_w );
+		const auto _2zz = _mm_mul_ps( _2z, i_z );
+		const auto _2zw = _mm_mul_ps( _2z, i_w );
+
+		o_elements[0][0] = _mm_sub_ps( _mm_sub_ps( one, _2yy ), _2zz );
+		o_elements[0][1] = _mm_sub_ps( _2xy, _2zw );
+		o_elements[0][2] = _mm_add_ps( _2xz, _2yw );
+
+		o_elements[1][0] = _mm_add_ps( _2xy, _2zw );
+		o_elements[1][1] = _mm_sub_ps( _mm_sub_ps( one, _2xx ), _2zz );
+		o_elements[1][2] = _mm_sub_ps( _2yz, _2xw );
+
+		o_elements[2][0] = _mm_sub_ps( _2xz, _2yw );
+		o_elements[2][1] = _mm_add_ps( _2yz, _2xw );
+		o_elements[2][2] = _mm_sub_ps( _mm_sub_ps( one, _2xx ), _2yy );
+	}
+
+	void NormalizeQuaternions( __m128& io_w, __m128& io_x, __m128& io_y, __m128& io_z )
+	{
+		const auto length = _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_add_ps(
+			_mm_mul_ps( io_w, io_w ), _mm_mul_ps( io_x, io_x ) ), _mm_mul_ps( io_y, io_y ) ), _mm_mul_ps( io_z, io_z ) ) );
+		const auto length_reciprocal = _mm_div_ps( _mm_set1_ps( 1.0f ), length );
+		io_w = _mm_mul_ps( io_w, length_reciprocal );
+		io_x = _mm_mul_ps( io_x, length_reciprocal );
+		io_y = _mm_mul_ps( io_y, length_reciprocal );
+		io_z = _mm_mul_ps( io_z, length_reciprocal );
+	}
+
+	void CalculateSinCos_fast( const __m128 i_anglesInRadians, __m128& o_sin, __m128& o_cos )
+	{
+		// See eae6320::Math::SinCos_fast() for an explanation
+		const auto isNonNegative = _mm_cmpge_ps( i_anglesInRadians, _mm_setzero_ps() );
+		const auto quadrant = _mm_cvttps_epi32( _mm_add_ps( _mm_mul_ps( i_anglesInRadians, _mm_set1_ps( 2.0f / eae6320::Math::Pi ) ),
+			Select( isNonNegative, _mm_set1_ps( 0.5f ), _mm_set1_ps( -0.5f ) ) ) );
+		const auto quadrant_float = _mm_cvtepi32_ps( quadrant );
+		auto angle = _mm_sub_ps( i_anglesInRadians, _mm_mul_ps( quadrant_float, _mm_set1_ps( 1.5703125f ) ) );
+		angle = _mm_sub_ps( angle, _mm_mul_ps( quadrant_float, _mm_set1_ps( 4.83751297e-4f ) ) );
+		angle = _mm_sub_ps( angle, _mm_mul_ps( quadrant_float, _mm_set1_ps( 7.54978995e-8f ) ) );
+		const auto angle_squared = _mm_mul_ps( angle, angle );
+		const auto sin_reduced = _mm_add_ps( angle, _mm_mul_ps( _mm_mul_ps( angle, angle_squared ),
+			_mm_add_ps( _mm_set1_ps( -1.6666654611e-1f ), _mm_mul_ps( angle_squared,
+				_mm_add_ps( _mm_set1_ps( 8.3321608736e-3f ), _mm_mul_ps( angle_squared, _mm_set1_ps( -1.9515295891e-4f ) ) ) ) ) ) );
+		const auto cos_reduced = _mm_add_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), _mm_mul_ps( _mm_set1_ps( 0.5f ), angle_squared ) ),
+			_mm_mul_ps( _mm_mul_ps( angle_squared, angle_squared ),
+				_mm_add_ps( _mm_set1_ps( 4.166664568e-2f ), _mm_mul_ps( angle_squared,
+					_mm_add_ps( _mm_set1_ps( -1.388731625e-3f ), _mm_mul_ps( angle_squared, _mm_set1_ps( 2.443315712e-5f ) ) ) ) ) ) );
+		// Odd quadrants swap the sine and cosine,
+		// the sine is negated in the third and fourth quadrants,
+		// and the cosine is negated in the second and third quadrants
+		const auto isOdd = _mm_castsi128_ps( _mm_cmpeq_epi32( _mm_and_si128( quadrant, _mm_set1_epi32( 1 ) ), _mm_set1_epi32( 1 ) ) );
+		const auto negation_sin = _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( quadrant, _mm_set1_epi32( 2 ) ), 30 ) );
+		const auto negation_cos = _mm_castsi128_ps( _mm_slli_epi32(
+			_mm_and_si128( _mm_add_epi32( quadrant, _mm_set1_epi32( 1 ) ), _mm_set1_epi32( 2 ) ), 30 ) );
+		o_sin = _mm_xor_ps( Select( isOdd, cos_reduced, sin_reduced ), negation_sin );
+		o_cos = _mm_xor_ps( Select( isOdd, sin_reduced, cos_reduced ), negation_cos );
+	}
+
+	__m128 CalculateSin_fast( const __m128 i_anglesInRadians )
+	{
+		__m128 sin, cos;
+		CalculateSinCos_fast( i_anglesInRadians, sin, cos );
+		return sin;
+	}
+
+	__m128 CalculateAcos_fast( const __m128 i_values )
+	{
+		// See eae6320::Math::Acos_fast() for an explanation
+		const auto values_abs = _mm_andnot_ps( _mm_set1_ps( -0.0f ), i_values );
+		auto polynomial = _mm_set1_ps( -0.0012624911f );
+		polynomial = _mm_add_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.0066700901f ) );
+		polynomial = _mm_sub_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.0170881256f ) );
+		polynomial = _mm_add_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.0308918810f ) );
+		polynomial = _mm_sub_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.0501743046f ) );
+		polynomial = _mm_add_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.0889789874f ) );
+		polynomial = _mm_sub_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 0.2145988016f ) );
+		polynomial = _mm_add_ps( _mm_mul_ps( polynomial, values_abs ), _mm_set1_ps( 1.5707963050f ) );
+		const auto result = _mm_mul_ps( _mm_sqrt_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), values_abs ) ), polynomial );
+		return Select( _mm_cmpge_ps( i_values, _mm_setzero_ps() ), result, _mm_sub_ps( _mm_set1_ps( eae6320::Math::Pi ), result ) );
+	}
+
+	__m128 Select( const __m128 i_mask, const __m128 i_ifTrue, const __m128 i_ifFalse )
+	{
+		return _mm_or_ps( _mm_and_ps( i_mask, i_ifTrue ), _mm_andnot_ps( i_mask, i_ifFalse ) );
+	}
+
+#endif
+}
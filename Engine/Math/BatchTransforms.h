@@ -0,0 +1,149 @@
+/*
+	This file declares functions that transform or interpolate many objects with a single call
+
+	The per-object inputs are passed as a structure of arrays
+	(e.g. every object's X in one array, every object's Y in another, and so on),
+	and so the SIMD versions calculate four objects at once
+	rather than trying to parallelize the math of a single object.
+	This means that the cost per object is mostly the cost of reading and writing its data.
+
+	The results are identical to calling the equivalent single-object function for every object.
+*/
+
+#ifndef EAE6320_MATH_BATCHTRANSFORMS_H
+#define EAE6320_MATH_BATCHTRANSFORMS_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class cMatrix_transformation;
+		class cQuaternion;
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Math
+	{
+		namespace BatchTransforms
+		{
+			// Spans
+			//------
+
+			// Each pointer points to an array with one element for every object
+			// (there are no alignment requirements)
+
+			struct sVectorSpans
+			{
+				float* x = nullptr;
+				float* y = nullptr;
+				float* z = nullptr;
+			};
+
+			struct sConstVectorSpans
+			{
+				const float* x = nullptr;
+				const float* y = nullptr;
+				const float* z = nullptr;
+
+				sConstVectorSpans() = default;
+				sConstVectorSpans( const float* const i_x, const float* const i_y, const float* const i_z ) : x( i_x ), y( i_y ), z( i_z ) {}
+				sConstVectorSpans( const sVectorSpans& i_spans ) : x( i_spans.x ), y( i_spans.y ), z( i_spans.z ) {}
+			};
+
+			struct sQuaternionSpans
+			{
+				float* w = nullptr;
+				float* x = nullptr;
+				float* y = nullptr;
+				float* z = nullptr;
+			};
+
+			// The quaternions must be normalized
+			// (just like the quaternion that is used to create a single cMatrix_transformation)
+			struct sConstQuaternionSpans
+			{
+				const float* w = nullptr;
+				const float* x = nullptr;
+				const float* y = nullptr;
+				const float* z = nullptr;
+
+				sConstQuaternionSpans() = default;
+				sConstQuaternionSpans( const float* const i_w, const float* const i_x, const float* const i_y, const float* const i_z )
+					: w( i_w ), x( i_x ), y( i_y ), z( i_z ) {}
+				sConstQuaternionSpans( const sQuaternionSpans& i_spans ) : w( i_spans.w ), x( i_spans.x ), y( i_spans.y ), z( i_spans.z ) {}
+			};
+
+			// Transforms
+			//-----------
+
+			// Creates a local-to-world transform for every rotation and translation
+			// (the same as cMatrix_transformation( rotation, translation ) for each object)
+			void CreateTransforms( const sConstQuaternionSpans& i_rotations, const sConstVectorSpans& i_translations, const size_t i_count,
+				cMatrix_transformation* const o_transforms );
+			// Creates the same transforms as CreateTransforms() but only outputs the top three rows of each,
+			// as 12 floats per object (row-major, with the translation as the last element of each row).
+			// This is the format that shaders usually expect for instanced or skinned transforms
+			// (the bottom row of an affine transform is always [0, 0, 0, 1] and doesn't need to be uploaded)
+			void CreateTransforms_3x4( const sConstQuaternionSpans& i_rotations, const sConstVectorSpans& i_translations, const size_t i_count,
+				float* const o_transforms );
+
+			// Transforms every point by the same transform
+			// (the same as i_transform * point for each point).
+			// The output spans may be the same as the input spans.
+			void TransformPoints( const cMatrix_transformation& i_transform, const sConstVectorSpans& i_points, const size_t i_count,
+				const sVectorSpans& o_points );
+
+			// Concatenates a single transform with every transform in the list
+			// (the same as cMatrix_transformation::ConcatenateAffine( i_nextTransform, firstTransform ) for each transform;
+			// e.g. a world-to-camera transform with every object's local-to-world transform).
+			// The output list may be the same as the input list.
+			void ConcatenateAffine( const cMatrix_transformation& i_nextTransform,
+				const cMatrix_transformation* const i_firstTransforms, const size_t i_count,
+				cMatrix_transformation* const o_transforms );
+
+			// Interpolation
+			//--------------
+
+			// Interpolates every pair of rotations by its own interpolation factor
+			// (the same as cQuaternion::Nlerp() or cQuaternion::Slerp() for each pair).
+			// The output spans may be the same as either of the input spans.
+			void Nlerp( const sConstQuaternionSpans& i_from, const sConstQuaternionSpans& i_to, const float* const i_ts, const size_t i_count,
+				const sQuaternionSpans& o_results );
+			void Slerp( const sConstQuaternionSpans& i_from, const sConstQuaternionSpans& i_to, const float* const i_ts, const size_t i_count,
+				const sQuaternionSpans& o_results );
+
+			// Rotation
+			//---------
+
+			// Rotates every orientation around its own local axis by its own angular speed for the same amount of time and renormalizes it
+			// (the same as ( orientation * cQuaternion::CreateFromAngleAxis_fast( angularSpeed * i_secondCount, axis ) ).GetNormalized()
+			// for each object; e.g. integrating the orientations of rigid bodies).
+			// The axes must be normalized.
+			void Rotate( const sQuaternionSpans& io_orientations, const float* const i_angularSpeeds, const sConstVectorSpans& i_axesOfRotation_local,
+				const size_t i_count, const float i_secondCount );
+
+			// Conversion
+			//-----------
+
+			// These copy quaternions to or from spans
+			// (e.g. to store a single object's rotation in a structure of arrays)
+			void CopyToSpans( const cQuaternion* const i_quaternions, const size_t i_count, const sQuaternionSpans& o_spans );
+			void CopyFromSpans( const sConstQuaternionSpans& i_spans, const size_t i_count, cQuaternion* const o_quaternions );
+		}
+	}
+}
+
+#endif	// EAE6320_MATH_BATCHTRANSFORMS_H
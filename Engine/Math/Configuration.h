@@ -0,0 +1,23 @@
+/*
+	This file provides configurable settings
+	that can be used to modify the math project
+*/
+
+#ifndef EAE6320_MATH_CONFIGURATION_H
+#define EAE6320_MATH_CONFIGURATION_H
+
+// SIMD versions of the hottest math functions are used
+// when the compiler is targeting an instruction set that supports them
+// (every x64 CPU supports SSE2, but AVX must be enabled explicitly, e.g. with /arch:AVX).
+// Defining EAE6320_MATH_DISABLESIMD uses the portable scalar versions instead,
+// which is useful for comparing results.
+#ifndef EAE6320_MATH_DISABLESIMD
+	#if defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) || defined( __SSE2__ )
+		#define EAE6320_MATH_ISSSE2ENABLED
+	#endif
+	#if defined( EAE6320_MATH_ISSSE2ENABLED ) && defined( __AVX__ )
+		#define EAE6320_MATH_ISAVXENABLED
+	#endif
+#endif
+
+#endif	// EAE6320_MATH_CONFIGURATION_H
@@ -13,3 +13,26 @@ float eae6320::Math::ConvertHorizontalFieldOfViewToVerticalFieldOfView( const fl
 {
 	return 2.0f * std::atan( std::tan( i_horizontalFieldOfView_inRadians * 0.5f ) / i_aspectRatio );
 }
+
+// Compile-Time Tests
+//===================
+
+// These are evaluated every time that this file is compiled
+
+namespace
+{
+	constexpr bool AreNearlyEqual( const float i_lhs, const float i_rhs )
+	{
+		return ( ( i_lhs - i_rhs ) < 1.0e-6f ) && ( ( i_rhs - i_lhs ) < 1.0e-6f );
+	}
+}
+
+static_assert( eae6320::Math::Sqrt_constexpr( 4.0f ) == 2.0f, "The square root of a perfect square isn't exact" );
+static_assert( eae6320::Math::Sqrt_constexpr( 0.0f ) == 0.0f, "The square root of zero isn't zero" );
+static_assert( AreNearlyEqual( eae6320::Math::Sqrt_constexpr( 2.0f ), 1.41421356f ), "The square root of two is wrong" );
+static_assert( eae6320::Math::Sin_constexpr( 0.0f ) == 0.0f, "The sine of zero isn't zero" );
+static_assert( eae6320::Math::Cos_constexpr( 0.0f ) == 1.0f, "The cosine of zero isn't one" );
+static_assert( AreNearlyEqual( eae6320::Math::Sin_constexpr( eae6320::Math::Pi / 6.0f ), 0.5f ), "The sine of 30 degrees is wrong" );
+static_assert( AreNearlyEqual( eae6320::Math::Cos_constexpr( eae6320::Math::Pi ), -1.0f ), "The cosine of 180 degrees is wrong" );
+static_assert( AreNearlyEqual( eae6320::Math::Sin_constexpr( eae6320::Math::Pi * 2.5f ), 1.0f ), "Angles outside of [-pi, pi] aren't reduced" );
+static_assert( AreNearlyEqual( eae6320::Math::Tan_constexpr( eae6320::Math::Pi * 0.25f ), 1.0f ), "The tangent of 45 degrees is wrong" );
@@ -14,7 +14,7 @@ namespace eae6320
 		// Interface
 		//==========
 
-		float ConvertDegreesToRadians( const float i_degrees );
+		constexpr float ConvertDegreesToRadians( const float i_degrees );
 		float ConvertHorizontalFieldOfViewToVerticalFieldOfView( const float i_horizontalFieldOfView_inRadians,
 			// aspectRatio = width / height
 			const float i_aspectRatio );
@@ -25,6 +25,49 @@ namespace eae6320
 		// If the multiple is known to be a power-of-2 this is cheaper than the previous function
 		template<typename tUnsignedInteger, class EnforceUnsigned = typename std::enable_if<std::is_unsigned<tUnsignedInteger>::value>::type>
 			tUnsignedInteger RoundUpToMultiple_powerOf2( const tUnsignedInteger i_value, const tUnsignedInteger i_multipleWhichIsAPowerOf2 );
+
+		// Compile-Time Functions
+		//-----------------------
+
+		// The standard library's square root and trigonometric functions can't be evaluated by the compiler,
+		// and so these versions can be used instead when a constant needs them
+		// (e.g. to create a constant transform or to fill a lookup table).
+		// They are calculated with doubles and are accurate to float precision,
+		// but they are much slower than the standard library's versions and shouldn't be used at run time.
+		// The value must not be negative (and none of the inputs can be infinite or NaN)
+		constexpr float Sqrt_constexpr( const float i_value );
+		constexpr float Sin_constexpr( const float i_angleInRadians );
+		constexpr float Cos_constexpr( const float i_angleInRadians );
+		constexpr float Tan_constexpr( const float i_angleInRadians );
+
+		// Fast Approximations
+		//--------------------
+
+		// These are cheaper than the standard library's functions but slightly less accurate,
+		// and so they should be used where small errors can't accumulate
+		// (e.g. when predicting an orientation to render, but not when integrating one that is simulated).
+		// The maximum errors listed below were measured against double-precision results
+		// by sweeping across the entire valid range of inputs.
+		// There is only this one tier of accuracy because the standard library's functions already are the accurate tier:
+		// The errors are only a few times bigger than the rounding error of a float,
+		// and getting rid of them would need more polynomial terms (or another Newton step)
+		// that would make these cost about as much as the standard library's functions
+		// (Benchmarks/Math/Functions.cpp compares them).
+
+		// The value must be positive (but it can be denormal).
+		// The relative error is less than 3e-7
+		// (this uses the SIMD reciprocal square root estimate refined with a Newton step;
+		// when SIMD is disabled it is calculated with full precision instead)
+		float ReciprocalSqrt_fast( const float i_value );
+		// The angle must be within [-8192, 8192] radians.
+		// The absolute error is less than 1e-7
+		// (calculating both results together is cheaper than calculating them separately)
+		void SinCos_fast( const float i_angleInRadians, float& o_sin, float& o_cos );
+		float Sin_fast( const float i_angleInRadians );
+		float Cos_fast( const float i_angleInRadians );
+		// The value must be within [-1, 1].
+		// The absolute error is less than 5e-7 radians
+		float Acos_fast( const float i_value );
 	}
 }
 
@@ -6,14 +6,23 @@
 
 #include "Functions.h"
 
+#include "Configuration.h"
 #include "Constants.h"
 
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <Engine/Asserts/Asserts.h>
 
+#ifdef EAE6320_MATH_ISSSE2ENABLED
+	#include <xmmintrin.h>
+#endif
+
 // Interface
 //==========
 
-inline float eae6320::Math::ConvertDegreesToRadians( const float i_degrees )
+constexpr float eae6320::Math::ConvertDegreesToRadians( const float i_degrees )
 {
 	return i_degrees * ( Pi / 180.0f );
 }
@@ -48,4 +57,159 @@ template<typename tUnsignedInteger, class EnforceUnsigned>
 	return returnValue;
 }
 
+// Compile-Time Functions
+//-----------------------
+
+constexpr float eae6320::Math::Sqrt_constexpr( const float i_value )
+{
+	if ( !( i_value > 0.0f ) )
+	{
+		return 0.0f;
+	}
+	// Newton's method converges from above when the first guess is greater than the square root,
+	// and so the iterations stop as soon as the guess stops getting smaller
+	const double value = i_value;
+	double guess = ( value >= 1.0 ) ? value : 1.0;
+	while ( true )
+	{
+		const auto nextGuess = 0.5 * ( guess + ( value / guess ) );
+		if ( nextGuess >= guess )
+		{
+			break;
+		}
+		guess = nextGuess;
+	}
+	return static_cast<float>( guess );
+}
+
+constexpr float eae6320::Math::Sin_constexpr( const float i_angleInRadians )
+{
+	// The angle is reduced to [-pi, pi] so that a fixed number of terms of the Taylor series is always enough
+	constexpr double pi = 3.14159265358979323846;
+	constexpr double twoPi = pi * 2.0;
+	double angle = i_angleInRadians;
+	{
+		const auto turnCount = angle / twoPi;
+		angle -= static_cast<double>( static_cast<long long>( turnCount + ( ( turnCount >= 0.0 ) ? 0.5 : -0.5 ) ) ) * twoPi;
+	}
+	const auto angle_squared = angle * angle;
+	auto term = angle;
+	auto sum = angle;
+	for ( int i = 1; i < 16; ++i )
+	{
+		term *= -angle_squared / static_cast<double>( ( 2 * i ) * ( ( 2 * i ) + 1 ) );
+		sum += term;
+	}
+	return static_cast<float>( sum );
+}
+
+constexpr float eae6320::Math::Cos_constexpr( const float i_angleInRadians )
+{
+	constexpr double pi = 3.14159265358979323846;
+	constexpr double twoPi = pi * 2.0;
+	double angle = i_angleInRadians;
+	{
+		const auto turnCount = angle / twoPi;
+		angle -= static_cast<double>( static_cast<long long>( turnCount + ( ( turnCount >= 0.0 ) ? 0.5 : -0.5 ) ) ) * twoPi;
+	}
+	const auto angle_squared = angle * angle;
+	double term = 1.0;
+	double sum = 1.0;
+	for ( int i = 1; i < 16; ++i )
+	{
+		term *= -angle_squared / static_cast<double>( ( ( 2 * i ) - 1 ) * ( 2 * i ) );
+		sum += term;
+	}
+	return static_cast<float>( sum );
+}
+
+constexpr float eae6320::Math::Tan_constexpr( const float i_angleInRadians )
+{
+	return Sin_constexpr( i_angleInRadians ) / Cos_constexpr( i_angleInRadians );
+}
+
+// Fast Approximations
+//--------------------
+
+inline float eae6320::Math::ReciprocalSqrt_fast( const float i_value )
+{
+	EAE6320_ASSERTF( i_value > 0.0f, "The value must be positive" );
+#ifdef EAE6320_MATH_ISSSE2ENABLED
+	// The estimate treats a denormal value as zero (and would return infinity),
+	// and so a denormal value is scaled by 2^24 into the normal range and the result is scaled back by 2^12
+	const auto isDenormal = i_value < FLT_MIN;
+	const auto value = isDenormal ? ( i_value * 16777216.0f ) : i_value;
+	// The estimate is accurate to about 12 bits,
+	// and a single Newton-Raphson iteration roughly doubles that
+	const auto estimate = _mm_cvtss_f32( _mm_rsqrt_ss( _mm_set_ss( value ) ) );
+	const auto result = estimate * ( 1.5f - ( ( 0.5f * value ) * ( estimate * estimate ) ) );
+	return isDenormal ? ( result * 4096.0f ) : result;
+#else
+	return 1.0f / std::sqrt( i_value );
+#endif
+}
+
+inline void eae6320::Math::SinCos_fast( const float i_angleInRadians, float& o_sin, float& o_cos )
+{
+	EAE6320_ASSERTF( ( i_angleInRadians >= -8192.0f ) && ( i_angleInRadians <= 8192.0f ), "The angle is too big to be reduced accurately" );
+	// The angle is reduced to [-pi/4, pi/4] by subtracting the nearest multiple of pi/2
+	// (which is split into three parts so that the subtraction doesn't lose precision),
+	// and then the multiple decides which quadrant the results are in
+	const auto quadrant = static_cast<int>( ( i_angleInRadians * ( 2.0f / Pi ) ) + ( ( i_angleInRadians >= 0.0f ) ? 0.5f : -0.5f ) );
+	const auto quadrant_float = static_cast<float>( quadrant );
+	auto angle = i_angleInRadians - ( quadrant_float * 1.5703125f );
+	angle -= quadrant_float * 4.83751297e-4f;
+	angle -= quadrant_float * 7.54978995e-8f;
+	// Minimax polynomials for the reduced range
+	const auto angle_squared = angle * angle;
+	const auto sin_reduced = angle + ( ( angle * angle_squared )
+		* ( -1.6666654611e-1f + ( angle_squared * ( 8.3321608736e-3f + ( angle_squared * -1.9515295891e-4f ) ) ) ) );
+	const auto cos_reduced = ( 1.0f - ( 0.5f * angle_squared ) ) + ( ( angle_squared * angle_squared )
+		* ( 4.166664568e-2f + ( angle_squared * ( -1.388731625e-3f + ( angle_squared * 2.443315712e-5f ) ) ) ) );
+	// The results are selected with bit operations because the quadrant of an arbitrary angle can't be predicted
+	// (and so branches would often be mispredicted):
+	// Odd quadrants swap the results, the sine is negated in quadrants 2 and 3, and the cosine in quadrants 1 and 2
+	uint32_t sin_reduced_bits, cos_reduced_bits;
+	std::memcpy( &sin_reduced_bits, &sin_reduced, sizeof( float ) );
+	std::memcpy( &cos_reduced_bits, &cos_reduced, sizeof( float ) );
+	const auto quadrant_bits = static_cast<uint32_t>( quadrant );
+	const auto swapMask = 0u - ( quadrant_bits & 1u );
+	const auto sin_bits = ( ( sin_reduced_bits & ~swapMask ) | ( cos_reduced_bits & swapMask ) ) ^ ( ( quadrant_bits & 2u ) << 30 );
+	const auto cos_bits = ( ( cos_reduced_bits & ~swapMask ) | ( sin_reduced_bits & swapMask ) ) ^ ( ( ( quadrant_bits + 1u ) & 2u ) << 30 );
+	std::memcpy( &o_sin, &sin_bits, sizeof( float ) );
+	std::memcpy( &o_cos, &cos_bits, sizeof( float ) );
+}
+
+inline float eae6320::Math::Sin_fast( const float i_angleInRadians )
+{
+	float sin, cos;
+	SinCos_fast( i_angleInRadians, sin, cos );
+	return sin;
+}
+
+inline float eae6320::Math::Cos_fast( const float i_angleInRadians )
+{
+	float sin, cos;
+	SinCos_fast( i_angleInRadians, sin, cos );
+	return cos;
+}
+
+inline float eae6320::Math::Acos_fast( const float i_value )
+{
+	EAE6320_ASSERTF( ( i_value >= -1.0f ) && ( i_value <= 1.0f ), "The value must be within [-1, 1]" );
+	// This is the polynomial approximation from Abramowitz and Stegun (4.4.46) for [0, 1],
+	// mirrored for negative values (acos(-x) = pi - acos(x))
+	const auto value_abs = std::abs( i_value );
+	auto polynomial = -0.0012624911f;
+	polynomial = ( polynomial * value_abs ) + 0.0066700901f;
+	polynomial = ( polynomial * value_abs ) - 0.0170881256f;
+	polynomial = ( polynomial * value_abs ) + 0.0308918810f;
+	polynomial = ( polynomial * value_abs ) - 0.0501743046f;
+	polynomial = ( polynomial * value_abs ) + 0.0889789874f;
+	polynomial = ( polynomial * value_abs ) - 0.2145988016f;
+	polynomial = ( polynomial * value_abs ) + 1.5707963050f;
+	const auto result = std::sqrt( 1.0f - value_abs ) * polynomial;
+	return ( i_value >= 0.0f ) ? result : ( Pi - result );
+}
+
 #endif	// EAE6320_MATH_FUNCTIONS_INL
\ No newline at end of file
@@ -0,0 +1,301 @@
+// Include Files
+//==============
+
+#include "Geometry.h"
+
+#include "cMatrix_transformation.h"
+#include "Configuration.h"
+
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	#include <xmmintrin.h>
+#endif
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Creates a normalized plane from the plane equation ( a * x ) + ( b * y ) + ( c * z ) + d = 0
+	eae6320::Math::sPlane CreatePlane( const float i_a, const float i_b, const float i_c, const float i_d );
+}
+
+// Interface
+//==========
+
+// Shapes
+//-------
+
+eae6320::Math::sFrustum eae6320::Math::sFrustum::CreateFromTransform( const cMatrix_transformation& i_transform_toProjected )
+{
+	// A position is inside the frustum if its projected position is inside the clip volume:
+	//	-w <= x <= w, -w <= y <= w, and (depending on the platform) 0 <= z <= w or -w <= z <= w
+	// Each of those inequalities is a plane made from rows of the transform
+	// (this is the "Gribb/Hartmann" method)
+	float rows[4][4];
+	for ( unsigned int r = 0; r < 4; ++r )
+	{
+		for ( unsigned int c = 0; c < 4; ++c )
+		{
+			rows[r][c] = i_transform_toProjected.GetElement( r, c );
+		}
+	}
+	const auto combineRows = []( const float ( &i_lhs )[4], const float ( &i_rhs )[4], const float i_rhsScale )
+	{
+		return CreatePlane( i_lhs[0] + ( i_rhs[0] * i_rhsScale ), i_lhs[1] + ( i_rhs[1] * i_rhsScale ),
+			i_lhs[2] + ( i_rhs[2] * i_rhsScale ), i_lhs[3] + ( i_rhs[3] * i_rhsScale ) );
+	};
+
+	sFrustum frustum;
+	frustum.planes[Left] = combineRows( rows[3], rows[0], 1.0f );
+	frustum.planes[Right] = combineRows( rows[3], rows[0], -1.0f );
+	frustum.planes[Bottom] = combineRows( rows[3], rows[1], 1.0f );
+	frustum.planes[Top] = combineRows( rows[3], rows[1], -1.0f );
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
+	// Direct3D's projected depth starts at zero
+	// (and the null platform uses the same projection as Direct3D)
+	frustum.planes[Near] = CreatePlane( rows[2][0], rows[2][1], rows[2][2], rows[2][3] );
+#elif defined( EAE6320_PLATFORM_GL )
+	// OpenGL's projected depth starts at -w
+	frustum.planes[Near] = combineRows( rows[3], rows[2], 1.0f );
+#endif
+	frustum.planes[Far] = combineRows( rows[3], rows[2], -1.0f );
+	return frustum;
+}
+
+// Single Tests
+//-------------
+
+bool eae6320::Math::Raycast( const sRay& i_ray, const sAxisAlignedBox& i_box, const float i_maximumDistance, float& o_hitDistance )
+{
+	// The ray is inside of each pair of slabs between two distances,
+	// and it hits the box if the three ranges overlap.
+	// If a direction is zero its reciprocal is infinite,
+	// which makes that range either everything (if the origin is between the slabs) or nothing.
+	// The comparisons are written the same way as the SIMD min/max instructions
+	// so that a NaN (from zero times infinity) never replaces a valid distance
+	auto nearestDistance = 0.0f;
+	auto farthestDistance = i_maximumDistance;
+	const float origin[] = { i_ray.origin.x, i_ray.origin.y, i_ray.origin.z };
+	const float direction[] = { i_ray.direction.x, i_ray.direction.y, i_ray.direction.z };
+	const float minimum[] = { i_box.minimum.x, i_box.minimum.y, i_box.minimum.z };
+	const float maximum[] = { i_box.maximum.x, i_box.maximum.y, i_box.maximum.z };
+	for ( unsigned int i = 0; i < 3; ++i )
+	{
+		const auto direction_reciprocal = 1.0f / direction[i];
+		const auto distance_toMinimum = ( minimum[i] - origin[i] ) * direction_reciprocal;
+		const auto distance_toMaximum = ( maximum[i] - origin[i] ) * direction_reciprocal;
+		const auto distance_enter = ( distance_toMinimum < distance_toMaximum ) ? distance_toMinimum : distance_toMaximum;
+		const auto distance_exit = ( distance_toMinimum > distance_toMaximum ) ? distance_toMinimum : distance_toMaximum;
+		nearestDistance = ( distance_enter > nearestDistance ) ? distance_enter : nearestDistance;
+		farthestDistance = ( distance_exit < farthestDistance ) ? distance_exit : farthestDistance;
+	}
+	if ( nearestDistance <= farthestDistance )
+	{
+		o_hitDistance = nearestDistance;
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool eae6320::Math::Raycast( const sRay& i_ray, const sSphere& i_sphere, const float i_maximumDistance, float& o_hitDistance )
+{
+	// Solve for the distance where the ray's distance to the center is the radius:
+	//	Dot( direction, direction ) * t^2 + 2 * Dot( offset, direction ) * t + Dot( offset, offset ) - radius^2 = 0
+	const auto offset = i_ray.origin - i_sphere.center;
+	const auto b = Dot( offset, i_ray.direction );
+	const auto c = Dot( offset, offset ) - ( i_sphere.radius * i_sphere.radius );
+	if ( c <= 0.0f )
+	{
+		// The ray starts inside of the sphere
+		o_hitDistance = 0.0f;
+		return true;
+	}
+	if ( b > 0.0f )
+	{
+		// The ray starts outside of the sphere and points away from it
+		return false;
+	}
+	const auto a = Dot( i_ray.direction, i_ray.direction );
+	EAE6320_ASSERTF( a > 0.0f, "A ray must have a direction" );
+	const auto discriminant = ( b * b ) - ( a * c );
+	if ( discriminant < 0.0f )
+	{
+		return false;
+	}
+	const auto hitDistance = ( -b - std::sqrt( discriminant ) ) / a;
+	if ( hitDistance <= i_maximumDistance )
+	{
+		o_hitDistance = hitDistance;
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+// Batched Tests
+//--------------
+
+void eae6320::Math::TestOverlaps( const sFrustum& i_frustum,
+	const BatchTransforms::sConstVectorSpans& i_sphereCenters, const float* const i_sphereRadii, const size_t i_count,
+	bool* const o_areOverlapping )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_areOverlapping );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto signBit = _mm_set1_ps( -0.0f );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto center_x = _mm_loadu_ps( i_sphereCenters.x + i );
+			const auto center_y = _mm_loadu_ps( i_sphereCenters.y + i );
+			const auto center_z = _mm_loadu_ps( i_sphereCenters.z + i );
+			const auto radius_negated = _mm_xor_ps( _mm_loadu_ps( i_sphereRadii + i ), signBit );
+			auto isOutside = _mm_setzero_ps();
+			for ( const auto& plane : i_frustum.planes )
+			{
+				const auto distance = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+					_mm_mul_ps( _mm_set1_ps( plane.normal.x ), center_x ), _mm_mul_ps( _mm_set1_ps( plane.normal.y ), center_y ) ),
+					_mm_mul_ps( _mm_set1_ps( plane.normal.z ), center_z ) ), _mm_set1_ps( plane.distance ) );
+				isOutside = _mm_or_ps( isOutside, _mm_cmplt_ps( distance, radius_negated ) );
+			}
+			const auto outsideMask = _mm_movemask_ps( isOutside );
+			for ( unsigned int j = 0; j < 4; ++j )
+			{
+				o_areOverlapping[i + j] = ( ( outsideMask >> j ) & 1 ) == 0;
+			}
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		sSphere sphere;
+		sphere.center = sVector( i_sphereCenters.x[i], i_sphereCenters.y[i], i_sphereCenters.z[i] );
+		sphere.radius = i_sphereRadii[i];
+		o_areOverlapping[i] = IsOverlapping( i_frustum, sphere );
+	}
+}
+
+void eae6320::Math::TestOverlaps( const sFrustum& i_frustum,
+	const BatchTransforms::sConstVectorSpans& i_boxMinimums, const BatchTransforms::sConstVectorSpans& i_boxMaximums, const size_t i_count,
+	bool* const o_areOverlapping )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_areOverlapping );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto signBit = _mm_set1_ps( -0.0f );
+		const auto half = _mm_set1_ps( 0.5f );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const auto minimum_x = _mm_loadu_ps( i_boxMinimums.x + i );
+			const auto minimum_y = _mm_loadu_ps( i_boxMinimums.y + i );
+			const auto minimum_z = _mm_loadu_ps( i_boxMinimums.z + i );
+			const auto maximum_x = _mm_loadu_ps( i_boxMaximums.x + i );
+			const auto maximum_y = _mm_loadu_ps( i_boxMaximums.y + i );
+			const auto maximum_z = _mm_loadu_ps( i_boxMaximums.z + i );
+			const auto center_x = _mm_mul_ps( _mm_add_ps( minimum_x, maximum_x ), half );
+			const auto center_y = _mm_mul_ps( _mm_add_ps( minimum_y, maximum_y ), half );
+			const auto center_z = _mm_mul_ps( _mm_add_ps( minimum_z, maximum_z ), half );
+			const auto halfExtent_x = _mm_mul_ps( _mm_sub_ps( maximum_x, minimum_x ), half );
+			const auto halfExtent_y = _mm_mul_ps( _mm_sub_ps( maximum_y, minimum_y ), half );
+			const auto halfExtent_z = _mm_mul_ps( _mm_sub_ps( maximum_z, minimum_z ), half );
+			auto isOutside = _mm_setzero_ps();
+			for ( const auto& plane : i_frustum.planes )
+			{
+				const auto distance = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+					_mm_mul_ps( _mm_set1_ps( plane.normal.x ), center_x ), _mm_mul_ps( _mm_set1_ps( plane.normal.y ), center_y ) ),
+					_mm_mul_ps( _mm_set1_ps( plane.normal.z ), center_z ) ), _mm_set1_ps( plane.distance ) );
+				const auto projectedRadius = _mm_add_ps( _mm_add_ps(
+					_mm_mul_ps( halfExtent_x, _mm_set1_ps( std::abs( plane.normal.x ) ) ), _mm_mul_ps( halfExtent_y, _mm_set1_ps( std::abs( plane.normal.y ) ) ) ),
+					_mm_mul_ps( halfExtent_z, _mm_set1_ps( std::abs( plane.normal.z ) ) ) );
+				isOutside = _mm_or_ps( isOutside, _mm_cmplt_ps( distance, _mm_xor_ps( projectedRadius, signBit ) ) );
+			}
+			const auto outsideMask = _mm_movemask_ps( isOutside );
+			for ( unsigned int j = 0; j < 4; ++j )
+			{
+				o_areOverlapping[i + j] = ( ( outsideMask >> j ) & 1 ) == 0;
+			}
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		sAxisAlignedBox box;
+		box.minimum = sVector( i_boxMinimums.x[i], i_boxMinimums.y[i], i_boxMinimums.z[i] );
+		box.maximum = sVector( i_boxMaximums.x[i], i_boxMaximums.y[i], i_boxMaximums.z[i] );
+		o_areOverlapping[i] = IsOverlapping( i_frustum, box );
+	}
+}
+
+void eae6320::Math::Raycast( const BatchTransforms::sConstVectorSpans& i_rayOrigins, const BatchTransforms::sConstVectorSpans& i_rayDirections, const size_t i_count,
+	const sAxisAlignedBox& i_box, const float i_maximumDistance,
+	float* const o_hitDistances )
+{
+	EAE6320_ASSERT( ( i_count == 0 ) || o_hitDistances );
+	size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	{
+		const auto one = _mm_set1_ps( 1.0f );
+		const auto miss = _mm_set1_ps( -1.0f );
+		const auto maximumDistance = _mm_set1_ps( i_maximumDistance );
+		const float* const origins[] = { i_rayOrigins.x, i_rayOrigins.y, i_rayOrigins.z };
+		const float* const directions[] = { i_rayDirections.x, i_rayDirections.y, i_rayDirections.z };
+		const __m128 minimums[] = { _mm_set1_ps( i_box.minimum.x ), _mm_set1_ps( i_box.minimum.y ), _mm_set1_ps( i_box.minimum.z ) };
+		const __m128 maximums[] = { _mm_set1_ps( i_box.maximum.x ), _mm_set1_ps( i_box.maximum.y ), _mm_set1_ps( i_box.maximum.z ) };
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			auto nearestDistance = _mm_setzero_ps();
+			auto farthestDistance = maximumDistance;
+			for ( unsigned int a = 0; a < 3; ++a )
+			{
+				const auto origin = _mm_loadu_ps( origins[a] + i );
+				const auto direction_reciprocal = _mm_div_ps( one, _mm_loadu_ps( directions[a] + i ) );
+				const auto distance_toMinimum = _mm_mul_ps( _mm_sub_ps( minimums[a], origin ), direction_reciprocal );
+				const auto distance_toMaximum = _mm_mul_ps( _mm_sub_ps( maximums[a], origin ), direction_reciprocal );
+				// The operand order matters if one of them is NaN
+				// (these instructions return the second operand unless the comparison is true)
+				const auto distance_enter = _mm_min_ps( distance_toMinimum, distance_toMaximum );
+				const auto distance_exit = _mm_max_ps( distance_toMinimum, distance_toMaximum );
+				nearestDistance = _mm_max_ps( distance_enter, nearestDistance );
+				farthestDistance = _mm_min_ps( distance_exit, farthestDistance );
+			}
+			const auto isHit = _mm_cmple_ps( nearestDistance, farthestDistance );
+			_mm_storeu_ps( o_hitDistances + i, _mm_or_ps( _mm_and_ps( isHit, nearestDistance ), _mm_andnot_ps( isHit, miss ) ) );
+		}
+	}
+#endif
+	for ( ; i < i_count; ++i )
+	{
+		sRay ray;
+		ray.origin = sVector( i_rayOrigins.x[i], i_rayOrigins.y[i], i_rayOrigins.z[i] );
+		ray.direction = sVector( i_rayDirections.x[i], i_rayDirections.y[i], i_rayDirections.z[i] );
+		float hitDistance;
+		o_hitDistances[i] = Raycast( ray, i_box, i_maximumDistance, hitDistance ) ? hitDistance : -1.0f;
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	eae6320::Math::sPlane CreatePlane( const float i_a, const float i_b, const float i_c, const float i_d )
+	{
+		// The plane is normalized so that distances to it can be compared with radii
+		eae6320::Math::sPlane plane;
+		plane.normal = eae6320::Math::sVector( i_a, i_b, i_c );
+		const auto length = plane.normal.GetLength();
+		EAE6320_ASSERT( length > 0.0f );
+		plane.normal /= length;
+		plane.distance = i_d / length;
+		return plane;
+	}
+}
@@ -0,0 +1,132 @@
+/*
+	This file declares simple geometric shapes
+	and the functions that test whether they intersect
+
+	The tests that involve a frustum are conservative:
+	A shape that is reported as not overlapping is definitely outside of the frustum,
+	but a shape near a corner of the frustum can be reported as overlapping when it is actually outside
+	(which is the right trade-off for culling).
+	The other tests are exact.
+
+	The batched tests take their shapes as a structure of arrays (see BatchTransforms.h),
+	and so the SIMD versions test four shapes at once.
+	Their results are identical to calling the equivalent single-shape function for every shape.
+*/
+
+#ifndef EAE6320_MATH_GEOMETRY_H
+#define EAE6320_MATH_GEOMETRY_H
+
+// Include Files
+//==============
+
+#include "BatchTransforms.h"
+#include "sVector.h"
+
+#include <cstddef>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class cMatrix_transformation;
+	}
+}
+
+// Shapes
+//=======
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// A point is in front of the plane if Dot( normal, point ) + distance > 0
+		// (the normal must be normalized for the distance to be meaningful)
+		struct sPlane
+		{
+			sVector normal;
+			float distance = 0.0f;
+
+			float GetSignedDistance( const sVector& i_point ) const;
+		};
+
+		struct sSphere
+		{
+			sVector center;
+			float radius = 0.0f;
+		};
+
+		struct sAxisAlignedBox
+		{
+			sVector minimum;
+			sVector maximum;
+
+			sVector GetCenter() const;
+			sVector GetHalfExtents() const;
+		};
+
+		// The distance to a hit is measured in multiples of the direction's length
+		// (and so it is a distance in world units if the direction is normalized)
+		struct sRay
+		{
+			sVector origin;
+			sVector direction;
+		};
+
+		// The planes' normals point into the frustum
+		struct sFrustum
+		{
+			enum ePlane
+			{
+				Left, Right, Bottom, Top, Near, Far,
+				Count
+			};
+			sPlane planes[Count];
+
+			// The frustum is extracted from a transform that ends in projected space,
+			// and it is in the space that the transform starts from:
+			//	* A camera-to-projected transform (e.g. from CreateCameraToProjectedTransform_perspective()) creates a frustum in camera space
+			//	* A world-to-projected transform (the camera-to-projected transform multiplied by a world-to-camera transform)
+			//		creates a frustum in world space
+			static sFrustum CreateFromTransform( const cMatrix_transformation& i_transform_toProjected );
+		};
+
+		// Single Tests
+		//=============
+
+		bool IsOverlapping( const sSphere& i_lhs, const sSphere& i_rhs );
+		bool IsOverlapping( const sAxisAlignedBox& i_lhs, const sAxisAlignedBox& i_rhs );
+		bool IsOverlapping( const sAxisAlignedBox& i_box, const sSphere& i_sphere );
+		bool IsOverlapping( const sFrustum& i_frustum, const sSphere& i_sphere );
+		bool IsOverlapping( const sFrustum& i_frustum, const sAxisAlignedBox& i_box );
+
+		// If the ray hits the shape within the maximum distance the distance to the hit is output
+		// (if the ray starts inside of the shape the distance is zero)
+		bool Raycast( const sRay& i_ray, const sAxisAlignedBox& i_box, const float i_maximumDistance, float& o_hitDistance );
+		bool Raycast( const sRay& i_ray, const sSphere& i_sphere, const float i_maximumDistance, float& o_hitDistance );
+
+		// Batched Tests
+		//==============
+
+		// o_areOverlapping[i] is the result for shape i
+		void TestOverlaps( const sFrustum& i_frustum,
+			const BatchTransforms::sConstVectorSpans& i_sphereCenters, const float* const i_sphereRadii, const size_t i_count,
+			bool* const o_areOverlapping );
+		void TestOverlaps( const sFrustum& i_frustum,
+			const BatchTransforms::sConstVectorSpans& i_boxMinimums, const BatchTransforms::sConstVectorSpans& i_boxMaximums, const size_t i_count,
+			bool* const o_areOverlapping );
+
+		// A packet of rays is tested against a single box
+		// (e.g. rays that are close together, like the rays through neighboring pixels, against a node of a bounding volume hierarchy).
+		// o_hitDistances[i] is the distance that ray i hits the box at, or a negative number if it misses
+		void Raycast( const BatchTransforms::sConstVectorSpans& i_rayOrigins, const BatchTransforms::sConstVectorSpans& i_rayDirections, const size_t i_count,
+			const sAxisAlignedBox& i_box, const float i_maximumDistance,
+			float* const o_hitDistances );
+	}
+}
+
+#include "Geometry.inl"
+
+#endif	// EAE6320_MATH_GEOMETRY_H
@@ -0,0 +1,89 @@
+#ifndef EAE6320_MATH_GEOMETRY_INL
+#define EAE6320_MATH_GEOMETRY_INL
+
+// Include Files
+//==============
+
+#include "Geometry.h"
+
+#include <cmath>
+
+// Interface
+//==========
+
+// Shapes
+//-------
+
+inline float eae6320::Math::sPlane::GetSignedDistance( const sVector& i_point ) const
+{
+	return ( ( ( normal.x * i_point.x ) + ( normal.y * i_point.y ) ) + ( normal.z * i_point.z ) ) + distance;
+}
+
+inline eae6320::Math::sVector eae6320::Math::sAxisAlignedBox::GetCenter() const
+{
+	return ( minimum + maximum ) * 0.5f;
+}
+
+inline eae6320::Math::sVector eae6320::Math::sAxisAlignedBox::GetHalfExtents() const
+{
+	return ( maximum - minimum ) * 0.5f;
+}
+
+// Single Tests
+//-------------
+
+inline bool eae6320::Math::IsOverlapping( const sSphere& i_lhs, const sSphere& i_rhs )
+{
+	const auto offset = i_rhs.center - i_lhs.center;
+	const auto radiusSum = i_lhs.radius + i_rhs.radius;
+	return Dot( offset, offset ) <= ( radiusSum * radiusSum );
+}
+
+inline bool eae6320::Math::IsOverlapping( const sAxisAlignedBox& i_lhs, const sAxisAlignedBox& i_rhs )
+{
+	return ( i_lhs.minimum.x <= i_rhs.maximum.x ) && ( i_lhs.maximum.x >= i_rhs.minimum.x )
+		&& ( i_lhs.minimum.y <= i_rhs.maximum.y ) && ( i_lhs.maximum.y >= i_rhs.minimum.y )
+		&& ( i_lhs.minimum.z <= i_rhs.maximum.z ) && ( i_lhs.maximum.z >= i_rhs.minimum.z );
+}
+
+inline bool eae6320::Math::IsOverlapping( const sAxisAlignedBox& i_box, const sSphere& i_sphere )
+{
+	// Find the point in the box that is closest to the sphere's center
+	const sVector closestPoint(
+		( i_sphere.center.x < i_box.minimum.x ) ? i_box.minimum.x : ( ( i_sphere.center.x > i_box.maximum.x ) ? i_box.maximum.x : i_sphere.center.x ),
+		( i_sphere.center.y < i_box.minimum.y ) ? i_box.minimum.y : ( ( i_sphere.center.y > i_box.maximum.y ) ? i_box.maximum.y : i_sphere.center.y ),
+		( i_sphere.center.z < i_box.minimum.z ) ? i_box.minimum.z : ( ( i_sphere.center.z > i_box.maximum.z ) ? i_box.maximum.z : i_sphere.center.z ) );
+	const auto offset = i_sphere.center - closestPoint;
+	return Dot( offset, offset ) <= ( i_sphere.radius * i_sphere.radius );
+}
+
+inline bool eae6320::Math::IsOverlapping( const sFrustum& i_frustum, const sSphere& i_sphere )
+{
+	for ( const auto& plane : i_frustum.planes )
+	{
+		if ( plane.GetSignedDistance( i_sphere.center ) < -i_sphere.radius )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+inline bool eae6320::Math::IsOverlapping( const sFrustum& i_frustum, const sAxisAlignedBox& i_box )
+{
+	const auto center = i_box.GetCenter();
+	const auto halfExtents = i_box.GetHalfExtents();
+	for ( const auto& plane : i_frustum.planes )
+	{
+		// This is how far the box reaches along the plane's normal
+		const auto projectedRadius = ( ( halfExtents.x * std::abs( plane.normal.x ) ) + ( halfExtents.y * std::abs( plane.normal.y ) ) )
+			+ ( halfExtents.z * std::abs( plane.normal.z ) );
+		if ( plane.GetSignedDistance( center ) < -projectedRadius )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif	// EAE6320_MATH_GEOMETRY_INL
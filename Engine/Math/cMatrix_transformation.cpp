@@ -3,11 +3,25 @@
 
 #include "cMatrix_transformation.h"
 
+#include "Configuration.h"
+#include "Constants.h"
 #include "cQuaternion.h"
 #include "sVector.h"
 
 #include <cmath>
 
+#if defined( EAE6320_MATH_ISAVXENABLED )
+	#include <immintrin.h>
+#elif defined( EAE6320_MATH_ISSSE2ENABLED )
+	#include <emmintrin.h>
+#endif
+
+// The SIMD versions of the functions below load and store each column of a matrix as four contiguous floats.
+// They do the same multiplications and additions in the same order as the scalar versions
+// (and so the results are identical as long as the compiler doesn't contract the scalar versions into fused multiply-adds).
+static_assert( sizeof( eae6320::Math::cMatrix_transformation ) == ( sizeof( float ) * 16 ),
+	"A matrix's columns must be contiguous" );
+
 // Interface
 //==========
 
@@ -16,160 +30,147 @@
 
 eae6320::Math::sVector eae6320::Math::cMatrix_transformation::operator *( const sVector& i_rhs ) const
 {
-	return sVector(
-		( m_00 * i_rhs.x ) + ( m_01 * i_rhs.y ) + ( m_02 * i_rhs.z ) + m_03,
-		( m_10 * i_rhs.x ) + ( m_11 * i_rhs.y ) + ( m_12 * i_rhs.z ) + m_13,
-		( m_20 * i_rhs.x ) + ( m_21 * i_rhs.y ) + ( m_22 * i_rhs.z ) + m_23
-	);
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	auto result = _mm_mul_ps( _mm_loadu_ps( &m_00 ), _mm_set1_ps( i_rhs.x ) );
+	result = _mm_add_ps( result, _mm_mul_ps( _mm_loadu_ps( &m_01 ), _mm_set1_ps( i_rhs.y ) ) );
+	result = _mm_add_ps( result, _mm_mul_ps( _mm_loadu_ps( &m_02 ), _mm_set1_ps( i_rhs.z ) ) );
+	result = _mm_add_ps( result, _mm_loadu_ps( &m_03 ) );
+	float elements[4];
+	_mm_storeu_ps( elements, result );
+	return sVector( elements[0], elements[1], elements[2] );
+#else
+	return Multiply_constexpr( *this, i_rhs );
+#endif
 }
 
 eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::operator *( const cMatrix_transformation& i_rhs ) const
 {
-	return cMatrix_transformation(
-		( m_00 * i_rhs.m_00 ) + ( m_01 * i_rhs.m_10 ) + ( m_02 * i_rhs.m_20 ) + ( m_03 * i_rhs.m_30 ),
-		( m_10 * i_rhs.m_00 ) + ( m_11 * i_rhs.m_10 ) + ( m_12 * i_rhs.m_20 ) + ( m_13 * i_rhs.m_30 ),
-		( m_20 * i_rhs.m_00 ) + ( m_21 * i_rhs.m_10 ) + ( m_22 * i_rhs.m_20 ) + ( m_23 * i_rhs.m_30 ),
-		( m_30 * i_rhs.m_00 ) + ( m_31 * i_rhs.m_10 ) + ( m_32 * i_rhs.m_20 ) + ( m_33 * i_rhs.m_30 ),
-
-		( m_00 * i_rhs.m_01 ) + ( m_01 * i_rhs.m_11 ) + ( m_02 * i_rhs.m_21 ) + ( m_03 * i_rhs.m_31 ),
-		( m_10 * i_rhs.m_01 ) + ( m_11 * i_rhs.m_11 ) + ( m_12 * i_rhs.m_21 ) + ( m_13 * i_rhs.m_31 ),
-		( m_20 * i_rhs.m_01 ) + ( m_21 * i_rhs.m_11 ) + ( m_22 * i_rhs.m_21 ) + ( m_23 * i_rhs.m_31 ),
-		( m_30 * i_rhs.m_01 ) + ( m_31 * i_rhs.m_11 ) + ( m_32 * i_rhs.m_21 ) + ( m_33 * i_rhs.m_31 ),
-
-		( m_00 * i_rhs.m_02 ) + ( m_01 * i_rhs.m_12 ) + ( m_02 * i_rhs.m_22 ) + ( m_03 * i_rhs.m_32 ),
-		( m_10 * i_rhs.m_02 ) + ( m_11 * i_rhs.m_12 ) + ( m_12 * i_rhs.m_22 ) + ( m_13 * i_rhs.m_32 ),
-		( m_20 * i_rhs.m_02 ) + ( m_21 * i_rhs.m_12 ) + ( m_22 * i_rhs.m_22 ) + ( m_23 * i_rhs.m_32 ),
-		( m_30 * i_rhs.m_02 ) + ( m_31 * i_rhs.m_12 ) + ( m_32 * i_rhs.m_22 ) + ( m_33 * i_rhs.m_32 ),
-
-		( m_00 * i_rhs.m_03 ) + ( m_01 * i_rhs.m_13 ) + ( m_02 * i_rhs.m_23 ) + ( m_03 * i_rhs.m_33 ),
-		( m_10 * i_rhs.m_03 ) + ( m_11 * i_rhs.m_13 ) + ( m_12 * i_rhs.m_23 ) + ( m_13 * i_rhs.m_33 ),
-		( m_20 * i_rhs.m_03 ) + ( m_21 * i_rhs.m_13 ) + ( m_22 * i_rhs.m_23 ) + ( m_23 * i_rhs.m_33 ),
-		( m_30 * i_rhs.m_03 ) + ( m_31 * i_rhs.m_13 ) + ( m_32 * i_rhs.m_23 ) + ( m_33 * i_rhs.m_33 )
-	);
+#if defined( EAE6320_MATH_ISAVXENABLED )
+	// Each column of the result is this matrix's columns weighted by the elements of the corresponding column of the right-hand side,
+	// and two columns of the result are calculated at once
+	cMatrix_transformation result;
+	const auto lhs_column0 = _mm256_broadcast_ps( reinterpret_cast<const __m128*>( &m_00 ) );
+	const auto lhs_column1 = _mm256_broadcast_ps( reinterpret_cast<const __m128*>( &m_01 ) );
+	const auto lhs_column2 = _mm256_broadcast_ps( reinterpret_cast<const __m128*>( &m_02 ) );
+	const auto lhs_column3 = _mm256_broadcast_ps( reinterpret_cast<const __m128*>( &m_03 ) );
+	for ( unsigned int c = 0; c < 4; c += 2 )
+	{
+		const auto rhs_columns = _mm256_loadu_ps( ( &i_rhs.m_00 ) + ( c * 4 ) );
+		auto result_columns = _mm256_mul_ps( lhs_column0, _mm256_shuffle_ps( rhs_columns, rhs_columns, _MM_SHUFFLE( 0, 0, 0, 0 ) ) );
+		result_columns = _mm256_add_ps( result_columns,
+			_mm256_mul_ps( lhs_column1, _mm256_shuffle_ps( rhs_columns, rhs_columns, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+		result_columns = _mm256_add_ps( result_columns,
+			_mm256_mul_ps( lhs_column2, _mm256_shuffle_ps( rhs_columns, rhs_columns, _MM_SHUFFLE( 2, 2, 2, 2 ) ) ) );
+		result_columns = _mm256_add_ps( result_columns,
+			_mm256_mul_ps( lhs_column3, _mm256_shuffle_ps( rhs_columns, rhs_columns, _MM_SHUFFLE( 3, 3, 3, 3 ) ) ) );
+		_mm256_storeu_ps( ( &result.m_00 ) + ( c * 4 ), result_columns );
+	}
+	return result;
+#elif defined( EAE6320_MATH_ISSSE2ENABLED )
+	// Each column of the result is this matrix's columns weighted by the elements of the corresponding column of the right-hand side
+	cMatrix_transformation result;
+	const auto lhs_column0 = _mm_loadu_ps( &m_00 );
+	const auto lhs_column1 = _mm_loadu_ps( &m_01 );
+	const auto lhs_column2 = _mm_loadu_ps( &m_02 );
+	const auto lhs_column3 = _mm_loadu_ps( &m_03 );
+	for ( unsigned int c = 0; c < 4; ++c )
+	{
+		const auto* const rhs_column = ( &i_rhs.m_00 ) + ( c * 4 );
+		auto result_column = _mm_mul_ps( lhs_column0, _mm_set1_ps( rhs_column[0] ) );
+		result_column = _mm_add_ps( result_column, _mm_mul_ps( lhs_column1, _mm_set1_ps( rhs_column[1] ) ) );
+		result_column = _mm_add_ps( result_column, _mm_mul_ps( lhs_column2, _mm_set1_ps( rhs_column[2] ) ) );
+		result_column = _mm_add_ps( result_column, _mm_mul_ps( lhs_column3, _mm_set1_ps( rhs_column[3] ) ) );
+		_mm_storeu_ps( ( &result.m_00 ) + ( c * 4 ), result_column );
+	}
+	return result;
+#else
+	return Multiply_constexpr( *this, i_rhs );
+#endif
 }
 
 const eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::ConcatenateAffine(
 	const cMatrix_transformation& i_nextTransform, const cMatrix_transformation& i_firstTransform )
 {
 	// A few simplifying assumptions can be made for affine transformations vs. general 4x4 matrix multiplication
-	return cMatrix_transformation(
-		( i_nextTransform.m_00 * i_firstTransform.m_00 ) + ( i_nextTransform.m_01 * i_firstTransform.m_10 ) + ( i_nextTransform.m_02 * i_firstTransform.m_20 ),
-		( i_nextTransform.m_10 * i_firstTransform.m_00 ) + ( i_nextTransform.m_11 * i_firstTransform.m_10 ) + ( i_nextTransform.m_12 * i_firstTransform.m_20 ),
-		( i_nextTransform.m_20 * i_firstTransform.m_00 ) + ( i_nextTransform.m_21 * i_firstTransform.m_10 ) + ( i_nextTransform.m_22 * i_firstTransform.m_20 ),
-		0.0f,
-
-		( i_nextTransform.m_00 * i_firstTransform.m_01 ) + ( i_nextTransform.m_01 * i_firstTransform.m_11 ) + ( i_nextTransform.m_02 * i_firstTransform.m_21 ),
-		( i_nextTransform.m_10 * i_firstTransform.m_01 ) + ( i_nextTransform.m_11 * i_firstTransform.m_11 ) + ( i_nextTransform.m_12 * i_firstTransform.m_21 ),
-		( i_nextTransform.m_20 * i_firstTransform.m_01 ) + ( i_nextTransform.m_21 * i_firstTransform.m_11 ) + ( i_nextTransform.m_22 * i_firstTransform.m_21 ),
-		0.0f,
-
-		( i_nextTransform.m_00 * i_firstTransform.m_02 ) + ( i_nextTransform.m_01 * i_firstTransform.m_12 ) + ( i_nextTransform.m_02 * i_firstTransform.m_22 ),
-		( i_nextTransform.m_10 * i_firstTransform.m_02 ) + ( i_nextTransform.m_11 * i_firstTransform.m_12 ) + ( i_nextTransform.m_12 * i_firstTransform.m_22 ),
-		( i_nextTransform.m_20 * i_firstTransform.m_02 ) + ( i_nextTransform.m_21 * i_firstTransform.m_12 ) + ( i_nextTransform.m_22 * i_firstTransform.m_22 ),
-		0.0f,
-
-		( i_nextTransform.m_00 * i_firstTransform.m_03 ) + ( i_nextTransform.m_01 * i_firstTransform.m_13 ) + ( i_nextTransform.m_02 * i_firstTransform.m_23 ) + i_nextTransform.m_03,
-		( i_nextTransform.m_10 * i_firstTransform.m_03 ) + ( i_nextTransform.m_11 * i_firstTransform.m_13 ) + ( i_nextTransform.m_12 * i_firstTransform.m_23 ) + i_nextTransform.m_13,
-		( i_nextTransform.m_20 * i_firstTransform.m_03 ) + ( i_nextTransform.m_21 * i_firstTransform.m_13 ) + ( i_nextTransform.m_22 * i_firstTransform.m_23 ) + i_nextTransform.m_23,
-		1.0f
-	);
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	// The bottom row is known rather than calculated,
+	// and so the W of every column is masked to zero (and then set to one for the translation)
+	cMatrix_transformation result;
+	const auto mask_xyz = _mm_castsi128_ps( _mm_set_epi32( 0, -1, -1, -1 ) );
+	const auto next_column0 = _mm_and_ps( _mm_loadu_ps( &i_nextTransform.m_00 ), mask_xyz );
+	const auto next_column1 = _mm_and_ps( _mm_loadu_ps( &i_nextTransform.m_01 ), mask_xyz );
+	const auto next_column2 = _mm_and_ps( _mm_loadu_ps( &i_nextTransform.m_02 ), mask_xyz );
+	for ( unsigned int c = 0; c < 4; ++c )
+	{
+		const auto* const first_column = ( &i_firstTransform.m_00 ) + ( c * 4 );
+		auto result_column = _mm_mul_ps( next_column0, _mm_set1_ps( first_column[0] ) );
+		result_column = _mm_add_ps( result_column, _mm_mul_ps( next_column1, _mm_set1_ps( first_column[1] ) ) );
+		result_column = _mm_add_ps( result_column, _mm_mul_ps( next_column2, _mm_set1_ps( first_column[2] ) ) );
+		// The W of a product of masked columns could still be NaN if an element of the first transform is infinite
+		result_column = _mm_and_ps( result_column, mask_xyz );
+		_mm_storeu_ps( ( &result.m_00 ) + ( c * 4 ), result_column );
+	}
+	{
+		auto translation = _mm_loadu_ps( &result.m_03 );
+		translation = _mm_add_ps( translation, _mm_and_ps( _mm_loadu_ps( &i_nextTransform.m_03 ), mask_xyz ) );
+		translation = _mm_or_ps( translation, _mm_set_ps( 1.0f, 0.0f, 0.0f, 0.0f ) );
+		_mm_storeu_ps( &result.m_03, translation );
+	}
+	return result;
+#else
+	return ConcatenateAffine_constexpr( i_nextTransform, i_firstTransform );
+#endif
 }
 
 // Camera
 //-------
 
-eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform( const cMatrix_transformation& i_transform_localCameraToWorld )
-{
-	// Many simplifying assumptions can be made in order to create the inverse
-	// because in our class a camera can only ever have rotation and translation
-	// (i.e. it can't be scaled)
-	return cMatrix_transformation(
-		i_transform_localCameraToWorld.m_00, i_transform_localCameraToWorld.m_01, i_transform_localCameraToWorld.m_02, 0.0f,
-		i_transform_localCameraToWorld.m_10, i_transform_localCameraToWorld.m_11, i_transform_localCameraToWorld.m_12, 0.0f,
-		i_transform_localCameraToWorld.m_20, i_transform_localCameraToWorld.m_21, i_transform_localCameraToWorld.m_22, 0.0f,
-
-		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_00 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_10 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_20 ),
-		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_01 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_11 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_21 ),
-		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_02 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_12 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_22 ),
-
-		1.0f );
-}
-
 eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
 	const float i_verticalFieldOfView_inRadians,
 	const float i_aspectRatio,
 	const float i_z_nearPlane, const float i_z_farPlane )
 {
-	const auto yScale = 1.0f / std::tan( i_verticalFieldOfView_inRadians * 0.5f );
-	const auto xScale = yScale / i_aspectRatio;
-#if defined( EAE6320_PLATFORM_D3D )
-	const auto zDistanceScale = i_z_farPlane / ( i_z_nearPlane - i_z_farPlane );
-	return cMatrix_transformation(
-		xScale, 0.0f, 0.0f, 0.0f,
-		0.0f, yScale, 0.0f, 0.0f,
-		0.0f, 0.0f, zDistanceScale, -1.0f,
-		0.0f, 0.0f, i_z_nearPlane * zDistanceScale, 0.0f );
-#elif defined( EAE6320_PLATFORM_GL )
-	const auto zDistanceScale = 1.0f / ( i_z_nearPlane - i_z_farPlane );
-	return cMatrix_transformation(
-		xScale, 0.0f, 0.0f, 0.0f,
-		0.0f, yScale, 0.0f, 0.0f,
-		0.0f, 0.0f, ( i_z_nearPlane + i_z_farPlane ) * zDistanceScale, -1.0f,
-		0.0f, 0.0f, ( 2.0f * i_z_nearPlane * i_z_farPlane ) * zDistanceScale, 0.0f );
-#endif
+	return CreateCameraToProjectedTransform_perspective_fromScale( 1.0f / std::tan( i_verticalFieldOfView_inRadians * 0.5f ),
+		i_aspectRatio, i_z_nearPlane, i_z_farPlane );
 }
 
-// Initialization / Shut Down
-//---------------------------
+// Compile-Time Tests
+//===================
 
-eae6320::Math::cMatrix_transformation::cMatrix_transformation( const cQuaternion& i_rotation, const sVector& i_translation )
-	:
-	m_30( 0.0f ), m_31( 0.0f ), m_32( 0.0f ),
-	m_03( i_translation.x ), m_13( i_translation.y ), m_23( i_translation.z ),
-	m_33( 1.0f )
-{
-	const auto _2x = i_rotation.m_x + i_rotation.m_x;
-	const auto _2y = i_rotation.m_y + i_rotation.m_y;
-	const auto _2z = i_rotation.m_z + i_rotation.m_z;
-	const auto _2xx = i_rotation.m_x * _2x;
-	const auto _2xy = _2x * i_rotation.m_y;
-	const auto _2xz = _2x * i_rotation.m_z;
-	const auto _2xw = _2x * i_rotation.m_w;
-	const auto _2yy = _2y * i_rotation.m_y;
-	const auto _2yz = _2y * i_rotation.m_z;
-	const auto _2yw = _2y * i_rotation.m_w;
-	const auto _2zz = _2z * i_rotation.m_z;
-	const auto _2zw = _2z * i_rotation.m_w;
-
-	m_00 = 1.0f - _2yy - _2zz;
-	m_01 = _2xy - _2zw;
-	m_02 = _2xz + _2yw;
-
-	m_10 = _2xy + _2zw;
-	m_11 = 1.0f - _2xx - _2zz;
-	m_12 = _2yz - _2xw;
-
-	m_20 = _2xz - _2yw;
-	m_21 = _2yz + _2xw;
-	m_22 = 1.0f - _2xx - _2yy;
-}
+// These are evaluated every time that this file is compiled
 
-// Implementation
-//===============
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cMatrix_transformation::cMatrix_transformation(
-	const float i_00, const float i_10, const float i_20, const float i_30,
-	const float i_01, const float i_11, const float i_21, const float i_31,
-	const float i_02, const float i_12, const float i_22, const float i_32,
-	const float i_03, const float i_13, const float i_23, const float i_33 )
-	:
-	m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
-	m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
-	m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
-	m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
+namespace
 {
-
+	constexpr bool AreNearlyEqual( const float i_lhs, const float i_rhs )
+	{
+		return ( ( i_lhs - i_rhs ) < 1.0e-6f ) && ( ( i_rhs - i_lhs ) < 1.0e-6f );
+	}
+	constexpr bool AreNearlyEqual( const eae6320::Math::sVector& i_lhs, const eae6320::Math::sVector& i_rhs )
+	{
+		return AreNearlyEqual( i_lhs.x, i_rhs.x ) && AreNearlyEqual( i_lhs.y, i_rhs.y ) && AreNearlyEqual( i_lhs.z, i_rhs.z );
+	}
+
+	constexpr eae6320::Math::sVector s_testPosition( 1.0f, 2.0f, 3.0f );
+	constexpr eae6320::Math::cMatrix_transformation s_testTranslation( eae6320::Math::cQuaternion(), s_testPosition );
+	// This rotates a quarter turn around Z
+	constexpr eae6320::Math::cMatrix_transformation s_testRotation(
+		eae6320::Math::cQuaternion::CreateFromAngleAxis_constexpr( eae6320::Math::Pi * 0.5f, eae6320::Math::sVector( 0.0f, 0.0f, 1.0f ) ),
+		eae6320::Math::sVector() );
 }
+
+static_assert( eae6320::Math::cMatrix_transformation::Multiply_constexpr( s_testTranslation, eae6320::Math::sVector() ) == s_testPosition,
+	"A translation doesn't move the origin to the translation" );
+static_assert( AreNearlyEqual( eae6320::Math::cMatrix_transformation::Multiply_constexpr( s_testRotation, eae6320::Math::sVector( 1.0f, 0.0f, 0.0f ) ),
+	eae6320::Math::sVector( 0.0f, 1.0f, 0.0f ) ), "A positive rotation around Z doesn't rotate X towards Y" );
+static_assert( eae6320::Math::cMatrix_transformation::Multiply_constexpr(
+	eae6320::Math::cMatrix_transformation::Multiply_constexpr( s_testTranslation, s_testTranslation ), eae6320::Math::sVector() )
+	== eae6320::Math::sVector( 2.0f, 4.0f, 6.0f ), "Multiplying two translations doesn't add them" );
+static_assert( AreNearlyEqual( eae6320::Math::cMatrix_transformation::Multiply_constexpr(
+	eae6320::Math::cMatrix_transformation::ConcatenateAffine_constexpr( s_testTranslation, s_testRotation ), eae6320::Math::sVector( 1.0f, 0.0f, 0.0f ) ),
+	eae6320::Math::sVector( 1.0f, 3.0f, 3.0f ) ), "Concatenated transforms aren't applied first to last" );
+static_assert( eae6320::Math::cMatrix_transformation::Multiply_constexpr(
+	eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform( eae6320::Math::cQuaternion(), s_testPosition ), s_testPosition )
+	== eae6320::Math::sVector(), "A camera's position isn't the origin in camera space" );
+static_assert( AreNearlyEqual( eae6320::Math::cMatrix_transformation::Multiply_constexpr(
+	eae6320::Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective_constexpr( eae6320::Math::Pi * 0.5f, 2.0f, 0.1f, 100.0f ),
+	eae6320::Math::sVector( 1.0f, 1.0f, -1.0f ) ).y, 1.0f ), "A 90 degree field of view doesn't project a 45 degree point to the edge" );
@@ -17,6 +17,12 @@
 			* The first vector is right, the second vector is up, and the third vector is back
 				* This is an arbitrary convention, and not necessarily a common one
 					(Maya, for example, has the first vector left and the third vector forward)
+
+	Constant transforms can be created at compile time:
+		* The constructors and the world-to-camera functions can be evaluated by the compiler
+		* The multiplication functions and the perspective projection use SIMD instructions or the standard library at run time,
+			and so each has a "_constexpr" version that calculates the same result and can be evaluated by the compiler
+			(those versions shouldn't be used at run time)
 */
 
 #ifndef EAE6320_MATH_CMATRIX_TRANSFORMATION_H
@@ -59,6 +65,12 @@ namespace eae6320
 			static const cMatrix_transformation ConcatenateAffine(
 				const cMatrix_transformation& i_nextTransform, const cMatrix_transformation& i_firstTransform );
 
+			// These calculate the same results as the functions above and can be evaluated at compile time
+			static constexpr sVector Multiply_constexpr( const cMatrix_transformation& i_lhs, const sVector& i_rhs );
+			static constexpr cMatrix_transformation Multiply_constexpr( const cMatrix_transformation& i_lhs, const cMatrix_transformation& i_rhs );
+			static constexpr cMatrix_transformation ConcatenateAffine_constexpr(
+				const cMatrix_transformation& i_nextTransform, const cMatrix_transformation& i_firstTransform );
+
 			// Access
 			//-------
 
@@ -66,15 +78,18 @@ namespace eae6320
 			const sVector& GetUpDirection() const;
 			const sVector& GetBackDirection() const;
 			const sVector& GetTranslation() const;
+			// This is the mathematical row and column
+			// (e.g. the translation is in column 3 and a projection's W is in row 3)
+			float GetElement( const unsigned int i_rowIndex, const unsigned int i_columnIndex ) const;
 
 			// Camera
 			//-------
 
 			// A world-to-camera transform (for rendering) can be created by specifying the relative camera data
-			static cMatrix_transformation CreateWorldToCameraTransform(
+			static constexpr cMatrix_transformation CreateWorldToCameraTransform(
 				const cQuaternion& i_cameraOrientation, const sVector& i_cameraPosition );
 			// If a camera's local-to-world transform has already been created then it can be specified instead to save calculations
-			static cMatrix_transformation CreateWorldToCameraTransform( const cMatrix_transformation& transform_localCameraToWorld );
+			static constexpr cMatrix_transformation CreateWorldToCameraTransform( const cMatrix_transformation& transform_localCameraToWorld );
 
 			// A camera-to-projected transform (for rendering) can be created by specifying the relative data
 			static cMatrix_transformation CreateCameraToProjectedTransform_perspective(
@@ -94,12 +109,16 @@ namespace eae6320
 				//			and the far plane should be as near to the camera as is acceptable
 				//			(i.e. where you don't notice things disappearing when the camera gets far away)
 				const float i_z_nearPlane, const float i_z_farPlane );
+			// This calculates the same result as the function above and can be evaluated at compile time
+			static constexpr cMatrix_transformation CreateCameraToProjectedTransform_perspective_constexpr(
+				const float i_verticalFieldOfView_inRadians, const float i_aspectRatio,
+				const float i_z_nearPlane, const float i_z_farPlane );
 
 			// Initialization / Shut Down
 			//---------------------------
 
-			cMatrix_transformation() = default;	// The default constructor creates a a transform with no rotation and no translation
-			cMatrix_transformation( const cQuaternion& i_rotation, const sVector& i_translation );
+			constexpr cMatrix_transformation() = default;	// The default constructor creates a a transform with no rotation and no translation
+			constexpr cMatrix_transformation( const cQuaternion& i_rotation, const sVector& i_translation );
 
 			// Data
 			//=====
@@ -117,10 +136,18 @@ namespace eae6320
 
 		private:
 
+			// Camera
+			//-------
+
+			// The scale is 1 / tan( verticalFieldOfView / 2 )
+			static constexpr cMatrix_transformation CreateCameraToProjectedTransform_perspective_fromScale(
+				const float i_yScale, const float i_aspectRatio,
+				const float i_z_nearPlane, const float i_z_farPlane );
+
 			// Initialization / Shut Down
 			//---------------------------
 
-			cMatrix_transformation(
+			constexpr cMatrix_transformation(
 				const float i_00, const float i_10, const float i_20, const float i_30,
 				const float i_01, const float i_11, const float i_21, const float i_31,
 				const float i_02, const float i_12, const float i_22, const float i_32,
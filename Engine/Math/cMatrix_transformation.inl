@@ -6,9 +6,78 @@
 
 #include "cMatrix_transformation.h"
 
+#include "cQuaternion.h"
+#include "Functions.h"
+#include "sVector.h"
+
 // Interface
 //==========
 
+// Multiplication
+//---------------
+
+constexpr eae6320::Math::sVector eae6320::Math::cMatrix_transformation::Multiply_constexpr( const cMatrix_transformation& i_lhs, const sVector& i_rhs )
+{
+	return sVector(
+		( i_lhs.m_00 * i_rhs.x ) + ( i_lhs.m_01 * i_rhs.y ) + ( i_lhs.m_02 * i_rhs.z ) + i_lhs.m_03,
+		( i_lhs.m_10 * i_rhs.x ) + ( i_lhs.m_11 * i_rhs.y ) + ( i_lhs.m_12 * i_rhs.z ) + i_lhs.m_13,
+		( i_lhs.m_20 * i_rhs.x ) + ( i_lhs.m_21 * i_rhs.y ) + ( i_lhs.m_22 * i_rhs.z ) + i_lhs.m_23
+	);
+}
+
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::Multiply_constexpr(
+	const cMatrix_transformation& i_lhs, const cMatrix_transformation& i_rhs )
+{
+	return cMatrix_transformation(
+		( i_lhs.m_00 * i_rhs.m_00 ) + ( i_lhs.m_01 * i_rhs.m_10 ) + ( i_lhs.m_02 * i_rhs.m_20 ) + ( i_lhs.m_03 * i_rhs.m_30 ),
+		( i_lhs.m_10 * i_rhs.m_00 ) + ( i_lhs.m_11 * i_rhs.m_10 ) + ( i_lhs.m_12 * i_rhs.m_20 ) + ( i_lhs.m_13 * i_rhs.m_30 ),
+		( i_lhs.m_20 * i_rhs.m_00 ) + ( i_lhs.m_21 * i_rhs.m_10 ) + ( i_lhs.m_22 * i_rhs.m_20 ) + ( i_lhs.m_23 * i_rhs.m_30 ),
+		( i_lhs.m_30 * i_rhs.m_00 ) + ( i_lhs.m_31 * i_rhs.m_10 ) + ( i_lhs.m_32 * i_rhs.m_20 ) + ( i_lhs.m_33 * i_rhs.m_30 ),
+
+		( i_lhs.m_00 * i_rhs.m_01 ) + ( i_lhs.m_01 * i_rhs.m_11 ) + ( i_lhs.m_02 * i_rhs.m_21 ) + ( i_lhs.m_03 * i_rhs.m_31 ),
+		( i_lhs.m_10 * i_rhs.m_01 ) + ( i_lhs.m_11 * i_rhs.m_11 ) + ( i_lhs.m_12 * i_rhs.m_21 ) + ( i_lhs.m_13 * i_rhs.m_31 ),
+		( i_lhs.m_20 * i_rhs.m_01 ) + ( i_lhs.m_21 * i_rhs.m_11 ) + ( i_lhs.m_22 * i_rhs.m_21 ) + ( i_lhs.m_23 * i_rhs.m_31 ),
+		( i_lhs.m_30 * i_rhs.m_01 ) + ( i_lhs.m_31 * i_rhs.m_11 ) + ( i_lhs.m_32 * i_rhs.m_21 ) + ( i_lhs.m_33 * i_rhs.m_31 ),
+
+		( i_lhs.m_00 * i_rhs.m_02 ) + ( i_lhs.m_01 * i_rhs.m_12 ) + ( i_lhs.m_02 * i_rhs.m_22 ) + ( i_lhs.m_03 * i_rhs.m_32 ),
+		( i_lhs.m_10 * i_rhs.m_02 ) + ( i_lhs.m_11 * i_rhs.m_12 ) + ( i_lhs.m_12 * i_rhs.m_22 ) + ( i_lhs.m_13 * i_rhs.m_32 ),
+		( i_lhs.m_20 * i_rhs.m_02 ) + ( i_lhs.m_21 * i_rhs.m_12 ) + ( i_lhs.m_22 * i_rhs.m_22 ) + ( i_lhs.m_23 * i_rhs.m_32 ),
+		( i_lhs.m_30 * i_rhs.m_02 ) + ( i_lhs.m_31 * i_rhs.m_12 ) + ( i_lhs.m_32 * i_rhs.m_22 ) + ( i_lhs.m_33 * i_rhs.m_32 ),
+
+		( i_lhs.m_00 * i_rhs.m_03 ) + ( i_lhs.m_01 * i_rhs.m_13 ) + ( i_lhs.m_02 * i_rhs.m_23 ) + ( i_lhs.m_03 * i_rhs.m_33 ),
+		( i_lhs.m_10 * i_rhs.m_03 ) + ( i_lhs.m_11 * i_rhs.m_13 ) + ( i_lhs.m_12 * i_rhs.m_23 ) + ( i_lhs.m_13 * i_rhs.m_33 ),
+		( i_lhs.m_20 * i_rhs.m_03 ) + ( i_lhs.m_21 * i_rhs.m_13 ) + ( i_lhs.m_22 * i_rhs.m_23 ) + ( i_lhs.m_23 * i_rhs.m_33 ),
+		( i_lhs.m_30 * i_rhs.m_03 ) + ( i_lhs.m_31 * i_rhs.m_13 ) + ( i_lhs.m_32 * i_rhs.m_23 ) + ( i_lhs.m_33 * i_rhs.m_33 )
+	);
+}
+
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::ConcatenateAffine_constexpr(
+	const cMatrix_transformation& i_nextTransform, const cMatrix_transformation& i_firstTransform )
+{
+	// A few simplifying assumptions can be made for affine transformations vs. general 4x4 matrix multiplication
+	return cMatrix_transformation(
+		( i_nextTransform.m_00 * i_firstTransform.m_00 ) + ( i_nextTransform.m_01 * i_firstTransform.m_10 ) + ( i_nextTransform.m_02 * i_firstTransform.m_20 ),
+		( i_nextTransform.m_10 * i_firstTransform.m_00 ) + ( i_nextTransform.m_11 * i_firstTransform.m_10 ) + ( i_nextTransform.m_12 * i_firstTransform.m_20 ),
+		( i_nextTransform.m_20 * i_firstTransform.m_00 ) + ( i_nextTransform.m_21 * i_firstTransform.m_10 ) + ( i_nextTransform.m_22 * i_firstTransform.m_20 ),
+		0.0f,
+
+		( i_nextTransform.m_00 * i_firstTransform.m_01 ) + ( i_nextTransform.m_01 * i_firstTransform.m_11 ) + ( i_nextTransform.m_02 * i_firstTransform.m_21 ),
+		( i_nextTransform.m_10 * i_firstTransform.m_01 ) + ( i_nextTransform.m_11 * i_firstTransform.m_11 ) + ( i_nextTransform.m_12 * i_firstTransform.m_21 ),
+		( i_nextTransform.m_20 * i_firstTransform.m_01 ) + ( i_nextTransform.m_21 * i_firstTransform.m_11 ) + ( i_nextTransform.m_22 * i_firstTransform.m_21 ),
+		0.0f,
+
+		( i_nextTransform.m_00 * i_firstTransform.m_02 ) + ( i_nextTransform.m_01 * i_firstTransform.m_12 ) + ( i_nextTransform.m_02 * i_firstTransform.m_22 ),
+		( i_nextTransform.m_10 * i_firstTransform.m_02 ) + ( i_nextTransform.m_11 * i_firstTransform.m_12 ) + ( i_nextTransform.m_12 * i_firstTransform.m_22 ),
+		( i_nextTransform.m_20 * i_firstTransform.m_02 ) + ( i_nextTransform.m_21 * i_firstTransform.m_12 ) + ( i_nextTransform.m_22 * i_firstTransform.m_22 ),
+		0.0f,
+
+		( i_nextTransform.m_00 * i_firstTransform.m_03 ) + ( i_nextTransform.m_01 * i_firstTransform.m_13 ) + ( i_nextTransform.m_02 * i_firstTransform.m_23 ) + i_nextTransform.m_03,
+		( i_nextTransform.m_10 * i_firstTransform.m_03 ) + ( i_nextTransform.m_11 * i_firstTransform.m_13 ) + ( i_nextTransform.m_12 * i_firstTransform.m_23 ) + i_nextTransform.m_13,
+		( i_nextTransform.m_20 * i_firstTransform.m_03 ) + ( i_nextTransform.m_21 * i_firstTransform.m_13 ) + ( i_nextTransform.m_22 * i_firstTransform.m_23 ) + i_nextTransform.m_23,
+		1.0f
+	);
+}
+
 // Access
 //-------
 
@@ -32,13 +101,125 @@ inline const eae6320::Math::sVector& eae6320::Math::cMatrix_transformation::GetT
 	return *reinterpret_cast<const sVector*>( &m_03 );
 }
 
+inline float eae6320::Math::cMatrix_transformation::GetElement( const unsigned int i_rowIndex, const unsigned int i_columnIndex ) const
+{
+	// The elements are stored as columns
+	return ( &m_00 )[( i_columnIndex * 4 ) + i_rowIndex];
+}
+
 // Camera
 //-------
 
-inline eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform(
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform(
 	const cQuaternion& i_cameraOrientation, const sVector& i_cameraPosition )
 {
 	return CreateWorldToCameraTransform( cMatrix_transformation( i_cameraOrientation, i_cameraPosition ) );
 }
 
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform( const cMatrix_transformation& i_transform_localCameraToWorld )
+{
+	// Many simplifying assumptions can be made in order to create the inverse
+	// because in our class a camera can only ever have rotation and translation
+	// (i.e. it can't be scaled)
+	return cMatrix_transformation(
+		i_transform_localCameraToWorld.m_00, i_transform_localCameraToWorld.m_01, i_transform_localCameraToWorld.m_02, 0.0f,
+		i_transform_localCameraToWorld.m_10, i_transform_localCameraToWorld.m_11, i_transform_localCameraToWorld.m_12, 0.0f,
+		i_transform_localCameraToWorld.m_20, i_transform_localCameraToWorld.m_21, i_transform_localCameraToWorld.m_22, 0.0f,
+
+		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_00 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_10 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_20 ),
+		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_01 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_11 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_21 ),
+		-( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_02 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_12 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_22 ),
+
+		1.0f );
+}
+
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective_constexpr(
+	const float i_verticalFieldOfView_inRadians, const float i_aspectRatio,
+	const float i_z_nearPlane, const float i_z_farPlane )
+{
+	return CreateCameraToProjectedTransform_perspective_fromScale( 1.0f / Tan_constexpr( i_verticalFieldOfView_inRadians * 0.5f ),
+		i_aspectRatio, i_z_nearPlane, i_z_farPlane );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrix_transformation::cMatrix_transformation( const cQuaternion& i_rotation, const sVector& i_translation )
+	:
+	m_30( 0.0f ), m_31( 0.0f ), m_32( 0.0f ),
+	m_03( i_translation.x ), m_13( i_translation.y ), m_23( i_translation.z ),
+	m_33( 1.0f )
+{
+	const auto _2x = i_rotation.m_x + i_rotation.m_x;
+	const auto _2y = i_rotation.m_y + i_rotation.m_y;
+	const auto _2z = i_rotation.m_z + i_rotation.m_z;
+	const auto _2xx = i_rotation.m_x * _2x;
+	const auto _2xy = _2x * i_rotation.m_y;
+	const auto _2xz = _2x * i_rotation.m_z;
+	const auto _2xw = _2x * i_rotation.m_w;
+	const auto _2yy = _2y * i_rotation.m_y;
+	const auto _2yz = _2y * i_rotation.m_z;
+	const auto _2yw = _2y * i_rotation.m_w;
+	const auto _2zz = _2z * i_rotation.m_z;
+	const auto _2zw = _2z * i_rotation.m_w;
+
+	m_00 = 1.0f - _2yy - _2zz;
+	m_01 = _2xy - _2zw;
+	m_02 = _2xz + _2yw;
+
+	m_10 = _2xy + _2zw;
+	m_11 = 1.0f - _2xx - _2zz;
+	m_12 = _2yz - _2xw;
+
+	m_20 = _2xz - _2yw;
+	m_21 = _2yz + _2xw;
+	m_22 = 1.0f - _2xx - _2yy;
+}
+
+// Implementation
+//===============
+
+// Camera
+//-------
+
+constexpr eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective_fromScale(
+	const float i_yScale, const float i_aspectRatio,
+	const float i_z_nearPlane, const float i_z_farPlane )
+{
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
+	const auto xScale = i_yScale / i_aspectRatio;
+	const auto zDistanceScale = i_z_farPlane / ( i_z_nearPlane - i_z_farPlane );
+	return cMatrix_transformation(
+		xScale, 0.0f, 0.0f, 0.0f,
+		0.0f, i_yScale, 0.0f, 0.0f,
+		0.0f, 0.0f, zDistanceScale, -1.0f,
+		0.0f, 0.0f, i_z_nearPlane * zDistanceScale, 0.0f );
+#elif defined( EAE6320_PLATFORM_GL )
+	const auto xScale = i_yScale / i_aspectRatio;
+	const auto zDistanceScale = 1.0f / ( i_z_nearPlane - i_z_farPlane );
+	return cMatrix_transformation(
+		xScale, 0.0f, 0.0f, 0.0f,
+		0.0f, i_yScale, 0.0f, 0.0f,
+		0.0f, 0.0f, ( i_z_nearPlane + i_z_farPlane ) * zDistanceScale, -1.0f,
+		0.0f, 0.0f, ( 2.0f * i_z_nearPlane * i_z_farPlane ) * zDistanceScale, 0.0f );
+#endif
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrix_transformation::cMatrix_transformation(
+	const float i_00, const float i_10, const float i_20, const float i_30,
+	const float i_01, const float i_11, const float i_21, const float i_31,
+	const float i_02, const float i_12, const float i_22, const float i_32,
+	const float i_03, const float i_13, const float i_23, const float i_33 )
+	:
+	m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
+	m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
+	m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
+	m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
+{
+
+}
+
 #endif	// EAE6320_MATH_CMATRIX_TRANSFORMATION_INL
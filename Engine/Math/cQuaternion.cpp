@@ -3,6 +3,7 @@
 
 #include "cQuaternion.h"
 
+#include "Functions.h"
 #include "sVector.h"
 
 #include <cmath>
@@ -19,33 +20,6 @@ namespace
 // Interface
 //==========
 
-// Multiplication
-//---------------
-
-eae6320::Math::cQuaternion eae6320::Math::cQuaternion::operator *( const cQuaternion& i_rhs ) const
-{
-	return cQuaternion(
-		( m_w * i_rhs.m_w ) - ( ( m_x * i_rhs.m_x ) + ( m_y * i_rhs.m_y ) + ( m_z * i_rhs.m_z ) ),
-		( m_w * i_rhs.m_x ) + ( m_x * i_rhs.m_w ) + ( ( m_y * i_rhs.m_z ) - ( m_z * i_rhs.m_y ) ),
-		( m_w * i_rhs.m_y ) + ( m_y * i_rhs.m_w ) + ( ( m_z * i_rhs.m_x ) - ( m_x * i_rhs.m_z ) ),
-		( m_w * i_rhs.m_z ) + ( m_z * i_rhs.m_w ) + ( ( m_x * i_rhs.m_y ) - ( m_y * i_rhs.m_x ) ) );
-}
-
-// Inversion
-//----------
-
-void eae6320::Math::cQuaternion::Invert()
-{
-	m_x = -m_x;
-	m_y = -m_y;
-	m_z = -m_z;
-}
-
-eae6320::Math::cQuaternion eae6320::Math::cQuaternion::GetInverse() const
-{
-	return cQuaternion( m_w, -m_x, -m_y, -m_z );
-}
-
 // Normalization
 //--------------
 
@@ -68,29 +42,62 @@ eae6320::Math::cQuaternion eae6320::Math::cQuaternion::GetNormalized() const
 	return cQuaternion( m_w * length_reciprocal, m_x * length_reciprocal, m_y * length_reciprocal, m_z * length_reciprocal );
 }
 
-// Products
-//---------
+void eae6320::Math::cQuaternion::Normalize_fast()
+{
+	const auto length_squared = ( m_w * m_w ) + ( m_x * m_x ) + ( m_y * m_y ) + ( m_z * m_z );
+	EAE6320_ASSERTF( length_squared > ( s_epsilon * s_epsilon ), "Can't divide by zero" );
+	const auto length_reciprocal = ReciprocalSqrt_fast( length_squared );
+	m_w *= length_reciprocal;
+	m_x *= length_reciprocal;
+	m_y *= length_reciprocal;
+	m_z *= length_reciprocal;
+}
 
-float eae6320::Math::Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs )
+eae6320::Math::cQuaternion eae6320::Math::cQuaternion::GetNormalized_fast() const
 {
-	return ( i_lhs.m_w * i_rhs.m_w ) + ( i_lhs.m_x * i_rhs.m_x ) + ( i_lhs.m_y * i_rhs.m_y ) + ( i_lhs.m_z * i_rhs.m_z );
+	const auto length_squared = ( m_w * m_w ) + ( m_x * m_x ) + ( m_y * m_y ) + ( m_z * m_z );
+	EAE6320_ASSERTF( length_squared > ( s_epsilon * s_epsilon ), "Can't divide by zero" );
+	const auto length_reciprocal = ReciprocalSqrt_fast( length_squared );
+	return cQuaternion( m_w * length_reciprocal, m_x * length_reciprocal, m_y * length_reciprocal, m_z * length_reciprocal );
 }
 
-// Access
-//-------
+// Interpolation
+//--------------
 
-eae6320::Math::sVector eae6320::Math::cQuaternion::CalculateForwardDirection() const
+eae6320::Math::cQuaternion eae6320::Math::cQuaternion::Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t )
 {
-	const auto _2x = m_x + m_x;
-	const auto _2y = m_y + m_y;
-	const auto _2xx = m_x * _2x;
-	const auto _2xz = _2x * m_z;
-	const auto _2xw = _2x * m_w;
-	const auto _2yy = _2y * m_y;
-	const auto _2yz = _2y * m_z;
-	const auto _2yw = _2y * m_w;
-
-	return sVector( -_2xz - _2yw, -_2yz + _2xw, -1.0f + _2xx + _2yy );
+	const auto toScale = ( Dot( i_from, i_to ) < 0.0f ) ? -1.0f : 1.0f;
+	return cQuaternion(
+		i_from.m_w + ( ( ( i_to.m_w * toScale ) - i_from.m_w ) * i_t ),
+		i_from.m_x + ( ( ( i_to.m_x * toScale ) - i_from.m_x ) * i_t ),
+		i_from.m_y + ( ( ( i_to.m_y * toScale ) - i_from.m_y ) * i_t ),
+		i_from.m_z + ( ( ( i_to.m_z * toScale ) - i_from.m_z ) * i_t ) ).GetNormalized();
+}
+
+eae6320::Math::cQuaternion eae6320::Math::cQuaternion::Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t )
+{
+	auto cosAngle = Dot( i_from, i_to );
+	auto toScale = 1.0f;
+	if ( cosAngle < 0.0f )
+	{
+		cosAngle = -cosAngle;
+		toScale = -1.0f;
+	}
+	// When the angle is small its sine is too close to zero to divide by,
+	// but linear interpolation is indistinguishable
+	if ( cosAngle > NlerpThreshold_cosAngle )
+	{
+		return Nlerp( i_from, i_to, i_t );
+	}
+	const auto angle = Acos_fast( cosAngle );
+	const auto sinAngle_reciprocal = 1.0f / Sin_fast( angle );
+	const auto fromScale = Sin_fast( ( 1.0f - i_t ) * angle ) * sinAngle_reciprocal;
+	toScale *= Sin_fast( i_t * angle ) * sinAngle_reciprocal;
+	return cQuaternion(
+		( i_from.m_w * fromScale ) + ( i_to.m_w * toScale ),
+		( i_from.m_x * fromScale ) + ( i_to.m_x * toScale ),
+		( i_from.m_y * fromScale ) + ( i_to.m_y * toScale ),
+		( i_from.m_z * fromScale ) + ( i_to.m_z * toScale ) );
 }
 
 // Initialization / Shut Down
@@ -105,3 +112,36 @@ eae6320::Math::cQuaternion::cQuaternion( const float i_angleInRadians, const sVe
 	m_y = i_axisOfRotation_normalized.y * sin_theta_half;
 	m_z = i_axisOfRotation_normalized.z * sin_theta_half;
 }
+
+eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateFromAngleAxis_fast( const float i_angleInRadians,
+	const sVector& i_axisOfRotation_normalized )
+{
+	float sin_theta_half, cos_theta_half;
+	SinCos_fast( i_angleInRadians * 0.5f, sin_theta_half, cos_theta_half );
+	return cQuaternion( cos_theta_half,
+		i_axisOfRotation_normalized.x * sin_theta_half, i_axisOfRotation_normalized.y * sin_theta_half, i_axisOfRotation_normalized.z * sin_theta_half );
+}
+
+// Compile-Time Tests
+//===================
+
+// These are evaluated every time that this file is compiled
+
+namespace
+{
+	constexpr bool AreNearlyEqual( const float i_lhs, const float i_rhs )
+	{
+		return ( ( i_lhs - i_rhs ) < 1.0e-6f ) && ( ( i_rhs - i_lhs ) < 1.0e-6f );
+	}
+
+	constexpr auto s_testRotation = eae6320::Math::cQuaternion::CreateFromAngleAxis_constexpr( 1.0f,
+		eae6320::Math::sVector( 1.0f, 2.0f, 2.0f ).GetNormalized_constexpr() );
+}
+
+static_assert( Dot( eae6320::Math::cQuaternion::CreateFromAngleAxis_constexpr( 0.0f, eae6320::Math::sVector( 0.0f, 1.0f, 0.0f ) ),
+	eae6320::Math::cQuaternion() ) == 1.0f, "A rotation of zero isn't the identity" );
+static_assert( AreNearlyEqual( Dot( s_testRotation, s_testRotation ), 1.0f ), "A rotation around a normalized axis isn't normalized" );
+static_assert( AreNearlyEqual( Dot( s_testRotation * s_testRotation.GetInverse(), eae6320::Math::cQuaternion() ), 1.0f ),
+	"A rotation multiplied by its inverse isn't the identity" );
+static_assert( eae6320::Math::cQuaternion().CalculateForwardDirection() == eae6320::Math::sVector( 0.0f, 0.0f, -1.0f ),
+	"The identity's forward direction isn't negative Z" );
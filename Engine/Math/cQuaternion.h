@@ -1,5 +1,8 @@
 /*
 	This class represents a rotation or an orientation
+
+	Everything except normalization and creating a quaternion from an angle can be evaluated at compile time
+	(and there are compile-time versions of those functions for constants that need them).
 */
 
 #ifndef EAE6320_MATH_CQUATERNION_H
@@ -33,24 +36,46 @@ namespace eae6320
 			// Multiplication
 			//---------------
 
-			cQuaternion operator *( const cQuaternion& i_rhs ) const;
+			constexpr cQuaternion operator *( const cQuaternion& i_rhs ) const;
 
 			// Inversion
 			//----------
 
-			void Invert();
-			cQuaternion GetInverse() const;
+			constexpr void Invert();
+			constexpr cQuaternion GetInverse() const;
 
 			// Normalization
 			//--------------
 
 			void Normalize();
 			cQuaternion GetNormalized() const;
+			// These are cheaper but less accurate (see ReciprocalSqrt_fast() in Functions.h)
+			void Normalize_fast();
+			cQuaternion GetNormalized_fast() const;
+			// This can be evaluated at compile time, but shouldn't be used at run time
+			constexpr cQuaternion GetNormalized_constexpr() const;
 
 			// Products
 			//---------
 
-			friend float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+			friend constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+
+			// Interpolation
+			//--------------
+
+			// Both of these interpolate along the shortest path
+			// (a quaternion and its negation are the same rotation,
+			// and so if the dot product is negative the destination is negated).
+			// The quaternions must be normalized.
+			//	* Nlerp() interpolates linearly and then normalizes,
+			//		which is cheap but changes speed in the middle (noticeably only when the rotations are far apart)
+			//	* Slerp() interpolates at a constant angular speed.
+			//		It uses the fast approximations from Functions.h (and switches to Nlerp() when the rotations are nearly the same),
+			//		and so its result is within 1e-6 of an exact slerp
+			static cQuaternion Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+			static cQuaternion Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+			// Slerp() uses Nlerp() when the cosine of the angle between the rotations is greater than this
+			static constexpr float NlerpThreshold_cosAngle = 0.9995f;
 
 			// Access
 			//-------
@@ -58,7 +83,7 @@ namespace eae6320
 			// Calculating the forward direction involves a variation of calculating a full transformation matrix;
 			// if the transform is already available or will need to be calculated in the future
 			// it is more efficient to extract the forward direction from that
-			sVector CalculateForwardDirection() const;
+			constexpr sVector CalculateForwardDirection() const;
 
 			// Initialization / Shut Down
 			//---------------------------
@@ -66,6 +91,13 @@ namespace eae6320
 			cQuaternion() = default;	// Identity
 			cQuaternion( const float i_angleInRadians,	// A positive angle rotates counter-clockwise (right-handed) around the axis
 				const sVector& i_axisOfRotation_normalized );
+			// This creates the same rotation as the constructor above but is cheaper and less accurate
+			// (see SinCos_fast() in Functions.h)
+			static cQuaternion CreateFromAngleAxis_fast( const float i_angleInRadians, const sVector& i_axisOfRotation_normalized );
+			// This creates the same rotation as the constructor above and can be evaluated at compile time,
+			// but it shouldn't be used at run time
+			static constexpr cQuaternion CreateFromAngleAxis_constexpr( const float i_angleInRadians,
+				const sVector& i_axisOfRotation_normalized );
 
 			// Data
 			//=====
@@ -85,13 +117,17 @@ namespace eae6320
 			// Initialization / Shut Down
 			//---------------------------
 
-			cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
+			constexpr cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
 
 			// Friends
 			//========
 
 			friend class cMatrix_transformation;
 		};
+
+		// The friend function is defined outside of the namespace (in cQuaternion.inl),
+		// which is only allowed if it has also been declared in it
+		constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
 	}
 }
 
@@ -6,13 +6,96 @@
 
 #include "cQuaternion.h"
 
+#include "Functions.h"
+#include "sVector.h"
+
+// Interface
+//==========
+
+// Multiplication
+//---------------
+
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::operator *( const cQuaternion& i_rhs ) const
+{
+	return cQuaternion(
+		( m_w * i_rhs.m_w ) - ( ( m_x * i_rhs.m_x ) + ( m_y * i_rhs.m_y ) + ( m_z * i_rhs.m_z ) ),
+		( m_w * i_rhs.m_x ) + ( m_x * i_rhs.m_w ) + ( ( m_y * i_rhs.m_z ) - ( m_z * i_rhs.m_y ) ),
+		( m_w * i_rhs.m_y ) + ( m_y * i_rhs.m_w ) + ( ( m_z * i_rhs.m_x ) - ( m_x * i_rhs.m_z ) ),
+		( m_w * i_rhs.m_z ) + ( m_z * i_rhs.m_w ) + ( ( m_x * i_rhs.m_y ) - ( m_y * i_rhs.m_x ) ) );
+}
+
+// Inversion
+//----------
+
+constexpr void eae6320::Math::cQuaternion::Invert()
+{
+	m_x = -m_x;
+	m_y = -m_y;
+	m_z = -m_z;
+}
+
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::GetInverse() const
+{
+	return cQuaternion( m_w, -m_x, -m_y, -m_z );
+}
+
+// Normalization
+//--------------
+
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::GetNormalized_constexpr() const
+{
+	// Dividing by zero isn't a constant expression,
+	// and so a zero-length quaternion can't be normalized at compile time
+	const auto length_reciprocal = 1.0f / Sqrt_constexpr( ( m_w * m_w ) + ( m_x * m_x ) + ( m_y * m_y ) + ( m_z * m_z ) );
+	return cQuaternion( m_w * length_reciprocal, m_x * length_reciprocal, m_y * length_reciprocal, m_z * length_reciprocal );
+}
+
+// Products
+//---------
+
+constexpr float eae6320::Math::Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs )
+{
+	return ( i_lhs.m_w * i_rhs.m_w ) + ( i_lhs.m_x * i_rhs.m_x ) + ( i_lhs.m_y * i_rhs.m_y ) + ( i_lhs.m_z * i_rhs.m_z );
+}
+
+// Access
+//-------
+
+constexpr eae6320::Math::sVector eae6320::Math::cQuaternion::CalculateForwardDirection() const
+{
+	const auto _2x = m_x + m_x;
+	const auto _2y = m_y + m_y;
+	const auto _2xx = m_x * _2x;
+	const auto _2xz = _2x * m_z;
+	const auto _2xw = _2x * m_w;
+	const auto _2yy = _2y * m_y;
+	const auto _2yz = _2y * m_z;
+	const auto _2yw = _2y * m_w;
+
+	return sVector( -_2xz - _2yw, -_2yz + _2xw, -1.0f + _2xx + _2yy );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateFromAngleAxis_constexpr( const float i_angleInRadians,
+	const sVector& i_axisOfRotation_normalized )
+{
+	const auto theta_half = i_angleInRadians * 0.5f;
+	const auto sin_theta_half = Sin_constexpr( theta_half );
+	return cQuaternion( Cos_constexpr( theta_half ),
+		i_axisOfRotation_normalized.x * sin_theta_half,
+		i_axisOfRotation_normalized.y * sin_theta_half,
+		i_axisOfRotation_normalized.z * sin_theta_half );
+}
+
 // Implementation
 //===============
 
 // Initialization / Shut Down
 //---------------------------
 
-inline eae6320::Math::cQuaternion::cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z )
+constexpr eae6320::Math::cQuaternion::cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z )
 	:
 	m_w( i_w ), m_x( i_x ), m_y( i_y ), m_z( i_z )
 {
@@ -3,6 +3,8 @@
 
 #include "sVector.h"
 
+#include "Functions.h"
+
 #include <cmath>
 #include <Engine/Asserts/Asserts.h>
 
@@ -17,59 +19,6 @@ namespace
 // Interface
 //==========
 
-// Addition
-//---------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator +( const sVector& i_rhs ) const
-{
-	return sVector( x + i_rhs.x, y + i_rhs.y, z + i_rhs.z );
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator +=( const sVector& i_rhs )
-{
-	x += i_rhs.x;
-	y += i_rhs.y;
-	z += i_rhs.z;
-	return *this;
-}
-
-// Subtraction / Negation
-//-----------------------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator -( const sVector& i_rhs ) const
-{
-	return sVector( x - i_rhs.x, y - i_rhs.y, z - i_rhs.z );
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator -=( const sVector& i_rhs )
-{
-	x -= i_rhs.x;
-	y -= i_rhs.y;
-	z -= i_rhs.z;
-	return *this;
-}
-
-eae6320::Math::sVector eae6320::Math::sVector::operator -() const
-{
-	return sVector( -x, -y, -z );
-}
-
-// Multiplication
-//---------------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator *( const float i_rhs ) const
-{
-	return sVector( x * i_rhs, y * i_rhs, z * i_rhs );
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator *=( const float i_rhs )
-{
-	x *= i_rhs;
-	y *= i_rhs;
-	z *= i_rhs;
-	return *this;
-}
-
 // Division
 //---------
 
@@ -114,34 +63,38 @@ eae6320::Math::sVector eae6320::Math::sVector::GetNormalized() const
 	return sVector( x * length_reciprocal, y * length_reciprocal, z * length_reciprocal );
 }
 
-// Comparison
-//-----------
-
-bool eae6320::Math::sVector::operator ==( const sVector& i_rhs ) const
+float eae6320::Math::sVector::Normalize_fast()
 {
-	// Use & rather than && to prevent branches (all three comparisons will be evaluated)
-	return ( x == i_rhs.x ) & ( y == i_rhs.y ) & ( z == i_rhs.z );
+	const auto length_squared = ( x * x ) + ( y * y ) + ( z * z );
+	EAE6320_ASSERTF( length_squared > ( s_epsilon * s_epsilon ), "Can't divide by zero" );
+	const auto length_reciprocal = ReciprocalSqrt_fast( length_squared );
+	x *= length_reciprocal;
+	y *= length_reciprocal;
+	z *= length_reciprocal;
+	return length_squared * length_reciprocal;
 }
 
-bool eae6320::Math::sVector::operator !=( const sVector& i_rhs ) const
+eae6320::Math::sVector eae6320::Math::sVector::GetNormalized_fast() const
 {
-	// Use | rather than || to prevent branches (all three comparisons will be evaluated)
-	return ( x != i_rhs.x ) | ( y != i_rhs.y ) | ( z != i_rhs.z );
+	const auto length_squared = ( x * x ) + ( y * y ) + ( z * z );
+	EAE6320_ASSERTF( length_squared > ( s_epsilon * s_epsilon ), "Can't divide by zero" );
+	const auto length_reciprocal = ReciprocalSqrt_fast( length_squared );
+	return sVector( x * length_reciprocal, y * length_reciprocal, z * length_reciprocal );
 }
 
-// Products
-//---------
+// Compile-Time Tests
+//===================
 
-float eae6320::Math::Dot( const sVector& i_lhs, const sVector& i_rhs )
-{
-	return ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z );
-}
+// These are evaluated every time that this file is compiled
 
-eae6320::Math::sVector eae6320::Math::Cross( const sVector& i_lhs, const sVector& i_rhs )
-{
-	return sVector(
-		( i_lhs.y * i_rhs.z ) - ( i_lhs.z * i_rhs.y ),
-		( i_lhs.z * i_rhs.x ) - ( i_lhs.x * i_rhs.z ),
-		( i_lhs.x * i_rhs.y ) - ( i_lhs.y * i_rhs.x )
-	);
-}
+static_assert( ( eae6320::Math::sVector( 1.0f, 2.0f, 3.0f ) + eae6320::Math::sVector( 4.0f, 5.0f, 6.0f ) ) == eae6320::Math::sVector( 5.0f, 7.0f, 9.0f ),
+	"Vector addition isn't correct" );
+static_assert( ( 2.0f * -eae6320::Math::sVector( 1.0f, 2.0f, 3.0f ) ) == eae6320::Math::sVector( -2.0f, -4.0f, -6.0f ),
+	"Vector multiplication isn't correct" );
+static_assert( Dot( eae6320::Math::sVector( 1.0f, 2.0f, 3.0f ), eae6320::Math::sVector( 4.0f, -5.0f, 6.0f ) ) == 12.0f,
+	"The dot product isn't correct" );
+static_assert( Cross( eae6320::Math::sVector( 1.0f, 0.0f, 0.0f ), eae6320::Math::sVector( 0.0f, 1.0f, 0.0f ) ) == eae6320::Math::sVector( 0.0f, 0.0f, 1.0f ),
+	"The cross product isn't right-handed" );
+static_assert( eae6320::Math::sVector( 3.0f, 0.0f, 4.0f ).GetLength_constexpr() == 5.0f, "The compile-time length isn't correct" );
+static_assert( eae6320::Math::sVector( 0.0f, -2.0f, 0.0f ).GetNormalized_constexpr() == eae6320::Math::sVector( 0.0f, -1.0f, 0.0f ),
+	"The compile-time normalization isn't correct" );
@@ -1,5 +1,8 @@
 /*
 	This struct represents a position or direction
+
+	Everything except division and the functions that need a square root can be evaluated at compile time
+	(and there are compile-time versions of those functions for constants that need them).
 */
 
 #ifndef EAE6320_MATH_SVECTOR_H
@@ -25,22 +28,22 @@ namespace eae6320
 			// Addition
 			//---------
 
-			sVector operator +( const sVector& i_rhs ) const;
-			sVector& operator +=( const sVector& i_rhs );
+			constexpr sVector operator +( const sVector& i_rhs ) const;
+			constexpr sVector& operator +=( const sVector& i_rhs );
 
 			// Subtraction / Negation
 			//-----------------------
 
-			sVector operator -( const sVector& i_rhs ) const;
-			sVector& operator -=( const sVector& i_rhs );
-			sVector operator -() const;
+			constexpr sVector operator -( const sVector& i_rhs ) const;
+			constexpr sVector& operator -=( const sVector& i_rhs );
+			constexpr sVector operator -() const;
 
 			// Multiplication
 			//---------------
 
-			sVector operator *( const float i_rhs ) const;
-			sVector& operator *=( const float i_rhs );
-			friend sVector operator *( const float i_lhs, const sVector& i_rhs );
+			constexpr sVector operator *( const float i_rhs ) const;
+			constexpr sVector& operator *=( const float i_rhs );
+			friend constexpr sVector operator *( const float i_lhs, const sVector& i_rhs );
 
 			// Division
 			//---------
@@ -54,25 +57,37 @@ namespace eae6320
 			float GetLength() const;
 			float Normalize();
 			sVector GetNormalized() const;
+			// These are cheaper but less accurate (see ReciprocalSqrt_fast() in Functions.h)
+			float Normalize_fast();
+			sVector GetNormalized_fast() const;
+			// These can be evaluated at compile time, but shouldn't be used at run time
+			constexpr float GetLength_constexpr() const;
+			constexpr sVector GetNormalized_constexpr() const;
 
 			// Products
 			//---------
 
-			friend float Dot( const sVector& i_lhs, const sVector& i_rhs );
-			friend sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
+			friend constexpr float Dot( const sVector& i_lhs, const sVector& i_rhs );
+			friend constexpr sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
 
 			// Comparison
 			//-----------
 
-			bool operator ==( const sVector& i_rhs ) const;
-			bool operator !=( const sVector& i_rhs ) const;
+			constexpr bool operator ==( const sVector& i_rhs ) const;
+			constexpr bool operator !=( const sVector& i_rhs ) const;
 
 			// Initialization / Shut Down
 			//---------------------------
 
 			sVector() = default;
-			sVector( const float i_x, const float i_y, const float i_z );
+			constexpr sVector( const float i_x, const float i_y, const float i_z );
 		};
+
+		// The friend functions are defined outside of the namespace (in sVector.inl),
+		// which is only allowed if they have also been declared in it
+		constexpr sVector operator *( const float i_lhs, const sVector& i_rhs );
+		constexpr float Dot( const sVector& i_lhs, const sVector& i_rhs );
+		constexpr sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
 	}
 }
 
@@ -6,21 +6,121 @@
 
 #include "sVector.h"
 
+#include "Functions.h"
+
 // Interface
 //==========
 
+// Addition
+//---------
+
+constexpr eae6320::Math::sVector eae6320::Math::sVector::operator +( const sVector& i_rhs ) const
+{
+	return sVector( x + i_rhs.x, y + i_rhs.y, z + i_rhs.z );
+}
+
+constexpr eae6320::Math::sVector& eae6320::Math::sVector::operator +=( const sVector& i_rhs )
+{
+	x += i_rhs.x;
+	y += i_rhs.y;
+	z += i_rhs.z;
+	return *this;
+}
+
+// Subtraction / Negation
+//-----------------------
+
+constexpr eae6320::Math::sVector eae6320::Math::sVector::operator -( const sVector& i_rhs ) const
+{
+	return sVector( x - i_rhs.x, y - i_rhs.y, z - i_rhs.z );
+}
+
+constexpr eae6320::Math::sVector& eae6320::Math::sVector::operator -=( const sVector& i_rhs )
+{
+	x -= i_rhs.x;
+	y -= i_rhs.y;
+	z -= i_rhs.z;
+	return *this;
+}
+
+constexpr eae6320::Math::sVector eae6320::Math::sVector::operator -() const
+{
+	return sVector( -x, -y, -z );
+}
+
 // Multiplication
 //---------------
 
-inline eae6320::Math::sVector operator *( const float i_lhs, const eae6320::Math::sVector& i_rhs )
+constexpr eae6320::Math::sVector eae6320::Math::sVector::operator *( const float i_rhs ) const
+{
+	return sVector( x * i_rhs, y * i_rhs, z * i_rhs );
+}
+
+constexpr eae6320::Math::sVector& eae6320::Math::sVector::operator *=( const float i_rhs )
+{
+	x *= i_rhs;
+	y *= i_rhs;
+	z *= i_rhs;
+	return *this;
+}
+
+constexpr eae6320::Math::sVector eae6320::Math::operator *( const float i_lhs, const sVector& i_rhs )
 {
 	return i_rhs * i_lhs;
 }
 
+// Length / Normalization
+//-----------------------
+
+constexpr float eae6320::Math::sVector::GetLength_constexpr() const
+{
+	return Sqrt_constexpr( ( x * x ) + ( y * y ) + ( z * z ) );
+}
+
+constexpr eae6320::Math::sVector eae6320::Math::sVector::GetNormalized_constexpr() const
+{
+	// Dividing by zero isn't a constant expression,
+	// and so a zero-length vector can't be normalized at compile time
+	const auto length_reciprocal = 1.0f / GetLength_constexpr();
+	return sVector( x * length_reciprocal, y * length_reciprocal, z * length_reciprocal );
+}
+
+// Products
+//---------
+
+constexpr float eae6320::Math::Dot( const sVector& i_lhs, const sVector& i_rhs )
+{
+	return ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z );
+}
+
+constexpr eae6320::Math::sVector eae6320::Math::Cross( const sVector& i_lhs, const sVector& i_rhs )
+{
+	return sVector(
+		( i_lhs.y * i_rhs.z ) - ( i_lhs.z * i_rhs.y ),
+		( i_lhs.z * i_rhs.x ) - ( i_lhs.x * i_rhs.z ),
+		( i_lhs.x * i_rhs.y ) - ( i_lhs.y * i_rhs.x )
+	);
+}
+
+// Comparison
+//-----------
+
+constexpr bool eae6320::Math::sVector::operator ==( const sVector& i_rhs ) const
+{
+	// Use & rather than && to prevent branches (all three comparisons will be evaluated)
+	return ( x == i_rhs.x ) & ( y == i_rhs.y ) & ( z == i_rhs.z );
+}
+
+constexpr bool eae6320::Math::sVector::operator !=( const sVector& i_rhs ) const
+{
+	// Use | rather than || to prevent branches (all three comparisons will be evaluated)
+	return ( x != i_rhs.x ) | ( y != i_rhs.y ) | ( z != i_rhs.z );
+}
+
 // Initialization / Shut Down
 //---------------------------
 
-inline eae6320::Math::sVector::sVector( const float i_x, const float i_y, const float i_z )
+constexpr eae6320::Math::sVector::sVector( const float i_x, const float i_y, const float i_z )
 	:
 	x( i_x ), y( i_y ), z( i_z )
 {
@@ -0,0 +1,497 @@
+// Include Files
+//==============
+
+#include "cBoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Objects are sorted into this many bins along an axis,
+	// and the surface area heuristic is only evaluated at the boundaries between bins
+	constexpr unsigned int s_binCount = 16;
+
+	eae6320::Math::sAxisAlignedBox CreateEmptyBounds();
+	eae6320::Math::sAxisAlignedBox CombineBounds( const eae6320::Math::sAxisAlignedBox& i_lhs, const eae6320::Math::sAxisAlignedBox& i_rhs );
+	float CalculateSurfaceArea( const eae6320::Math::sAxisAlignedBox& i_bounds );
+	float GetComponent( const eae6320::Math::sVector& i_vector, const unsigned int i_axis );
+	// This returns true if the box is completely inside of the frustum
+	// (and so everything in the box is too)
+	bool IsContained( const eae6320::Math::sFrustum& i_frustum, const eae6320::Math::sAxisAlignedBox& i_box );
+}
+
+// Interface
+//==========
+
+// Building
+//---------
+
+void eae6320::Physics::cBoundingVolumeHierarchy::Build( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums,
+	const size_t i_count )
+{
+	EAE6320_ASSERTF( i_count <= 0xffffffff, "A hierarchy can't have more than 2^32 - 1 objects" );
+	m_objectBounds.resize( i_count );
+	m_objectIndices.resize( i_count );
+	for ( size_t i = 0; i < i_count; ++i )
+	{
+		auto& bounds = m_objectBounds[i];
+		bounds.minimum = Math::sVector( i_minimums.x[i], i_minimums.y[i], i_minimums.z[i] );
+		bounds.maximum = Math::sVector( i_maximums.x[i], i_maximums.y[i], i_maximums.z[i] );
+		m_objectIndices[i] = static_cast<uint32_t>( i );
+	}
+	m_nodes.clear();
+	m_nodeBuildInfos.clear();
+	m_unusedNodePairIndices.clear();
+	if ( i_count > 0 )
+	{
+		m_nodes.emplace_back();
+		m_nodeBuildInfos.emplace_back();
+		BuildNode( 0, 0, static_cast<uint32_t>( i_count ), 0 );
+	}
+}
+
+void eae6320::Physics::cBoundingVolumeHierarchy::Refit( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums )
+{
+	const auto objectCount = m_objectBounds.size();
+	for ( size_t i = 0; i < objectCount; ++i )
+	{
+		auto& bounds = m_objectBounds[i];
+		bounds.minimum = Math::sVector( i_minimums.x[i], i_minimums.y[i], i_minimums.z[i] );
+		bounds.maximum = Math::sVector( i_maximums.x[i], i_maximums.y[i], i_maximums.z[i] );
+	}
+	if ( !m_nodes.empty() )
+	{
+		RefitNode( 0 );
+	}
+}
+
+size_t eae6320::Physics::cBoundingVolumeHierarchy::RebuildDegradedSubtrees( const float i_maximumSurfaceAreaRatio )
+{
+	EAE6320_ASSERTF( i_maximumSurfaceAreaRatio >= 1.0f, "A ratio less than one would rebuild subtrees that haven't changed" );
+	return !m_nodes.empty() ? RebuildDegradedNode( 0, i_maximumSurfaceAreaRatio ) : 0;
+}
+
+// Queries
+//--------
+
+bool eae6320::Physics::cBoundingVolumeHierarchy::Raycast( const Math::sRay& i_ray, const float i_maximumDistance, uint32_t& o_objectId, float& o_hitDistance ) const
+{
+	if ( m_nodes.empty() )
+	{
+		return false;
+	}
+	auto closestDistance = i_maximumDistance;
+	auto wasHit = false;
+	// Each node on the stack has the distance that the ray enters it
+	// so that it can be skipped if something closer has been hit since it was pushed
+	struct sStackEntry
+	{
+		uint32_t nodeIndex;
+		float distance;
+	} stack[MaximumDepth + 2];
+	unsigned int stackSize = 0;
+	{
+		float distance;
+		if ( Math::Raycast( i_ray, m_nodes[0].bounds, closestDistance, distance ) )
+		{
+			stack[stackSize++] = { 0, distance };
+		}
+	}
+	while ( stackSize > 0 )
+	{
+		const auto stackEntry = stack[--stackSize];
+		if ( stackEntry.distance > closestDistance )
+		{
+			continue;
+		}
+		const auto& node = m_nodes[stackEntry.nodeIndex];
+		if ( node.IsLeaf() )
+		{
+			for ( uint32_t i = 0; i < node.objectCount_leaf; ++i )
+			{
+				const auto objectId = m_objectIndices[node.index + i];
+				float distance;
+				if ( Math::Raycast( i_ray, m_objectBounds[objectId], closestDistance, distance )
+					&& ( !wasHit || ( distance < closestDistance ) ) )
+				{
+					closestDistance = distance;
+					o_objectId = objectId;
+					wasHit = true;
+				}
+			}
+		}
+		else
+		{
+			// The nearer child is pushed last so that it is visited first
+			float distance_0, distance_1;
+			const auto isHit_0 = Math::Raycast( i_ray, m_nodes[node.index].bounds, closestDistance, distance_0 );
+			const auto isHit_1 = Math::Raycast( i_ray, m_nodes[node.index + 1].bounds, closestDistance, distance_1 );
+			if ( isHit_0 && isHit_1 )
+			{
+				const auto isFirstNearer = distance_0 <= distance_1;
+				stack[stackSize++] = isFirstNearer ? sStackEntry{ node.index + 1, distance_1 } : sStackEntry{ node.index, distance_0 };
+				stack[stackSize++] = isFirstNearer ? sStackEntry{ node.index, distance_0 } : sStackEntry{ node.index + 1, distance_1 };
+			}
+			else if ( isHit_0 )
+			{
+				stack[stackSize++] = { node.index, distance_0 };
+			}
+			else if ( isHit_1 )
+			{
+				stack[stackSize++] = { node.index + 1, distance_1 };
+			}
+		}
+	}
+	if ( wasHit )
+	{
+		o_hitDistance = closestDistance;
+	}
+	return wasHit;
+}
+
+void eae6320::Physics::cBoundingVolumeHierarchy::FindOverlaps( const Math::sSphere& i_sphere, std::vector<uint32_t>& o_objectIds ) const
+{
+	o_objectIds.clear();
+	if ( m_nodes.empty() )
+	{
+		return;
+	}
+	uint32_t stack[MaximumDepth + 2];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = 0;
+	while ( stackSize > 0 )
+	{
+		const auto& node = m_nodes[stack[--stackSize]];
+		if ( Math::IsOverlapping( node.bounds, i_sphere ) )
+		{
+			if ( node.IsLeaf() )
+			{
+				for ( uint32_t i = 0; i < node.objectCount_leaf; ++i )
+				{
+					const auto objectId = m_objectIndices[node.index + i];
+					if ( Math::IsOverlapping( m_objectBounds[objectId], i_sphere ) )
+					{
+						o_objectIds.push_back( objectId );
+					}
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.index + 1;
+				stack[stackSize++] = node.index;
+			}
+		}
+	}
+}
+
+void eae6320::Physics::cBoundingVolumeHierarchy::FindOverlaps( const Math::sFrustum& i_frustum, std::vector<uint32_t>& o_objectIds ) const
+{
+	o_objectIds.clear();
+	if ( m_nodes.empty() )
+	{
+		return;
+	}
+	uint32_t stack[MaximumDepth + 2];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = 0;
+	while ( stackSize > 0 )
+	{
+		const auto nodeIndex = stack[--stackSize];
+		const auto& node = m_nodes[nodeIndex];
+		if ( Math::IsOverlapping( i_frustum, node.bounds ) )
+		{
+			if ( IsContained( i_frustum, node.bounds ) )
+			{
+				// Every object in a node that is completely inside of the frustum is visible
+				// without testing them individually
+				const auto& buildInfo = m_nodeBuildInfos[nodeIndex];
+				o_objectIds.insert( o_objectIds.end(), m_objectIndices.begin() + buildInfo.objectIndex_first,
+					m_objectIndices.begin() + buildInfo.objectIndex_first + buildInfo.objectCount );
+			}
+			else if ( node.IsLeaf() )
+			{
+				for ( uint32_t i = 0; i < node.objectCount_leaf; ++i )
+				{
+					const auto objectId = m_objectIndices[node.index + i];
+					if ( Math::IsOverlapping( i_frustum, m_objectBounds[objectId] ) )
+					{
+						o_objectIds.push_back( objectId );
+					}
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.index + 1;
+				stack[stackSize++] = node.index;
+			}
+		}
+	}
+}
+
+// Implementation
+//===============
+
+void eae6320::Physics::cBoundingVolumeHierarchy::BuildNode( const uint32_t i_nodeIndex, const uint32_t i_objectIndex_first, const uint32_t i_objectCount,
+	const uint32_t i_depth )
+{
+	EAE6320_ASSERT( i_objectCount > 0 );
+	const auto objectIndices_begin = m_objectIndices.begin() + i_objectIndex_first;
+	const auto objectIndices_end = objectIndices_begin + i_objectCount;
+
+	// Calculate the bounds of the objects and of their centers
+	auto bounds = CreateEmptyBounds();
+	auto centerBounds = CreateEmptyBounds();
+	for ( auto objectIndex = objectIndices_begin; objectIndex != objectIndices_end; ++objectIndex )
+	{
+		const auto& objectBounds = m_objectBounds[*objectIndex];
+		bounds = CombineBounds( bounds, objectBounds );
+		const auto center = objectBounds.GetCenter();
+		Math::sAxisAlignedBox centerPoint;
+		centerPoint.minimum = centerPoint.maximum = center;
+		centerBounds = CombineBounds( centerBounds, centerPoint );
+	}
+	m_nodes[i_nodeIndex].bounds = bounds;
+	{
+		auto& buildInfo = m_nodeBuildInfos[i_nodeIndex];
+		buildInfo.objectIndex_first = i_objectIndex_first;
+		buildInfo.objectCount = i_objectCount;
+		buildInfo.depth = i_depth;
+		buildInfo.surfaceArea_built = CalculateSurfaceArea( bounds );
+	}
+	if ( ( i_objectCount <= MaximumObjectCountPerLeaf ) || ( i_depth >= MaximumDepth ) )
+	{
+		auto& node = m_nodes[i_nodeIndex];
+		node.index = i_objectIndex_first;
+		node.objectCount_leaf = i_objectCount;
+		return;
+	}
+
+	// Split the objects along the axis where their centers are most spread out
+	unsigned int axis = 0;
+	{
+		const auto extents = centerBounds.maximum - centerBounds.minimum;
+		if ( extents.y > GetComponent( extents, axis ) )
+		{
+			axis = 1;
+		}
+		if ( extents.z > GetComponent( extents, axis ) )
+		{
+			axis = 2;
+		}
+	}
+	const auto center_minimum = GetComponent( centerBounds.minimum, axis );
+	const auto center_extent = GetComponent( centerBounds.maximum, axis ) - center_minimum;
+	uint32_t objectCount_first = 0;
+	if ( center_extent > 0.0f )
+	{
+		const auto binScale = static_cast<float>( s_binCount ) / center_extent;
+		const auto calculateBinIndex = [this, axis, center_minimum, binScale]( const uint32_t i_objectIndex )
+		{
+			const auto center = GetComponent( m_objectBounds[i_objectIndex].GetCenter(), axis );
+			return std::min( static_cast<unsigned int>( ( center - center_minimum ) * binScale ), s_binCount - 1 );
+		};
+		// Sort the objects into bins
+		struct
+		{
+			Math::sAxisAlignedBox bounds = CreateEmptyBounds();
+			uint32_t objectCount = 0;
+		} bins[s_binCount];
+		for ( auto objectIndex = objectIndices_begin; objectIndex != objectIndices_end; ++objectIndex )
+		{
+			auto& bin = bins[calculateBinIndex( *objectIndex )];
+			bin.bounds = CombineBounds( bin.bounds, m_objectBounds[*objectIndex] );
+			++bin.objectCount;
+		}
+		// The cost of splitting after bin i is proportional to
+		//	( surfaceArea_first * objectCount_first ) + ( surfaceArea_second * objectCount_second )
+		// (the probability of a ray hitting a box is proportional to its surface area,
+		// and the work done in a box that is hit is proportional to how many objects it has)
+		float costs[s_binCount - 1];
+		{
+			auto bounds_first = CreateEmptyBounds();
+			uint32_t objectCount_first_bin = 0;
+			for ( unsigned int i = 0; i < ( s_binCount - 1 ); ++i )
+			{
+				bounds_first = CombineBounds( bounds_first, bins[i].bounds );
+				objectCount_first_bin += bins[i].objectCount;
+				costs[i] = CalculateSurfaceArea( bounds_first ) * static_cast<float>( objectCount_first_bin );
+			}
+			auto bounds_second = CreateEmptyBounds();
+			uint32_t objectCount_second_bin = 0;
+			for ( auto i = s_binCount - 1; i > 0; --i )
+			{
+				bounds_second = CombineBounds( bounds_second, bins[i].bounds );
+				objectCount_second_bin += bins[i].objectCount;
+				costs[i - 1] += CalculateSurfaceArea( bounds_second ) * static_cast<float>( objectCount_second_bin );
+			}
+		}
+		unsigned int bestBinIndex = 0;
+		{
+			auto bestCost = FLT_MAX;
+			uint32_t objectCount_first_bin = 0;
+			for ( unsigned int i = 0; i < ( s_binCount - 1 ); ++i )
+			{
+				objectCount_first_bin += bins[i].objectCount;
+				if ( ( objectCount_first_bin > 0 ) && ( objectCount_first_bin < i_objectCount ) && ( costs[i] < bestCost ) )
+				{
+					bestCost = costs[i];
+					bestBinIndex = i;
+				}
+			}
+		}
+		objectCount_first = static_cast<uint32_t>( std::partition( objectIndices_begin, objectIndices_end,
+			[calculateBinIndex, bestBinIndex]( const uint32_t i_objectIndex ) { return calculateBinIndex( i_objectIndex ) <= bestBinIndex; } )
+			- objectIndices_begin );
+	}
+	if ( ( objectCount_first == 0 ) || ( objectCount_first == i_objectCount ) )
+	{
+		// If the objects' centers can't be separated (e.g. they are all the same)
+		// they are split in half arbitrarily to keep the leaves small
+		objectCount_first = i_objectCount / 2;
+	}
+
+	// Build the children
+	// (the nodes can be reallocated when a pair is allocated,
+	// and so no references to them are kept across the calls)
+	const auto childIndex = AllocateNodePair();
+	{
+		auto& node = m_nodes[i_nodeIndex];
+		node.index = childIndex;
+		node.objectCount_leaf = 0;
+	}
+	BuildNode( childIndex, i_objectIndex_first, objectCount_first, i_depth + 1 );
+	BuildNode( childIndex + 1, i_objectIndex_first + objectCount_first, i_objectCount - objectCount_first, i_depth + 1 );
+}
+
+void eae6320::Physics::cBoundingVolumeHierarchy::RefitNode( const uint32_t i_nodeIndex )
+{
+	auto& node = m_nodes[i_nodeIndex];
+	if ( node.IsLeaf() )
+	{
+		auto bounds = CreateEmptyBounds();
+		for ( uint32_t i = 0; i < node.objectCount_leaf; ++i )
+		{
+			bounds = CombineBounds( bounds, m_objectBounds[m_objectIndices[node.index + i]] );
+		}
+		node.bounds = bounds;
+	}
+	else
+	{
+		RefitNode( node.index );
+		RefitNode( node.index + 1 );
+		node.bounds = CombineBounds( m_nodes[node.index].bounds, m_nodes[node.index + 1].bounds );
+	}
+}
+
+size_t eae6320::Physics::cBoundingVolumeHierarchy::RebuildDegradedNode( const uint32_t i_nodeIndex, const float i_maximumSurfaceAreaRatio )
+{
+	// A leaf can't be improved by rebuilding it
+	if ( m_nodes[i_nodeIndex].IsLeaf() )
+	{
+		return 0;
+	}
+	const auto buildInfo = m_nodeBuildInfos[i_nodeIndex];
+	if ( CalculateSurfaceArea( m_nodes[i_nodeIndex].bounds ) > ( buildInfo.surfaceArea_built * i_maximumSurfaceAreaRatio ) )
+	{
+		FreeChildren( i_nodeIndex );
+		BuildNode( i_nodeIndex, buildInfo.objectIndex_first, buildInfo.objectCount, buildInfo.depth );
+		return 1;
+	}
+	else
+	{
+		const auto childIndex = m_nodes[i_nodeIndex].index;
+		return RebuildDegradedNode( childIndex, i_maximumSurfaceAreaRatio ) + RebuildDegradedNode( childIndex + 1, i_maximumSurfaceAreaRatio );
+	}
+}
+
+uint32_t eae6320::Physics::cBoundingVolumeHierarchy::AllocateNodePair()
+{
+	if ( !m_unusedNodePairIndices.empty() )
+	{
+		const auto nodeIndex = m_unusedNodePairIndices.back();
+		m_unusedNodePairIndices.pop_back();
+		return nodeIndex;
+	}
+	else
+	{
+		const auto nodeIndex = static_cast<uint32_t>( m_nodes.size() );
+		m_nodes.resize( nodeIndex + 2 );
+		m_nodeBuildInfos.resize( nodeIndex + 2 );
+		return nodeIndex;
+	}
+}
+
+void eae6320::Physics::cBoundingVolumeHierarchy::FreeChildren( const uint32_t i_nodeIndex )
+{
+	const auto& node = m_nodes[i_nodeIndex];
+	if ( !node.IsLeaf() )
+	{
+		const auto childIndex = node.index;
+		FreeChildren( childIndex );
+		FreeChildren( childIndex + 1 );
+		m_unusedNodePairIndices.push_back( childIndex );
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	eae6320::Math::sAxisAlignedBox CreateEmptyBounds()
+	{
+		eae6320::Math::sAxisAlignedBox bounds;
+		bounds.minimum = eae6320::Math::sVector( FLT_MAX, FLT_MAX, FLT_MAX );
+		bounds.maximum = eae6320::Math::sVector( -FLT_MAX, -FLT_MAX, -FLT_MAX );
+		return bounds;
+	}
+
+	eae6320::Math::sAxisAlignedBox CombineBounds( const eae6320::Math::sAxisAlignedBox& i_lhs, const eae6320::Math::sAxisAlignedBox& i_rhs )
+	{
+		eae6320::Math::sAxisAlignedBox bounds;
+		bounds.minimum = eae6320::Math::sVector( std::min( i_lhs.minimum.x, i_rhs.minimum.x ),
+			std::min( i_lhs.minimum.y, i_rhs.minimum.y ), std::min( i_lhs.minimum.z, i_rhs.minimum.z ) );
+		bounds.maximum = eae6320::Math::sVector( std::max( i_lhs.maximum.x, i_rhs.maximum.x ),
+			std::max( i_lhs.maximum.y, i_rhs.maximum.y ), std::max( i_lhs.maximum.z, i_rhs.maximum.z ) );
+		return bounds;
+	}
+
+	float CalculateSurfaceArea( const eae6320::Math::sAxisAlignedBox& i_bounds )
+	{
+		// An empty box (with a maximum less than its minimum) has no area
+		const auto extents = i_bounds.maximum - i_bounds.minimum;
+		if ( ( extents.x < 0.0f ) || ( extents.y < 0.0f ) || ( extents.z < 0.0f ) )
+		{
+			return 0.0f;
+		}
+		return 2.0f * ( ( extents.x * extents.y ) + ( extents.y * extents.z ) + ( extents.z * extents.x ) );
+	}
+
+	float GetComponent( const eae6320::Math::sVector& i_vector, const unsigned int i_axis )
+	{
+		return ( i_axis == 0 ) ? i_vector.x : ( ( i_axis == 1 ) ? i_vector.y : i_vector.z );
+	}
+
+	bool IsContained( const eae6320::Math::sFrustum& i_frustum, const eae6320::Math::sAxisAlignedBox& i_box )
+	{
+		const auto center = i_box.GetCenter();
+		const auto halfExtents = i_box.GetHalfExtents();
+		for ( const auto& plane : i_frustum.planes )
+		{
+			// The box is only inside of the plane if its farthest corner behind the plane is still in front of it
+			const auto projectedRadius = ( ( halfExtents.x * std::abs( plane.normal.x ) ) + ( halfExtents.y * std::abs( plane.normal.y ) ) )
+				+ ( halfExtents.z * std::abs( plane.normal.z ) );
+			if ( plane.GetSignedDistance( center ) < projectedRadius )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,123 @@
+/*
+	A bounding volume hierarchy is a tree of boxes
+	where each box contains all of the boxes below it
+	and the leaves contain the bounds of objects
+
+	It answers queries about a scene (raycasts, overlaps, visibility)
+	by only visiting the branches whose boxes could contain an answer.
+
+	The tree is built with the surface area heuristic,
+	which splits objects where the expected cost of visiting the two new boxes is lowest.
+	When objects move the tree can be refit (which keeps its structure and only grows boxes),
+	and then any subtrees whose boxes have grown too much since they were built can be rebuilt.
+*/
+
+#ifndef EAE6320_PHYSICS_CBOUNDINGVOLUMEHIERARCHY_H
+#define EAE6320_PHYSICS_CBOUNDINGVOLUMEHIERARCHY_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/Geometry.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Physics
+	{
+		class cBoundingVolumeHierarchy
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// The bounds are a structure of arrays (e.g. the bounds of every body in a world),
+			// and the object IDs that queries output are indices into those arrays
+
+			// Building
+			//---------
+
+			void Build( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums,
+				const size_t i_count );
+			// The objects must be the same as when the tree was built
+			// (if objects have been added or removed the tree must be built again)
+			void Refit( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums );
+			// This rebuilds every subtree whose surface area has grown by more than the given ratio since it was built
+			// (only the highest such subtree is rebuilt, and so rebuilding the root rebuilds everything).
+			// It returns how many subtrees were rebuilt.
+			size_t RebuildDegradedSubtrees( const float i_maximumSurfaceAreaRatio = 2.0f );
+
+			size_t GetObjectCount() const { return m_objectBounds.size(); }
+			size_t GetNodeCount() const { return m_nodes.size() - ( m_unusedNodePairIndices.size() * 2 ); }
+
+			// Queries
+			//--------
+
+			// If the ray hits an object within the maximum distance
+			// the object and the distance to the closest hit are output
+			bool Raycast( const Math::sRay& i_ray, const float i_maximumDistance, uint32_t& o_objectId, float& o_hitDistance ) const;
+			// These output every object that overlaps the shape
+			// (the vector is cleared first, and it should be reused to avoid allocations)
+			void FindOverlaps( const Math::sSphere& i_sphere, std::vector<uint32_t>& o_objectIds ) const;
+			void FindOverlaps( const Math::sFrustum& i_frustum, std::vector<uint32_t>& o_objectIds ) const;
+
+			// A leaf is only split if it has more objects than this
+			static constexpr uint32_t MaximumObjectCountPerLeaf = 4;
+			// The tree is never deeper than this
+			// (which limits the size of the stack that traversing it needs)
+			static constexpr uint32_t MaximumDepth = 48;
+
+			// Data
+			//=====
+
+		private:
+
+			// An interior node's index is its first child (and the second child is after it),
+			// and a leaf node's index is its first object in the object indices
+			struct sNode
+			{
+				Math::sAxisAlignedBox bounds;
+				uint32_t index = 0;
+				uint32_t objectCount_leaf = 0;	// Zero for interior nodes
+
+				bool IsLeaf() const { return objectCount_leaf != 0; }
+			};
+			std::vector<sNode> m_nodes;
+			// Information that queries don't need is kept separately
+			// so that the nodes stay small
+			struct sNodeBuildInfo
+			{
+				uint32_t objectIndex_first = 0;	// Every node's objects are contiguous in the object indices
+				uint32_t objectCount = 0;
+				uint32_t depth = 0;
+				float surfaceArea_built = 0.0f;
+			};
+			std::vector<sNodeBuildInfo> m_nodeBuildInfos;
+			// The children of rebuilt subtrees are freed in pairs and reused
+			std::vector<uint32_t> m_unusedNodePairIndices;
+
+			std::vector<Math::sAxisAlignedBox> m_objectBounds;
+			std::vector<uint32_t> m_objectIndices;
+
+			// Implementation
+			//===============
+
+		private:
+
+			void BuildNode( const uint32_t i_nodeIndex, const uint32_t i_objectIndex_first, const uint32_t i_objectCount, const uint32_t i_depth );
+			void RefitNode( const uint32_t i_nodeIndex );
+			size_t RebuildDegradedNode( const uint32_t i_nodeIndex, const float i_maximumSurfaceAreaRatio );
+			uint32_t AllocateNodePair();
+			void FreeChildren( const uint32_t i_nodeIndex );
+		};
+	}
+}
+
+#endif	// EAE6320_PHYSICS_CBOUNDINGVOLUMEHIERARCHY_H
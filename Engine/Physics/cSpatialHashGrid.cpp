@@ -0,0 +1,165 @@
+// Include Files
+//==============
+
+#include "cSpatialHashGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Each cell coordinate uses 21 bits of a key,
+	// and so a grid can be 2^21 cells wide along each axis (centered on the origin)
+	constexpr int s_coordinateBitCount = 21;
+	constexpr int64_t s_coordinateOffset = int64_t( 1 ) << ( s_coordinateBitCount - 1 );
+
+	int64_t CalculateCellCoordinate( const float i_position, const float i_cellSize_reciprocal );
+	uint64_t CalculateKey( const int64_t i_x, const int64_t i_y, const int64_t i_z );
+}
+
+// Interface
+//==========
+
+void eae6320::Physics::cSpatialHashGrid::FindOverlappingPairs( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums,
+	const size_t i_count, std::vector<sOverlappingPair>& o_pairs )
+{
+	o_pairs.clear();
+
+	// Put each object into every cell that its bounds touch
+	m_entries.clear();
+	m_oversizedIds.clear();
+	for ( size_t i = 0; i < i_count; ++i )
+	{
+		// The number of cells is calculated with floats first
+		// so that an object that is too big can't overflow an integer or be too far from the origin for a key
+		{
+			const auto cellCount =
+				( std::floor( i_maximums.x[i] * m_cellSize_reciprocal ) - std::floor( i_minimums.x[i] * m_cellSize_reciprocal ) + 1.0f )
+				* ( std::floor( i_maximums.y[i] * m_cellSize_reciprocal ) - std::floor( i_minimums.y[i] * m_cellSize_reciprocal ) + 1.0f )
+				* ( std::floor( i_maximums.z[i] * m_cellSize_reciprocal ) - std::floor( i_minimums.z[i] * m_cellSize_reciprocal ) + 1.0f );
+			if ( !( cellCount <= static_cast<float>( MaximumCellCountPerObject ) ) )
+			{
+				m_oversizedIds.push_back( static_cast<uint32_t>( i ) );
+				continue;
+			}
+		}
+		const auto minimum_x = CalculateCellCoordinate( i_minimums.x[i], m_cellSize_reciprocal );
+		const auto minimum_y = CalculateCellCoordinate( i_minimums.y[i], m_cellSize_reciprocal );
+		const auto minimum_z = CalculateCellCoordinate( i_minimums.z[i], m_cellSize_reciprocal );
+		const auto maximum_x = CalculateCellCoordinate( i_maximums.x[i], m_cellSize_reciprocal );
+		const auto maximum_y = CalculateCellCoordinate( i_maximums.y[i], m_cellSize_reciprocal );
+		const auto maximum_z = CalculateCellCoordinate( i_maximums.z[i], m_cellSize_reciprocal );
+		for ( auto z = minimum_z; z <= maximum_z; ++z )
+		{
+			for ( auto y = minimum_y; y <= maximum_y; ++y )
+			{
+				for ( auto x = minimum_x; x <= maximum_x; ++x )
+				{
+					sEntry entry;
+					entry.key = CalculateKey( x, y, z );
+					entry.id = static_cast<uint32_t>( i );
+					m_entries.push_back( entry );
+				}
+			}
+		}
+	}
+	// Sort the entries so that the objects in each cell are next to each other
+	std::sort( m_entries.begin(), m_entries.end() );
+	// Test the objects in each cell against each other
+	const auto entryCount = m_entries.size();
+	for ( size_t cellBegin = 0; cellBegin < entryCount; )
+	{
+		const auto key = m_entries[cellBegin].key;
+		auto cellEnd = cellBegin + 1;
+		while ( ( cellEnd < entryCount ) && ( m_entries[cellEnd].key == key ) )
+		{
+			++cellEnd;
+		}
+		for ( auto i = cellBegin; i < cellEnd; ++i )
+		{
+			const auto id_a = m_entries[i].id;
+			for ( auto j = i + 1; j < cellEnd; ++j )
+			{
+				const auto id_b = m_entries[j].id;
+				// Two objects can share more than one cell,
+				// and so a pair is only output from the cell that contains the minimum corner of the overlap
+				if ( ( i_minimums.x[id_a] <= i_maximums.x[id_b] ) && ( i_maximums.x[id_a] >= i_minimums.x[id_b] )
+					&& ( i_minimums.y[id_a] <= i_maximums.y[id_b] ) && ( i_maximums.y[id_a] >= i_minimums.y[id_b] )
+					&& ( i_minimums.z[id_a] <= i_maximums.z[id_b] ) && ( i_maximums.z[id_a] >= i_minimums.z[id_b] ) )
+				{
+					const auto overlapKey = CalculateKey(
+						CalculateCellCoordinate( std::max( i_minimums.x[id_a], i_minimums.x[id_b] ), m_cellSize_reciprocal ),
+						CalculateCellCoordinate( std::max( i_minimums.y[id_a], i_minimums.y[id_b] ), m_cellSize_reciprocal ),
+						CalculateCellCoordinate( std::max( i_minimums.z[id_a], i_minimums.z[id_b] ), m_cellSize_reciprocal ) );
+					if ( overlapKey == key )
+					{
+						o_pairs.emplace_back( id_a, id_b );
+					}
+				}
+			}
+		}
+		cellBegin = cellEnd;
+	}
+	// Test each oversized object against every other object
+	const auto oversizedCount = m_oversizedIds.size();
+	for ( size_t i = 0; i < oversizedCount; ++i )
+	{
+		const auto id_a = m_oversizedIds[i];
+		// A pair of oversized objects is only tested once,
+		// and so the oversized objects with smaller IDs are skipped
+		// (the IDs are in ascending order, and so the next one to skip can be tracked while iterating)
+		size_t oversizedIndex_next = 0;
+		for ( uint32_t id_b = 0; id_b < i_count; ++id_b )
+		{
+			if ( ( oversizedIndex_next < oversizedCount ) && ( m_oversizedIds[oversizedIndex_next] == id_b ) )
+			{
+				if ( oversizedIndex_next++ <= i )
+				{
+					continue;
+				}
+			}
+			if ( ( i_minimums.x[id_a] <= i_maximums.x[id_b] ) && ( i_maximums.x[id_a] >= i_minimums.x[id_b] )
+				&& ( i_minimums.y[id_a] <= i_maximums.y[id_b] ) && ( i_maximums.y[id_a] >= i_minimums.y[id_b] )
+				&& ( i_minimums.z[id_a] <= i_maximums.z[id_b] ) && ( i_maximums.z[id_a] >= i_minimums.z[id_b] ) )
+			{
+				o_pairs.emplace_back( id_a, id_b );
+			}
+		}
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::cSpatialHashGrid::cSpatialHashGrid( const float i_cellSize )
+	:
+	m_cellSize( i_cellSize ), m_cellSize_reciprocal( 1.0f / i_cellSize )
+{
+	EAE6320_ASSERTF( i_cellSize > 0.0f, "A grid's cells must have a size" );
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	int64_t CalculateCellCoordinate( const float i_position, const float i_cellSize_reciprocal )
+	{
+		const auto coordinate = static_cast<int64_t>( std::floor( i_position * i_cellSize_reciprocal ) );
+		EAE6320_ASSERTF( ( coordinate >= -s_coordinateOffset ) && ( coordinate < s_coordinateOffset ),
+			"A position is too far from the origin for the grid's cell size" );
+		return coordinate;
+	}
+
+	uint64_t CalculateKey( const int64_t i_x, const int64_t i_y, const int64_t i_z )
+	{
+		constexpr uint64_t mask = ( uint64_t( 1 ) << s_coordinateBitCount ) - 1;
+		return ( static_cast<uint64_t>( i_x + s_coordinateOffset ) & mask )
+			| ( ( static_cast<uint64_t>( i_y + s_coordinateOffset ) & mask ) << s_coordinateBitCount )
+			| ( ( static_cast<uint64_t>( i_z + s_coordinateOffset ) & mask ) << ( s_coordinateBitCount * 2 ) );
+	}
+}
@@ -0,0 +1,87 @@
+/*
+	A spatial hash grid is a broadphase that divides space into uniform cells
+	and only tests objects that are in the same cell against each other
+
+	Nothing is kept between searches,
+	and so the cost doesn't depend on how much objects have moved
+	(which makes this the better broadphase for many dynamic objects that are spread out).
+	The cell size should be about the size of a typical object:
+	Objects much bigger than a cell would be put into many cells
+	(and so any object that touches more than a maximum number of cells is instead tested against every other object),
+	and cells much bigger than objects contain many objects that don't overlap.
+
+	Instead of storing cells in a hash table
+	each cell's coordinates are packed into a key and every (key, object) entry is sorted,
+	which puts the objects in the same cell next to each other without any collisions between different cells.
+*/
+
+#ifndef EAE6320_PHYSICS_CSPATIALHASHGRID_H
+#define EAE6320_PHYSICS_CSPATIALHASHGRID_H
+
+// Include Files
+//==============
+
+#include "sOverlappingPair.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Math/BatchTransforms.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Physics
+	{
+		class cSpatialHashGrid
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// The bounds are a structure of arrays (e.g. the bounds of every body in a world),
+			// and the IDs in the output pairs are indices into those arrays.
+			// Every pair of objects whose bounds overlap is output once
+			// (the vector is cleared first, and it should be reused to avoid allocations).
+			void FindOverlappingPairs( const Math::BatchTransforms::sConstVectorSpans& i_minimums, const Math::BatchTransforms::sConstVectorSpans& i_maximums,
+				const size_t i_count, std::vector<sOverlappingPair>& o_pairs );
+
+			float GetCellSize() const { return m_cellSize; }
+
+			// An object whose bounds touch more cells than this isn't put into the grid
+			// and is instead tested against every other object
+			// (a few huge objects, e.g. the ground, would otherwise add more entries than every other object combined)
+			static constexpr uint64_t MaximumCellCountPerObject = 64;
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			cSpatialHashGrid( const float i_cellSize );
+
+			// Data
+			//=====
+
+		private:
+
+			float m_cellSize;
+			float m_cellSize_reciprocal;
+
+			// The entries are kept between searches so that their memory is reused
+			struct sEntry
+			{
+				uint64_t key;
+				uint32_t id;
+
+				bool operator <( const sEntry& i_rhs ) const { return ( key < i_rhs.key ) || ( ( key == i_rhs.key ) && ( id < i_rhs.id ) ); }
+			};
+			std::vector<sEntry> m_entries;
+			// The IDs of the objects that touch too many cells (in ascending order)
+			std::vector<uint32_t> m_oversizedIds;
+		};
+	}
+}
+
+#endif	// EAE6320_PHYSICS_CSPATIALHASHGRID_H
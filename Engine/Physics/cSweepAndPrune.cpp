@@ -0,0 +1,126 @@
+// Include Files
+//==============
+
+#include "cSweepAndPrune.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+eae6320::Physics::cSweepAndPrune::tProxyId eae6320::Physics::cSweepAndPrune::AddProxy( const Math::sAxisAlignedBox& i_bounds, const uint32_t i_userId )
+{
+	tProxyId proxyId;
+	if ( !m_unusedProxyIds.empty() )
+	{
+		proxyId = m_unusedProxyIds.back();
+		m_unusedProxyIds.pop_back();
+	}
+	else
+	{
+		proxyId = static_cast<tProxyId>( m_proxies.size() );
+		m_proxies.emplace_back();
+	}
+	auto& proxy = m_proxies[proxyId];
+	proxy.bounds = i_bounds;
+	proxy.userId = i_userId;
+	proxy.isUsed = true;
+	// The new entry is sorted into place during the next search
+	{
+		sEntry entry;
+		entry.userId = i_userId;
+		entry.proxyId = proxyId;
+		m_sortedEntries.push_back( entry );
+	}
+	return proxyId;
+}
+
+void eae6320::Physics::cSweepAndPrune::RemoveProxy( const tProxyId i_proxyId )
+{
+	EAE6320_ASSERTF( ( i_proxyId < m_proxies.size() ) && m_proxies[i_proxyId].isUsed, "This proxy doesn't exist" );
+	m_proxies[i_proxyId].isUsed = false;
+	m_removedProxyIds.push_back( i_proxyId );
+}
+
+void eae6320::Physics::cSweepAndPrune::UpdateProxy( const tProxyId i_proxyId, const Math::sAxisAlignedBox& i_bounds )
+{
+	EAE6320_ASSERTF( ( i_proxyId < m_proxies.size() ) && m_proxies[i_proxyId].isUsed, "This proxy doesn't exist" );
+	m_proxies[i_proxyId].bounds = i_bounds;
+}
+
+void eae6320::Physics::cSweepAndPrune::FindOverlappingPairs( std::vector<sOverlappingPair>& o_pairs )
+{
+	o_pairs.clear();
+
+	// Copy the current bounds into the entries
+	// (and remove the entries of proxies that have been removed)
+	size_t sortedEntryCount = 0;
+	{
+		size_t entryCount = 0;
+		for ( size_t i = 0; i < m_sortedEntries.size(); ++i )
+		{
+			const auto& entry_old = m_sortedEntries[i];
+			const auto& proxy = m_proxies[entry_old.proxyId];
+			if ( proxy.isUsed )
+			{
+				if ( i < m_sortedEntryCount )
+				{
+					++sortedEntryCount;
+				}
+				auto& entry = m_sortedEntries[entryCount++];
+				entry.minimum_x = proxy.bounds.minimum.x;
+				entry.minimum_y = proxy.bounds.minimum.y;
+				entry.minimum_z = proxy.bounds.minimum.z;
+				entry.maximum_x = proxy.bounds.maximum.x;
+				entry.maximum_y = proxy.bounds.maximum.y;
+				entry.maximum_z = proxy.bounds.maximum.z;
+				entry.userId = proxy.userId;
+				entry.proxyId = entry_old.proxyId;
+			}
+		}
+		m_sortedEntries.resize( entryCount );
+		m_unusedProxyIds.insert( m_unusedProxyIds.end(), m_removedProxyIds.begin(), m_removedProxyIds.end() );
+		m_removedProxyIds.clear();
+	}
+	// Sort the entries by their minimum x
+	{
+		const auto isLess = []( const sEntry& i_lhs, const sEntry& i_rhs ) { return i_lhs.minimum_x < i_rhs.minimum_x; };
+		// An insertion sort only does a little work for each entry that has moved past its neighbors,
+		// and objects in a mostly-static scene rarely do
+		for ( size_t i = 1; i < sortedEntryCount; ++i )
+		{
+			const auto entry = m_sortedEntries[i];
+			auto j = i;
+			for ( ; ( j > 0 ) && ( m_sortedEntries[j - 1].minimum_x > entry.minimum_x ); --j )
+			{
+				m_sortedEntries[j] = m_sortedEntries[j - 1];
+			}
+			m_sortedEntries[j] = entry;
+		}
+		// New entries could be anywhere,
+		// and so they are sorted separately and then merged with the others
+		const auto newEntries = m_sortedEntries.begin() + sortedEntryCount;
+		std::sort( newEntries, m_sortedEntries.end(), isLess );
+		std::inplace_merge( m_sortedEntries.begin(), newEntries, m_sortedEntries.end(), isLess );
+		m_sortedEntryCount = m_sortedEntries.size();
+	}
+	// Sweep along the x axis:
+	// Each entry can only overlap the entries after it that start before it ends
+	{
+		const auto entryCount = m_sortedEntries.size();
+		for ( size_t i = 0; i < entryCount; ++i )
+		{
+			const auto& entry = m_sortedEntries[i];
+			for ( auto j = i + 1; ( j < entryCount ) && ( m_sortedEntries[j].minimum_x <= entry.maximum_x ); ++j )
+			{
+				const auto& entry_other = m_sortedEntries[j];
+				if ( ( entry.minimum_y <= entry_other.maximum_y ) && ( entry.maximum_y >= entry_other.minimum_y )
+					&& ( entry.minimum_z <= entry_other.maximum_z ) && ( entry.maximum_z >= entry_other.minimum_z ) )
+				{
+					o_pairs.emplace_back( entry.userId, entry_other.userId );
+				}
+			}
+		}
+	}
+}
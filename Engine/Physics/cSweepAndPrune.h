@@ -0,0 +1,87 @@
+/*
+	Sweep and prune is a broadphase that keeps objects sorted along one axis
+	and finds overlapping pairs by sweeping along that axis
+
+	Objects are added once and then their bounds are updated when they move.
+	The sorted order is kept between searches and fixed with an insertion sort,
+	which is almost free when only a few objects have moved past each other
+	(and so this is the better broadphase for scenes that are mostly static).
+	A scene where everything moves (or where many objects are lined up along the x axis)
+	is better handled by cSpatialHashGrid.
+*/
+
+#ifndef EAE6320_PHYSICS_CSWEEPANDPRUNE_H
+#define EAE6320_PHYSICS_CSWEEPANDPRUNE_H
+
+// Include Files
+//==============
+
+#include "sOverlappingPair.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Math/Geometry.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Physics
+	{
+		class cSweepAndPrune
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// A proxy represents an object in the broadphase
+			using tProxyId = uint32_t;
+			static constexpr tProxyId InvalidProxyId = ~tProxyId( 0 );
+
+			// The user ID is what identifies the object in the overlapping pairs
+			tProxyId AddProxy( const Math::sAxisAlignedBox& i_bounds, const uint32_t i_userId );
+			void RemoveProxy( const tProxyId i_proxyId );
+			void UpdateProxy( const tProxyId i_proxyId, const Math::sAxisAlignedBox& i_bounds );
+
+			size_t GetProxyCount() const { return m_proxies.size() - m_unusedProxyIds.size() - m_removedProxyIds.size(); }
+
+			// Every pair of proxies whose bounds overlap is output once
+			// (the vector is cleared first, and it should be reused to avoid allocations)
+			void FindOverlappingPairs( std::vector<sOverlappingPair>& o_pairs );
+
+			// Data
+			//=====
+
+		private:
+
+			struct sProxy
+			{
+				Math::sAxisAlignedBox bounds;
+				uint32_t userId = 0;
+				bool isUsed = false;
+			};
+			std::vector<sProxy> m_proxies;
+			std::vector<tProxyId> m_unusedProxyIds;
+			// A removed proxy's ID can't be used again until its entry has been removed from the sorted entries
+			std::vector<tProxyId> m_removedProxyIds;
+
+			// The sorted entries have copies of the bounds
+			// so that the sweep only reads contiguous memory
+			struct sEntry
+			{
+				float minimum_x, minimum_y, minimum_z;
+				float maximum_x, maximum_y, maximum_z;
+				uint32_t userId;
+				tProxyId proxyId;
+			};
+			std::vector<sEntry> m_sortedEntries;
+			// Entries for new proxies are added after the ones that were sorted by the last search
+			size_t m_sortedEntryCount = 0;
+		};
+	}
+}
+
+#endif	// EAE6320_PHYSICS_CSWEEPANDPRUNE_H
@@ -0,0 +1,1032 @@
+// Include Files
+//==============
+
+#include "cWorld.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Math/Configuration.h>
+#include <utility>
+
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+	#include <xmmintrin.h>
+#endif
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// This is the same as doing the following for each element:
+	//	value += rate * i_secondCount
+	//	rate += rateOfChange * i_secondCount
+	// (e.g. integrating one component of positions and velocities)
+	void Integrate( float* const io_values, float* const io_rates, const float* const i_ratesOfChange, const size_t i_count,
+		const float i_secondCount );
+
+	// This marks an element of the island arrays that isn't used
+	constexpr uint32_t s_invalidIslandParent = ~uint32_t( 0 );
+
+	// A snapshot starts with this,
+	// and then has every slot (as a body index and an ID), the unused slot indices,
+	// every body's slot index, and then every float array.
+	// Everything is four bytes so that deltas can compare snapshots one word at a time.
+	struct sSnapshotHeader
+	{
+		uint32_t bodyCount;
+		uint32_t awakeBodyCount;
+		uint32_t slotCount;
+		uint32_t unusedSlotIndexCount;
+	};
+	constexpr size_t s_snapshotWordSize = sizeof( uint32_t );
+	constexpr size_t s_snapshotWordCountPerSlot = 2;
+
+	// A word past the end of a base snapshot is treated as zero
+	// (so that a delta can be encoded from a base that had fewer bodies)
+	uint32_t GetSnapshotWord( const void* const i_snapshot, const size_t i_wordCount, const size_t i_wordIndex );
+	// Lengths in a delta are written seven bits per byte,
+	// with the high bit set in every byte except the last
+	void WriteVariableLengthInteger( const size_t i_value, std::vector<uint8_t>& io_bytes );
+	bool ReadVariableLengthInteger( const uint8_t*& io_byte, const uint8_t* const i_end, size_t& o_value );
+}
+
+// Interface
+//==========
+
+// Bodies
+//-------
+
+eae6320::cResult eae6320::Physics::cWorld::AddBody( const sRigidBodyState& i_state, cBodyHandle& o_handle )
+{
+	// Find a slot for the body
+	uint32_t slotIndex;
+	if ( !m_unusedSlotIndices.empty() )
+	{
+		slotIndex = m_unusedSlotIndices.back();
+		m_unusedSlotIndices.pop_back();
+	}
+	else
+	{
+		const auto slotCount = m_slots.size();
+		if ( slotCount < cBodyHandle::InvalidIndex )
+		{
+			slotIndex = static_cast<uint32_t>( slotCount );
+			m_slots.emplace_back();
+		}
+		else
+		{
+			EAE6320_ASSERTF( false, "A world can't have more than %u bodies", static_cast<unsigned int>( cBodyHandle::InvalidIndex ) );
+			o_handle.MakeInvalid();
+			return Results::OutOfMemory;
+		}
+	}
+	// Add the body to the end of the arrays
+	{
+		const auto bodyIndex = GetBodyCount();
+		m_positions.x.push_back( 0.0f ); m_positions.y.push_back( 0.0f ); m_positions.z.push_back( 0.0f );
+		m_velocities.x.push_back( 0.0f ); m_velocities.y.push_back( 0.0f ); m_velocities.z.push_back( 0.0f );
+		m_accelerations.x.push_back( 0.0f ); m_accelerations.y.push_back( 0.0f ); m_accelerations.z.push_back( 0.0f );
+		m_orientations.w.push_back( 1.0f ); m_orientations.x.push_back( 0.0f ); m_orientations.y.push_back( 0.0f ); m_orientations.z.push_back( 0.0f );
+		m_angularVelocityAxes_local.x.push_back( 0.0f ); m_angularVelocityAxes_local.y.push_back( 1.0f ); m_angularVelocityAxes_local.z.push_back( 0.0f );
+		m_angularSpeeds.push_back( 0.0f );
+		m_stillSecondCounts.push_back( 0.0f );
+		m_slotIndices.push_back( slotIndex );
+		m_islandParents.push_back( s_invalidIslandParent );
+		m_areIslandsMoving.push_back( 0 );
+
+		auto& slot = m_slots[slotIndex];
+		slot.bodyIndex = static_cast<uint32_t>( bodyIndex );
+		o_handle = cBodyHandle( slotIndex, slot.id );
+	}
+	// A new body starts awake
+	SwapBodies( GetBodyCount() - 1, m_awakeBodyCount );
+	++m_awakeBodyCount;
+	SetBodyState( o_handle, i_state );
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Physics::cWorld::RemoveBody( cBodyHandle& io_handle )
+{
+	if ( !IsValid( io_handle ) )
+	{
+		EAE6320_ASSERTF( false, "A handle attempting to be removed doesn't refer to a body in this world" );
+		io_handle.MakeInvalid();
+		return Results::Failure;
+	}
+
+	const auto slotIndex = static_cast<uint32_t>( io_handle.GetIndex() );
+	// Move the body to the end of the arrays so that the arrays stay contiguous when it is removed
+	// (an awake body is first moved to the end of the awake bodies so that the awake bodies stay contiguous)
+	{
+		size_t bodyIndex = m_slots[slotIndex].bodyIndex;
+		if ( bodyIndex < m_awakeBodyCount )
+		{
+			--m_awakeBodyCount;
+			SwapBodies( bodyIndex, m_awakeBodyCount );
+			bodyIndex = m_awakeBodyCount;
+		}
+		SwapBodies( bodyIndex, GetBodyCount() - 1 );
+		for ( auto* const floatArray : GetFloatArrays() )
+		{
+			floatArray->pop_back();
+		}
+		m_slotIndices.pop_back();
+		m_islandParents.pop_back();
+		m_areIslandsMoving.pop_back();
+	}
+	// Change the slot's ID so that any other handles to the removed body become invalid
+	auto& slot = m_slots[slotIndex];
+	slot.id = static_cast<uint16_t>( cBodyHandle::IncrementId( slot.id ) );
+	m_unusedSlotIndices.push_back( slotIndex );
+	io_handle.MakeInvalid();
+
+	return Results::Success;
+}
+
+bool eae6320::Physics::cWorld::IsValid( const cBodyHandle i_handle ) const
+{
+	const auto slotIndex = i_handle.GetIndex();
+	if ( ( slotIndex < m_slots.size() ) && ( m_slots[slotIndex].id == i_handle.GetId() ) )
+	{
+		// A slot's ID changes when its body is removed,
+		// but a handle from after a snapshot was taken can match the ID of a slot that was unused in the snapshot
+		const auto bodyIndex = m_slots[slotIndex].bodyIndex;
+		return ( bodyIndex < m_slotIndices.size() ) && ( m_slotIndices[bodyIndex] == slotIndex );
+	}
+	return false;
+}
+
+// Access
+//-------
+
+eae6320::Physics::sRigidBodyState eae6320::Physics::cWorld::GetBodyState( const cBodyHandle i_handle ) const
+{
+	const auto i = GetBodyIndex( i_handle );
+	sRigidBodyState state;
+	state.position = Math::sVector( m_positions.x[i], m_positions.y[i], m_positions.z[i] );
+	state.velocity = Math::sVector( m_velocities.x[i], m_velocities.y[i], m_velocities.z[i] );
+	state.acceleration = Math::sVector( m_accelerations.x[i], m_accelerations.y[i], m_accelerations.z[i] );
+	state.orientation = GetOrientation( i_handle );
+	state.angularVelocity_axis_local = Math::sVector( m_angularVelocityAxes_local.x[i], m_angularVelocityAxes_local.y[i], m_angularVelocityAxes_local.z[i] );
+	state.angularSpeed = m_angularSpeeds[i];
+	return state;
+}
+
+void eae6320::Physics::cWorld::SetBodyState( const cBodyHandle i_handle, const sRigidBodyState& i_state )
+{
+	SetPosition( i_handle, i_state.position );
+	SetVelocity( i_handle, i_state.velocity );
+	SetAcceleration( i_handle, i_state.acceleration );
+	SetOrientation( i_handle, i_state.orientation );
+	SetAngularVelocity( i_handle, i_state.angularVelocity_axis_local, i_state.angularSpeed );
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::GetPosition( const cBodyHandle i_handle ) const
+{
+	const auto i = GetBodyIndex( i_handle );
+	return Math::sVector( m_positions.x[i], m_positions.y[i], m_positions.z[i] );
+}
+
+void eae6320::Physics::cWorld::SetPosition( const cBodyHandle i_handle, const Math::sVector& i_position )
+{
+	const auto i = GetBodyIndex( i_handle );
+	m_positions.x[i] = i_position.x;
+	m_positions.y[i] = i_position.y;
+	m_positions.z[i] = i_position.z;
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::GetVelocity( const cBodyHandle i_handle ) const
+{
+	const auto i = GetBodyIndex( i_handle );
+	return Math::sVector( m_velocities.x[i], m_velocities.y[i], m_velocities.z[i] );
+}
+
+void eae6320::Physics::cWorld::SetVelocity( const cBodyHandle i_handle, const Math::sVector& i_velocity )
+{
+	const auto i = GetBodyIndex( i_handle );
+	m_velocities.x[i] = i_velocity.x;
+	m_velocities.y[i] = i_velocity.y;
+	m_velocities.z[i] = i_velocity.z;
+	if ( ( i >= m_awakeBodyCount ) && !IsStill( i ) )
+	{
+		WakeUp( i );
+	}
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::GetAcceleration( const cBodyHandle i_handle ) const
+{
+	const auto i = GetBodyIndex( i_handle );
+	return Math::sVector( m_accelerations.x[i], m_accelerations.y[i], m_accelerations.z[i] );
+}
+
+void eae6320::Physics::cWorld::SetAcceleration( const cBodyHandle i_handle, const Math::sVector& i_acceleration )
+{
+	const auto i = GetBodyIndex( i_handle );
+	m_accelerations.x[i] = i_acceleration.x;
+	m_accelerations.y[i] = i_acceleration.y;
+	m_accelerations.z[i] = i_acceleration.z;
+	if ( ( i >= m_awakeBodyCount ) && !IsStill( i ) )
+	{
+		WakeUp( i );
+	}
+}
+
+eae6320::Math::cQuaternion eae6320::Physics::cWorld::GetOrientation( const cBodyHandle i_handle ) const
+{
+	const auto i = GetBodyIndex( i_handle );
+	Math::cQuaternion orientation;
+	Math::BatchTransforms::CopyFromSpans(
+		Math::BatchTransforms::sConstQuaternionSpans( &m_orientations.w[i], &m_orientations.x[i], &m_orientations.y[i], &m_orientations.z[i] ),
+		1, &orientation );
+	return orientation;
+}
+
+void eae6320::Physics::cWorld::SetOrientation( const cBodyHandle i_handle, const Math::cQuaternion& i_orientation )
+{
+	Math::BatchTransforms::CopyToSpans( &i_orientation, 1, GetSpans( m_orientations, GetBodyIndex( i_handle ) ) );
+}
+
+void eae6320::Physics::cWorld::SetAngularVelocity( const cBodyHandle i_handle, const Math::sVector& i_axis_local, const float i_angularSpeed )
+{
+	const auto i = GetBodyIndex( i_handle );
+	m_angularVelocityAxes_local.x[i] = i_axis_local.x;
+	m_angularVelocityAxes_local.y[i] = i_axis_local.y;
+	m_angularVelocityAxes_local.z[i] = i_axis_local.z;
+	m_angularSpeeds[i] = i_angularSpeed;
+	if ( ( i >= m_awakeBodyCount ) && !IsStill( i ) )
+	{
+		WakeUp( i );
+	}
+}
+
+// Sleeping
+//---------
+
+void eae6320::Physics::cWorld::SetSleepSettings( const sSleepSettings& i_sleepSettings )
+{
+	m_sleepSettings = i_sleepSettings;
+	if ( !m_sleepSettings.isEnabled )
+	{
+		while ( m_awakeBodyCount < GetBodyCount() )
+		{
+			WakeUp( m_awakeBodyCount );
+		}
+	}
+}
+
+bool eae6320::Physics::cWorld::IsAwake( const cBodyHandle i_handle ) const
+{
+	return GetBodyIndex( i_handle ) < m_awakeBodyCount;
+}
+
+void eae6320::Physics::cWorld::WakeUp( const cBodyHandle i_handle )
+{
+	const auto i = GetBodyIndex( i_handle );
+	if ( i < m_awakeBodyCount )
+	{
+		// Waking up an awake body makes it wait the full time again before it can sleep
+		m_stillSecondCounts[i] = 0.0f;
+	}
+	else
+	{
+		WakeUp( i );
+	}
+}
+
+void eae6320::Physics::cWorld::AddContact( const cBodyHandle i_handle_a, const cBodyHandle i_handle_b )
+{
+	EAE6320_ASSERTF( IsValid( i_handle_a ) && IsValid( i_handle_b ), "A contact must be between two bodies in this world" );
+	m_contacts.emplace_back( i_handle_a, i_handle_b );
+}
+
+// Snapshots
+//----------
+
+size_t eae6320::Physics::cWorld::GetSnapshotSize() const
+{
+	const auto bodyCount = GetBodyCount();
+	return sizeof( sSnapshotHeader )
+		+ ( ( ( m_slots.size() * s_snapshotWordCountPerSlot ) + m_unusedSlotIndices.size()
+			+ ( bodyCount * ( 1 + FloatArrayCount ) ) ) * s_snapshotWordSize );
+}
+
+eae6320::cResult eae6320::Physics::cWorld::TakeSnapshot( void* const o_snapshot, const size_t i_snapshotBufferSize ) const
+{
+	const auto snapshotSize = GetSnapshotSize();
+	if ( i_snapshotBufferSize < snapshotSize )
+	{
+		EAE6320_ASSERTF( false, "A snapshot needs %zu bytes but the buffer only has %zu", snapshotSize, i_snapshotBufferSize );
+		Logging::OutputError( "A physics snapshot couldn't be taken because the buffer was too small (%zu < %zu)",
+			i_snapshotBufferSize, snapshotSize );
+		return Results::Failure;
+	}
+
+	auto* currentByte = static_cast<uint8_t*>( o_snapshot );
+	const auto write = [&currentByte]( const void* const i_data, const size_t i_size )
+	{
+		if ( i_size > 0 )
+		{
+			memcpy( currentByte, i_data, i_size );
+			currentByte += i_size;
+		}
+	};
+	{
+		sSnapshotHeader header;
+		header.bodyCount = static_cast<uint32_t>( GetBodyCount() );
+		header.awakeBodyCount = static_cast<uint32_t>( m_awakeBodyCount );
+		header.slotCount = static_cast<uint32_t>( m_slots.size() );
+		header.unusedSlotIndexCount = static_cast<uint32_t>( m_unusedSlotIndices.size() );
+		write( &header, sizeof( header ) );
+	}
+	// A slot is written as words rather than copied
+	// so that its padding doesn't make otherwise identical snapshots different
+	for ( const auto& slot : m_slots )
+	{
+		const uint32_t words[s_snapshotWordCountPerSlot] = { slot.bodyIndex, slot.id };
+		write( words, sizeof( words ) );
+	}
+	write( m_unusedSlotIndices.data(), m_unusedSlotIndices.size() * sizeof( uint32_t ) );
+	write( m_slotIndices.data(), m_slotIndices.size() * sizeof( uint32_t ) );
+	for ( const auto* const floatArray : GetFloatArrays() )
+	{
+		write( floatArray->data(), floatArray->size() * sizeof( float ) );
+	}
+	EAE6320_ASSERT( currentByte == ( static_cast<uint8_t*>( o_snapshot ) + snapshotSize ) );
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Physics::cWorld::RestoreSnapshot( const void* const i_snapshot, const size_t i_snapshotSize )
+{
+	// Make sure that the snapshot is the right size before changing anything
+	sSnapshotHeader header;
+	{
+		bool isValid = i_snapshotSize >= sizeof( header );
+		if ( isValid )
+		{
+			memcpy( &header, i_snapshot, sizeof( header ) );
+			const size_t expectedSize = sizeof( header )
+				+ ( ( ( static_cast<size_t>( header.slotCount ) * s_snapshotWordCountPerSlot ) + header.unusedSlotIndexCount
+					+ ( static_cast<size_t>( header.bodyCount ) * ( 1 + FloatArrayCount ) ) ) * s_snapshotWordSize );
+			isValid = ( header.awakeBodyCount <= header.bodyCount ) && ( header.bodyCount <= header.slotCount )
+				&& ( header.slotCount <= cBodyHandle::InvalidIndex ) && ( i_snapshotSize == expectedSize )
+				// Every slot is either used by a body or unused
+				&& ( ( static_cast<size_t>( header.bodyCount ) + header.unusedSlotIndexCount ) == header.slotCount );
+		}
+		// Make sure that every slot and body refer to each other
+		// (a snapshot can come from somewhere that can't be trusted, e.g. a delta received over a network,
+		// and restoring invalid indices would make later accesses go outside of the arrays)
+		if ( isValid )
+		{
+			const auto wordCount = i_snapshotSize / s_snapshotWordSize;
+			const auto wordIndex_slots = sizeof( header ) / s_snapshotWordSize;
+			const auto wordIndex_unusedSlotIndices = wordIndex_slots + ( static_cast<size_t>( header.slotCount ) * s_snapshotWordCountPerSlot );
+			const auto wordIndex_slotIndices = wordIndex_unusedSlotIndices + header.unusedSlotIndexCount;
+			m_areSlotsAccountedFor.assign( header.slotCount, 0 );
+			for ( uint32_t i = 0; isValid && ( i < header.slotCount ); ++i )
+			{
+				const auto id = GetSnapshotWord( i_snapshot, wordCount, wordIndex_slots + ( i * s_snapshotWordCountPerSlot ) + 1 );
+				isValid = id <= cBodyHandle::IdMax;
+			}
+			for ( uint32_t i = 0; isValid && ( i < header.bodyCount ); ++i )
+			{
+				const auto slotIndex = GetSnapshotWord( i_snapshot, wordCount, wordIndex_slotIndices + i );
+				isValid = ( slotIndex < header.slotCount ) && ( m_areSlotsAccountedFor[slotIndex] == 0 )
+					&& ( GetSnapshotWord( i_snapshot, wordCount, wordIndex_slots + ( slotIndex * s_snapshotWordCountPerSlot ) ) == i );
+				if ( isValid )
+				{
+					m_areSlotsAccountedFor[slotIndex] = 1;
+				}
+			}
+			for ( uint32_t i = 0; isValid && ( i < header.unusedSlotIndexCount ); ++i )
+			{
+				const auto slotIndex = GetSnapshotWord( i_snapshot, wordCount, wordIndex_unusedSlotIndices + i );
+				isValid = ( slotIndex < header.slotCount ) && ( m_areSlotsAccountedFor[slotIndex] == 0 );
+				if ( isValid )
+				{
+					m_areSlotsAccountedFor[slotIndex] = 1;
+				}
+			}
+		}
+		if ( !isValid )
+		{
+			EAE6320_ASSERTF( false, "This isn't a snapshot of a physics world" );
+			Logging::OutputError( "A physics snapshot couldn't be restored because its contents are invalid" );
+			return Results::Failure;
+		}
+	}
+
+	auto* currentByte = static_cast<const uint8_t*>( i_snapshot ) + sizeof( header );
+	const auto read = [&currentByte]( void* const o_data, const size_t i_size )
+	{
+		if ( i_size > 0 )
+		{
+			memcpy( o_data, currentByte, i_size );
+			currentByte += i_size;
+		}
+	};
+	m_slots.resize( header.slotCount );
+	for ( auto& slot : m_slots )
+	{
+		uint32_t words[s_snapshotWordCountPerSlot];
+		read( words, sizeof( words ) );
+		slot.bodyIndex = words[0];
+		slot.id = static_cast<uint16_t>( words[1] );
+	}
+	m_unusedSlotIndices.resize( header.unusedSlotIndexCount );
+	read( m_unusedSlotIndices.data(), m_unusedSlotIndices.size() * sizeof( uint32_t ) );
+	m_slotIndices.resize( header.bodyCount );
+	read( m_slotIndices.data(), m_slotIndices.size() * sizeof( uint32_t ) );
+	for ( auto* const floatArray : GetFloatArrays() )
+	{
+		floatArray->resize( header.bodyCount );
+		read( floatArray->data(), floatArray->size() * sizeof( float ) );
+	}
+	EAE6320_ASSERT( currentByte == ( static_cast<const uint8_t*>( i_snapshot ) + i_snapshotSize ) );
+	m_awakeBodyCount = header.awakeBodyCount;
+	// Contacts referred to bodies as they were before the snapshot was restored
+	m_contacts.clear();
+	m_islandParents.assign( header.bodyCount, s_invalidIslandParent );
+	m_areIslandsMoving.assign( header.bodyCount, 0 );
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Physics::cWorld::EncodeSnapshotDelta( const void* const i_snapshot_base, const size_t i_snapshotSize_base,
+	const void* const i_snapshot, const size_t i_snapshotSize, std::vector<uint8_t>& o_delta )
+{
+	o_delta.clear();
+	if ( ( ( i_snapshotSize_base % s_snapshotWordSize ) != 0 ) || ( ( i_snapshotSize % s_snapshotWordSize ) != 0 ) )
+	{
+		EAE6320_ASSERTF( false, "A snapshot's size must be a multiple of its word size" );
+		Logging::OutputError( "A physics snapshot delta couldn't be encoded because a snapshot's size is invalid" );
+		return Results::Failure;
+	}
+
+	// The delta starts with the number of words in the snapshot,
+	// and then alternates between a run of words that are the same as the base and a run of words that are different.
+	// Each run starts with its length,
+	// and a different word is written as the XOR of it and the base word
+	// (so that values that only changed a little have zeros in their high bits).
+	const auto wordCount_base = i_snapshotSize_base / s_snapshotWordSize;
+	const auto wordCount = i_snapshotSize / s_snapshotWordSize;
+	const auto getDifference = [i_snapshot_base, wordCount_base, i_snapshot, wordCount]( const size_t i_wordIndex )
+	{
+		return GetSnapshotWord( i_snapshot, wordCount, i_wordIndex ) ^ GetSnapshotWord( i_snapshot_base, wordCount_base, i_wordIndex );
+	};
+	WriteVariableLengthInteger( wordCount, o_delta );
+	for ( size_t i = 0; i < wordCount; )
+	{
+		const auto wordIndex_same = i;
+		while ( ( i < wordCount ) && ( getDifference( i ) == 0 ) )
+		{
+			++i;
+		}
+		const auto wordIndex_different = i;
+		while ( ( i < wordCount ) && ( getDifference( i ) != 0 ) )
+		{
+			++i;
+		}
+		WriteVariableLengthInteger( wordIndex_different - wordIndex_same, o_delta );
+		WriteVariableLengthInteger( i - wordIndex_different, o_delta );
+		const auto deltaSize_runStart = o_delta.size();
+		o_delta.resize( deltaSize_runStart + ( ( i - wordIndex_different ) * s_snapshotWordSize ) );
+		auto* currentByte = o_delta.data() + deltaSize_runStart;
+		for ( auto j = wordIndex_different; j < i; ++j )
+		{
+			const auto difference = getDifference( j );
+			memcpy( currentByte, &difference, sizeof( difference ) );
+			currentByte += sizeof( difference );
+		}
+	}
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Physics::cWorld::DecodeSnapshotDelta( const void* const i_snapshot_base, const size_t i_snapshotSize_base,
+	const void* const i_delta, const size_t i_deltaSize, std::vector<uint8_t>& o_snapshot )
+{
+	auto result = Results::Success;
+
+	const auto wordCount_base = i_snapshotSize_base / s_snapshotWordSize;
+	const auto* currentByte = static_cast<const uint8_t*>( i_delta );
+	const auto* const endByte = currentByte + i_deltaSize;
+	size_t wordCount;
+	if ( !ReadVariableLengthInteger( currentByte, endByte, wordCount ) )
+	{
+		result = Results::Failure;
+		goto OnExit;
+	}
+	// The size is checked before anything is allocated
+	// (a delta can come from somewhere that can't be trusted, e.g. a network).
+	// No snapshot can be bigger than one of a world that has every possible slot and a body in every slot.
+	{
+		constexpr size_t maximumWordCount = ( sizeof( sSnapshotHeader ) / s_snapshotWordSize )
+			+ ( static_cast<size_t>( cBodyHandle::InvalidIndex ) * ( s_snapshotWordCountPerSlot + 1 + FloatArrayCount ) );
+		static_assert( maximumWordCount <= ( SIZE_MAX / s_snapshotWordSize ), "The size of the largest snapshot must fit in a size_t" );
+		if ( wordCount > maximumWordCount )
+		{
+			result = Results::Failure;
+			goto OnExit;
+		}
+	}
+	// Every word is written below
+	// (either copied from the base or decoded from the delta),
+	// and so the vector isn't cleared first and only new elements past its old size are initialized
+	o_snapshot.resize( wordCount * s_snapshotWordSize );
+	for ( size_t i = 0; i < wordCount; )
+	{
+		size_t wordCount_same, wordCount_different;
+		if ( !ReadVariableLengthInteger( currentByte, endByte, wordCount_same )
+			|| !ReadVariableLengthInteger( currentByte, endByte, wordCount_different )
+			|| ( wordCount_same > ( wordCount - i ) ) || ( wordCount_different > ( wordCount - i - wordCount_same ) )
+			|| ( ( wordCount_different * s_snapshotWordSize ) > static_cast<size_t>( endByte - currentByte ) ) )
+		{
+			result = Results::Failure;
+			goto OnExit;
+		}
+		for ( const auto wordIndex_end = i + wordCount_same; i < wordIndex_end; ++i )
+		{
+			const auto word = GetSnapshotWord( i_snapshot_base, wordCount_base, i );
+			memcpy( o_snapshot.data() + ( i * s_snapshotWordSize ), &word, sizeof( word ) );
+		}
+		for ( const auto wordIndex_end = i + wordCount_different; i < wordIndex_end; ++i )
+		{
+			uint32_t word;
+			memcpy( &word, currentByte, sizeof( word ) );
+			currentByte += sizeof( word );
+			word ^= GetSnapshotWord( i_snapshot_base, wordCount_base, i );
+			memcpy( o_snapshot.data() + ( i * s_snapshotWordSize ), &word, sizeof( word ) );
+		}
+	}
+	if ( currentByte != endByte )
+	{
+		result = Results::Failure;
+		goto OnExit;
+	}
+
+OnExit:
+
+	if ( !result )
+	{
+		EAE6320_ASSERTF( false, "This isn't a physics snapshot delta" );
+		Logging::OutputError( "A physics snapshot delta couldn't be decoded because its contents are invalid" );
+		o_snapshot.clear();
+	}
+
+	return result;
+}
+
+// Simulation
+//-----------
+
+void eae6320::Physics::cWorld::Update( const float i_secondCountToIntegrate )
+{
+	// Integrate the awake bodies
+	// (sleeping bodies are after them in the arrays and aren't touched)
+	{
+		const auto bodyCount = m_awakeBodyCount;
+		// Decide how many threads to use
+		size_t threadCount = 1;
+		if ( m_workerCount > 0 )
+		{
+			threadCount = std::min( static_cast<size_t>( m_workerCount ) + 1, bodyCount / MinimumBodyCountPerThread );
+			threadCount = std::max( threadCount, static_cast<size_t>( 1 ) );
+		}
+		if ( threadCount <= 1 )
+		{
+			IntegrateBodies( 0, bodyCount, i_secondCountToIntegrate );
+		}
+		else
+		{
+			// Each range is a multiple of a cache line's worth of floats
+			// so that two threads rarely write to the same cache line
+			// (and so that only the last range can have bodies left over after the SIMD groups of four)
+			constexpr size_t bodyCountPerCacheLine = 64 / sizeof( float );
+			const auto bodyCountPerThread = ( ( ( bodyCount + threadCount - 1 ) / threadCount ) + ( bodyCountPerCacheLine - 1 ) )
+				& ~( bodyCountPerCacheLine - 1 );
+			// Give the worker threads every range except for the first
+			size_t workerCount_used = 0;
+			for ( size_t bodyIndex_begin = bodyCountPerThread; bodyIndex_begin < bodyCount; bodyIndex_begin += bodyCountPerThread )
+			{
+				auto& worker = m_workers[workerCount_used++];
+				worker.bodyIndex_begin = bodyIndex_begin;
+				worker.bodyIndex_end = std::min( bodyIndex_begin + bodyCountPerThread, bodyCount );
+				worker.secondCountToIntegrate = i_secondCountToIntegrate;
+				const auto result = worker.whenWorkIsReady.Signal();
+				EAE6320_ASSERT( result );
+			}
+			// Integrate the first range on this thread
+			IntegrateBodies( 0, std::min( bodyCountPerThread, bodyCount ), i_secondCountToIntegrate );
+			// Wait for the worker threads to finish
+			for ( size_t i = 0; i < workerCount_used; ++i )
+			{
+				const auto result = Concurrency::WaitForEvent( m_workers[i].whenWorkIsDone );
+				EAE6320_ASSERTF( result, "Couldn't wait for a physics worker thread to finish integrating" );
+			}
+		}
+	}
+	// Put bodies to sleep and wake them up
+	if ( m_sleepSettings.isEnabled )
+	{
+		UpdateSleeping( i_secondCountToIntegrate );
+	}
+	// Contacts are only for a single update
+	m_contacts.clear();
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Physics::cWorld::Initialize( const unsigned int i_workerThreadCount )
+{
+	auto result = Results::Success;
+
+	EAE6320_ASSERTF( m_workerCount == 0, "A world can't be initialized twice" );
+	if ( i_workerThreadCount > 0 )
+	{
+		m_workers.reset( new ( std::nothrow ) sWorker[i_workerThreadCount] );
+		if ( !m_workers )
+		{
+			result = Results::OutOfMemory;
+			EAE6320_ASSERTF( false, "Couldn't allocate %u physics worker threads", i_workerThreadCount );
+			Logging::OutputError( "Failed to allocate %u physics worker threads", i_workerThreadCount );
+			goto OnExit;
+		}
+		for ( unsigned int i = 0; i < i_workerThreadCount; ++i )
+		{
+			auto& worker = m_workers[i];
+			worker.world = this;
+			if ( !( result = worker.whenWorkIsReady.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) ) )
+			{
+				EAE6320_ASSERTF( false, "Couldn't initialize a physics worker thread's event" );
+				goto OnExit;
+			}
+			if ( !( result = worker.whenWorkIsDone.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) ) )
+			{
+				EAE6320_ASSERTF( false, "Couldn't initialize a physics worker thread's event" );
+				goto OnExit;
+			}
+			if ( !( result = worker.thread.Start( WorkerThreadFunction, &worker ) ) )
+			{
+				EAE6320_ASSERTF( false, "Couldn't start a physics worker thread" );
+				goto OnExit;
+			}
+			// The worker is only counted once its thread has started
+			// so that CleanUp() only stops threads that exist
+			m_workerCount = i + 1;
+		}
+	}
+
+OnExit:
+
+	if ( !result )
+	{
+		const auto result_cleanUp = CleanUp();
+		EAE6320_ASSERT( result_cleanUp );
+	}
+
+	return result;
+}
+
+eae6320::cResult eae6320::Physics::cWorld::CleanUp()
+{
+	auto result = Results::Success;
+
+	// Tell every worker thread to exit and wait for it
+	for ( unsigned int i = 0; i < m_workerCount; ++i )
+	{
+		auto& worker = m_workers[i];
+		worker.shouldExit = true;
+		const auto result_signal = worker.whenWorkIsReady.Signal();
+		if ( result_signal )
+		{
+			const auto result_wait = Concurrency::WaitForThreadToStop( worker.thread );
+			if ( !result_wait )
+			{
+				EAE6320_ASSERTF( false, "Couldn't wait for a physics worker thread to stop" );
+				if ( result )
+				{
+					result = result_wait;
+				}
+			}
+		}
+		else
+		{
+			EAE6320_ASSERTF( false, "Couldn't tell a physics worker thread to stop" );
+			if ( result )
+			{
+				result = result_signal;
+			}
+		}
+	}
+	m_workerCount = 0;
+	m_workers.reset();
+
+	return result;
+}
+
+eae6320::Physics::cWorld::~cWorld()
+{
+	const auto result = CleanUp();
+	EAE6320_ASSERT( result );
+}
+
+// Implementation
+//===============
+
+size_t eae6320::Physics::cWorld::GetBodyIndex( const cBodyHandle i_handle ) const
+{
+	EAE6320_ASSERTF( IsValid( i_handle ), "This handle doesn't refer to a body in this world" );
+	return m_slots[i_handle.GetIndex()].bodyIndex;
+}
+
+std::array<const std::vector<float>*, eae6320::Physics::cWorld::FloatArrayCount> eae6320::Physics::cWorld::GetFloatArrays() const
+{
+	const auto floatArrays = const_cast<cWorld*>( this )->GetFloatArrays();
+	std::array<const std::vector<float>*, FloatArrayCount> floatArrays_const;
+	std::copy( floatArrays.begin(), floatArrays.end(), floatArrays_const.begin() );
+	return floatArrays_const;
+}
+
+std::array<std::vector<float>*, eae6320::Physics::cWorld::FloatArrayCount> eae6320::Physics::cWorld::GetFloatArrays()
+{
+	return { {
+		&m_positions.x, &m_positions.y, &m_positions.z,
+		&m_velocities.x, &m_velocities.y, &m_velocities.z,
+		&m_accelerations.x, &m_accelerations.y, &m_accelerations.z,
+		&m_orientations.w, &m_orientations.x, &m_orientations.y, &m_orientations.z,
+		&m_angularVelocityAxes_local.x, &m_angularVelocityAxes_local.y, &m_angularVelocityAxes_local.z,
+		&m_angularSpeeds,
+		&m_stillSecondCounts
+	} };
+}
+
+void eae6320::Physics::cWorld::SwapBodies( const size_t i_bodyIndex_a, const size_t i_bodyIndex_b )
+{
+	if ( i_bodyIndex_a != i_bodyIndex_b )
+	{
+		for ( auto* const floatArray : GetFloatArrays() )
+		{
+			std::swap( ( *floatArray )[i_bodyIndex_a], ( *floatArray )[i_bodyIndex_b] );
+		}
+		std::swap( m_slotIndices[i_bodyIndex_a], m_slotIndices[i_bodyIndex_b] );
+		m_slots[m_slotIndices[i_bodyIndex_a]].bodyIndex = static_cast<uint32_t>( i_bodyIndex_a );
+		m_slots[m_slotIndices[i_bodyIndex_b]].bodyIndex = static_cast<uint32_t>( i_bodyIndex_b );
+	}
+}
+
+void eae6320::Physics::cWorld::IntegrateBodies( const size_t i_bodyIndex_begin, const size_t i_bodyIndex_end, const float i_secondCountToIntegrate )
+{
+	const auto i = i_bodyIndex_begin;
+	const auto bodyCount = i_bodyIndex_end - i_bodyIndex_begin;
+	// Update positions and velocities
+	{
+		Integrate( m_positions.x.data() + i, m_velocities.x.data() + i, m_accelerations.x.data() + i, bodyCount, i_secondCountToIntegrate );
+		Integrate( m_positions.y.data() + i, m_velocities.y.data() + i, m_accelerations.y.data() + i, bodyCount, i_secondCountToIntegrate );
+		Integrate( m_positions.z.data() + i, m_velocities.z.data() + i, m_accelerations.z.data() + i, bodyCount, i_secondCountToIntegrate );
+	}
+	// Update orientations
+	{
+		Math::BatchTransforms::Rotate( GetSpans( m_orientations, i ), m_angularSpeeds.data() + i, GetSpans( m_angularVelocityAxes_local, i ),
+			bodyCount, i_secondCountToIntegrate );
+	}
+}
+
+void eae6320::Physics::cWorld::WorkerThreadFunction( void* const io_worker )
+{
+	auto& worker = *static_cast<sWorker*>( io_worker );
+	while ( true )
+	{
+		const auto result_wait = Concurrency::WaitForEvent( worker.whenWorkIsReady );
+		if ( !result_wait )
+		{
+			EAE6320_ASSERTF( false, "A physics worker thread couldn't wait for work" );
+			Logging::OutputError( "A physics worker thread failed to wait for work and will exit" );
+			break;
+		}
+		if ( worker.shouldExit )
+		{
+			break;
+		}
+		worker.world->IntegrateBodies( worker.bodyIndex_begin, worker.bodyIndex_end, worker.secondCountToIntegrate );
+		const auto result_signal = worker.whenWorkIsDone.Signal();
+		EAE6320_ASSERT( result_signal );
+	}
+}
+
+bool eae6320::Physics::cWorld::IsStill( const size_t i_bodyIndex ) const
+{
+	const auto i = i_bodyIndex;
+	const auto calculateLengthSquared = [i]( const sVectors& i_vectors )
+	{
+		return ( i_vectors.x[i] * i_vectors.x[i] ) + ( i_vectors.y[i] * i_vectors.y[i] ) + ( i_vectors.z[i] * i_vectors.z[i] );
+	};
+	const auto& settings = m_sleepSettings;
+	return ( calculateLengthSquared( m_velocities ) <= ( settings.linearSpeedThreshold * settings.linearSpeedThreshold ) )
+		&& ( calculateLengthSquared( m_accelerations ) <= ( settings.accelerationThreshold * settings.accelerationThreshold ) )
+		&& ( std::abs( m_angularSpeeds[i] ) <= settings.angularSpeedThreshold );
+}
+
+void eae6320::Physics::cWorld::UpdateSleeping( const float i_secondCountToIntegrate )
+{
+	const auto secondCountUntilSleep = m_sleepSettings.secondCountUntilSleep;
+	// Update how long each awake body has been still
+	for ( size_t i = 0; i < m_awakeBodyCount; ++i )
+	{
+		m_stillSecondCounts[i] = IsStill( i ) ? ( m_stillSecondCounts[i] + i_secondCountToIntegrate ) : 0.0f;
+	}
+	// Merge the bodies in each contact into the same island
+	m_bodyIndicesInContacts.clear();
+	for ( const auto& contact : m_contacts )
+	{
+		// A body could have been removed after its contact was added
+		if ( !IsValid( contact.first ) || !IsValid( contact.second ) )
+		{
+			continue;
+		}
+		uint32_t bodyIndices[2] = { static_cast<uint32_t>( GetBodyIndex( contact.first ) ), static_cast<uint32_t>( GetBodyIndex( contact.second ) ) };
+		for ( const auto bodyIndex : bodyIndices )
+		{
+			if ( m_islandParents[bodyIndex] == s_invalidIslandParent )
+			{
+				m_islandParents[bodyIndex] = bodyIndex;
+				m_areIslandsMoving[bodyIndex] = 0;
+				m_bodyIndicesInContacts.push_back( bodyIndex );
+			}
+		}
+		const auto island_a = FindIsland( bodyIndices[0] );
+		const auto island_b = FindIsland( bodyIndices[1] );
+		if ( island_a != island_b )
+		{
+			m_islandParents[island_b] = island_a;
+		}
+	}
+	// An island is moving if any of its awake bodies hasn't been still long enough
+	for ( const auto bodyIndex : m_bodyIndicesInContacts )
+	{
+		if ( ( bodyIndex < m_awakeBodyCount ) && ( m_stillSecondCounts[bodyIndex] < secondCountUntilSleep ) )
+		{
+			m_areIslandsMoving[FindIsland( bodyIndex )] = 1;
+		}
+	}
+	// Find every body that has to change
+	// (its slot is remembered rather than its index because putting bodies to sleep and waking them moves them)
+	m_slotIndicesToChange.clear();
+	{
+		// A body in a contact is awake if its island is moving
+		for ( const auto bodyIndex : m_bodyIndicesInContacts )
+		{
+			const auto shouldBeAwake = m_areIslandsMoving[FindIsland( bodyIndex )] != 0;
+			const auto isAwake = bodyIndex < m_awakeBodyCount;
+			if ( shouldBeAwake != isAwake )
+			{
+				m_slotIndicesToChange.push_back( m_slotIndices[bodyIndex] );
+			}
+		}
+		// A body that isn't in a contact is its own island
+		for ( size_t i = 0; i < m_awakeBodyCount; ++i )
+		{
+			if ( ( m_islandParents[i] == s_invalidIslandParent ) && ( m_stillSecondCounts[i] >= secondCountUntilSleep ) )
+			{
+				m_slotIndicesToChange.push_back( m_slotIndices[i] );
+			}
+		}
+		for ( const auto bodyIndex : m_bodyIndicesInContacts )
+		{
+			m_islandParents[bodyIndex] = s_invalidIslandParent;
+		}
+	}
+	for ( const auto slotIndex : m_slotIndicesToChange )
+	{
+		const size_t bodyIndex = m_slots[slotIndex].bodyIndex;
+		if ( bodyIndex < m_awakeBodyCount )
+		{
+			PutToSleep( bodyIndex );
+		}
+		else
+		{
+			WakeUp( bodyIndex );
+		}
+	}
+}
+
+uint32_t eae6320::Physics::cWorld::FindIsland( uint32_t i_bodyIndex )
+{
+	// Every body on the way to the root is pointed at its grandparent
+	// so that later searches are shorter
+	while ( m_islandParents[i_bodyIndex] != i_bodyIndex )
+	{
+		const auto parent = m_islandParents[i_bodyIndex];
+		m_islandParents[i_bodyIndex] = m_islandParents[parent];
+		i_bodyIndex = parent;
+	}
+	return i_bodyIndex;
+}
+
+void eae6320::Physics::cWorld::PutToSleep( const size_t i_bodyIndex )
+{
+	EAE6320_ASSERT( i_bodyIndex < m_awakeBodyCount );
+	// A sleeping body doesn't keep whatever tiny motion it had
+	// (so that it is exactly still when it is woken up)
+	m_velocities.x[i_bodyIndex] = m_velocities.y[i_bodyIndex] = m_velocities.z[i_bodyIndex] = 0.0f;
+	m_angularSpeeds[i_bodyIndex] = 0.0f;
+	--m_awakeBodyCount;
+	SwapBodies( i_bodyIndex, m_awakeBodyCount );
+}
+
+void eae6320::Physics::cWorld::WakeUp( const size_t i_bodyIndex )
+{
+	EAE6320_ASSERT( i_bodyIndex >= m_awakeBodyCount );
+	m_stillSecondCounts[i_bodyIndex] = 0.0f;
+	SwapBodies( i_bodyIndex, m_awakeBodyCount );
+	++m_awakeBodyCount;
+}
+
+eae6320::Math::BatchTransforms::sVectorSpans eae6320::Physics::cWorld::GetSpans( sVectors& io_vectors, const size_t i_bodyIndex )
+{
+	Math::BatchTransforms::sVectorSpans spans;
+	spans.x = io_vectors.x.data() + i_bodyIndex;
+	spans.y = io_vectors.y.data() + i_bodyIndex;
+	spans.z = io_vectors.z.data() + i_bodyIndex;
+	return spans;
+}
+
+eae6320::Math::BatchTransforms::sQuaternionSpans eae6320::Physics::cWorld::GetSpans( sQuaternions& io_quaternions, const size_t i_bodyIndex )
+{
+	Math::BatchTransforms::sQuaternionSpans spans;
+	spans.w = io_quaternions.w.data() + i_bodyIndex;
+	spans.x = io_quaternions.x.data() + i_bodyIndex;
+	spans.y = io_quaternions.y.data() + i_bodyIndex;
+	spans.z = io_quaternions.z.data() + i_bodyIndex;
+	return spans;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Integrate( float* const io_values, float* const io_rates, const float* const i_ratesOfChange, const size_t i_count,
+		const float i_secondCount )
+	{
+		size_t i = 0;
+#if defined( EAE6320_MATH_ISSSE2ENABLED )
+		{
+			const auto secondCount = _mm_set1_ps( i_secondCount );
+			for ( ; ( i + 4 ) <= i_count; i += 4 )
+			{
+				const auto rate = _mm_loadu_ps( io_rates + i );
+				_mm_storeu_ps( io_values + i, _mm_add_ps( _mm_loadu_ps( io_values + i ), _mm_mul_ps( rate, secondCount ) ) );
+				_mm_storeu_ps( io_rates + i, _mm_add_ps( rate, _mm_mul_ps( _mm_loadu_ps( i_ratesOfChange + i ), secondCount ) ) );
+			}
+		}
+#endif
+		for ( ; i < i_count; ++i )
+		{
+			io_values[i] += io_rates[i] * i_secondCount;
+			io_rates[i] += i_ratesOfChange[i] * i_secondCount;
+		}
+	}
+
+	uint32_t GetSnapshotWord( const void* const i_snapshot, const size_t i_wordCount, const size_t i_wordIndex )
+	{
+		uint32_t word = 0;
+		if ( i_wordIndex < i_wordCount )
+		{
+			memcpy( &word, static_cast<const uint8_t*>( i_snapshot ) + ( i_wordIndex * s_snapshotWordSize ), sizeof( word ) );
+		}
+		return word;
+	}
+
+	void WriteVariableLengthInteger( const size_t i_value, std::vector<uint8_t>& io_bytes )
+	{
+		auto value = i_value;
+		while ( value >= 0x80 )
+		{
+			io_bytes.push_back( static_cast<uint8_t>( value | 0x80 ) );
+			value >>= 7;
+		}
+		io_bytes.push_back( static_cast<uint8_t>( value ) );
+	}
+
+	bool ReadVariableLengthInteger( const uint8_t*& io_byte, const uint8_t* const i_end, size_t& o_value )
+	{
+		o_value = 0;
+		for ( unsigned int shift = 0; ( io_byte < i_end ) && ( shift < ( sizeof( o_value ) * 8 ) ); shift += 7 )
+		{
+			const auto byte = *io_byte++;
+			o_value |= static_cast<size_t>( byte & 0x7f ) << shift;
+			if ( ( byte & 0x80 ) == 0 )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
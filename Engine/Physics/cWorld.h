@@ -0,0 +1,302 @@
+/*
+	A world owns many rigid bodies and integrates all of them at once
+
+	The bodies' states are stored as a structure of arrays
+	(all of the positions' x values are contiguous, then all of the y values, etc.)
+	so that a single pass can update four bodies at a time with SIMD instructions.
+	Because a body is moved within the arrays when another body is removed
+	a body is identified by a handle rather than by its index.
+
+	A world can be given worker threads,
+	and then each update is split into contiguous ranges of bodies that are integrated concurrently.
+	Every body is integrated the same way regardless of which thread integrates it,
+	and so the results are identical for any number of threads.
+
+	A body whose motion stays below the sleep thresholds long enough is put to sleep,
+	and sleeping bodies aren't integrated until they are woken up.
+	Bodies that are in contact form an island that sleeps and wakes together
+	(so that a body resting on another one isn't left hanging when the one below it starts moving).
+	The awake bodies are kept at the start of the arrays and the sleeping ones at the end,
+	and so an update only has to visit the awake bodies.
+
+	The state of every body (and of every handle) can be copied into a snapshot and restored later,
+	which makes it possible to roll the simulation back (e.g. for netcode that predicts and then corrects).
+	A snapshot is the world's arrays copied one after the other,
+	and so consecutive snapshots are mostly identical and can be stored as a small delta from an earlier one.
+
+	The result of integrating a body is the same as sRigidBodyState::Update()
+	except that the rotation is calculated with the fast sine and cosine approximations
+	(whose error is about the same as a float's precision,
+	and so after many updates an orientation differs from sRigidBodyState's by a few millionths).
+*/
+
+#ifndef EAE6320_PHYSICS_CWORLD_H
+#define EAE6320_PHYSICS_CWORLD_H
+
+// Include Files
+//==============
+
+#include "sRigidBodyState.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/cThread.h>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Results/Results.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Physics
+	{
+		class cWorld
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// A handle stays valid until its body is removed,
+			// and a handle to a removed body is detected even if a new body reuses its slot
+			// (in the same way as Assets::cHandle)
+			class cBodyHandle
+			{
+			public:
+
+				bool IsValid() const { return GetIndex() != InvalidIndex; }
+				operator bool() const { return IsValid(); }
+
+				cBodyHandle() = default;
+
+			private:
+
+				// The lowest 20 bits are the index of the body's slot
+				// and the remaining high bits are the error checking ID
+				static constexpr uint_fast32_t IndexMask = 0xfffff;
+				static constexpr uint_fast32_t IdShift = 20;
+				static constexpr uint_fast32_t IdMax = ( 1 << ( 32 - IdShift ) ) - 1;
+				// The largest possible bit value is used as an invalid index
+				static constexpr uint_fast32_t InvalidIndex = IndexMask;
+				uint32_t value = InvalidIndex;
+
+				uint_fast32_t GetIndex() const { return static_cast<uint_fast32_t>( value & IndexMask ); }
+				uint_fast16_t GetId() const { return static_cast<uint_fast16_t>( value >> IdShift ); }
+				void MakeInvalid() { value = InvalidIndex; }
+				static uint_fast16_t IncrementId( const uint_fast16_t i_id ) { return static_cast<uint_fast16_t>( ( i_id + 1 ) & IdMax ); }
+
+				cBodyHandle( const uint_fast32_t i_index, const uint_fast16_t i_id )
+					:
+					value( static_cast<uint32_t>( i_index | ( i_id << IdShift ) ) )
+				{
+
+				}
+
+				friend class cWorld;
+			};
+
+			// Bodies
+			//-------
+
+			// Every handle returned from a successful call to AddBody()
+			// must eventually be passed to RemoveBody() (or the world must be destroyed)
+			cResult AddBody( const sRigidBodyState& i_state, cBodyHandle& o_handle );
+			cResult RemoveBody( cBodyHandle& io_handle );
+
+			bool IsValid( const cBodyHandle i_handle ) const;
+			size_t GetBodyCount() const { return m_positions.x.size(); }
+			size_t GetAwakeBodyCount() const { return m_awakeBodyCount; }
+			size_t GetSleepingBodyCount() const { return GetBodyCount() - m_awakeBodyCount; }
+
+			// Access
+			//-------
+
+			// The handle must be valid.
+			// Setting a body's velocity, acceleration, or angular velocity above the sleep thresholds wakes it up.
+			sRigidBodyState GetBodyState( const cBodyHandle i_handle ) const;
+			void SetBodyState( const cBodyHandle i_handle, const sRigidBodyState& i_state );
+
+			Math::sVector GetPosition( const cBodyHandle i_handle ) const;
+			void SetPosition( const cBodyHandle i_handle, const Math::sVector& i_position );
+			Math::sVector GetVelocity( const cBodyHandle i_handle ) const;
+			void SetVelocity( const cBodyHandle i_handle, const Math::sVector& i_velocity );
+			Math::sVector GetAcceleration( const cBodyHandle i_handle ) const;
+			void SetAcceleration( const cBodyHandle i_handle, const Math::sVector& i_acceleration );
+			Math::cQuaternion GetOrientation( const cBodyHandle i_handle ) const;
+			void SetOrientation( const cBodyHandle i_handle, const Math::cQuaternion& i_orientation );
+			// The axis is in local space and must be normalized
+			void SetAngularVelocity( const cBodyHandle i_handle, const Math::sVector& i_axis_local, const float i_angularSpeed );
+
+			// Sleeping
+			//---------
+
+			struct sSleepSettings
+			{
+				// A body is still when all of these are at or below their threshold
+				float linearSpeedThreshold = 0.01f;	// Distance per-second
+				float accelerationThreshold = 0.01f;	// Distance per-second^2
+				float angularSpeedThreshold = 0.01f;	// Radians per-second
+				// A body goes to sleep once it has been still for this long
+				float secondCountUntilSleep = 0.5f;
+				bool isEnabled = true;
+			};
+			const sSleepSettings& GetSleepSettings() const { return m_sleepSettings; }
+			// Disabling sleeping wakes every body
+			void SetSleepSettings( const sSleepSettings& i_sleepSettings );
+
+			bool IsAwake( const cBodyHandle i_handle ) const;
+			void WakeUp( const cBodyHandle i_handle );
+
+			// A contact puts two bodies in the same island during the next update
+			// (contacts only last for a single update, and so they should be added again before every update
+			// from whatever finds them, e.g. a broadphase).
+			// If any body in an island is moving every body in it is woken up,
+			// and an island only goes to sleep when every body in it has been still long enough.
+			void AddContact( const cBodyHandle i_handle_a, const cBodyHandle i_handle_b );
+
+			// Snapshots
+			//----------
+
+			// A snapshot contains every body's state and which handles are valid,
+			// and so every handle refers to the same body after a snapshot is restored that it did when the snapshot was taken
+			// (the sleep settings, the worker threads, and any contacts aren't part of a snapshot).
+			// The size of a snapshot only depends on how many bodies have ever been in the world at the same time and how many are in it now.
+			size_t GetSnapshotSize() const;
+			// The buffer must be at least GetSnapshotSize() bytes
+			cResult TakeSnapshot( void* const o_snapshot, const size_t i_snapshotBufferSize ) const;
+			cResult RestoreSnapshot( const void* const i_snapshot, const size_t i_snapshotSize );
+
+			// A delta encodes a snapshot as the differences from a base snapshot
+			// (any earlier snapshot of the same world can be the base, but the closer it is the smaller the delta).
+			// The vector is cleared first, and it should be reused to avoid allocations.
+			static cResult EncodeSnapshotDelta( const void* const i_snapshot_base, const size_t i_snapshotSize_base,
+				const void* const i_snapshot, const size_t i_snapshotSize, std::vector<uint8_t>& o_delta );
+			// The base must be the same one that the delta was encoded from.
+			// The vector's existing memory is used for the snapshot, and so it should also be reused to avoid allocations.
+			static cResult DecodeSnapshotDelta( const void* const i_snapshot_base, const size_t i_snapshotSize_base,
+				const void* const i_delta, const size_t i_deltaSize, std::vector<uint8_t>& o_snapshot );
+
+			// Simulation
+			//-----------
+
+			// This must not be called at the same time as any other function
+			// (the worker threads are only used during the update)
+			void Update( const float i_secondCountToIntegrate );
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			// The thread that calls Update() integrates bodies too,
+			// and so the total number of threads integrating is one more than the number of worker threads
+			cResult Initialize( const unsigned int i_workerThreadCount = 0 );
+			cResult CleanUp();
+
+			cWorld() = default;
+			~cWorld();
+
+			// A range is only given to another thread if it has at least this many bodies
+			// (for fewer bodies the synchronization would take longer than the integration)
+			static constexpr size_t MinimumBodyCountPerThread = 4096;
+
+			// Data
+			//=====
+
+		private:
+
+			// Each worker thread waits until it is given a range of bodies to integrate
+			struct sWorker
+			{
+				cWorld* world = nullptr;
+				size_t bodyIndex_begin = 0;
+				size_t bodyIndex_end = 0;
+				float secondCountToIntegrate = 0.0f;
+				bool shouldExit = false;
+				Concurrency::cEvent whenWorkIsReady;
+				Concurrency::cEvent whenWorkIsDone;
+				Concurrency::cThread thread;
+			};
+			std::unique_ptr<sWorker[]> m_workers;
+			unsigned int m_workerCount = 0;
+
+			// A slot is what a handle refers to,
+			// and it stores the current index of the body in the arrays
+			struct sSlot
+			{
+				uint32_t bodyIndex = 0;
+				uint16_t id = 0;
+			};
+			std::vector<sSlot> m_slots;
+			std::vector<uint32_t> m_unusedSlotIndices;
+
+			// The state of body i is element i of every array
+			struct sVectors
+			{
+				std::vector<float> x, y, z;
+			};
+			struct sQuaternions
+			{
+				std::vector<float> w, x, y, z;
+			};
+			sVectors m_positions;
+			sVectors m_velocities;
+			sVectors m_accelerations;
+			sQuaternions m_orientations;
+			sVectors m_angularVelocityAxes_local;
+			std::vector<float> m_angularSpeeds;
+			std::vector<float> m_stillSecondCounts;	// How long each body has been still
+			std::vector<uint32_t> m_slotIndices;
+			static constexpr size_t FloatArrayCount = 18;
+
+			// Bodies [0, m_awakeBodyCount) are awake and the rest are sleeping
+			size_t m_awakeBodyCount = 0;
+			sSleepSettings m_sleepSettings;
+
+			// The contacts that were added since the last update
+			std::vector<std::pair<cBodyHandle, cBodyHandle>> m_contacts;
+			// These are only used during an update to find islands,
+			// and an element is only initialized while its body is in a contact
+			// (so that bodies that aren't in contacts don't cost anything)
+			std::vector<uint32_t> m_islandParents;
+			std::vector<uint8_t> m_areIslandsMoving;
+			std::vector<uint32_t> m_bodyIndicesInContacts;
+			std::vector<uint32_t> m_slotIndicesToChange;
+			// This is only used while a snapshot is being restored to check that no slot is used twice
+			// (it is a member so that rolling back several times every frame doesn't allocate)
+			std::vector<uint8_t> m_areSlotsAccountedFor;
+
+			// Implementation
+			//===============
+
+		private:
+
+			// This returns the index of the body in the arrays
+			size_t GetBodyIndex( const cBodyHandle i_handle ) const;
+
+			std::array<std::vector<float>*, FloatArrayCount> GetFloatArrays();
+			std::array<const std::vector<float>*, FloatArrayCount> GetFloatArrays() const;
+			void SwapBodies( const size_t i_bodyIndex_a, const size_t i_bodyIndex_b );
+
+			void IntegrateBodies( const size_t i_bodyIndex_begin, const size_t i_bodyIndex_end, const float i_secondCountToIntegrate );
+			static void WorkerThreadFunction( void* const io_worker );
+
+			bool IsStill( const size_t i_bodyIndex ) const;
+			void UpdateSleeping( const float i_secondCountToIntegrate );
+			uint32_t FindIsland( uint32_t i_bodyIndex );
+			void PutToSleep( const size_t i_bodyIndex );
+			void WakeUp( const size_t i_bodyIndex );
+
+			static Math::BatchTransforms::sVectorSpans GetSpans( sVectors& io_vectors, const size_t i_bodyIndex = 0 );
+			static Math::BatchTransforms::sQuaternionSpans GetSpans( sQuaternions& io_quaternions, const size_t i_bodyIndex = 0 );
+		};
+	}
+}
+
+#endif	// EAE6320_PHYSICS_CWORLD_H
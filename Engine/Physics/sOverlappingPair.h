@@ -0,0 +1,43 @@
+/*
+	An overlapping pair is two objects whose bounds overlap,
+	and a broadphase finds these pairs so that only they need to be tested more precisely
+*/
+
+#ifndef EAE6320_PHYSICS_SOVERLAPPINGPAIR_H
+#define EAE6320_PHYSICS_SOVERLAPPINGPAIR_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+	namespace Physics
+	{
+		// The IDs are whatever the broadphase was given to identify objects,
+		// and the smaller ID is always first
+		// (so that the same two objects always make the same pair)
+		struct sOverlappingPair
+		{
+			uint32_t id_a = 0;
+			uint32_t id_b = 0;
+
+			sOverlappingPair() = default;
+			sOverlappingPair( const uint32_t i_id_0, const uint32_t i_id_1 )
+				:
+				id_a( ( i_id_0 < i_id_1 ) ? i_id_0 : i_id_1 ), id_b( ( i_id_0 < i_id_1 ) ? i_id_1 : i_id_0 )
+			{
+
+			}
+
+			bool operator ==( const sOverlappingPair& i_rhs ) const { return ( id_a == i_rhs.id_a ) && ( id_b == i_rhs.id_b ); }
+			bool operator <( const sOverlappingPair& i_rhs ) const { return ( id_a < i_rhs.id_a ) || ( ( id_a == i_rhs.id_a ) && ( id_b < i_rhs.id_b ) ); }
+		};
+	}
+}
+
+#endif	// EAE6320_PHYSICS_SOVERLAPPINGPAIR_H
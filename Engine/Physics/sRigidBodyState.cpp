@@ -31,6 +31,8 @@ eae6320::Math::sVector eae6320::Physics::sRigidBodyState::PredictFuturePosition(
 
 eae6320::Math::cQuaternion eae6320::Physics::sRigidBodyState::PredictFutureOrientation( const float i_secondCountToExtrapolate ) const
 {
-	const auto rotation = Math::cQuaternion( angularSpeed * i_secondCountToExtrapolate, angularVelocity_axis_local );
-	return Math::cQuaternion( orientation * rotation ).GetNormalized();
+	// The prediction is only used for rendering and is recalculated from the simulated state every time,
+	// and so the errors of the faster approximations can't accumulate
+	const auto rotation = Math::cQuaternion::CreateFromAngleAxis_fast( angularSpeed * i_secondCountToExtrapolate, angularVelocity_axis_local );
+	return Math::cQuaternion( orientation * rotation ).GetNormalized_fast();
 }
@@ -0,0 +1,459 @@
+// Include Files
+//==============
+
+#include "../Platform.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <Engine/Asserts/Asserts.h>
+#include <fcntl.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Helper Declarations
+//====================
+
+namespace
+{
+	std::string GetLastSystemError( int* const o_optionalErrorCode = nullptr );
+}
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Platform::CopyFile( const char* const i_path_source, const char* const i_path_target,
+	const bool i_shouldFunctionFailIfTargetAlreadyExists, const bool i_shouldTargetFileTimeBeModified,
+	std::string* o_errorMessage )
+{
+	auto result = Results::Success;
+
+	sDataFromFile dataFromFile;
+	if ( i_shouldFunctionFailIfTargetAlreadyExists && DoesFileExist( i_path_target ) )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "The file \"" << i_path_target << "\" can't be copied to because it already exists";
+			*o_errorMessage = errorMessage.str();
+		}
+		result = Results::Failure;
+		goto OnExit;
+	}
+	if ( !( result = LoadBinaryFile( i_path_source, dataFromFile, o_errorMessage ) ) )
+	{
+		goto OnExit;
+	}
+	if ( !( result = WriteBinaryFile( i_path_target, dataFromFile.data, dataFromFile.size, o_errorMessage ) ) )
+	{
+		goto OnExit;
+	}
+	// Writing the file modified its time,
+	// and so if that isn't wanted the source's time is copied
+	if ( !i_shouldTargetFileTimeBeModified )
+	{
+		struct stat fileStatus;
+		if ( stat( i_path_source, &fileStatus ) == 0 )
+		{
+			const timespec times[] = { fileStatus.st_atim, fileStatus.st_mtim };
+			if ( utimensat( AT_FDCWD, i_path_target, times, 0 ) != 0 )
+			{
+				if ( o_errorMessage )
+				{
+					std::ostringstream errorMessage;
+					errorMessage << "Failed to set the time of the copied file \"" << i_path_target << "\": " << GetLastSystemError();
+					*o_errorMessage = errorMessage.str();
+				}
+				result = Results::Failure;
+				goto OnExit;
+			}
+		}
+		else
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to get the time of the file \"" << i_path_source << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			result = Results::Failure;
+			goto OnExit;
+		}
+	}
+
+OnExit:
+
+	dataFromFile.Free();
+
+	return result;
+}
+
+eae6320::cResult eae6320::Platform::CreateDirectoryIfItDoesntExist( const std::string& i_filePath, std::string* const o_errorMessage )
+{
+	// The path is to a file, and so everything after the last slash is ignored
+	const auto lastSlash = i_filePath.find_last_of( '/' );
+	if ( lastSlash == std::string::npos )
+	{
+		return Results::Success;
+	}
+	const auto directory = i_filePath.substr( 0, lastSlash );
+	// Every directory in the path is created in turn (starting at the root)
+	for ( auto slash = directory.find( '/', 1 ); ; slash = directory.find( '/', slash + 1 ) )
+	{
+		const auto directory_partial = directory.substr( 0, slash );
+		if ( ( mkdir( directory_partial.c_str(), 0777 ) != 0 ) && ( errno != EEXIST ) )
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to create the directory \"" << directory_partial << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			return Results::Failure;
+		}
+		if ( slash == std::string::npos )
+		{
+			break;
+		}
+	}
+	return Results::Success;
+}
+
+bool eae6320::Platform::DoesFileExist( const char* const i_path, std::string* const o_errorMessage )
+{
+	struct stat fileStatus;
+	if ( stat( i_path, &fileStatus ) == 0 )
+	{
+		return true;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			int errorCode;
+			const auto systemError = GetLastSystemError( &errorCode );
+			if ( ( errorCode != ENOENT ) && ( errorCode != ENOTDIR ) )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to determine whether the file \"" << i_path << "\" exists: " << systemError;
+				*o_errorMessage = errorMessage.str();
+			}
+		}
+		return false;
+	}
+}
+
+eae6320::cResult eae6320::Platform::ExecuteCommand( const char* const i_command, int* const o_exitCode, std::string* const o_errorMessage )
+{
+	const auto status = system( i_command );
+	if ( ( status != -1 ) && WIFEXITED( status ) )
+	{
+		if ( o_exitCode )
+		{
+			*o_exitCode = WEXITSTATUS( status );
+		}
+		return Results::Success;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "The command \"" << i_command << "\" couldn't be executed or didn't exit normally";
+			if ( status == -1 )
+			{
+				errorMessage << ": " << GetLastSystemError();
+			}
+			*o_errorMessage = errorMessage.str();
+		}
+		return Results::Failure;
+	}
+}
+
+eae6320::cResult eae6320::Platform::GetEnvironmentVariable( const char* const i_key, std::string& o_value, std::string* const o_errorMessage )
+{
+	if ( const auto* const value = getenv( i_key ) )
+	{
+		o_value = value;
+		return Results::Success;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "The environment variable \"" << i_key << "\" doesn't exist";
+			*o_errorMessage = errorMessage.str();
+		}
+		return Results::Platform::EnvironmentVariableDoesntExist;
+	}
+}
+
+eae6320::cResult eae6320::Platform::GetFilesInDirectory( const std::string& i_path, std::vector<std::string>& o_paths,
+	const bool i_shouldSubdirectoriesBeSearchedRecursively, std::string* const o_errorMessage )
+{
+	auto result = Results::Success;
+
+	// The returned paths start with the directory's path
+	auto path = i_path;
+	if ( !path.empty() && ( path.back() != '/' ) )
+	{
+		path += '/';
+	}
+	auto* const directory = opendir( path.empty() ? "." : path.c_str() );
+	if ( !directory )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to open the directory \"" << i_path << "\": " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		return Results::Failure;
+	}
+	while ( const auto* const entry = readdir( directory ) )
+	{
+		// Hidden files (and the current and parent directories) are skipped
+		if ( entry->d_name[0] == '.' )
+		{
+			continue;
+		}
+		const auto path_entry = path + entry->d_name;
+		struct stat fileStatus;
+		if ( stat( path_entry.c_str(), &fileStatus ) != 0 )
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to get the attributes of \"" << path_entry << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			result = Results::Failure;
+			break;
+		}
+		if ( S_ISDIR( fileStatus.st_mode ) )
+		{
+			if ( i_shouldSubdirectoriesBeSearchedRecursively )
+			{
+				if ( !( result = GetFilesInDirectory( path_entry, o_paths, i_shouldSubdirectoriesBeSearchedRecursively, o_errorMessage ) ) )
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			o_paths.push_back( path_entry );
+		}
+	}
+	closedir( directory );
+
+	return result;
+}
+
+eae6320::cResult eae6320::Platform::GetLastWriteTime( const char* const i_path, uint64_t& o_lastWriteTime, std::string* const o_errorMessage )
+{
+	struct stat fileStatus;
+	if ( stat( i_path, &fileStatus ) == 0 )
+	{
+		// The time is in nanoseconds since the Unix epoch
+		// (the values are only meant to be compared with each other)
+		o_lastWriteTime = ( static_cast<uint64_t>( fileStatus.st_mtim.tv_sec ) * 1000000000u ) + static_cast<uint64_t>( fileStatus.st_mtim.tv_nsec );
+		return Results::Success;
+	}
+	else
+	{
+		int errorCode;
+		const auto systemError = GetLastSystemError( &errorCode );
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to get the last write time of the file \"" << i_path << "\": " << systemError;
+			*o_errorMessage = errorMessage.str();
+		}
+		return ( ( errorCode == ENOENT ) || ( errorCode == ENOTDIR ) ) ? Results::FileDoesntExist : Results::Failure;
+	}
+}
+
+eae6320::cResult eae6320::Platform::InvalidateLastWriteTime( const char* const i_path, std::string* const o_errorMessage )
+{
+	// The time is set to an arbitrary date that is older than any file that could be built from it
+	// (this matches the Windows implementation, which uses January 1, 1980)
+	constexpr time_t secondsSinceUnixEpoch_1980 = 315532800;
+	timespec times[2];
+	times[0].tv_sec = times[1].tv_sec = secondsSinceUnixEpoch_1980;
+	times[0].tv_nsec = times[1].tv_nsec = 0;
+	if ( utimensat( AT_FDCWD, i_path, times, 0 ) == 0 )
+	{
+		return Results::Success;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to set the last write time of the file \"" << i_path << "\": " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		return Results::Failure;
+	}
+}
+
+eae6320::cResult eae6320::Platform::LoadBinaryFile( const char* const i_path, sDataFromFile& o_data, std::string* const o_errorMessage )
+{
+	auto result = Results::Success;
+
+	// Initialize the output struct so that if there's an error during this function any existing garbage data isn't misinterpreted
+	{
+		o_data.data = nullptr;
+		o_data.size = 0;
+	}
+
+	// Open the file
+	FILE* const file = fopen( i_path, "rb" );
+	if ( !file )
+	{
+		int errorCode;
+		const auto systemError = GetLastSystemError( &errorCode );
+		result = ( ( errorCode == ENOENT ) || ( errorCode == ENOTDIR ) ) ? Results::FileDoesntExist : Results::Failure;
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to open the file \"" << i_path << "\" for reading: " << systemError;
+			*o_errorMessage = errorMessage.str();
+		}
+		goto OnExit;
+	}
+	// Get the file's size
+	{
+		struct stat fileStatus;
+		if ( fstat( fileno( file ), &fileStatus ) == 0 )
+		{
+			o_data.size = static_cast<size_t>( fileStatus.st_size );
+		}
+		else
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to get the size of the file \"" << i_path << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			result = Results::Failure;
+			goto OnExit;
+		}
+	}
+	// Read the file's contents into allocated memory
+	// (at least one byte is allocated so that an empty file still has data that can be freed)
+	o_data.data = malloc( ( o_data.size > 0 ) ? o_data.size : 1 );
+	if ( o_data.data )
+	{
+		if ( fread( o_data.data, 1, o_data.size, file ) != o_data.size )
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to read the contents of the file \"" << i_path << "\"";
+				*o_errorMessage = errorMessage.str();
+			}
+			result = Results::Failure;
+			goto OnExit;
+		}
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to allocate " << o_data.size << " bytes to read in the file \"" << i_path << "\"";
+			*o_errorMessage = errorMessage.str();
+		}
+		result = Results::OutOfMemory;
+		goto OnExit;
+	}
+
+OnExit:
+
+	if ( !result )
+	{
+		if ( o_data.data )
+		{
+			o_data.Free();
+		}
+	}
+	if ( file )
+	{
+		fclose( file );
+	}
+
+	return result;
+}
+
+eae6320::cResult eae6320::Platform::WriteBinaryFile( const char* const i_path, const void* const i_data, const size_t i_size, std::string* const o_errorMessage )
+{
+	auto result = Results::Success;
+
+	// Open the file
+	FILE* const file = fopen( i_path, "wb" );
+	if ( !file )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to open the file \"" << i_path << "\" for writing: " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		result = Results::Failure;
+		goto OnExit;
+	}
+	// Write the data
+	if ( fwrite( i_data, 1, i_size, file ) != i_size )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to write the file \"" << i_path << "\": " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		result = Results::Failure;
+		goto OnExit;
+	}
+
+OnExit:
+
+	if ( file )
+	{
+		// Closing the file is when buffered data is actually written
+		if ( ( fclose( file ) != 0 ) && result )
+		{
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to close the file \"" << i_path << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			result = Results::Failure;
+		}
+	}
+
+	return result;
+}
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	std::string GetLastSystemError( int* const o_optionalErrorCode )
+	{
+		const auto errorCode = errno;
+		if ( o_optionalErrorCode )
+		{
+			*o_optionalErrorCode = errorCode;
+		}
+		return std::strerror( errorCode );
+	}
+}
@@ -0,0 +1,67 @@
+// Include Files
+//==============
+
+#include "../Time.h"
+
+#include <ctime>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The monotonic clock is always measured in nanoseconds,
+	// and so a tick is a nanosecond
+	constexpr uint64_t s_ticksPerSecond = 1000000000u;
+	constexpr double s_secondsPerTick = 1.0 / static_cast<double>( s_ticksPerSecond );
+}
+
+// Interface
+//==========
+
+// Time
+//-----
+
+uint64_t eae6320::Time::GetCurrentSystemTimeTickCount()
+{
+	timespec timeSinceUnspecifiedStart;
+	if ( clock_gettime( CLOCK_MONOTONIC, &timeSinceUnspecifiedStart ) != 0 )
+	{
+		// The monotonic clock is required by POSIX and can only fail if the arguments are invalid
+		EAE6320_ASSERTF( false, "clock_gettime() failed" );
+	}
+	return ( static_cast<uint64_t>( timeSinceUnspecifiedStart.tv_sec ) * s_ticksPerSecond )
+		+ static_cast<uint64_t>( timeSinceUnspecifiedStart.tv_nsec );
+}
+
+double eae6320::Time::ConvertTicksToSeconds( const uint64_t i_tickCount )
+{
+	return static_cast<double>( i_tickCount ) * s_secondsPerTick;
+}
+
+uint64_t eae6320::Time::ConvertSecondsToTicks( const double i_secondCount )
+{
+	return static_cast<uint64_t>( ( i_secondCount / s_secondsPerTick ) + 0.5 );
+}
+
+double eae6320::Time::ConvertRatePerSecondToRatePerTick( const double i_rate_perSecond )
+{
+	return i_rate_perSecond * s_secondsPerTick;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Time::Initialize()
+{
+	Logging::OutputMessage( "Initialized time" );
+
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::Time::CleanUp()
+{
+	return Results::Success;
+}
@@ -0,0 +1,37 @@
+// Include Files
+//==============
+
+#include "../UserOutput.h"
+
+#include <cstdarg>
+#include <cstdio>
+
+// Interface
+//==========
+
+void eae6320::UserOutput::Print( const char* const i_message, ... )
+{
+	// There is no message box,
+	// and so the message is written to standard error
+	// (which is where a program with no window reports things to whoever is running it)
+	{
+		va_list insertions;
+		va_start( insertions, i_message );
+		vfprintf( stderr, i_message, insertions );
+		va_end( insertions );
+	}
+	fputc( '\n', stderr );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::UserOutput::Initialize( const sInitializationParameters& )
+{
+	return Results::Success;
+}
+
+eae6320::cResult eae6320::UserOutput::CleanUp()
+{
+	return Results::Success;
+}
@@ -12,6 +12,7 @@
 #include <Engine/UserInput/UserInput.h>
 #include <Engine/Math/Constants.h>
 #include <Engine/Graphics/cRenderState.h>
+#include <Engine/Physics/cWorld.h>
 #include <fstream>
 
 //#include <cstdio>
@@ -44,15 +45,30 @@ eae6320::Graphics::meshData data5;
 eae6320::Graphics::meshData data6;
 eae6320::Graphics::meshData data7;
 
-eae6320::Physics::sRigidBodyState rigidBody4; // for meshData4
-eae6320::Physics::sRigidBodyState rigidBody5; // for meshData5
-eae6320::Physics::sRigidBodyState rigidBody6; // for meshData6
-eae6320::Physics::sRigidBodyState rigidBody7; // for meshData7
+// the bodies are all integrated together by the world
+eae6320::Physics::cWorld world;
+eae6320::Physics::cWorld::cBodyHandle rigidBody4; // for meshData4
+eae6320::Physics::cWorld::cBodyHandle rigidBody5; // for meshData5
+eae6320::Physics::cWorld::cBodyHandle rigidBody6; // for meshData6
+eae6320::Physics::cWorld::cBodyHandle rigidBody7; // for meshData7
 
 eae6320::Graphics::cCamera camera;
 
 float timer = 0.0f;
 
+// helpers to change a single component of a body's velocity
+void SetVelocityX(const eae6320::Physics::cWorld::cBodyHandle i_rigidBody, const float i_x) {
+	auto velocity = world.GetVelocity(i_rigidBody);
+	velocity.x = i_x;
+	world.SetVelocity(i_rigidBody, velocity);
+}
+
+void SetVelocityY(const eae6320::Physics::cWorld::cBodyHandle i_rigidBody, const float i_y) {
+	auto velocity = world.GetVelocity(i_rigidBody);
+	velocity.y = i_y;
+	world.SetVelocity(i_rigidBody, velocity);
+}
+
 // test function
 //void eae6320::cExampleGame::testWriteFile() {
 //	File * pfile;
@@ -69,10 +85,14 @@ void eae6320::cExampleGame::SubmitDataToBeRendered(const float i_elapsedSecondCo
 
 	eae6320::Graphics::SubmitCamera(camera);
 
-	eae6320::Graphics::SubmitEffectAndMesh(data5, rigidBody4);
-	eae6320::Graphics::SubmitEffectAndMesh(data4, rigidBody5); // almond
-	eae6320::Graphics::SubmitEffectAndMesh(data6, rigidBody6);
-	eae6320::Graphics::SubmitEffectAndMesh(data7, rigidBody7);
+	auto rigidBodyState4 = world.GetBodyState(rigidBody4);
+	auto rigidBodyState5 = world.GetBodyState(rigidBody5);
+	auto rigidBodyState6 = world.GetBodyState(rigidBody6);
+	auto rigidBodyState7 = world.GetBodyState(rigidBody7);
+	eae6320::Graphics::SubmitEffectAndMesh(data5, rigidBodyState4);
+	eae6320::Graphics::SubmitEffectAndMesh(data4, rigidBodyState5); // almond
+	eae6320::Graphics::SubmitEffectAndMesh(data6, rigidBodyState6);
+	eae6320::Graphics::SubmitEffectAndMesh(data7, rigidBodyState7);
 }
 
 // Run
@@ -102,16 +122,16 @@ void  eae6320::cExampleGame::UpdateBasedOnTime(const float i_elapsedSecondCount_
 	timer += i_elapsedSecondCount_sinceLastUpdate;
 	if (timer > 1.0f) 
 	{
-		rigidBody5.velocity.y = 0.8f;
-		rigidBody6.velocity.y = -1.3f;
-		rigidBody7.velocity.y = -1.6f;
+		SetVelocityY(rigidBody5, 0.8f);
+		SetVelocityY(rigidBody6, -1.3f);
+		SetVelocityY(rigidBody7, -1.6f);
 	}
 
 	if (timer > 10.0f) 
 	{
-		rigidBody5.velocity.y = -0.8f;
-		rigidBody6.velocity.y = 1.3f;
-		rigidBody7.velocity.y = 1.6f;
+		SetVelocityY(rigidBody5, -0.8f);
+		SetVelocityY(rigidBody6, 1.3f);
+		SetVelocityY(rigidBody7, 1.6f);
 
 		timer = -8.0f;
 	}
@@ -133,15 +153,15 @@ void  eae6320::cExampleGame::UpdateSimulationBasedOnInput() {
 	//}
 
 	if (UserInput::IsKeyPressed(UserInput::KeyCodes::Left)) {
-		rigidBody4.velocity.x = -1.5f;
+		SetVelocityX(rigidBody4, -1.5f);
 	}
 	
 	else if (UserInput::IsKeyPressed(UserInput::KeyCodes::Right)) {
-		rigidBody4.velocity.x = 1.5f;
+		SetVelocityX(rigidBody4, 1.5f);
 	}
 
 	else {
-		rigidBody4.velocity.x = 0.0f;
+		SetVelocityX(rigidBody4, 0.0f);
 	}
 	if (UserInput::IsKeyPressed('W')) {
 		camera.m_rigidBodyState.velocity.z = -1.0f;
@@ -166,13 +186,9 @@ void  eae6320::cExampleGame::UpdateSimulationBasedOnInput() {
 }
 
 void  eae6320::cExampleGame::UpdateSimulationBasedOnTime(const float i_elapsedSecondCount_sinceLastUpdate) {
-	rigidBody4.Update(i_elapsedSecondCount_sinceLastUpdate);
+	world.Update(i_elapsedSecondCount_sinceLastUpdate);
 	timer += i_elapsedSecondCount_sinceLastUpdate;
 
-	rigidBody5.Update(i_elapsedSecondCount_sinceLastUpdate);
-	rigidBody6.Update(i_elapsedSecondCount_sinceLastUpdate);
-	rigidBody7.Update(i_elapsedSecondCount_sinceLastUpdate);
-
 	camera.m_rigidBodyState.Update(i_elapsedSecondCount_sinceLastUpdate);
 }
 // Initialization / Clean Up
@@ -277,22 +293,46 @@ eae6320::cResult eae6320::cExampleGame::Initialize()
 	data6 = eae6320::Graphics::meshData(effect1, cMesh::s_manager.Get(mesh1), eae6320::Graphics::cTexture::s_manager.Get(texture3));
 	data7 = eae6320::Graphics::meshData(effect1, cMesh::s_manager.Get(mesh1), eae6320::Graphics::cTexture::s_manager.Get(texture3));
 
-	// the board
-	rigidBody4.position.x = -3.5f;
-	rigidBody4.position.y = 0.5f;
-	rigidBody4.position.z = -0.5f;
-
-	rigidBody5.position.x = 0.5f;
-	rigidBody5.position.y = -2.5f;
-	rigidBody5.position.z = -0.5f;
-
-	rigidBody6.position.x = -1.5f;
-	rigidBody6.position.y = 0.5f;
+	// there are only a few bodies, and so they are all integrated on this thread
+	result = world.Initialize(0);
+	if (!result) {
+		EAE6320_ASSERT(false);
+		return result;
+	}
+	{
+		eae6320::Physics::sRigidBodyState rigidBodyState;
+
+		// the board
+		rigidBodyState.position = eae6320::Math::sVector(-3.5f, 0.5f, -0.5f);
+		result = world.AddBody(rigidBodyState, rigidBody4);
+		if (!result) {
+			EAE6320_ASSERT(false);
+			return result;
+		}
+
+		rigidBodyState.position = eae6320::Math::sVector(0.5f, -2.5f, -0.5f);
+		result = world.AddBody(rigidBodyState, rigidBody5);
+		if (!result) {
+			EAE6320_ASSERT(false);
+			return result;
+		}
+
+		rigidBodyState.position = eae6320::Math::sVector(-1.5f, 0.5f, 0.0f);
+		result = world.AddBody(rigidBodyState, rigidBody6);
+		if (!result) {
+			EAE6320_ASSERT(false);
+			return result;
+		}
+
+		//rigidBodyState.position.z = 1.0f;
+		rigidBodyState.position = eae6320::Math::sVector(2.5f, 0.8f, 0.0f);
+		result = world.AddBody(rigidBodyState, rigidBody7);
+		if (!result) {
+			EAE6320_ASSERT(false);
+			return result;
+		}
+	}
 
-	//rigidBody7.position.z = 1.0f;
-	rigidBody7.position.x = 2.5f;
-	rigidBody7.position.y = 0.8f;
-	
 
 	eae6320::Math::sVector position(0.0f, 0.0f, 10.0f);
 	camera.m_rigidBodyState.position = position;
@@ -359,5 +399,23 @@ eae6320::cResult eae6320::cExampleGame::CleanUp()
 		cMesh::s_manager.Release(mesh4);
 	}
 
+	if (rigidBody4) {
+		world.RemoveBody(rigidBody4);
+	}
+
+	if (rigidBody5) {
+		world.RemoveBody(rigidBody5);
+	}
+
+	if (rigidBody6) {
+		world.RemoveBody(rigidBody6);
+	}
+
+	if (rigidBody7) {
+		world.RemoveBody(rigidBody7);
+	}
+
+	world.CleanUp();
+
 	return Results::Success;
 }
@@ -0,0 +1,241 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <atomic>
+#include <chrono>
+#include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/cThread.h>
+#include <initializer_list>
+#include <thread>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	constexpr unsigned int s_waitingThreadCount = 4;
+	// This is how long the tests give other threads to start waiting
+	// (or to do something that they shouldn't, e.g. return from a wait that should have released a different thread)
+	constexpr auto s_timeToLetThreadsRun = std::chrono::milliseconds( 50 );
+	// Threads that should return are waited for this long before the test fails
+	// (so that a thread that never returns fails the test instead of hanging it)
+	constexpr unsigned int s_timeToWaitForThreads_inMilliseconds = 5000;
+
+	// Each thread waits for the event once and then counts itself as released
+	struct sWaitingThreads
+	{
+		Concurrency::cEvent event;
+		std::atomic<unsigned int> releasedThreadCount{ 0 };
+		Concurrency::cThread threads[s_waitingThreadCount];
+
+		bool Start()
+		{
+			for ( auto& thread : threads )
+			{
+				if ( !EAE6320_TEST_CHECK( thread.Start( []( void* const io_userData )
+					{
+						auto& waitingThreads = *static_cast<sWaitingThreads*>( io_userData );
+						if ( Concurrency::WaitForEvent( waitingThreads.event ) )
+						{
+							waitingThreads.releasedThreadCount.fetch_add( 1 );
+						}
+					}, this ) ) )
+				{
+					return false;
+				}
+			}
+			std::this_thread::sleep_for( s_timeToLetThreadsRun );
+			return true;
+		}
+		bool WaitForThreadsToStop()
+		{
+			for ( auto& thread : threads )
+			{
+				if ( !EAE6320_TEST_CHECKF( Concurrency::WaitForThreadToStop( thread, s_timeToWaitForThreads_inMilliseconds ),
+					"A thread that was waiting for the event wasn't released" ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		bool WaitForReleasedThreadCount( const unsigned int i_releasedThreadCount )
+		{
+			const auto time_giveUp = std::chrono::steady_clock::now() + std::chrono::milliseconds( s_timeToWaitForThreads_inMilliseconds );
+			while ( ( releasedThreadCount.load() < i_releasedThreadCount ) && ( std::chrono::steady_clock::now() < time_giveUp ) )
+			{
+				std::this_thread::yield();
+			}
+			// Any other thread that was released by mistake is given time to count itself
+			std::this_thread::sleep_for( s_timeToLetThreadsRun );
+			return EAE6320_TEST_CHECKF( releasedThreadCount.load() == i_releasedThreadCount,
+				"%u threads were released instead of %u", releasedThreadCount.load(), i_releasedThreadCount );
+		}
+	};
+
+	bool IsSignaled( const Concurrency::cEvent& i_event )
+	{
+		const auto result = Concurrency::WaitForEvent( i_event, 0 );
+		EAE6320_TEST_CHECK( result || ( result == Results::TimeOut ) );
+		return static_cast<bool>( result );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cEvent_ResetAutomatically_ReleasesASingleWaitingThreadPerSignal )
+{
+	sWaitingThreads waitingThreads;
+	if ( !EAE6320_TEST_CHECK( waitingThreads.event.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) )
+		|| !waitingThreads.Start() )
+	{
+		return;
+	}
+	for ( unsigned int i = 1; i <= s_waitingThreadCount; ++i )
+	{
+		if ( !EAE6320_TEST_CHECK( waitingThreads.event.Signal() ) || !waitingThreads.WaitForReleasedThreadCount( i ) )
+		{
+			// The other threads are released so that they can stop
+			for ( unsigned int j = i; j < s_waitingThreadCount; ++j )
+			{
+				waitingThreads.event.Signal();
+				waitingThreads.WaitForReleasedThreadCount( j + 1 );
+			}
+			break;
+		}
+	}
+	waitingThreads.WaitForThreadsToStop();
+	// The signal that released the last thread was reset
+	EAE6320_TEST_CHECK( !IsSignaled( waitingThreads.event ) );
+}
+
+EAE6320_TEST( cEvent_RemainSignaledUntilReset_ReleasesEveryWaitingThread )
+{
+	// The event remains signaled until it is reset
+	{
+		sWaitingThreads waitingThreads;
+		if ( !EAE6320_TEST_CHECK( waitingThreads.event.Initialize( Concurrency::EventType::RemainSignaledUntilReset ) )
+			|| !waitingThreads.Start() )
+		{
+			return;
+		}
+		EAE6320_TEST_CHECK( waitingThreads.releasedThreadCount.load() == 0 );
+		if ( !EAE6320_TEST_CHECK( waitingThreads.event.Signal() ) || !waitingThreads.WaitForThreadsToStop() )
+		{
+			return;
+		}
+		EAE6320_TEST_CHECK( waitingThreads.releasedThreadCount.load() == s_waitingThreadCount );
+		// Waiting doesn't reset the event
+		EAE6320_TEST_CHECK( IsSignaled( waitingThreads.event ) );
+		EAE6320_TEST_CHECK( IsSignaled( waitingThreads.event ) );
+		EAE6320_TEST_CHECK( waitingThreads.event.ResetToUnsignaled() );
+		EAE6320_TEST_CHECK( !IsSignaled( waitingThreads.event ) );
+	}
+	// The event is reset immediately after it is signaled
+	// (before the waiting threads have had a chance to wake up)
+	{
+		sWaitingThreads waitingThreads;
+		if ( !EAE6320_TEST_CHECK( waitingThreads.event.Initialize( Concurrency::EventType::RemainSignaledUntilReset ) )
+			|| !waitingThreads.Start() )
+		{
+			return;
+		}
+		EAE6320_TEST_CHECK( waitingThreads.event.Signal() );
+		EAE6320_TEST_CHECK( waitingThreads.event.ResetToUnsignaled() );
+		if ( !waitingThreads.WaitForThreadsToStop() )
+		{
+			// The threads that are still waiting are released so that they can stop
+			waitingThreads.event.Signal();
+			waitingThreads.WaitForThreadsToStop();
+			return;
+		}
+		EAE6320_TEST_CHECK( waitingThreads.releasedThreadCount.load() == s_waitingThreadCount );
+		EAE6320_TEST_CHECK( !IsSignaled( waitingThreads.event ) );
+	}
+}
+
+EAE6320_TEST( cEvent_Signal_IsRememberedUntilAThreadWaits )
+{
+	for ( const auto eventType : { Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled, Concurrency::EventType::RemainSignaledUntilReset } )
+	{
+		const auto shouldResetAutomatically = eventType == Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled;
+		// Signaled by this thread
+		{
+			Concurrency::cEvent event;
+			if ( !EAE6320_TEST_CHECK( event.Initialize( eventType ) ) )
+			{
+				return;
+			}
+			EAE6320_TEST_CHECK( event.Signal() );
+			EAE6320_TEST_CHECK( Concurrency::WaitForEvent( event, s_timeToWaitForThreads_inMilliseconds ) );
+			EAE6320_TEST_CHECK( IsSignaled( event ) == !shouldResetAutomatically );
+		}
+		// Signaled by another thread that has already stopped
+		{
+			Concurrency::cEvent event;
+			if ( !EAE6320_TEST_CHECK( event.Initialize( eventType ) ) )
+			{
+				return;
+			}
+			Concurrency::cThread thread;
+			if ( !EAE6320_TEST_CHECK( thread.Start( []( void* const io_event ) { static_cast<Concurrency::cEvent*>( io_event )->Signal(); }, &event ) )
+				|| !EAE6320_TEST_CHECK( Concurrency::WaitForThreadToStop( thread ) ) )
+			{
+				return;
+			}
+			EAE6320_TEST_CHECK( Concurrency::WaitForEvent( event, s_timeToWaitForThreads_inMilliseconds ) );
+			EAE6320_TEST_CHECK( IsSignaled( event ) == !shouldResetAutomatically );
+		}
+		// Initialized as signaled
+		{
+			Concurrency::cEvent event;
+			if ( !EAE6320_TEST_CHECK( event.Initialize( eventType, Concurrency::EventState::Signaled ) ) )
+			{
+				return;
+			}
+			EAE6320_TEST_CHECK( Concurrency::WaitForEvent( event, s_timeToWaitForThreads_inMilliseconds ) );
+			EAE6320_TEST_CHECK( IsSignaled( event ) == !shouldResetAutomatically );
+		}
+	}
+}
+
+EAE6320_TEST( cEvent_WaitForEvent_TimesOut )
+{
+	Concurrency::cEvent event;
+	if ( !EAE6320_TEST_CHECK( event.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) ) )
+	{
+		return;
+	}
+	// A time-out of zero returns immediately
+	{
+		const auto time_start = std::chrono::steady_clock::now();
+		const auto result = Concurrency::WaitForEvent( event, 0 );
+		const auto elapsedTime = std::chrono::steady_clock::now() - time_start;
+		EAE6320_TEST_CHECK( result == Results::TimeOut );
+		EAE6320_TEST_CHECKF( elapsedTime < s_timeToLetThreadsRun, "Waiting with a time-out of zero took %g ms",
+			std::chrono::duration<double, std::milli>( elapsedTime ).count() );
+	}
+	// A time-out that isn't zero returns after at least that long
+	{
+		constexpr unsigned int timeToWait_inMilliseconds = 30;
+		const auto time_start = std::chrono::steady_clock::now();
+		const auto result = Concurrency::WaitForEvent( event, timeToWait_inMilliseconds );
+		const auto elapsedTime = std::chrono::steady_clock::now() - time_start;
+		EAE6320_TEST_CHECK( result == Results::TimeOut );
+		// A millisecond is allowed for the different clocks that the platform might measure the time-out with
+		EAE6320_TEST_CHECKF( elapsedTime >= std::chrono::milliseconds( timeToWait_inMilliseconds - 1 ),
+			"Waiting with a time-out of %u ms returned after %g ms", timeToWait_inMilliseconds,
+			std::chrono::duration<double, std::milli>( elapsedTime ).count() );
+		EAE6320_TEST_CHECKF( elapsedTime < std::chrono::milliseconds( s_timeToWaitForThreads_inMilliseconds ),
+			"Waiting with a time-out of %u ms didn't return for %g ms", timeToWait_inMilliseconds,
+			std::chrono::duration<double, std::milli>( elapsedTime ).count() );
+	}
+	// A time-out doesn't change the event
+	EAE6320_TEST_CHECK( event.Signal() );
+	EAE6320_TEST_CHECK( Concurrency::WaitForEvent( event, 0 ) );
+}
@@ -0,0 +1,412 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <Engine/Concurrency/cJobSystem.h>
+#include <Engine/Concurrency/cThread.h>
+#include <thread>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// Every test is run with no worker threads (where the initializing thread runs every job),
+	// a single worker thread, and more worker threads than most machines have cores
+	constexpr unsigned int s_workerThreadCounts[] = { 0, 1, 3, 7 };
+
+	bool InitializeJobSystem( Concurrency::cJobSystem& io_jobSystem, const unsigned int i_workerThreadCount )
+	{
+		return EAE6320_TEST_CHECKF( io_jobSystem.Initialize( i_workerThreadCount ) && ( io_jobSystem.GetWorkerThreadCount() == i_workerThreadCount ),
+			"The job system couldn't be initialized with %u worker threads", i_workerThreadCount );
+	}
+	bool CleanUpJobSystem( Concurrency::cJobSystem& io_jobSystem )
+	{
+		return EAE6320_TEST_CHECKF( io_jobSystem.CleanUp(), "The job system couldn't be cleaned up" );
+	}
+
+	// Writing Jobs
+	//-------------
+
+	// Each job writes several plain (non-atomic) values,
+	// and so a thread that sees the counter reach zero before a job's writes are visible would read old values
+	constexpr size_t s_valueCountPerJob = 16;
+
+	struct sWriteJob
+	{
+		uint64_t values[s_valueCountPerJob];
+		uint64_t round = 0;
+	};
+
+	void Write( void* const io_userData )
+	{
+		auto& job = *static_cast<sWriteJob*>( io_userData );
+		for ( size_t i = 0; i < s_valueCountPerJob; ++i )
+		{
+			job.values[i] = ( job.round * s_valueCountPerJob ) + i;
+		}
+	}
+
+	bool WereValuesWritten( const std::vector<sWriteJob>& i_writeJobs, const uint64_t i_round, const unsigned int i_workerThreadCount )
+	{
+		for ( size_t j = 0; j < i_writeJobs.size(); ++j )
+		{
+			for ( size_t i = 0; i < s_valueCountPerJob; ++i )
+			{
+				if ( !EAE6320_TEST_CHECKF( i_writeJobs[j].values[i] == ( ( i_round * s_valueCountPerJob ) + i ),
+					"Value %zu of job %zu in round %u with %u worker threads wasn't written when its counter was done",
+					i, j, static_cast<unsigned int>( i_round ), i_workerThreadCount ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	std::vector<Concurrency::cJobSystem::sJob> CreateWriteJobs( std::vector<sWriteJob>& io_writeJobs, const uint64_t i_round )
+	{
+		std::vector<Concurrency::cJobSystem::sJob> jobs( io_writeJobs.size() );
+		for ( size_t i = 0; i < io_writeJobs.size(); ++i )
+		{
+			io_writeJobs[i].round = i_round;
+			jobs[i].function = Write;
+			jobs[i].userData = &io_writeJobs[i];
+		}
+		return jobs;
+	}
+
+	// Nested Jobs
+	//------------
+
+	// Each job that isn't a leaf runs its children and waits for them from inside of the job
+	// and then adds up how many leaves they had
+	constexpr size_t s_childCountPerJob = 4;
+
+	struct sTreeJob
+	{
+		Concurrency::cJobSystem* jobSystem = nullptr;
+		unsigned int depth = 0;
+		uint64_t leafCount = 0;
+	};
+
+	void CountLeaves( void* const io_userData )
+	{
+		auto& job = *static_cast<sTreeJob*>( io_userData );
+		if ( job.depth == 0 )
+		{
+			job.leafCount = 1;
+			return;
+		}
+		sTreeJob childTreeJobs[s_childCountPerJob];
+		Concurrency::cJobSystem::sJob childJobs[s_childCountPerJob];
+		for ( size_t i = 0; i < s_childCountPerJob; ++i )
+		{
+			childTreeJobs[i].jobSystem = job.jobSystem;
+			childTreeJobs[i].depth = job.depth - 1;
+			childJobs[i].function = CountLeaves;
+			childJobs[i].userData = &childTreeJobs[i];
+		}
+		Concurrency::cJobSystem::cCounter counter;
+		// Half of the children are run together and half are run one at a time
+		job.jobSystem->Run( childJobs, s_childCountPerJob / 2, &counter );
+		for ( size_t i = s_childCountPerJob / 2; i < s_childCountPerJob; ++i )
+		{
+			job.jobSystem->Run( childJobs[i], &counter );
+		}
+		job.jobSystem->WaitForCounter( counter );
+		job.leafCount = 0;
+		for ( const auto& childTreeJob : childTreeJobs )
+		{
+			job.leafCount += childTreeJob.leafCount;
+		}
+	}
+
+	// Counting Jobs
+	//--------------
+
+	void Increment( void* const io_userData )
+	{
+		static_cast<std::atomic<size_t>*>( io_userData )->fetch_add( 1, std::memory_order_relaxed );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cJobSystem_WaitForCounter_ReturnsAfterEveryJobsWritesAreVisible )
+{
+	constexpr size_t jobCount = 1000;
+	constexpr uint64_t roundCount = 20;
+	for ( const auto workerThreadCount : s_workerThreadCounts )
+	{
+		Concurrency::cJobSystem jobSystem;
+		if ( !InitializeJobSystem( jobSystem, workerThreadCount ) )
+		{
+			return;
+		}
+		std::vector<sWriteJob> writeJobs( jobCount );
+		for ( uint64_t round = 1; round <= roundCount; ++round )
+		{
+			const auto jobs = CreateWriteJobs( writeJobs, round );
+			Concurrency::cJobSystem::cCounter counter;
+			jobSystem.Run( jobs.data(), jobs.size(), &counter );
+			jobSystem.WaitForCounter( counter );
+			if ( !EAE6320_TEST_CHECK( counter.IsDone() ) || !WereValuesWritten( writeJobs, round, workerThreadCount ) )
+			{
+				return;
+			}
+		}
+		// A thread that only checks whether the counter is done
+		// (rather than running jobs while it waits) must see the writes too
+		if ( workerThreadCount > 0 )
+		{
+			for ( uint64_t round = roundCount + 1; round <= ( roundCount * 2 ); ++round )
+			{
+				const auto jobs = CreateWriteJobs( writeJobs, round );
+				Concurrency::cJobSystem::cCounter counter;
+				jobSystem.Run( jobs.data(), jobs.size(), &counter );
+				while ( !counter.IsDone() )
+				{
+					std::this_thread::yield();
+				}
+				if ( !WereValuesWritten( writeJobs, round, workerThreadCount ) )
+				{
+					return;
+				}
+			}
+		}
+		if ( !CleanUpJobSystem( jobSystem ) )
+		{
+			return;
+		}
+	}
+}
+
+EAE6320_TEST( cJobSystem_WaitForCounter_CanBeCalledFromInsideOfAJob )
+{
+	constexpr unsigned int depth = 5;
+	constexpr uint64_t expectedLeafCount = 1024;	// s_childCountPerJob ^ depth
+	for ( const auto workerThreadCount : s_workerThreadCounts )
+	{
+		Concurrency::cJobSystem jobSystem;
+		if ( !InitializeJobSystem( jobSystem, workerThreadCount ) )
+		{
+			return;
+		}
+		for ( int i = 0; i < 10; ++i )
+		{
+			sTreeJob treeJob;
+			treeJob.jobSystem = &jobSystem;
+			treeJob.depth = depth;
+			Concurrency::cJobSystem::sJob job;
+			job.function = CountLeaves;
+			job.userData = &treeJob;
+			Concurrency::cJobSystem::cCounter counter;
+			jobSystem.Run( job, &counter );
+			jobSystem.WaitForCounter( counter );
+			if ( !EAE6320_TEST_CHECKF( treeJob.leafCount == expectedLeafCount, "A tree of nested jobs with %u worker threads counted %u leaves instead of %u",
+				workerThreadCount, static_cast<unsigned int>( treeJob.leafCount ), static_cast<unsigned int>( expectedLeafCount ) ) )
+			{
+				return;
+			}
+		}
+		if ( !CleanUpJobSystem( jobSystem ) )
+		{
+			return;
+		}
+	}
+}
+
+EAE6320_TEST( cJobSystem_ParallelFor_CoversEveryIndexExactlyOnce )
+{
+	struct sCase
+	{
+		size_t index_begin, index_end, indexCountPerRange;
+	};
+	constexpr sCase cases[] =
+	{
+		// No indices
+		{ 0, 0, 1 }, { 5, 5, 64 }, { 10, 5, 1 },
+		// A single index
+		{ 0, 1, 1 }, { 5, 6, 64 },
+		// Fewer ranges than threads
+		{ 0, 2, 1 }, { 3, 20, 16 },
+		// A last range that is shorter than the others
+		{ 3, 1003, 7 }, { 100, 117, 5 },
+		// A range for every index
+		{ 0, 10000, 1 },
+		// A single range with every index
+		{ 0, 1000, 1000 }, { 0, 1000, 5000 },
+	};
+	for ( const auto workerThreadCount : s_workerThreadCounts )
+	{
+		Concurrency::cJobSystem jobSystem;
+		if ( !InitializeJobSystem( jobSystem, workerThreadCount ) )
+		{
+			return;
+		}
+		for ( const auto& parallelForCase : cases )
+		{
+			const auto indexCount = ( parallelForCase.index_end > parallelForCase.index_begin ) ? ( parallelForCase.index_end - parallelForCase.index_begin ) : 0;
+			std::vector<std::atomic<unsigned int>> callCounts( indexCount );
+			// The checks can't be made from other threads,
+			// and so any range that isn't as documented is remembered instead
+			std::atomic<bool> wereRangesValid( true );
+			jobSystem.ParallelFor( parallelForCase.index_begin, parallelForCase.index_end, parallelForCase.indexCountPerRange,
+				[&]( const size_t i_index_begin, const size_t i_index_end )
+				{
+					const auto expectedIndex_end = std::min( i_index_begin + parallelForCase.indexCountPerRange, parallelForCase.index_end );
+					if ( ( i_index_begin < parallelForCase.index_begin ) || ( ( ( i_index_begin - parallelForCase.index_begin ) % parallelForCase.indexCountPerRange ) != 0 )
+						|| ( i_index_end != expectedIndex_end ) )
+					{
+						wereRangesValid.store( false );
+						return;
+					}
+					for ( auto i = i_index_begin; i < i_index_end; ++i )
+					{
+						callCounts[i - parallelForCase.index_begin].fetch_add( 1, std::memory_order_relaxed );
+					}
+				} );
+			if ( !EAE6320_TEST_CHECKF( wereRangesValid.load(), "ParallelFor( %zu, %zu, %zu ) with %u worker threads called the function with an invalid range",
+				parallelForCase.index_begin, parallelForCase.index_end, parallelForCase.indexCountPerRange, workerThreadCount ) )
+			{
+				return;
+			}
+			for ( size_t i = 0; i < indexCount; ++i )
+			{
+				const auto callCount = callCounts[i].load();
+				if ( !EAE6320_TEST_CHECKF( callCount == 1, "ParallelFor( %zu, %zu, %zu ) with %u worker threads covered index %zu %u times",
+					parallelForCase.index_begin, parallelForCase.index_end, parallelForCase.indexCountPerRange, workerThreadCount,
+					parallelForCase.index_begin + i, callCount ) )
+				{
+					return;
+				}
+			}
+		}
+		if ( !CleanUpJobSystem( jobSystem ) )
+		{
+			return;
+		}
+	}
+}
+
+EAE6320_TEST( cJobSystem_Run_RunsJobsFromAThreadThatDoesntRunJobs )
+{
+	constexpr size_t jobCount = 5000;
+	for ( const auto workerThreadCount : s_workerThreadCounts )
+	{
+		Concurrency::cJobSystem jobSystem;
+		if ( !InitializeJobSystem( jobSystem, workerThreadCount ) )
+		{
+			return;
+		}
+		// The other thread doesn't have a queue,
+		// and so with no worker threads the only way that its jobs can run
+		// is if this thread takes them from the shared queue while it waits
+		std::atomic<size_t> runJobCount( 0 );
+		Concurrency::cJobSystem::cCounter counter;
+		{
+			Concurrency::cThread thread;
+			const auto result_start = thread.Start( [&jobSystem, &runJobCount, &counter]( void* const )
+				{
+					Concurrency::cJobSystem::sJob job;
+					job.function = Increment;
+					job.userData = &runJobCount;
+					// Jobs are run both one at a time and together
+					for ( size_t i = 0; i < ( jobCount / 2 ); ++i )
+					{
+						jobSystem.Run( job, &counter );
+					}
+					const std::vector<Concurrency::cJobSystem::sJob> jobs( jobCount - ( jobCount / 2 ), job );
+					jobSystem.Run( jobs.data(), jobs.size(), &counter );
+				} );
+			if ( !EAE6320_TEST_CHECK( result_start ) || !EAE6320_TEST_CHECK( Concurrency::WaitForThreadToStop( thread ) ) )
+			{
+				return;
+			}
+		}
+		jobSystem.WaitForCounter( counter );
+		if ( !EAE6320_TEST_CHECKF( runJobCount.load() == jobCount, "%zu of %zu jobs from another thread ran with %u worker threads",
+			runJobCount.load(), jobCount, workerThreadCount ) )
+		{
+			return;
+		}
+		if ( !CleanUpJobSystem( jobSystem ) )
+		{
+			return;
+		}
+	}
+}
+
+EAE6320_TEST( cJobSystem_Run_RunsTheJobImmediatelyWhenTheQueueIsFull )
+{
+	// With no worker threads nothing else can take jobs from this thread's queue,
+	// and so every job past the maximum is run before Run() returns
+	Concurrency::cJobSystem jobSystem;
+	if ( !InitializeJobSystem( jobSystem, 0 ) )
+	{
+		return;
+	}
+	constexpr size_t extraJobCount = 10;
+	constexpr auto jobCount = Concurrency::cJobSystem::MaximumJobCountPerQueue + extraJobCount;
+	std::atomic<size_t> runJobCount( 0 );
+	Concurrency::cJobSystem::sJob job;
+	job.function = Increment;
+	job.userData = &runJobCount;
+	Concurrency::cJobSystem::cCounter counter;
+	for ( size_t i = 0; i < jobCount; ++i )
+	{
+		jobSystem.Run( job, &counter );
+	}
+	EAE6320_TEST_CHECKF( runJobCount.load() == extraJobCount, "%zu jobs ran before waiting instead of the %zu that didn't fit in the queue",
+		runJobCount.load(), extraJobCount );
+	EAE6320_TEST_CHECK( !counter.IsDone() );
+	jobSystem.WaitForCounter( counter );
+	EAE6320_TEST_CHECKF( runJobCount.load() == jobCount, "%zu of %zu jobs ran", runJobCount.load(), jobCount );
+	CleanUpJobSystem( jobSystem );
+}
+
+EAE6320_TEST( cJobSystem_CleanUp_StopsWorkerThreadsThatAreWaiting )
+{
+	for ( const auto workerThreadCount : s_workerThreadCounts )
+	{
+		Concurrency::cJobSystem jobSystem;
+		// Clean up immediately after initializing
+		// (when the worker threads might not have started waiting yet)
+		if ( !InitializeJobSystem( jobSystem, workerThreadCount ) || !CleanUpJobSystem( jobSystem ) )
+		{
+			return;
+		}
+		// Clean up after the worker threads have run out of jobs and are waiting for more
+		// (and then make sure that the job system can be used again)
+		for ( int i = 0; i < 2; ++i )
+		{
+			if ( !InitializeJobSystem( jobSystem, workerThreadCount ) )
+			{
+				return;
+			}
+			std::atomic<size_t> runJobCount( 0 );
+			Concurrency::cJobSystem::sJob job;
+			job.function = Increment;
+			job.userData = &runJobCount;
+			const std::vector<Concurrency::cJobSystem::sJob> jobs( 100, job );
+			Concurrency::cJobSystem::cCounter counter;
+			jobSystem.Run( jobs.data(), jobs.size(), &counter );
+			jobSystem.WaitForCounter( counter );
+			std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+			if ( !EAE6320_TEST_CHECK( runJobCount.load() == jobs.size() ) || !CleanUpJobSystem( jobSystem ) )
+			{
+				return;
+			}
+		}
+	}
+}
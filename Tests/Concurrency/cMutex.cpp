@@ -0,0 +1,148 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <atomic>
+#include <cstdint>
+#include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/cMutex.h>
+#include <Engine/Concurrency/cThread.h>
+#include <thread>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// More threads than most machines have cores
+	// (so that threads are preempted while they hold the lock and other threads have to sleep)
+	constexpr unsigned int s_threadCount = 8;
+	constexpr unsigned int s_incrementCountPerThread = 100000;
+
+	// The counter is a plain (non-atomic) value,
+	// and so any increment that isn't protected by the mutex would make the total wrong
+	struct sSharedCounter
+	{
+		Concurrency::cMutex mutex;
+		uint64_t count = 0;
+	};
+
+	bool IncrementFromManyThreads( sSharedCounter& io_sharedCounter, const Concurrency::fThreadFunction& i_threadFunction )
+	{
+		Concurrency::cThread threads[s_threadCount];
+		for ( auto& thread : threads )
+		{
+			if ( !EAE6320_TEST_CHECK( thread.Start( i_threadFunction, &io_sharedCounter ) ) )
+			{
+				return false;
+			}
+		}
+		for ( auto& thread : threads )
+		{
+			if ( !EAE6320_TEST_CHECK( Concurrency::WaitForThreadToStop( thread ) ) )
+			{
+				return false;
+			}
+		}
+		constexpr auto expectedCount = static_cast<uint64_t>( s_threadCount ) * s_incrementCountPerThread;
+		return EAE6320_TEST_CHECKF( io_sharedCounter.count == expectedCount, "The shared counter is %u instead of %u",
+			static_cast<unsigned int>( io_sharedCounter.count ), static_cast<unsigned int>( expectedCount ) );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cMutex_Lock_KeepsASharedCounterExact )
+{
+	sSharedCounter sharedCounter;
+	IncrementFromManyThreads( sharedCounter, []( void* const io_userData )
+		{
+			auto& sharedCounter = *static_cast<sSharedCounter*>( io_userData );
+			for ( unsigned int i = 0; i < s_incrementCountPerThread; ++i )
+			{
+				Concurrency::cMutex::cScopeLock scopeLock( sharedCounter.mutex );
+				++sharedCounter.count;
+			}
+		} );
+}
+
+EAE6320_TEST( cMutex_LockIfPossible_KeepsASharedCounterExact )
+{
+	// Half of the increments try to lock the mutex until they succeed
+	// and the other half wait for it
+	// (so that a thread that fails to lock the mutex can't break a thread that is waiting for it)
+	sSharedCounter sharedCounter;
+	IncrementFromManyThreads( sharedCounter, []( void* const io_userData )
+		{
+			auto& sharedCounter = *static_cast<sSharedCounter*>( io_userData );
+			for ( unsigned int i = 0; i < s_incrementCountPerThread; ++i )
+			{
+				if ( ( i % 2 ) == 0 )
+				{
+					while ( !sharedCounter.mutex.LockIfPossible() )
+					{
+						std::this_thread::yield();
+					}
+				}
+				else
+				{
+					sharedCounter.mutex.Lock();
+				}
+				++sharedCounter.count;
+				sharedCounter.mutex.Unlock();
+			}
+		} );
+}
+
+EAE6320_TEST( cMutex_LockIfPossible_FailsOnlyWhileAnotherThreadHoldsTheLock )
+{
+	Concurrency::cMutex mutex;
+	// The other thread locks the mutex, signals that it is holding it,
+	// and then waits to be told to release it
+	Concurrency::cEvent whenTheLockIsHeld, whenTheLockShouldBeReleased;
+	if ( !EAE6320_TEST_CHECK( whenTheLockIsHeld.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) )
+		|| !EAE6320_TEST_CHECK( whenTheLockShouldBeReleased.Initialize( Concurrency::EventType::ResetAutomaticallyAfterBeingSignaled ) ) )
+	{
+		return;
+	}
+	std::atomic<bool> couldOtherThreadLock( false );
+	Concurrency::cThread thread;
+	if ( !EAE6320_TEST_CHECK( thread.Start( [&]( void* const )
+		{
+			couldOtherThreadLock.store( static_cast<bool>( mutex.LockIfPossible() ) );
+			whenTheLockIsHeld.Signal();
+			Concurrency::WaitForEvent( whenTheLockShouldBeReleased );
+			if ( couldOtherThreadLock.load() )
+			{
+				mutex.Unlock();
+			}
+		} ) ) )
+	{
+		return;
+	}
+	if ( EAE6320_TEST_CHECK( Concurrency::WaitForEvent( whenTheLockIsHeld ) ) )
+	{
+		EAE6320_TEST_CHECK( couldOtherThreadLock.load() );
+		// Trying again doesn't change the result while the other thread holds the lock
+		EAE6320_TEST_CHECK( !mutex.LockIfPossible() );
+		EAE6320_TEST_CHECK( !mutex.LockIfPossible() );
+	}
+	whenTheLockShouldBeReleased.Signal();
+	if ( !EAE6320_TEST_CHECK( Concurrency::WaitForThreadToStop( thread ) ) )
+	{
+		return;
+	}
+	// Once the lock has been released it can be locked again
+	if ( EAE6320_TEST_CHECK( mutex.LockIfPossible() ) )
+	{
+		mutex.Unlock();
+	}
+	if ( EAE6320_TEST_CHECK( mutex.LockIfPossible() ) )
+	{
+		mutex.Unlock();
+	}
+}
@@ -0,0 +1,373 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <Engine/Assets/ReferenceCountedAssets.h>
+#include <Engine/Graphics/cEffect.h>
+#include <Engine/Graphics/cMesh.h>
+#include <Engine/Graphics/ConstantBufferFormats.h>
+#include <Engine/Graphics/cRenderState.h>
+#include <Engine/Graphics/cTexture.h>
+#include <Engine/Graphics/Graphics.h>
+#include <Engine/Graphics/Null/NullDevice.h>
+#include <Engine/Graphics/TextureFormats.h>
+#include <Engine/Graphics/VertexFormats.h>
+#include <Engine/Platform/Platform.h>
+#include <Engine/Time/Time.h>
+#include <new>
+#include <string>
+#include <vector>
+
+// Heap Allocation Counting
+//=========================
+
+// Every allocation that this test program makes from the heap is counted
+// so that a test can tell whether rendering a frame allocated anything
+
+namespace
+{
+	std::atomic<uint64_t> s_heapAllocationCount( 0 );
+}
+
+void* operator new( const size_t i_byteCount )
+{
+	++s_heapAllocationCount;
+	if ( auto* const memory = std::malloc( ( i_byteCount > 0 ) ? i_byteCount : 1 ) )
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete( void* const i_memory ) noexcept
+{
+	std::free( i_memory );
+}
+
+void operator delete( void* const i_memory, size_t ) noexcept
+{
+	std::free( i_memory );
+}
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// The assets are written to the working directory when a test starts
+	// (the null device doesn't read shaders or textures, but they are still loaded from files the same way the real platforms load them)
+	constexpr auto* const s_path_shader = "Tests_Graphics.shd";
+	constexpr auto* const s_path_texture = "Tests_Graphics.tex";
+	constexpr auto* const s_path_mesh = "Tests_Graphics.mesh";
+	constexpr size_t s_meshIndexCount = 3;
+
+	template <typename tData>
+	void Append( const tData& i_data, std::vector<uint8_t>& io_file )
+	{
+		const auto* const bytes = reinterpret_cast<const uint8_t*>( &i_data );
+		io_file.insert( io_file.end(), bytes, bytes + sizeof( i_data ) );
+	}
+
+	bool WriteAssetFiles()
+	{
+		// Shader
+		{
+			const std::vector<uint8_t> file( 64, 0 );
+			if ( !Platform::WriteBinaryFile( s_path_shader, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		// Texture (a single 4x4 block)
+		{
+			std::vector<uint8_t> file;
+			Graphics::TextureFormats::sTextureInfo textureInfo;
+			textureInfo.width = textureInfo.height = 4;
+			textureInfo.mipMapCount = 1;
+			textureInfo.compressionType = Graphics::TextureFormats::Compression::BC1;
+			Append( textureInfo, file );
+			file.resize( file.size() + Graphics::TextureFormats::Compression::GetSizeOfBlock( textureInfo.compressionType ), 0 );
+			if ( !Platform::WriteBinaryFile( s_path_texture, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		// Mesh (a single triangle inside of a unit sphere)
+		{
+			std::vector<uint8_t> file;
+			Graphics::sMeshBounds bounds;
+			bounds.sphereRadius = 1.0f;
+			for ( size_t i = 0; i < 3; ++i )
+			{
+				bounds.boxMinimum[i] = -1.0f;
+				bounds.boxMaximum[i] = 1.0f;
+			}
+			Append( bounds, file );
+			constexpr size_t vertexCount = 3;
+			Append( vertexCount, file );
+			for ( size_t i = 0; i < vertexCount; ++i )
+			{
+				Graphics::VertexFormats::sMesh vertex;
+				vertex.x = ( i == 1 ) ? 1.0f : 0.0f;
+				vertex.y = ( i == 2 ) ? 1.0f : 0.0f;
+				vertex.z = 0.0f;
+				vertex.u = vertex.v = 0.0f;
+				Append( vertex, file );
+			}
+			Append( s_meshIndexCount, file );
+			for ( uint16_t i = 0; i < s_meshIndexCount; ++i )
+			{
+				Append( i, file );
+			}
+			if ( !Platform::WriteBinaryFile( s_path_mesh, file.data(), file.size() ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void DeleteAssetFiles()
+	{
+		std::remove( s_path_shader );
+		std::remove( s_path_texture );
+		std::remove( s_path_mesh );
+	}
+
+	Graphics::cCamera CreateCamera()
+	{
+		// The camera is at the origin looking down negative Z
+		Graphics::cCamera camera;
+		camera.m_verticalFieldOfView_inRadians = 1.0f;
+		camera.m_aspectRatio = 1.0f;
+		camera.m_z_nearPlane = 0.1f;
+		camera.m_z_farPlane = 100.0f;
+		return camera;
+	}
+
+	// This initializes the graphics system and creates the resources that the tests submit
+	struct sScene
+	{
+		cEffect* effect_opaque = nullptr;
+		cEffect* effect_translucent = nullptr;
+		Graphics::cTexture* texture = nullptr;
+		cMesh* mesh_a = nullptr;
+		cMesh* mesh_b = nullptr;
+
+		int64_t liveObjectCount_beforeInitialization = 0;
+		bool isGraphicsInitialized = false;
+
+		bool Initialize()
+		{
+			if ( !EAE6320_TEST_CHECK( WriteAssetFiles() ) )
+			{
+				return false;
+			}
+			liveObjectCount_beforeInitialization = Graphics::NullDevice::GetStatistics().liveObjectCount;
+			if ( !EAE6320_TEST_CHECK( Time::Initialize() ) || !EAE6320_TEST_CHECK( Graphics::Initialize( Graphics::sInitializationParameters() ) ) )
+			{
+				return false;
+			}
+			isGraphicsInitialized = true;
+			effect_opaque = CreateEffect( Graphics::RenderStates::DepthBuffering );
+			effect_translucent = CreateEffect( Graphics::RenderStates::DepthBuffering | Graphics::RenderStates::AlphaTransparency );
+			EAE6320_TEST_CHECK( Graphics::cTexture::Load( s_path_texture, texture ) );
+			EAE6320_TEST_CHECK( cMesh::Load( s_path_mesh, mesh_a ) );
+			EAE6320_TEST_CHECK( cMesh::Load( s_path_mesh, mesh_b ) );
+			return EAE6320_TEST_CHECK( effect_opaque && effect_translucent && texture && mesh_a && mesh_b );
+		}
+
+		// Every object that the null device created should be destroyed
+		void CleanUp()
+		{
+			Release( effect_opaque );
+			Release( effect_translucent );
+			Release( texture );
+			Release( mesh_a );
+			Release( mesh_b );
+			if ( isGraphicsInitialized )
+			{
+				EAE6320_TEST_CHECK( Graphics::CleanUp() );
+				EAE6320_TEST_CHECK( Time::CleanUp() );
+				const auto liveObjectCount = Graphics::NullDevice::GetStatistics().liveObjectCount;
+				EAE6320_TEST_CHECKF( liveObjectCount == liveObjectCount_beforeInitialization, "%lld null device objects are still live",
+					static_cast<long long>( liveObjectCount - liveObjectCount_beforeInitialization ) );
+			}
+			DeleteAssetFiles();
+		}
+
+		~sScene() { CleanUp(); }
+
+	private:
+
+		static cEffect* CreateEffect( const uint8_t i_renderStateBits )
+		{
+			std::string path_vertex( s_path_shader );
+			cEffect* effect = nullptr;
+			return cEffect::CreateEffect( effect, &path_vertex[0], s_path_shader, i_renderStateBits ) ? effect : nullptr;
+		}
+
+		template <typename tResource>
+		static void Release( tResource*& io_resource )
+		{
+			if ( io_resource )
+			{
+				io_resource->DecrementReferenceCount();
+				io_resource = nullptr;
+			}
+		}
+	};
+
+	void SubmitMesh( cEffect* const i_effect, cMesh* const i_mesh, Graphics::cTexture* const i_texture, const float i_z )
+	{
+		Graphics::meshData meshData( i_effect, i_mesh, i_texture );
+		Physics::sRigidBodyState rigidBodyState;
+		rigidBodyState.position = Math::sVector( 0.0f, 0.0f, i_z );
+		Graphics::SubmitEffectAndMesh( meshData, rigidBodyState );
+	}
+
+	// Submits and renders a frame with the given number of opaque meshes
+	void RenderFrame( const sScene& i_scene, const unsigned int i_meshCount )
+	{
+		EAE6320_TEST_CHECK( Graphics::WaitUntilDataForANewFrameCanBeSubmitted( 0 ) );
+		Graphics::SubmitElapsedTime( 0.0f, 0.0f );
+		Graphics::SubmitBackgroundColor( 0.0f, 0.0f, 0.0f, 1.0f );
+		auto camera = CreateCamera();
+		Graphics::SubmitCamera( camera );
+		for ( unsigned int i = 0; i < i_meshCount; ++i )
+		{
+			SubmitMesh( i_scene.effect_opaque, ( ( i % 2 ) == 0 ) ? i_scene.mesh_a : i_scene.mesh_b, i_scene.texture,
+				-10.0f - static_cast<float>( i % 50 ) );
+		}
+		EAE6320_TEST_CHECK( Graphics::SignalThatAllDataForAFrameHasBeenSubmitted() );
+		Graphics::RenderFrame();
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( Graphics_RenderFrame_RecordsTheSubmittedFrame )
+{
+	sScene scene;
+	if ( !scene.Initialize() )
+	{
+		return;
+	}
+
+	// Only the frame's calls are counted
+	Graphics::NullDevice::ResetStatistics();
+	const auto referenceCountOperationCount_beforeFrame = Assets::GetReferenceCountOperationCount().load();
+
+	// Submit a frame
+	constexpr unsigned int instanceCount_opaqueA = 5;
+	constexpr unsigned int instanceCount_opaqueB = 3;
+	constexpr unsigned int instanceCount_translucent = 2;
+	constexpr unsigned int visibleMeshCount = instanceCount_opaqueA + instanceCount_opaqueB + instanceCount_translucent;
+	{
+		EAE6320_TEST_CHECK( Graphics::WaitUntilDataForANewFrameCanBeSubmitted( 0 ) );
+		Graphics::SubmitElapsedTime( 0.0f, 0.0f );
+		Graphics::SubmitBackgroundColor( 0.0f, 0.0f, 0.0f, 1.0f );
+		auto camera = CreateCamera();
+		Graphics::SubmitCamera( camera );
+		// The opaque meshes are submitted interleaved and are drawn as one instanced draw call per mesh
+		for ( unsigned int i = 0; i < instanceCount_opaqueA; ++i )
+		{
+			SubmitMesh( scene.effect_opaque, scene.mesh_a, scene.texture, -10.0f - static_cast<float>( i ) );
+			if ( i < instanceCount_opaqueB )
+			{
+				SubmitMesh( scene.effect_opaque, scene.mesh_b, scene.texture, -10.0f - static_cast<float>( i ) );
+			}
+		}
+		// The translucent meshes are at different depths with different meshes and so each is its own draw call
+		SubmitMesh( scene.effect_translucent, scene.mesh_a, scene.texture, -20.0f );
+		SubmitMesh( scene.effect_translucent, scene.mesh_b, scene.texture, -30.0f );
+		// This mesh is behind the camera
+		SubmitMesh( scene.effect_opaque, scene.mesh_a, scene.texture, 50.0f );
+		EAE6320_TEST_CHECK( Graphics::SignalThatAllDataForAFrameHasBeenSubmitted() );
+	}
+	// The frame was already submitted and so rendering it on this thread doesn't wait
+	Graphics::RenderFrame();
+
+	const auto renderStatistics = Graphics::GetRenderStatisticsForLastFrame();
+	EAE6320_TEST_CHECKF( renderStatistics.visibleMeshCount == visibleMeshCount, "%u meshes were visible", renderStatistics.visibleMeshCount );
+	EAE6320_TEST_CHECKF( renderStatistics.culledMeshCount == 1, "%u meshes were culled", renderStatistics.culledMeshCount );
+	EAE6320_TEST_CHECKF( renderStatistics.drawCallCount == 4, "%u draw calls were made", renderStatistics.drawCallCount );
+	EAE6320_TEST_CHECK( renderStatistics.meshInstanceCount == visibleMeshCount );
+	EAE6320_TEST_CHECK( renderStatistics.pinnedResourceCount == 5 );
+	// Each resource was pinned and released once no matter how many draws used it
+	const auto referenceCountOperationCount = Assets::GetReferenceCountOperationCount().load() - referenceCountOperationCount_beforeFrame;
+	EAE6320_TEST_CHECKF( referenceCountOperationCount == ( renderStatistics.pinnedResourceCount * 2 ), "%llu reference count operations were made",
+		static_cast<unsigned long long>( referenceCountOperationCount ) );
+
+	// Every call that the frame made should have been recorded by the null device
+	const auto deviceStatistics = Graphics::NullDevice::GetStatistics();
+	using namespace Graphics::NullDevice::ApiCalls;
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[Clear] == 1 );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[Present] == 1 );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[DrawIndexedInstanced] == renderStatistics.drawCallCount );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[Draw] == 0 );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[BindProgram] == renderStatistics.effectBindCount );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[BindTexture] == renderStatistics.textureBindCount );
+	EAE6320_TEST_CHECK( deviceStatistics.callCounts[BindVertexArray] == renderStatistics.meshBindCount );
+	EAE6320_TEST_CHECK( deviceStatistics.drawnInstanceCount == visibleMeshCount );
+	EAE6320_TEST_CHECK( deviceStatistics.drawnVertexCount == ( visibleMeshCount * s_meshIndexCount ) );
+	// The per-frame constant buffer and the instances are the only data that are uploaded
+	EAE6320_TEST_CHECKF( deviceStatistics.callCounts[UpdateBuffer] == 2, "%llu buffer updates were made",
+		static_cast<unsigned long long>( deviceStatistics.callCounts[UpdateBuffer] ) );
+	const auto expectedUploadedByteCount = sizeof( Graphics::ConstantBufferFormats::sPerFrame )
+		+ ( visibleMeshCount * sizeof( Graphics::VertexFormats::sMeshInstance ) );
+	EAE6320_TEST_CHECKF( deviceStatistics.uploadedByteCount == expectedUploadedByteCount, "%llu bytes were uploaded instead of %llu",
+		static_cast<unsigned long long>( deviceStatistics.uploadedByteCount ), static_cast<unsigned long long>( expectedUploadedByteCount ) );
+	EAE6320_TEST_CHECK( renderStatistics.instanceBufferUploadByteCount == ( visibleMeshCount * sizeof( Graphics::VertexFormats::sMeshInstance ) ) );
+}
+
+EAE6320_TEST( Graphics_RenderFrame_DoesntAllocateFromTheHeapOnceFramesStopGrowing )
+{
+	sScene scene;
+	if ( !scene.Initialize() )
+	{
+		return;
+	}
+
+	// This is more than the frame arenas and the instance buffer start with,
+	// and so the first frames grow them
+	constexpr unsigned int meshCount = 5000;
+	constexpr unsigned int frameCount_warmUp = 10;
+	for ( unsigned int i = 0; i < frameCount_warmUp; ++i )
+	{
+		RenderFrame( scene, meshCount );
+	}
+	EAE6320_TEST_CHECK( Graphics::GetRenderStatisticsForLastFrame().visibleMeshCount == meshCount );
+
+	// Once every frame has grown to the size it needs nothing else should be allocated
+	// (each frame's arena counts its own heap allocations,
+	// and so a frame is compared with the one that used the same arena)
+	constexpr unsigned int framePipelineDepth = 3;
+	uint32_t arenaHeapAllocationCounts[framePipelineDepth];
+	for ( unsigned int i = 0; i < framePipelineDepth; ++i )
+	{
+		RenderFrame( scene, meshCount );
+		arenaHeapAllocationCounts[i] = Graphics::GetRenderStatisticsForLastFrame().frameArenaHeapAllocationCount;
+	}
+	const auto heapAllocationCount_beforeSteadyState = s_heapAllocationCount.load();
+	constexpr unsigned int frameCount_steadyState = 4 * framePipelineDepth;
+	for ( unsigned int i = 0; i < frameCount_steadyState; ++i )
+	{
+		RenderFrame( scene, meshCount );
+		const auto arenaHeapAllocationCount = Graphics::GetRenderStatisticsForLastFrame().frameArenaHeapAllocationCount;
+		EAE6320_TEST_CHECKF( arenaHeapAllocationCount == arenaHeapAllocationCounts[i % framePipelineDepth],
+			"Frame %u's arena allocated from the heap %u times", i,
+			arenaHeapAllocationCount - arenaHeapAllocationCounts[i % framePipelineDepth] );
+	}
+	const auto heapAllocationCount_steadyState = s_heapAllocationCount.load() - heapAllocationCount_beforeSteadyState;
+	EAE6320_TEST_CHECKF( heapAllocationCount_steadyState == 0, "%llu heap allocations were made in %u frames",
+		static_cast<unsigned long long>( heapAllocationCount_steadyState ), frameCount_steadyState );
+}
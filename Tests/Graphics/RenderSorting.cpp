@@ -0,0 +1,189 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <Engine/Graphics/RenderSorting.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+	using Graphics::RenderSorting::ePass;
+
+	struct sDraw
+	{
+		ePass pass;
+		uint16_t effectId, textureId, meshId;
+		float cameraSpaceZ;
+	};
+
+	bool HaveSameState( const sDraw& i_lhs, const sDraw& i_rhs )
+	{
+		return ( i_lhs.pass == i_rhs.pass ) && ( i_lhs.effectId == i_rhs.effectId ) && ( i_lhs.textureId == i_rhs.textureId )
+			&& ( i_lhs.meshId == i_rhs.meshId );
+	}
+
+	// Returns the keys in sorted order
+	std::vector<Graphics::RenderSorting::sDrawKey> CreateSortedKeys( const std::vector<sDraw>& i_draws )
+	{
+		std::vector<Graphics::RenderSorting::sDrawKey> keys( i_draws.size() ), scratch( i_draws.size() );
+		for ( size_t i = 0; i < i_draws.size(); ++i )
+		{
+			const auto& draw = i_draws[i];
+			keys[i].value = Graphics::RenderSorting::CreateKey( draw.pass, draw.effectId, draw.textureId, draw.meshId, draw.cameraSpaceZ );
+			keys[i].drawIndex = static_cast<uint32_t>( i );
+		}
+		Graphics::RenderSorting::RadixSort( keys.data(), scratch.data(), keys.size() );
+		return keys;
+	}
+
+	// Returns the length of every run in the sorted keys
+	// (the same way that the renderer walks them to make instanced draw calls)
+	std::vector<size_t> GetRunLengths( const std::vector<Graphics::RenderSorting::sDrawKey>& i_keys )
+	{
+		std::vector<size_t> runLengths;
+		for ( size_t i = 0; i < i_keys.size(); )
+		{
+			const auto runLength = Graphics::RenderSorting::GetInstanceRunLength( &i_keys[i], i_keys.size() - i );
+			if ( runLength == 0 )
+			{
+				break;
+			}
+			runLengths.push_back( runLength );
+			i += runLength;
+		}
+		return runLengths;
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( RenderSorting_GetInstanceRunLength_IsZeroWithNoKeys )
+{
+	EAE6320_TEST_CHECK( Graphics::RenderSorting::GetInstanceRunLength( nullptr, 0 ) == 0 );
+}
+
+EAE6320_TEST( RenderSorting_GetInstanceRunLength_GroupsOpaqueDrawsByStateAtAnyDepth )
+{
+	// The draws are submitted interleaved and far apart in depth
+	const std::vector<sDraw> draws =
+	{
+		{ ePass::Opaque, 0, 0, 0, -50.0f },
+		{ ePass::Opaque, 0, 0, 1, -1.0f },
+		{ ePass::Opaque, 0, 0, 0, -2.0f },
+		{ ePass::Opaque, 1, 0, 0, -3.0f },
+		{ ePass::Opaque, 0, 0, 1, -80.0f },
+		{ ePass::Opaque, 0, 0, 0, -20.0f },
+		{ ePass::Opaque, 0, 1, 0, -4.0f },
+	};
+	const auto keys = CreateSortedKeys( draws );
+	const auto runLengths = GetRunLengths( keys );
+	// Effect 0/texture 0/mesh 0 (3), mesh 1 (2), texture 1 (1), effect 1 (1)
+	const std::vector<size_t> expectedRunLengths = { 3, 2, 1, 1 };
+	EAE6320_TEST_CHECKF( runLengths == expectedRunLengths, "The opaque draws were grouped into %u runs instead of %u",
+		static_cast<unsigned int>( runLengths.size() ), static_cast<unsigned int>( expectedRunLengths.size() ) );
+	// Each run is drawn front-to-back
+	EAE6320_TEST_CHECK( ( draws[keys[0].drawIndex].cameraSpaceZ == -2.0f ) && ( draws[keys[1].drawIndex].cameraSpaceZ == -20.0f )
+		&& ( draws[keys[2].drawIndex].cameraSpaceZ == -50.0f ) );
+}
+
+EAE6320_TEST( RenderSorting_GetInstanceRunLength_OnlyGroupsTranslucentDrawsThatAreNextToEachOtherInDepth )
+{
+	// A translucent draw must never be moved past another one at a different depth,
+	// and so two draws with the same state only share a run if nothing is between them
+	const std::vector<sDraw> draws =
+	{
+		{ ePass::Translucent, 0, 0, 0, -10.0f },
+		{ ePass::Translucent, 0, 0, 1, -20.0f },
+		{ ePass::Translucent, 0, 0, 0, -30.0f },
+		{ ePass::Translucent, 0, 0, 0, -40.0f },
+		{ ePass::Translucent, 0, 0, 0, -50.0f },
+	};
+	const auto keys = CreateSortedKeys( draws );
+	const auto runLengths = GetRunLengths( keys );
+	// Back-to-front: -50, -40, -30 (one run), -20 (mesh 1), -10
+	const std::vector<size_t> expectedRunLengths = { 3, 1, 1 };
+	EAE6320_TEST_CHECKF( runLengths == expectedRunLengths, "The translucent draws were grouped into %u runs instead of %u",
+		static_cast<unsigned int>( runLengths.size() ), static_cast<unsigned int>( expectedRunLengths.size() ) );
+	for ( size_t i = 1; i < keys.size(); ++i )
+	{
+		EAE6320_TEST_CHECK( draws[keys[i - 1].drawIndex].cameraSpaceZ < draws[keys[i].drawIndex].cameraSpaceZ );
+	}
+}
+
+EAE6320_TEST( RenderSorting_GetInstanceRunLength_NeverGroupsAcrossPasses )
+{
+	// The last opaque key and the first translucent key have the same resources
+	const std::vector<sDraw> draws =
+	{
+		{ ePass::Translucent, 3, 2, 1, -10.0f },
+		{ ePass::Opaque, 3, 2, 1, -10.0f },
+		{ ePass::Opaque, 3, 2, 1, -5.0f },
+	};
+	const auto keys = CreateSortedKeys( draws );
+	const auto runLengths = GetRunLengths( keys );
+	const std::vector<size_t> expectedRunLengths = { 2, 1 };
+	EAE6320_TEST_CHECK( runLengths == expectedRunLengths );
+	EAE6320_TEST_CHECK( draws[keys[2].drawIndex].pass == ePass::Translucent );
+}
+
+EAE6320_TEST( RenderSorting_GetInstanceRunLength_FindsEveryLongestRun )
+{
+	// Many random draws with only a few resources so that there are long runs in both passes
+	std::mt19937 randomNumberGenerator( 0 );
+	std::uniform_int_distribution<int> distribution_id( 0, 2 );
+	std::uniform_int_distribution<int> distribution_isTranslucent( 0, 3 );
+	std::uniform_real_distribution<float> distribution_z( -100.0f, -0.5f );
+	std::vector<sDraw> draws( 5000 );
+	for ( auto& draw : draws )
+	{
+		draw.pass = ( distribution_isTranslucent( randomNumberGenerator ) == 0 ) ? ePass::Translucent : ePass::Opaque;
+		draw.effectId = static_cast<uint16_t>( distribution_id( randomNumberGenerator ) );
+		draw.textureId = static_cast<uint16_t>( distribution_id( randomNumberGenerator ) );
+		draw.meshId = static_cast<uint16_t>( distribution_id( randomNumberGenerator ) );
+		// Translucent draws are often at exactly the same depth as each other (e.g. particles in a plane)
+		draw.cameraSpaceZ = ( draw.pass == ePass::Translucent ) ? -static_cast<float>( distribution_id( randomNumberGenerator ) + 1 )
+			: distribution_z( randomNumberGenerator );
+	}
+	const auto keys = CreateSortedKeys( draws );
+	const auto runLengths = GetRunLengths( keys );
+
+	size_t firstKey = 0;
+	size_t opaqueRunCount = 0;
+	for ( const auto runLength : runLengths )
+	{
+		const auto& firstDraw = draws[keys[firstKey].drawIndex];
+		// Every draw in a run has the same state
+		for ( size_t i = firstKey + 1; i < ( firstKey + runLength ); ++i )
+		{
+			if ( !EAE6320_TEST_CHECKF( HaveSameState( firstDraw, draws[keys[i].drawIndex] ), "The draw at %u doesn't match its run",
+				static_cast<unsigned int>( i ) ) )
+			{
+				return;
+			}
+		}
+		firstKey += runLength;
+		// A run only ends when the next draw has a different state
+		if ( firstKey < keys.size() )
+		{
+			if ( !EAE6320_TEST_CHECKF( !HaveSameState( firstDraw, draws[keys[firstKey].drawIndex] ), "The run ending at %u could have been longer",
+				static_cast<unsigned int>( firstKey ) ) )
+			{
+				return;
+			}
+		}
+		if ( firstDraw.pass == ePass::Opaque )
+		{
+			++opaqueRunCount;
+		}
+	}
+	EAE6320_TEST_CHECK( firstKey == keys.size() );
+	// Opaque draws are only grouped by state, and so there is a single run for every combination of resources
+	EAE6320_TEST_CHECKF( opaqueRunCount == ( 3 * 3 * 3 ), "There were %u opaque runs", static_cast<unsigned int>( opaqueRunCount ) );
+}
@@ -0,0 +1,118 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <cstdint>
+#include <Engine/Graphics/cFrameArena.h>
+#include <limits>
+
+// Tests
+//======
+
+EAE6320_TEST( cFrameArray_PushBack_KeepsEveryElementWhenItGrows )
+{
+	eae6320::Graphics::cFrameArena arena;
+	if ( !EAE6320_TEST_CHECK( arena.Initialize( 256 ) ) )
+	{
+		return;
+	}
+	eae6320::Graphics::cFrameArray<uint64_t> elements;
+	elements.SetArena( arena );
+	// This is more than the arena's main block can hold, and so the array also grows into overflow blocks
+	constexpr uint64_t elementCount = 10000;
+	for ( uint64_t i = 0; i < elementCount; ++i )
+	{
+		if ( !EAE6320_TEST_CHECK( elements.push_back( i ) ) )
+		{
+			return;
+		}
+	}
+	EAE6320_TEST_CHECK( elements.size() == elementCount );
+	for ( uint64_t i = 0; i < elementCount; ++i )
+	{
+		if ( !EAE6320_TEST_CHECKF( elements[i] == i, "Element %llu is %llu", static_cast<unsigned long long>( i ),
+			static_cast<unsigned long long>( elements[i] ) ) )
+		{
+			return;
+		}
+	}
+	elements.clear();
+	arena.Reset();
+}
+
+EAE6320_TEST( cFrameArena_Reset_StopsAllocatingFromTheHeapOnceFramesStopGrowing )
+{
+	eae6320::Graphics::cFrameArena arena;
+	if ( !EAE6320_TEST_CHECK( arena.Initialize( 1024 ) ) )
+	{
+		return;
+	}
+	const auto simulateFrame = [&arena]()
+	{
+		eae6320::Graphics::cFrameArray<float> elements;
+		elements.SetArena( arena );
+		for ( unsigned int i = 0; i < 20000; ++i )
+		{
+			elements.push_back( static_cast<float>( i ) );
+		}
+		// Some memory is also allocated directly with a different alignment
+		arena.Allocate( 3000, 64 );
+		elements.clear();
+		arena.Reset();
+	};
+	// The first frame overflows the initial block, and the reset replaces it with one that is big enough
+	simulateFrame();
+	const auto heapAllocationCount = arena.GetHeapAllocationCount();
+	EAE6320_TEST_CHECK( arena.GetCapacity() > 1024 );
+	for ( unsigned int i = 0; i < 10; ++i )
+	{
+		simulateFrame();
+	}
+	EAE6320_TEST_CHECKF( arena.GetHeapAllocationCount() == heapAllocationCount, "The arena allocated from the heap %llu times in the later frames",
+		static_cast<unsigned long long>( arena.GetHeapAllocationCount() - heapAllocationCount ) );
+}
+
+// These tests cause an allocation to fail,
+// which is reported by an assert when asserts are enabled
+#ifndef EAE6320_ASSERTS_AREENABLED
+
+EAE6320_TEST( cFrameArray_Grow_KeepsItsElementsWhenTheArenaIsOutOfMemory )
+{
+	eae6320::Graphics::cFrameArena arena;
+	if ( !EAE6320_TEST_CHECK( arena.Initialize( 1024 ) ) )
+	{
+		return;
+	}
+	eae6320::Graphics::cFrameArray<uint64_t> elements;
+	elements.SetArena( arena );
+	constexpr uint64_t elementCount = 100;
+	for ( uint64_t i = 0; i < elementCount; ++i )
+	{
+		elements.push_back( i );
+	}
+	const auto* const elements_beforeFailure = elements.data();
+
+	// No heap can provide this much memory
+	// (one of these is too big for an arena to even try, and the other is a request that the heap will fail)
+	EAE6320_TEST_CHECK( !elements.resize( std::numeric_limits<size_t>::max() ) );
+	EAE6320_TEST_CHECK( !elements.resize( std::numeric_limits<size_t>::max() / sizeof( uint64_t ) ) );
+	EAE6320_TEST_CHECK( !elements.resize( ( size_t( 1 ) << ( sizeof( size_t ) * 8 - 4 ) ) / sizeof( uint64_t ) ) );
+
+	// The array still has its original storage and elements
+	EAE6320_TEST_CHECK( elements.data() == elements_beforeFailure );
+	if ( EAE6320_TEST_CHECK( elements.size() == elementCount ) )
+	{
+		for ( uint64_t i = 0; i < elementCount; ++i )
+		{
+			EAE6320_TEST_CHECK( elements[i] == i );
+		}
+	}
+	// and it can still be used
+	EAE6320_TEST_CHECK( elements.push_back( elementCount ) );
+	EAE6320_TEST_CHECK( ( elements.size() == ( elementCount + 1 ) ) && ( elements[elementCount] == elementCount ) );
+	elements.clear();
+	arena.Reset();
+}
+
+#endif	// EAE6320_ASSERTS_AREENABLED
@@ -0,0 +1,388 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Constants.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <initializer_list>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// The batched functions must calculate results that are identical to the bit to the single-object functions
+	// (see BatchTransforms.h).
+	// Every count up to this is tested so that the SIMD loops (four objects at a time)
+	// are tested with every number of objects left over
+	constexpr size_t s_maximumCount = 9;
+
+	struct sQuaternions
+	{
+		std::vector<float> w, x, y, z;
+
+		explicit sQuaternions( const size_t i_count ) : w( i_count ), x( i_count ), y( i_count ), z( i_count ) {}
+		explicit sQuaternions( const std::vector<Math::cQuaternion>& i_quaternions ) : sQuaternions( i_quaternions.size() )
+		{
+			Math::BatchTransforms::CopyToSpans( i_quaternions.data(), i_quaternions.size(), GetSpans() );
+		}
+
+		Math::BatchTransforms::sQuaternionSpans GetSpans()
+		{
+			Math::BatchTransforms::sQuaternionSpans spans;
+			spans.w = w.data();
+			spans.x = x.data();
+			spans.y = y.data();
+			spans.z = z.data();
+			return spans;
+		}
+		Math::BatchTransforms::sConstQuaternionSpans GetConstSpans() const { return { w.data(), x.data(), y.data(), z.data() }; }
+		Math::cQuaternion Get( const size_t i_index ) const
+		{
+			Math::cQuaternion quaternion;
+			Math::BatchTransforms::CopyFromSpans( { &w[i_index], &x[i_index], &y[i_index], &z[i_index] }, 1, &quaternion );
+			return quaternion;
+		}
+	};
+
+	struct sVectors
+	{
+		std::vector<float> x, y, z;
+
+		explicit sVectors( const size_t i_count ) : x( i_count ), y( i_count ), z( i_count ) {}
+
+		Math::BatchTransforms::sVectorSpans GetSpans()
+		{
+			Math::BatchTransforms::sVectorSpans spans;
+			spans.x = x.data();
+			spans.y = y.data();
+			spans.z = z.data();
+			return spans;
+		}
+		Math::BatchTransforms::sConstVectorSpans GetConstSpans() const { return { x.data(), y.data(), z.data() }; }
+		Math::sVector Get( const size_t i_index ) const { return Math::sVector( x[i_index], y[i_index], z[i_index] ); }
+	};
+
+	bool AreIdentical( const Math::cQuaternion& i_lhs, const Math::cQuaternion& i_rhs )
+	{
+		return std::memcmp( &i_lhs, &i_rhs, sizeof( i_lhs ) ) == 0;
+	}
+	bool AreIdentical( const Math::cMatrix_transformation& i_lhs, const Math::cMatrix_transformation& i_rhs )
+	{
+		return std::memcmp( &i_lhs, &i_rhs, sizeof( i_lhs ) ) == 0;
+	}
+	bool AreIdentical( const Math::sVector& i_lhs, const Math::sVector& i_rhs )
+	{
+		return std::memcmp( &i_lhs, &i_rhs, sizeof( i_lhs ) ) == 0;
+	}
+
+	// The elements are column-major (the same as the matrix's storage)
+	// so that the tests can create matrices that the class's interface can't (e.g. with a non-uniform scale)
+	Math::cMatrix_transformation CreateMatrix( const float ( &i_elements )[16] )
+	{
+		static_assert( std::is_trivially_copyable<Math::cMatrix_transformation>::value, "A matrix can't be copied from floats" );
+		static_assert( sizeof( Math::cMatrix_transformation ) == sizeof( i_elements ), "A matrix isn't 16 floats" );
+		Math::cMatrix_transformation matrix;
+		std::memcpy( &matrix, i_elements, sizeof( matrix ) );
+		return matrix;
+	}
+
+	void CreateRotationsAndTranslations( const size_t i_count, const unsigned int i_seed,
+		std::vector<Math::cQuaternion>& o_rotations, sVectors& o_translations )
+	{
+		std::mt19937 randomNumberGenerator( i_seed );
+		std::uniform_real_distribution<float> distribution( -10.0f, 10.0f );
+		o_rotations.clear();
+		o_translations = sVectors( i_count );
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			o_rotations.emplace_back( distribution( randomNumberGenerator ),
+				Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ), 20.0f ).GetNormalized() );
+			o_translations.x[i] = distribution( randomNumberGenerator );
+			o_translations.y[i] = distribution( randomNumberGenerator );
+			o_translations.z[i] = distribution( randomNumberGenerator );
+		}
+	}
+
+	// The bottom row of an affine matrix is [0, 0, 0, 1]
+	// and the other elements have magnitudes within many orders of magnitude
+	// (so that any difference in the order of the operations would change how the results are rounded)
+	Math::cMatrix_transformation CreateRandomMatrix( std::mt19937& io_randomNumberGenerator, const bool i_isAffine )
+	{
+		std::uniform_real_distribution<float> distribution_exponent( -6.0f, 6.0f );
+		std::uniform_int_distribution<int> distribution_sign( 0, 1 );
+		float elements[16];
+		for ( unsigned int i = 0; i < 16; ++i )
+		{
+			if ( i_isAffine && ( ( i % 4 ) == 3 ) )
+			{
+				elements[i] = ( i == 15 ) ? 1.0f : 0.0f;
+			}
+			else
+			{
+				const auto magnitude = std::pow( 10.0f, distribution_exponent( io_randomNumberGenerator ) );
+				elements[i] = ( distribution_sign( io_randomNumberGenerator ) == 0 ) ? magnitude : -magnitude;
+			}
+		}
+		return CreateMatrix( elements );
+	}
+
+	// The pairs of rotations are a mix of the cases that each take a different path
+	// (rotations that are far apart, rotations that are nearly the same and are interpolated with Nlerp(),
+	// and rotations with negative dot products),
+	// and so the four objects in a SIMD group don't all take the same path
+	void CreateRotationPairs( const size_t i_count, const unsigned int i_seed,
+		std::vector<Math::cQuaternion>& o_from, std::vector<Math::cQuaternion>& o_to, std::vector<float>& o_ts )
+	{
+		std::mt19937 randomNumberGenerator( i_seed );
+		std::uniform_real_distribution<float> distribution_angle( -2.0f * Math::Pi, 2.0f * Math::Pi );
+		std::uniform_real_distribution<float> distribution_angle_small( -0.05f, 0.05f );
+		std::uniform_real_distribution<float> distribution_axis( -1.0f, 1.0f );
+		std::uniform_real_distribution<float> distribution_t( 0.0f, 1.0f );
+		const auto createAxis = [&]()
+		{
+			return Math::sVector( distribution_axis( randomNumberGenerator ), distribution_axis( randomNumberGenerator ),
+				0.5f + distribution_axis( randomNumberGenerator ) ).GetNormalized();
+		};
+		o_from.clear();
+		o_to.clear();
+		o_ts.clear();
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			const Math::cQuaternion from( distribution_angle( randomNumberGenerator ), createAxis() );
+			const auto isNearlyTheSame = ( ( i % 3 ) == 1 );
+			const auto to = isNearlyTheSame ? ( from * Math::cQuaternion( distribution_angle_small( randomNumberGenerator ), createAxis() ) )
+				: Math::cQuaternion( distribution_angle( randomNumberGenerator ), createAxis() );
+			o_from.push_back( from );
+			o_to.push_back( to );
+			o_ts.push_back( distribution_t( randomNumberGenerator ) );
+		}
+	}
+
+	template<typename tBatchedFunction, typename tSingleFunction>
+		bool DoInterpolationsMatch( const tBatchedFunction& i_batchedFunction, const tSingleFunction& i_singleFunction, const char* const i_functionName )
+	{
+		std::vector<Math::cQuaternion> from, to;
+		std::vector<float> ts;
+		for ( size_t count = 0; count <= s_maximumCount; ++count )
+		{
+			CreateRotationPairs( count, static_cast<unsigned int>( count ), from, to, ts );
+			const sQuaternions from_spans( from ), to_spans( to );
+			sQuaternions results( count );
+			i_batchedFunction( from_spans.GetConstSpans(), to_spans.GetConstSpans(), ts.data(), count, results.GetSpans() );
+			// The output may be the same as either input
+			auto results_inPlace_from = from_spans;
+			i_batchedFunction( results_inPlace_from.GetConstSpans(), to_spans.GetConstSpans(), ts.data(), count, results_inPlace_from.GetSpans() );
+			auto results_inPlace_to = to_spans;
+			i_batchedFunction( from_spans.GetConstSpans(), results_inPlace_to.GetConstSpans(), ts.data(), count, results_inPlace_to.GetSpans() );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				const auto expected = i_singleFunction( from[i], to[i], ts[i] );
+				if ( !EAE6320_TEST_CHECKF( AreIdentical( results.Get( i ), expected )
+					&& AreIdentical( results_inPlace_from.Get( i ), expected ) && AreIdentical( results_inPlace_to.Get( i ), expected ),
+					"The batched %s of object %zu of %zu is different from the single-object result", i_functionName, i, count ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( BatchTransforms_Nlerp_MatchesTheSingleObjectFunction )
+{
+	DoInterpolationsMatch( Math::BatchTransforms::Nlerp, Math::cQuaternion::Nlerp, "Nlerp()" );
+}
+
+EAE6320_TEST( BatchTransforms_Slerp_MatchesTheSingleObjectFunction )
+{
+	DoInterpolationsMatch( Math::BatchTransforms::Slerp, Math::cQuaternion::Slerp, "Slerp()" );
+}
+
+EAE6320_TEST( BatchTransforms_CreateTransforms_MatchesTheSingleObjectFunction )
+{
+	std::vector<Math::cQuaternion> rotations;
+	sVectors translations( 0 );
+	for ( size_t count = 0; count <= s_maximumCount; ++count )
+	{
+		CreateRotationsAndTranslations( count, static_cast<unsigned int>( count ), rotations, translations );
+		const sQuaternions rotations_spans( rotations );
+		std::vector<Math::cMatrix_transformation> transforms( count );
+		Math::BatchTransforms::CreateTransforms( rotations_spans.GetConstSpans(), translations.GetConstSpans(), count, transforms.data() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			if ( !EAE6320_TEST_CHECKF( AreIdentical( transforms[i], Math::cMatrix_transformation( rotations[i], translations.Get( i ) ) ),
+				"The batched transform of object %zu of %zu is different from the single-object result", i, count ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( BatchTransforms_CreateTransforms_3x4_MatchesTheTopRowsOfCreateTransforms )
+{
+	std::vector<Math::cQuaternion> rotations;
+	sVectors translations( 0 );
+	for ( size_t count = 0; count <= s_maximumCount; ++count )
+	{
+		CreateRotationsAndTranslations( count, static_cast<unsigned int>( count ), rotations, translations );
+		const sQuaternions rotations_spans( rotations );
+		std::vector<Math::cMatrix_transformation> transforms( count );
+		Math::BatchTransforms::CreateTransforms( rotations_spans.GetConstSpans(), translations.GetConstSpans(), count, transforms.data() );
+		std::vector<float> transforms_3x4( count * 12 );
+		Math::BatchTransforms::CreateTransforms_3x4( rotations_spans.GetConstSpans(), translations.GetConstSpans(), count, transforms_3x4.data() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			for ( unsigned int r = 0; r < 3; ++r )
+			{
+				for ( unsigned int c = 0; c < 4; ++c )
+				{
+					const auto element = transforms_3x4[( i * 12 ) + ( r * 4 ) + c];
+					const auto expected = transforms[i].GetElement( r, c );
+					if ( !EAE6320_TEST_CHECKF( std::memcmp( &element, &expected, sizeof( element ) ) == 0,
+						"Element [%u][%u] of object %zu of %zu is %.9g instead of %.9g", r, c, i, count, element, expected ) )
+					{
+						return;
+					}
+				}
+			}
+		}
+	}
+}
+
+EAE6320_TEST( BatchTransforms_TransformPoints_MatchesTheSingleObjectFunction )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	std::uniform_real_distribution<float> distribution( -100.0f, 100.0f );
+	// An affine transform, a projection, and a matrix with no special structure
+	const Math::cMatrix_transformation transforms[] =
+	{
+		Math::cMatrix_transformation( Math::cQuaternion( 0.7f, Math::sVector( 1.0f, 2.0f, -3.0f ).GetNormalized() ), Math::sVector( 5.0f, -6.0f, 7.0f ) ),
+		Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective( 1.0f, 1.5f, 0.1f, 1000.0f ),
+		CreateRandomMatrix( randomNumberGenerator, false ),
+	};
+	for ( const auto& transform : transforms )
+	{
+		for ( size_t count = 0; count <= s_maximumCount; ++count )
+		{
+			sVectors points( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				points.x[i] = distribution( randomNumberGenerator );
+				points.y[i] = distribution( randomNumberGenerator );
+				points.z[i] = distribution( randomNumberGenerator );
+			}
+			sVectors results( count );
+			Math::BatchTransforms::TransformPoints( transform, points.GetConstSpans(), count, results.GetSpans() );
+			// The output may be the same as the input
+			auto results_inPlace = points;
+			Math::BatchTransforms::TransformPoints( transform, results_inPlace.GetConstSpans(), count, results_inPlace.GetSpans() );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				const auto expected = transform * points.Get( i );
+				if ( !EAE6320_TEST_CHECKF( AreIdentical( results.Get( i ), expected ) && AreIdentical( results_inPlace.Get( i ), expected ),
+					"The batched transformed point %zu of %zu is different from the single-object result", i, count ) )
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+EAE6320_TEST( BatchTransforms_ConcatenateAffine_MatchesTheSingleObjectFunction )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	std::vector<Math::cQuaternion> rotations;
+	sVectors translations( 0 );
+	for ( size_t count = 0; count <= s_maximumCount; ++count )
+	{
+		// Half of the first transforms are rotations and translations and half are random affine matrices
+		CreateRotationsAndTranslations( count, static_cast<unsigned int>( count ), rotations, translations );
+		std::vector<Math::cMatrix_transformation> firstTransforms;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			firstTransforms.push_back( ( ( i % 2 ) == 0 ) ? Math::cMatrix_transformation( rotations[i], translations.Get( i ) )
+				: CreateRandomMatrix( randomNumberGenerator, true ) );
+		}
+		const auto nextTransform = CreateRandomMatrix( randomNumberGenerator, true );
+		std::vector<Math::cMatrix_transformation> results( count );
+		Math::BatchTransforms::ConcatenateAffine( nextTransform, firstTransforms.data(), count, results.data() );
+		// The output may be the same as the input
+		auto results_inPlace = firstTransforms;
+		Math::BatchTransforms::ConcatenateAffine( nextTransform, results_inPlace.data(), count, results_inPlace.data() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			const auto expected = Math::cMatrix_transformation::ConcatenateAffine( nextTransform, firstTransforms[i] );
+			if ( !EAE6320_TEST_CHECKF( AreIdentical( results[i], expected ) && AreIdentical( results_inPlace[i], expected ),
+				"The batched concatenation of object %zu of %zu is different from the single-object result", i, count ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( BatchTransforms_CopyToSpans_CopiesEveryComponent )
+{
+	static_assert( std::is_trivially_copyable<Math::cQuaternion>::value, "A quaternion can't be copied to floats" );
+	static_assert( sizeof( Math::cQuaternion ) == ( sizeof( float ) * 4 ), "A quaternion isn't 4 floats" );
+	constexpr float sentinel = -12345.0f;
+	std::vector<Math::cQuaternion> rotations;
+	sVectors translations( 0 );
+	for ( size_t count = 0; count <= s_maximumCount; ++count )
+	{
+		CreateRotationsAndTranslations( count, static_cast<unsigned int>( count ), rotations, translations );
+		// The spans start one element into each array (because there are no alignment requirements)
+		// and have an extra element at the end that must not be written to
+		sQuaternions spans( count + 2 );
+		for ( auto* const components : { &spans.w, &spans.x, &spans.y, &spans.z } )
+		{
+			std::fill( components->begin(), components->end(), sentinel );
+		}
+		Math::BatchTransforms::sQuaternionSpans spans_offset = spans.GetSpans();
+		++spans_offset.w; ++spans_offset.x; ++spans_offset.y; ++spans_offset.z;
+		Math::BatchTransforms::CopyToSpans( rotations.data(), count, spans_offset );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			// The components are [w, x, y, z]
+			float expected[4];
+			std::memcpy( expected, &rotations[i], sizeof( expected ) );
+			const float components[] = { spans_offset.w[i], spans_offset.x[i], spans_offset.y[i], spans_offset.z[i] };
+			if ( !EAE6320_TEST_CHECKF( std::memcmp( components, expected, sizeof( components ) ) == 0,
+				"The copied components of object %zu of %zu are different from the quaternion's", i, count ) )
+			{
+				return;
+			}
+		}
+		EAE6320_TEST_CHECK( ( spans.w.front() == sentinel ) && ( spans.x.front() == sentinel ) && ( spans.y.front() == sentinel ) && ( spans.z.front() == sentinel ) );
+		EAE6320_TEST_CHECK( ( spans.w.back() == sentinel ) && ( spans.x.back() == sentinel ) && ( spans.y.back() == sentinel ) && ( spans.z.back() == sentinel ) );
+		// Copying back gives the same quaternions
+		std::vector<Math::cQuaternion> rotations_copied( count );
+		Math::BatchTransforms::CopyFromSpans( spans_offset, count, rotations_copied.data() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			if ( !EAE6320_TEST_CHECKF( AreIdentical( rotations_copied[i], rotations[i] ), "Quaternion %zu of %zu changed when it was copied to spans and back", i, count ) )
+			{
+				return;
+			}
+		}
+	}
+}
@@ -0,0 +1,215 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <Engine/Math/Constants.h>
+#include <Engine/Math/Functions.h>
+#include <initializer_list>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// This keeps the biggest error of a function and the input that caused it
+	// (so that a sweep across millions of inputs only reports one failure)
+	struct sMaximumError
+	{
+		double error = 0.0;
+		float input = 0.0f;
+
+		void Update( const double i_error, const float i_input )
+		{
+			// A NaN result counts as an error that is bigger than any bound
+			if ( !( i_error <= error ) )
+			{
+				error = std::isnan( i_error ) ? INFINITY : i_error;
+				input = i_input;
+			}
+		}
+		bool IsLessThan( const double i_bound, const char* const i_functionName ) const
+		{
+			return EAE6320_TEST_CHECKF( error < i_bound, "The error of %s is %g for %.9g (which isn't less than %g)", i_functionName, error, input, i_bound );
+		}
+	};
+
+	float CreateFloatFromBits( const uint32_t i_bits )
+	{
+		float value;
+		std::memcpy( &value, &i_bits, sizeof( value ) );
+		return value;
+	}
+	uint32_t GetBitsOfFloat( const float i_value )
+	{
+		uint32_t bits;
+		std::memcpy( &bits, &i_value, sizeof( bits ) );
+		return bits;
+	}
+
+	// Positive floats that are finite are ordered the same as their bits,
+	// and so every nth float can be swept by stepping through their bits
+	template<typename tFunction>
+		void SweepFloats( const float i_min, const float i_max, const uint32_t i_step, const tFunction& i_function )
+	{
+		const auto bits_max = GetBitsOfFloat( i_max );
+		for ( auto bits = GetBitsOfFloat( i_min ); bits <= bits_max; bits += i_step )
+		{
+			i_function( CreateFloatFromBits( bits ) );
+			if ( ( bits_max - bits ) < i_step )
+			{
+				break;
+			}
+		}
+		i_function( i_max );
+	}
+
+	// Reciprocal Square Root
+	//-----------------------
+
+	// This is the documented bound in Functions.h
+	constexpr double s_maximumRelativeError_reciprocalSqrt = 3.0e-7;
+
+	void UpdateReciprocalSqrtError( const float i_value, sMaximumError& io_maximumError )
+	{
+		const auto expected = 1.0 / std::sqrt( static_cast<double>( i_value ) );
+		io_maximumError.Update( std::abs( Math::ReciprocalSqrt_fast( i_value ) - expected ) / expected, i_value );
+	}
+
+	// Sine and Cosine
+	//----------------
+
+	// These are the documented bounds in Functions.h
+	constexpr double s_maximumAbsoluteError_sinCos = 1.0e-7;
+	constexpr float s_maximumAngle_sinCos = 8192.0f;
+
+	// The single results must be the same as the results that are calculated together
+	bool UpdateSinCosError( const float i_angle, sMaximumError& io_maximumError )
+	{
+		float sin, cos;
+		Math::SinCos_fast( i_angle, sin, cos );
+		const auto angle = static_cast<double>( i_angle );
+		io_maximumError.Update( std::abs( sin - std::sin( angle ) ), i_angle );
+		io_maximumError.Update( std::abs( cos - std::cos( angle ) ), i_angle );
+		if ( ( Math::Sin_fast( i_angle ) != sin ) || ( Math::Cos_fast( i_angle ) != cos ) )
+		{
+			return EAE6320_TEST_CHECKF( false, "Sin_fast() or Cos_fast() is different from SinCos_fast() for %.9g", i_angle );
+		}
+		return true;
+	}
+
+	// Arc Cosine
+	//-----------
+
+	// This is the documented bound in Functions.h
+	constexpr double s_maximumAbsoluteError_acos = 5.0e-7;
+
+	void UpdateAcosError( const float i_value, sMaximumError& io_maximumError )
+	{
+		io_maximumError.Update( std::abs( Math::Acos_fast( i_value ) - std::acos( static_cast<double>( i_value ) ) ), i_value );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( Functions_ReciprocalSqrt_fast_IsWithinTheDocumentedBound )
+{
+	sMaximumError maximumError;
+	const auto updateError = [&maximumError]( const float i_value ) { UpdateReciprocalSqrtError( i_value, maximumError ); };
+	// Every thousandth float across the entire positive finite range
+	SweepFloats( CreateFloatFromBits( 1 ), FLT_MAX, 1021, updateError );
+	// Every float from 1 to 4
+	// (the estimate depends on the mantissa and whether the exponent is odd or even, and so this covers every estimate)
+	SweepFloats( 1.0f, 4.0f, 1, updateError );
+	// Every float near the boundaries of the range
+	SweepFloats( CreateFloatFromBits( 1 ), CreateFloatFromBits( 1 << 16 ), 1, updateError );
+	SweepFloats( CreateFloatFromBits( GetBitsOfFloat( FLT_MIN ) - ( 1 << 16 ) ), CreateFloatFromBits( GetBitsOfFloat( FLT_MIN ) + ( 1 << 16 ) ), 1, updateError );
+	SweepFloats( CreateFloatFromBits( GetBitsOfFloat( FLT_MAX ) - ( 1 << 16 ) ), FLT_MAX, 1, updateError );
+	maximumError.IsLessThan( s_maximumRelativeError_reciprocalSqrt, "ReciprocalSqrt_fast()" );
+}
+
+EAE6320_TEST( Functions_ReciprocalSqrt_fast_WorksForDenormalValues )
+{
+	// The smallest denormal, the biggest denormal, and the smallest normal value
+	for ( const auto value : { CreateFloatFromBits( 1 ), CreateFloatFromBits( 0x007fffff ), FLT_MIN } )
+	{
+		const auto result = Math::ReciprocalSqrt_fast( value );
+		const auto expected = 1.0 / std::sqrt( static_cast<double>( value ) );
+		EAE6320_TEST_CHECKF( std::isfinite( result ) && ( ( std::abs( result - expected ) / expected ) < s_maximumRelativeError_reciprocalSqrt ),
+			"The reciprocal square root of %g is %g instead of %g", value, result, expected );
+	}
+}
+
+EAE6320_TEST( Functions_SinCos_fast_IsWithinTheDocumentedBound )
+{
+	sMaximumError maximumError;
+	bool areSingleResultsTheSame = true;
+	const auto updateError = [&maximumError, &areSingleResultsTheSame]( const float i_angle )
+	{
+		if ( areSingleResultsTheSame )
+		{
+			areSingleResultsTheSame = UpdateSinCosError( i_angle, maximumError ) && UpdateSinCosError( -i_angle, maximumError );
+		}
+	};
+	// Every thousandth float across the valid range
+	SweepFloats( 0.0f, s_maximumAngle_sinCos, 1021, updateError );
+	// Evenly-spaced angles across the valid range
+	{
+		constexpr int angleCount = 1 << 20;
+		for ( int i = 0; i <= angleCount; ++i )
+		{
+			updateError( s_maximumAngle_sinCos * ( static_cast<float>( i ) / static_cast<float>( angleCount ) ) );
+		}
+	}
+	// Every 31st float in the first turn
+	// (where the error comes from the polynomials rather than the angle reduction)
+	SweepFloats( 1.0f, Math::Pi * 2.0f, 31, updateError );
+	// Every float near the biggest valid angle
+	SweepFloats( s_maximumAngle_sinCos - 64.0f, s_maximumAngle_sinCos, 1, updateError );
+	// The closest floats to multiples of pi/2
+	// (where the reduced angle is the smallest and so the angle reduction loses the most precision)
+	for ( int i = 0; i < 5215; ++i )
+	{
+		const auto angle = static_cast<float>( i * ( 3.14159265358979323846 * 0.5 ) );
+		for ( const auto angle_neighbor : { std::nextafter( angle, 0.0f ), angle, std::nextafter( angle, INFINITY ) } )
+		{
+			if ( angle_neighbor <= s_maximumAngle_sinCos )
+			{
+				updateError( angle_neighbor );
+			}
+		}
+	}
+	maximumError.IsLessThan( s_maximumAbsoluteError_sinCos, "SinCos_fast()" );
+}
+
+EAE6320_TEST( Functions_Acos_fast_IsWithinTheDocumentedBound )
+{
+	sMaximumError maximumError;
+	const auto updateError = [&maximumError]( const float i_value )
+	{
+		UpdateAcosError( i_value, maximumError );
+		UpdateAcosError( -i_value, maximumError );
+	};
+	// Every thousandth float across the valid range
+	SweepFloats( 0.0f, 1.0f, 1021, updateError );
+	// Every float near 1
+	// (where the slope is the steepest)
+	SweepFloats( 0.999f, 1.0f, 1, updateError );
+	// Every float near 0.5
+	// (where the error is the biggest)
+	SweepFloats( 0.45f, 0.5f, 1, updateError );
+	maximumError.IsLessThan( s_maximumAbsoluteError_acos, "Acos_fast()" );
+}
+
+EAE6320_TEST( Functions_Acos_fast_IsExactAtTheEndsOfTheRange )
+{
+	EAE6320_TEST_CHECKF( Math::Acos_fast( 1.0f ) == 0.0f, "The arc cosine of 1 is %g", Math::Acos_fast( 1.0f ) );
+	EAE6320_TEST_CHECKF( Math::Acos_fast( -1.0f ) == Math::Pi, "The arc cosine of -1 is %.9g instead of %.9g", Math::Acos_fast( -1.0f ), Math::Pi );
+}
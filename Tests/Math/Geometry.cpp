@@ -0,0 +1,328 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <cmath>
+#include <cstring>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Constants.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/Geometry.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// The batched tests must calculate the same results as the single tests
+	// (see Geometry.h).
+	// Every count up to 9 is tested so that the SIMD loops (four shapes at a time)
+	// are tested with every number of shapes left over,
+	// and then a count that is big enough to have every kind of shape in every position of a group
+	constexpr size_t s_counts[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4000 };
+
+	struct sVectors
+	{
+		std::vector<float> x, y, z;
+
+		size_t GetCount() const { return x.size(); }
+		Math::sVector Get( const size_t i_index ) const { return Math::sVector( x[i_index], y[i_index], z[i_index] ); }
+		Math::BatchTransforms::sConstVectorSpans GetSpans() const { return { x.data(), y.data(), z.data() }; }
+
+		void Add( const Math::sVector& i_vector ) { x.push_back( i_vector.x ); y.push_back( i_vector.y ); z.push_back( i_vector.z ); }
+	};
+
+	// The camera is at ( 1, 2, 3 ) and turned a little to the left
+	// (so that the frustum's planes aren't aligned with the axes)
+	constexpr float s_verticalFieldOfView = 1.0f;
+	constexpr float s_aspectRatio = 1.5f;
+	constexpr float s_z_nearPlane = 0.5f;
+	constexpr float s_z_farPlane = 100.0f;
+	const Math::cQuaternion s_cameraOrientation( 0.4f, Math::sVector( 0.0f, 1.0f, 0.0f ) );
+	const Math::sVector s_cameraPosition( 1.0f, 2.0f, 3.0f );
+
+	Math::sFrustum CreateFrustum_world()
+	{
+		const auto transform_cameraToProjected = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
+			s_verticalFieldOfView, s_aspectRatio, s_z_nearPlane, s_z_farPlane );
+		const auto transform_worldToCamera = Math::cMatrix_transformation::CreateWorldToCameraTransform( s_cameraOrientation, s_cameraPosition );
+		return Math::sFrustum::CreateFromTransform( transform_cameraToProjected * transform_worldToCamera );
+	}
+
+	// This converts a position relative to the camera
+	// (as a distance in front of the camera and the fractions of the way from the center of the view to its edges)
+	// into world space
+	Math::sVector CreatePoint_world( const float i_distance, const float i_fraction_horizontal, const float i_fraction_vertical )
+	{
+		const auto tan_halfVerticalFieldOfView = std::tan( s_verticalFieldOfView * 0.5f );
+		// The camera looks down -Z
+		const Math::sVector position_camera( i_fraction_horizontal * i_distance * tan_halfVerticalFieldOfView * s_aspectRatio,
+			i_fraction_vertical * i_distance * tan_halfVerticalFieldOfView, -i_distance );
+		return Math::cMatrix_transformation( s_cameraOrientation, s_cameraPosition ) * position_camera;
+	}
+
+	bool IsPointInFrustum( const Math::sFrustum& i_frustum, const Math::sVector& i_point )
+	{
+		Math::sSphere sphere;
+		sphere.center = i_point;
+		return Math::IsOverlapping( i_frustum, sphere );
+	}
+
+	// The shapes are spread around the frustum so that some are inside, some are outside, and some cross its planes
+	void CreateRandomSpheres( const size_t i_count, std::mt19937& io_randomNumberGenerator, sVectors& o_centers, std::vector<float>& o_radii )
+	{
+		std::uniform_real_distribution<float> distribution_distance( -10.0f, 120.0f );
+		std::uniform_real_distribution<float> distribution_fraction( -1.5f, 1.5f );
+		std::uniform_real_distribution<float> distribution_radius( 0.0f, 5.0f );
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			o_centers.Add( CreatePoint_world( distribution_distance( io_randomNumberGenerator ), distribution_fraction( io_randomNumberGenerator ),
+				distribution_fraction( io_randomNumberGenerator ) ) );
+			o_radii.push_back( distribution_radius( io_randomNumberGenerator ) );
+		}
+	}
+	void CreateRandomBoxes( const size_t i_count, std::mt19937& io_randomNumberGenerator, sVectors& o_minimums, sVectors& o_maximums )
+	{
+		std::uniform_real_distribution<float> distribution_distance( -10.0f, 120.0f );
+		std::uniform_real_distribution<float> distribution_fraction( -1.5f, 1.5f );
+		std::uniform_real_distribution<float> distribution_size( 0.0f, 8.0f );
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			const auto minimum = CreatePoint_world( distribution_distance( io_randomNumberGenerator ), distribution_fraction( io_randomNumberGenerator ),
+				distribution_fraction( io_randomNumberGenerator ) );
+			o_minimums.Add( minimum );
+			o_maximums.Add( minimum + Math::sVector( distribution_size( io_randomNumberGenerator ), distribution_size( io_randomNumberGenerator ),
+				distribution_size( io_randomNumberGenerator ) ) );
+		}
+	}
+
+	// Rays
+	//-----
+
+	const Math::sAxisAlignedBox s_box{ Math::sVector( -1.0f, -2.0f, -3.0f ), Math::sVector( 2.0f, 1.0f, 0.5f ) };
+	constexpr float s_maximumRayDistance = 20.0f;
+
+	// The rays are a mix of rays that start outside of the box (and point in random directions, most of which miss),
+	// rays that start inside of the box, and rays that are parallel to one or two of the axes
+	// (including rays whose origin is exactly on a face of the box, which calculate zero times infinity)
+	void CreateRandomRays( const size_t i_count, std::mt19937& io_randomNumberGenerator, sVectors& o_origins, sVectors& o_directions )
+	{
+		std::uniform_real_distribution<float> distribution_origin( -6.0f, 6.0f );
+		std::uniform_real_distribution<float> distribution_direction( -1.0f, 1.0f );
+		std::uniform_int_distribution<int> distribution_case( 0, 5 );
+		std::uniform_int_distribution<int> distribution_axis( 0, 2 );
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			float origin[] = { distribution_origin( io_randomNumberGenerator ), distribution_origin( io_randomNumberGenerator ),
+				distribution_origin( io_randomNumberGenerator ) };
+			float direction[] = { distribution_direction( io_randomNumberGenerator ), distribution_direction( io_randomNumberGenerator ),
+				distribution_direction( io_randomNumberGenerator ) };
+			const float minimum[] = { s_box.minimum.x, s_box.minimum.y, s_box.minimum.z };
+			const float maximum[] = { s_box.maximum.x, s_box.maximum.y, s_box.maximum.z };
+			switch ( distribution_case( io_randomNumberGenerator ) )
+			{
+			case 0:
+				// The origin is inside of the box
+				for ( unsigned int a = 0; a < 3; ++a )
+				{
+					origin[a] = minimum[a] + ( ( maximum[a] - minimum[a] ) * ( ( distribution_direction( io_randomNumberGenerator ) * 0.5f ) + 0.5f ) );
+				}
+				break;
+			case 1:
+				// The ray is parallel to one axis
+				{
+					const auto axis = distribution_axis( io_randomNumberGenerator );
+					for ( int a = 0; a < 3; ++a )
+					{
+						if ( a != axis )
+						{
+							direction[a] = 0.0f;
+						}
+					}
+				}
+				break;
+			case 2:
+				// The ray is parallel to a plane
+				// (and the zero is sometimes negative, which makes the reciprocal negative infinity)
+				direction[distribution_axis( io_randomNumberGenerator )] = ( ( i % 2 ) == 0 ) ? 0.0f : -0.0f;
+				break;
+			case 3:
+				// The origin is exactly on a face of the box and the ray is parallel to that face
+				{
+					const auto axis = distribution_axis( io_randomNumberGenerator );
+					origin[axis] = ( ( i % 2 ) == 0 ) ? minimum[axis] : maximum[axis];
+					direction[axis] = 0.0f;
+				}
+				break;
+			default:
+				break;
+			}
+			o_origins.Add( Math::sVector( origin[0], origin[1], origin[2] ) );
+			o_directions.Add( Math::sVector( direction[0], direction[1], direction[2] ) );
+		}
+	}
+
+	float Raycast_single( const Math::sVector& i_origin, const Math::sVector& i_direction )
+	{
+		Math::sRay ray;
+		ray.origin = i_origin;
+		ray.direction = i_direction;
+		float hitDistance;
+		return Math::Raycast( ray, s_box, s_maximumRayDistance, hitDistance ) ? hitDistance : -1.0f;
+	}
+
+	bool AreIdentical( const float i_lhs, const float i_rhs )
+	{
+		return std::memcmp( &i_lhs, &i_rhs, sizeof( i_lhs ) ) == 0;
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( Geometry_TestOverlaps_Spheres_MatchesTheSingleShapeFunction )
+{
+	const auto frustum = CreateFrustum_world();
+	std::mt19937 randomNumberGenerator( 0 );
+	for ( const auto count : s_counts )
+	{
+		sVectors centers;
+		std::vector<float> radii;
+		CreateRandomSpheres( count, randomNumberGenerator, centers, radii );
+		std::unique_ptr<bool[]> areOverlapping( new bool[count] );
+		Math::TestOverlaps( frustum, centers.GetSpans(), radii.data(), count, areOverlapping.get() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			Math::sSphere sphere;
+			sphere.center = centers.Get( i );
+			sphere.radius = radii[i];
+			if ( !EAE6320_TEST_CHECKF( areOverlapping[i] == Math::IsOverlapping( frustum, sphere ),
+				"The batched result of sphere %zu of %zu is different from the single-shape result", i, count ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( Geometry_TestOverlaps_Boxes_MatchesTheSingleShapeFunction )
+{
+	const auto frustum = CreateFrustum_world();
+	std::mt19937 randomNumberGenerator( 0 );
+	for ( const auto count : s_counts )
+	{
+		sVectors minimums, maximums;
+		CreateRandomBoxes( count, randomNumberGenerator, minimums, maximums );
+		std::unique_ptr<bool[]> areOverlapping( new bool[count] );
+		Math::TestOverlaps( frustum, minimums.GetSpans(), maximums.GetSpans(), count, areOverlapping.get() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			Math::sAxisAlignedBox box;
+			box.minimum = minimums.Get( i );
+			box.maximum = maximums.Get( i );
+			if ( !EAE6320_TEST_CHECKF( areOverlapping[i] == Math::IsOverlapping( frustum, box ),
+				"The batched result of box %zu of %zu is different from the single-shape result", i, count ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( Geometry_Raycast_Batched_MatchesTheSingleShapeFunction )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	for ( const auto count : s_counts )
+	{
+		sVectors origins, directions;
+		CreateRandomRays( count, randomNumberGenerator, origins, directions );
+		std::vector<float> hitDistances( count );
+		Math::Raycast( origins.GetSpans(), directions.GetSpans(), count, s_box, s_maximumRayDistance, hitDistances.data() );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			const auto expected = Raycast_single( origins.Get( i ), directions.Get( i ) );
+			// Any negative number is a miss
+			const auto isHit = hitDistances[i] >= 0.0f;
+			if ( !EAE6320_TEST_CHECKF( ( isHit == ( expected >= 0.0f ) ) && ( !isHit || AreIdentical( hitDistances[i], expected ) ),
+				"The batched hit distance of ray %zu of %zu is %.9g instead of %.9g", i, count, hitDistances[i], expected ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( Geometry_Raycast_Box_HandlesRaysParallelToAnAxisAndRaysThatStartInside )
+{
+	// A ray that starts inside hits at zero
+	EAE6320_TEST_CHECK( Raycast_single( s_box.GetCenter(), Math::sVector( 0.3f, -0.2f, 0.9f ) ) == 0.0f );
+	EAE6320_TEST_CHECK( Raycast_single( s_box.GetCenter(), Math::sVector( 0.0f, 0.0f, 1.0f ) ) == 0.0f );
+	// A ray parallel to an axis that passes through the box hits the nearest face
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( 0.0f, 0.0f, 10.0f ), Math::sVector( 0.0f, 0.0f, -1.0f ) ) == 9.5f );
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( -5.0f, 0.0f, 0.0f ), Math::sVector( 2.0f, 0.0f, 0.0f ) ) == 2.0f );
+	// A ray parallel to an axis that passes next to the box misses
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( 0.0f, 1.5f, 10.0f ), Math::sVector( 0.0f, 0.0f, -1.0f ) ) < 0.0f );
+	// A ray parallel to an axis that points away from the box misses
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( 0.0f, 0.0f, 10.0f ), Math::sVector( 0.0f, 0.0f, 1.0f ) ) < 0.0f );
+	// A ray that slides along a face of the box hits it
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( 0.0f, 1.0f, 10.0f ), Math::sVector( 0.0f, 0.0f, -1.0f ) ) == 9.5f );
+	// A ray that reaches the box beyond the maximum distance misses
+	EAE6320_TEST_CHECK( Raycast_single( Math::sVector( 0.0f, 0.0f, 30.0f ), Math::sVector( 0.0f, 0.0f, -1.0f ) ) < 0.0f );
+}
+
+EAE6320_TEST( Geometry_sFrustum_ContainsThePointsThatThePerspectiveProjectionShows )
+{
+	const auto frustum = CreateFrustum_world();
+	// Points that are inside of the frustum
+	std::mt19937 randomNumberGenerator( 0 );
+	{
+		std::uniform_real_distribution<float> distribution_distance( s_z_nearPlane * 1.01f, s_z_farPlane * 0.99f );
+		std::uniform_real_distribution<float> distribution_fraction( -0.99f, 0.99f );
+		for ( int i = 0; i < 10000; ++i )
+		{
+			const auto distance = distribution_distance( randomNumberGenerator );
+			const auto fraction_horizontal = distribution_fraction( randomNumberGenerator );
+			const auto fraction_vertical = distribution_fraction( randomNumberGenerator );
+			if ( !EAE6320_TEST_CHECKF( IsPointInFrustum( frustum, CreatePoint_world( distance, fraction_horizontal, fraction_vertical ) ),
+				"A point %g in front of the camera at (%g, %g) of the view isn't in the frustum", distance, fraction_horizontal, fraction_vertical ) )
+			{
+				return;
+			}
+		}
+	}
+	// Points that are outside of each plane
+	{
+		std::uniform_real_distribution<float> distribution_distance( s_z_nearPlane * 1.01f, s_z_farPlane * 0.99f );
+		std::uniform_real_distribution<float> distribution_fraction( -0.99f, 0.99f );
+		std::uniform_real_distribution<float> distribution_fraction_outside( 1.01f, 3.0f );
+		for ( int i = 0; i < 10000; ++i )
+		{
+			auto distance = distribution_distance( randomNumberGenerator );
+			float fractions[] = { distribution_fraction( randomNumberGenerator ), distribution_fraction( randomNumberGenerator ) };
+			switch ( i % 6 )
+			{
+			case Math::sFrustum::Left: fractions[0] = -distribution_fraction_outside( randomNumberGenerator ); break;
+			case Math::sFrustum::Right: fractions[0] = distribution_fraction_outside( randomNumberGenerator ); break;
+			case Math::sFrustum::Bottom: fractions[1] = -distribution_fraction_outside( randomNumberGenerator ); break;
+			case Math::sFrustum::Top: fractions[1] = distribution_fraction_outside( randomNumberGenerator ); break;
+			case Math::sFrustum::Near: distance = s_z_nearPlane * ( 2.0f - distribution_fraction_outside( randomNumberGenerator ) ); break;
+			default: distance = s_z_farPlane * distribution_fraction_outside( randomNumberGenerator ); break;
+			}
+			if ( !EAE6320_TEST_CHECKF( !IsPointInFrustum( frustum, CreatePoint_world( distance, fractions[0], fractions[1] ) ),
+				"A point %g in front of the camera at (%g, %g) of the view is in the frustum", distance, fractions[0], fractions[1] ) )
+			{
+				return;
+			}
+		}
+	}
+	// Points behind the camera
+	EAE6320_TEST_CHECK( !IsPointInFrustum( frustum, CreatePoint_world( -1.0f, 0.0f, 0.0f ) ) );
+	EAE6320_TEST_CHECK( !IsPointInFrustum( frustum, CreatePoint_world( -50.0f, 0.5f, -0.5f ) ) );
+	EAE6320_TEST_CHECK( !IsPointInFrustum( frustum, s_cameraPosition ) );
+}
@@ -0,0 +1,234 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <cmath>
+#include <cstring>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Constants.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// The SIMD and scalar versions do the same multiplications and additions in the same order
+	// (see cMatrix_transformation.cpp),
+	// and so every result must be identical to the bit
+
+	// The elements are column-major (the same as the matrix's storage)
+	// so that the tests can create matrices that the class's interface can't (e.g. with a non-uniform scale)
+	Math::cMatrix_transformation CreateMatrix( const float ( &i_elements )[16] )
+	{
+		static_assert( std::is_trivially_copyable<Math::cMatrix_transformation>::value, "A matrix can't be copied from floats" );
+		static_assert( sizeof( Math::cMatrix_transformation ) == sizeof( i_elements ), "A matrix isn't 16 floats" );
+		Math::cMatrix_transformation matrix;
+		std::memcpy( &matrix, i_elements, sizeof( matrix ) );
+		return matrix;
+	}
+
+	bool AreIdentical( const Math::cMatrix_transformation& i_result, const Math::cMatrix_transformation& i_expected, const char* const i_functionName )
+	{
+		if ( std::memcmp( &i_result, &i_expected, sizeof( i_result ) ) == 0 )
+		{
+			return true;
+		}
+		for ( unsigned int c = 0; c < 4; ++c )
+		{
+			for ( unsigned int r = 0; r < 4; ++r )
+			{
+				const auto result = i_result.GetElement( r, c );
+				const auto expected = i_expected.GetElement( r, c );
+				if ( std::memcmp( &result, &expected, sizeof( result ) ) != 0 )
+				{
+					return EAE6320_TEST_CHECKF( false, "Element [%u][%u] of %s is %.9g instead of %.9g", r, c, i_functionName, result, expected );
+				}
+			}
+		}
+		return false;
+	}
+	bool AreIdentical( const Math::sVector& i_result, const Math::sVector& i_expected )
+	{
+		return EAE6320_TEST_CHECKF( std::memcmp( &i_result, &i_expected, sizeof( i_result ) ) == 0,
+			"The transformed vector is (%.9g, %.9g, %.9g) instead of (%.9g, %.9g, %.9g)",
+			i_result.x, i_result.y, i_result.z, i_expected.x, i_expected.y, i_expected.z );
+	}
+
+	bool DoProductsMatch( const Math::cMatrix_transformation& i_lhs, const Math::cMatrix_transformation& i_rhs )
+	{
+		return AreIdentical( i_lhs * i_rhs, Math::cMatrix_transformation::Multiply_constexpr( i_lhs, i_rhs ), "operator *()" );
+	}
+	// Both transforms must be affine
+	bool DoConcatenationsMatch( const Math::cMatrix_transformation& i_nextTransform, const Math::cMatrix_transformation& i_firstTransform )
+	{
+		return AreIdentical( Math::cMatrix_transformation::ConcatenateAffine( i_nextTransform, i_firstTransform ),
+			Math::cMatrix_transformation::ConcatenateAffine_constexpr( i_nextTransform, i_firstTransform ), "ConcatenateAffine()" );
+	}
+	bool DoTransformedVectorsMatch( const Math::cMatrix_transformation& i_transform, const Math::sVector& i_vector )
+	{
+		return AreIdentical( i_transform * i_vector, Math::cMatrix_transformation::Multiply_constexpr( i_transform, i_vector ) );
+	}
+
+	// Every element has a random sign and a magnitude within many orders of magnitude
+	// (so that any difference in the order of the operations would change how the results are rounded)
+	class cRandomValues
+	{
+	public:
+
+		float GetFloat()
+		{
+			const auto magnitude = std::pow( 10.0f, m_distribution_exponent( m_randomNumberGenerator ) );
+			return ( m_distribution_sign( m_randomNumberGenerator ) == 0 ) ? magnitude : -magnitude;
+		}
+		Math::sVector GetVector()
+		{
+			const auto x = GetFloat();
+			const auto y = GetFloat();
+			return Math::sVector( x, y, GetFloat() );
+		}
+		Math::cMatrix_transformation GetMatrix()
+		{
+			float elements[16];
+			for ( auto& element : elements )
+			{
+				element = GetFloat();
+			}
+			return CreateMatrix( elements );
+		}
+		// The bottom row is [0, 0, 0, 1]
+		Math::cMatrix_transformation GetAffineMatrix()
+		{
+			float elements[16];
+			for ( unsigned int i = 0; i < 16; ++i )
+			{
+				elements[i] = ( ( i % 4 ) != 3 ) ? GetFloat() : ( ( i == 15 ) ? 1.0f : 0.0f );
+			}
+			return CreateMatrix( elements );
+		}
+
+	private:
+
+		std::mt19937 m_randomNumberGenerator{ 0 };
+		std::uniform_real_distribution<float> m_distribution_exponent{ -6.0f, 6.0f };
+		std::uniform_int_distribution<int> m_distribution_sign{ 0, 1 };
+	};
+
+	// These are the transforms that are special cases of an affine transform
+	std::vector<Math::cMatrix_transformation> CreateDegenerateAffineTransforms()
+	{
+		std::vector<Math::cMatrix_transformation> transforms;
+		// Identity
+		transforms.emplace_back();
+		// A rotation with no translation
+		transforms.emplace_back( Math::cQuaternion( 0.7f, Math::sVector( 1.0f, 2.0f, -3.0f ).GetNormalized() ), Math::sVector() );
+		// A translation with no rotation
+		transforms.emplace_back( Math::cQuaternion(), Math::sVector( 5.0f, -6.0f, 7.0f ) );
+		// A non-uniform scale (including a mirror) with no translation
+		transforms.push_back( CreateMatrix( { 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, -3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } ) );
+		// A non-uniform scale with a rotation and translation
+		transforms.push_back( Math::cMatrix_transformation::ConcatenateAffine_constexpr(
+			Math::cMatrix_transformation( Math::cQuaternion( -1.3f, Math::sVector( 0.0f, 1.0f, 0.0f ) ), Math::sVector( 1.0f, 2.0f, 3.0f ) ),
+			CreateMatrix( { 1.0e-3f, 0.0f, 0.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f, 0.0f, 0.0f, 250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } ) ) );
+		// A scale of zero along one axis (which flattens everything)
+		transforms.push_back( CreateMatrix( { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 3.0f, 4.0f, 5.0f, 1.0f } ) );
+		return transforms;
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cMatrix_transformation_Multiply_MatchesTheScalarVersion )
+{
+	cRandomValues randomValues;
+	for ( int i = 0; i < 10000; ++i )
+	{
+		if ( !DoProductsMatch( randomValues.GetMatrix(), randomValues.GetMatrix() ) )
+		{
+			return;
+		}
+	}
+	// Special cases of each input
+	{
+		auto transforms = CreateDegenerateAffineTransforms();
+		transforms.push_back( Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective( 1.0f, 1.5f, 0.1f, 1000.0f ) );
+		transforms.push_back( CreateMatrix( { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } ) );
+		for ( const auto& transform : transforms )
+		{
+			for ( const auto& transform_other : transforms )
+			{
+				DoProductsMatch( transform, transform_other );
+			}
+			DoProductsMatch( transform, randomValues.GetMatrix() );
+			DoProductsMatch( randomValues.GetMatrix(), transform );
+		}
+	}
+}
+
+EAE6320_TEST( cMatrix_transformation_ConcatenateAffine_MatchesTheScalarVersion )
+{
+	cRandomValues randomValues;
+	for ( int i = 0; i < 10000; ++i )
+	{
+		if ( !DoConcatenationsMatch( randomValues.GetAffineMatrix(), randomValues.GetAffineMatrix() ) )
+		{
+			return;
+		}
+	}
+	const auto transforms = CreateDegenerateAffineTransforms();
+	for ( const auto& transform : transforms )
+	{
+		for ( const auto& transform_other : transforms )
+		{
+			DoConcatenationsMatch( transform, transform_other );
+		}
+		DoConcatenationsMatch( transform, randomValues.GetAffineMatrix() );
+		DoConcatenationsMatch( randomValues.GetAffineMatrix(), transform );
+	}
+}
+
+EAE6320_TEST( cMatrix_transformation_TransformVector_MatchesTheScalarVersion )
+{
+	cRandomValues randomValues;
+	for ( int i = 0; i < 10000; ++i )
+	{
+		if ( !DoTransformedVectorsMatch( randomValues.GetMatrix(), randomValues.GetVector() ) )
+		{
+			return;
+		}
+	}
+	auto transforms = CreateDegenerateAffineTransforms();
+	transforms.push_back( Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective( 1.0f, 1.5f, 0.1f, 1000.0f ) );
+	for ( const auto& transform : transforms )
+	{
+		DoTransformedVectorsMatch( transform, Math::sVector() );
+		DoTransformedVectorsMatch( transform, Math::sVector( 1.0f, -2.0f, 3.0f ) );
+		DoTransformedVectorsMatch( transform, randomValues.GetVector() );
+	}
+}
+
+EAE6320_TEST( cMatrix_transformation_MatchesResultsCalculatedByTheCompiler )
+{
+	// These are calculated when the test is compiled
+	// (and so they show that the run-time versions match the compile-time versions and not just the scalar run-time code)
+	constexpr Math::cMatrix_transformation transform_a(
+		Math::cQuaternion::CreateFromAngleAxis_constexpr( 0.3f, Math::sVector( 0.0f, 0.6f, 0.8f ) ), Math::sVector( 1.5f, -2.25f, 3.125f ) );
+	constexpr Math::cMatrix_transformation transform_b(
+		Math::cQuaternion::CreateFromAngleAxis_constexpr( -2.1f, Math::sVector( 0.8f, 0.0f, -0.6f ) ), Math::sVector( -7.0f, 0.1f, 42.0f ) );
+	constexpr auto projection = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective_constexpr( 1.0f, 1.5f, 0.1f, 1000.0f );
+	constexpr Math::sVector vector( 0.3f, -0.7f, 11.0f );
+	constexpr auto product = Math::cMatrix_transformation::Multiply_constexpr( projection, transform_a );
+	constexpr auto concatenation = Math::cMatrix_transformation::ConcatenateAffine_constexpr( transform_a, transform_b );
+	constexpr auto transformedVector = Math::cMatrix_transformation::Multiply_constexpr( transform_b, vector );
+	AreIdentical( projection * transform_a, product, "operator *()" );
+	AreIdentical( Math::cMatrix_transformation::ConcatenateAffine( transform_a, transform_b ), concatenation, "ConcatenateAffine()" );
+	AreIdentical( transform_b * vector, transformedVector );
+}
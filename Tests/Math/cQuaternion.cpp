@@ -0,0 +1,261 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <cmath>
+#include <Engine/Math/BatchTransforms.h>
+#include <Engine/Math/Constants.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <initializer_list>
+#include <random>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// This is the documented bound in cQuaternion.h
+	constexpr double s_maximumError_slerp = 1.0e-6;
+
+	// The components are [w, x, y, z]
+	void GetComponents( const Math::cQuaternion& i_quaternion, float ( &o_components )[4] )
+	{
+		Math::BatchTransforms::sQuaternionSpans spans;
+		spans.w = &o_components[0];
+		spans.x = &o_components[1];
+		spans.y = &o_components[2];
+		spans.z = &o_components[3];
+		Math::BatchTransforms::CopyToSpans( &i_quaternion, 1, spans );
+	}
+	// A quaternion and its negation are the same rotation
+	Math::cQuaternion GetNegated( const Math::cQuaternion& i_quaternion )
+	{
+		float components[4];
+		GetComponents( i_quaternion, components );
+		const float w = -components[0], x = -components[1], y = -components[2], z = -components[3];
+		Math::cQuaternion quaternion;
+		Math::BatchTransforms::CopyFromSpans( Math::BatchTransforms::sConstQuaternionSpans( &w, &x, &y, &z ), 1, &quaternion );
+		return quaternion;
+	}
+
+	// This is an exact slerp along the shortest path calculated with doubles
+	void CalculateSlerp_reference( const Math::cQuaternion& i_from, const Math::cQuaternion& i_to, const double i_t, double ( &o_result )[4] )
+	{
+		float from[4], to[4];
+		GetComponents( i_from, from );
+		GetComponents( i_to, to );
+		auto cosAngle = 0.0;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			cosAngle += static_cast<double>( from[i] ) * static_cast<double>( to[i] );
+		}
+		auto toSign = 1.0;
+		if ( cosAngle < 0.0 )
+		{
+			cosAngle = -cosAngle;
+			toSign = -1.0;
+		}
+		const auto angle = std::acos( ( cosAngle < 1.0 ) ? cosAngle : 1.0 );
+		const auto sinAngle = std::sin( angle );
+		// The limit of the scales as the angle goes to zero is linear interpolation
+		const auto fromScale = ( sinAngle > 1.0e-12 ) ? ( std::sin( ( 1.0 - i_t ) * angle ) / sinAngle ) : ( 1.0 - i_t );
+		const auto toScale = ( ( sinAngle > 1.0e-12 ) ? ( std::sin( i_t * angle ) / sinAngle ) : i_t ) * toSign;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			o_result[i] = ( from[i] * fromScale ) + ( to[i] * toScale );
+		}
+	}
+
+	double CalculateMaximumDifference( const Math::cQuaternion& i_quaternion, const double ( &i_expected )[4] )
+	{
+		float components[4];
+		GetComponents( i_quaternion, components );
+		auto maximumDifference = 0.0;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			const auto difference = std::abs( components[i] - i_expected[i] );
+			// A NaN counts as a difference that is bigger than any bound
+			maximumDifference = ( difference <= maximumDifference ) ? maximumDifference : ( std::isnan( difference ) ? INFINITY : difference );
+		}
+		return maximumDifference;
+	}
+	bool IsSlerpWithinTheBound( const Math::cQuaternion& i_from, const Math::cQuaternion& i_to, const float i_t )
+	{
+		double expected[4];
+		CalculateSlerp_reference( i_from, i_to, i_t, expected );
+		const auto difference = CalculateMaximumDifference( Math::cQuaternion::Slerp( i_from, i_to, i_t ), expected );
+		return EAE6320_TEST_CHECKF( difference < s_maximumError_slerp, "The slerp with a dot product of %.9g at t = %.9g is off by %g",
+			Dot( i_from, i_to ), i_t, difference );
+	}
+	bool AreIdentical( const Math::cQuaternion& i_lhs, const Math::cQuaternion& i_rhs )
+	{
+		float lhs[4], rhs[4];
+		GetComponents( i_lhs, lhs );
+		GetComponents( i_rhs, rhs );
+		return ( lhs[0] == rhs[0] ) && ( lhs[1] == rhs[1] ) && ( lhs[2] == rhs[2] ) && ( lhs[3] == rhs[3] );
+	}
+
+	class cRandomRotations
+	{
+	public:
+
+		Math::cQuaternion GetRotation()
+		{
+			return GetRotation( m_distribution_angle( m_randomNumberGenerator ) );
+		}
+		Math::cQuaternion GetRotation( const float i_angle )
+		{
+			const Math::sVector axis( m_distribution_axis( m_randomNumberGenerator ), m_distribution_axis( m_randomNumberGenerator ),
+				m_distribution_axis( m_randomNumberGenerator ) );
+			return Math::cQuaternion( i_angle, ( axis.GetLength() > 1.0e-3f ) ? axis.GetNormalized() : Math::sVector( 0.0f, 0.0f, 1.0f ) );
+		}
+		float GetT() { return m_distribution_t( m_randomNumberGenerator ); }
+		float GetFloat( const float i_min, const float i_max ) { return std::uniform_real_distribution<float>( i_min, i_max )( m_randomNumberGenerator ); }
+
+	private:
+
+		std::mt19937 m_randomNumberGenerator{ 0 };
+		// A rotation of more than pi is the same as a negative rotation the other way,
+		// but its quaternion is negated and so has a negative dot product with rotations near the identity
+		std::uniform_real_distribution<float> m_distribution_angle{ -2.0f * Math::Pi, 2.0f * Math::Pi };
+		std::uniform_real_distribution<float> m_distribution_axis{ -1.0f, 1.0f };
+		std::uniform_real_distribution<float> m_distribution_t{ 0.0f, 1.0f };
+	};
+
+	// This is the angle of a rotation whose quaternion has a dot product with the identity of exactly the threshold
+	// (the angle between quaternions is half of the angle of the rotation between them)
+	const float s_nlerpThresholdAngle = static_cast<float>( 2.0 * std::acos( static_cast<double>( Math::cQuaternion::NlerpThreshold_cosAngle ) ) );
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cQuaternion_Slerp_IsWithinTheDocumentedBoundOfAnExactSlerp )
+{
+	cRandomRotations randomRotations;
+	// Random rotations
+	// (about half of the pairs have a negative dot product)
+	for ( int i = 0; i < 20000; ++i )
+	{
+		const auto from = randomRotations.GetRotation();
+		const auto to = randomRotations.GetRotation();
+		if ( !IsSlerpWithinTheBound( from, to, randomRotations.GetT() ) )
+		{
+			return;
+		}
+	}
+	// Rotations on both sides of the threshold where Nlerp() is used instead
+	for ( int i = 0; i < 20000; ++i )
+	{
+		const auto from = randomRotations.GetRotation();
+		const auto angle = randomRotations.GetFloat( s_nlerpThresholdAngle * 0.5f, s_nlerpThresholdAngle * 1.5f );
+		auto to = from * randomRotations.GetRotation( angle );
+		// Negating one of the rotations doesn't change the result
+		if ( ( i % 2 ) != 0 )
+		{
+			to = GetNegated( to );
+		}
+		if ( !IsSlerpWithinTheBound( from, to, randomRotations.GetT() ) )
+		{
+			return;
+		}
+	}
+	// Rotations that are far apart
+	// (where the slerp is the most different from a linear interpolation)
+	for ( int i = 0; i < 20000; ++i )
+	{
+		const auto from = randomRotations.GetRotation();
+		const auto to = from * randomRotations.GetRotation( randomRotations.GetFloat( 0.9f, 1.0f ) * Math::Pi );
+		if ( !IsSlerpWithinTheBound( from, to, randomRotations.GetT() ) )
+		{
+			return;
+		}
+	}
+}
+
+EAE6320_TEST( cQuaternion_Slerp_ReturnsTheEndpointsAtZeroAndOne )
+{
+	cRandomRotations randomRotations;
+	for ( int i = 0; i < 1000; ++i )
+	{
+		const auto from = randomRotations.GetRotation();
+		// Both far apart and nearly the same rotations
+		const auto to = ( ( i % 2 ) == 0 ) ? randomRotations.GetRotation() : ( from * randomRotations.GetRotation( s_nlerpThresholdAngle * 0.5f ) );
+		// The endpoint at one is the destination along the shortest path
+		// (i.e. it is negated if the dot product is negative)
+		const auto toSign = ( Dot( from, to ) < 0.0f ) ? -1.0 : 1.0;
+		float from_components[4], to_components[4];
+		GetComponents( from, from_components );
+		GetComponents( to, to_components );
+		const double from_expected[] = { from_components[0], from_components[1], from_components[2], from_components[3] };
+		const double to_expected[] =
+			{ to_components[0] * toSign, to_components[1] * toSign, to_components[2] * toSign, to_components[3] * toSign };
+		for ( const auto difference : { CalculateMaximumDifference( Math::cQuaternion::Slerp( from, to, 0.0f ), from_expected ),
+			CalculateMaximumDifference( Math::cQuaternion::Slerp( from, to, 1.0f ), to_expected ),
+			CalculateMaximumDifference( Math::cQuaternion::Nlerp( from, to, 0.0f ), from_expected ),
+			CalculateMaximumDifference( Math::cQuaternion::Nlerp( from, to, 1.0f ), to_expected ) } )
+		{
+			if ( !EAE6320_TEST_CHECKF( difference < s_maximumError_slerp, "An endpoint is off by %g", difference ) )
+			{
+				return;
+			}
+		}
+	}
+}
+
+EAE6320_TEST( cQuaternion_Slerp_TakesTheShortestPath )
+{
+	const Math::sVector axis( 0.0f, 0.0f, 1.0f );
+	const Math::cQuaternion from;
+	// A rotation of 3/2 pi is the same as a rotation of -1/2 pi,
+	// and its quaternion has a negative dot product with the identity
+	const Math::cQuaternion to( 1.5f * Math::Pi, axis );
+	if ( !EAE6320_TEST_CHECK( Dot( from, to ) < 0.0f ) )
+	{
+		return;
+	}
+	// Halfway along the shortest path is a rotation of -1/4 pi
+	// (halfway along the long path would be a rotation of 3/4 pi)
+	float expected_components[4];
+	GetComponents( Math::cQuaternion( -0.25f * Math::Pi, axis ), expected_components );
+	const double expected[] = { expected_components[0], expected_components[1], expected_components[2], expected_components[3] };
+	const auto difference_slerp = CalculateMaximumDifference( Math::cQuaternion::Slerp( from, to, 0.5f ), expected );
+	EAE6320_TEST_CHECKF( difference_slerp < s_maximumError_slerp, "The slerp is off by %g", difference_slerp );
+	const auto difference_nlerp = CalculateMaximumDifference( Math::cQuaternion::Nlerp( from, to, 0.5f ), expected );
+	EAE6320_TEST_CHECKF( difference_nlerp < s_maximumError_slerp, "The nlerp is off by %g", difference_nlerp );
+}
+
+EAE6320_TEST( cQuaternion_Slerp_UsesNlerpForNearlyTheSameRotations )
+{
+	cRandomRotations randomRotations;
+	for ( int i = 0; i < 1000; ++i )
+	{
+		const auto from = randomRotations.GetRotation();
+		const auto to = from * randomRotations.GetRotation( randomRotations.GetFloat( 0.0f, s_nlerpThresholdAngle * 0.9f ) );
+		if ( std::abs( Dot( from, to ) ) <= Math::cQuaternion::NlerpThreshold_cosAngle )
+		{
+			continue;
+		}
+		const auto t = randomRotations.GetT();
+		if ( !EAE6320_TEST_CHECKF( AreIdentical( Math::cQuaternion::Slerp( from, to, t ), Math::cQuaternion::Nlerp( from, to, t ) ),
+			"The slerp with a dot product of %.9g isn't the nlerp", Dot( from, to ) ) )
+		{
+			return;
+		}
+	}
+	// Identical rotations and a rotation and its negation
+	// (whose angle is zero, and so a slerp would divide by zero)
+	{
+		const auto rotation = randomRotations.GetRotation();
+		for ( const auto& to : { rotation, GetNegated( rotation ) } )
+		{
+			IsSlerpWithinTheBound( rotation, to, 0.0f );
+			IsSlerpWithinTheBound( rotation, to, 0.5f );
+			IsSlerpWithinTheBound( rotation, to, 1.0f );
+		}
+	}
+}
@@ -0,0 +1,208 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Physics/cBoundingVolumeHierarchy.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	constexpr float s_worldExtent = 50.0f;
+
+	struct sBounds
+	{
+		std::vector<float> minimum_x, minimum_y, minimum_z;
+		std::vector<float> maximum_x, maximum_y, maximum_z;
+
+		size_t GetCount() const { return minimum_x.size(); }
+		Math::BatchTransforms::sConstVectorSpans GetMinimums() const { return { minimum_x.data(), minimum_y.data(), minimum_z.data() }; }
+		Math::BatchTransforms::sConstVectorSpans GetMaximums() const { return { maximum_x.data(), maximum_y.data(), maximum_z.data() }; }
+		Math::sAxisAlignedBox GetBox( const size_t i_index ) const
+		{
+			Math::sAxisAlignedBox box;
+			box.minimum = Math::sVector( minimum_x[i_index], minimum_y[i_index], minimum_z[i_index] );
+			box.maximum = Math::sVector( maximum_x[i_index], maximum_y[i_index], maximum_z[i_index] );
+			return box;
+		}
+
+		void Move( const size_t i_index, const Math::sVector& i_offset )
+		{
+			minimum_x[i_index] += i_offset.x; minimum_y[i_index] += i_offset.y; minimum_z[i_index] += i_offset.z;
+			maximum_x[i_index] += i_offset.x; maximum_y[i_index] += i_offset.y; maximum_z[i_index] += i_offset.z;
+		}
+	};
+
+	sBounds CreateBounds( const size_t i_count, std::mt19937& io_randomNumberGenerator )
+	{
+		std::uniform_real_distribution<float> distribution_position( -s_worldExtent, s_worldExtent );
+		std::uniform_real_distribution<float> distribution_size( 0.2f, 2.0f );
+		sBounds bounds;
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			bounds.minimum_x.push_back( distribution_position( io_randomNumberGenerator ) );
+			bounds.minimum_y.push_back( distribution_position( io_randomNumberGenerator ) );
+			bounds.minimum_z.push_back( distribution_position( io_randomNumberGenerator ) );
+			bounds.maximum_x.push_back( bounds.minimum_x.back() + distribution_size( io_randomNumberGenerator ) );
+			bounds.maximum_y.push_back( bounds.minimum_y.back() + distribution_size( io_randomNumberGenerator ) );
+			bounds.maximum_z.push_back( bounds.minimum_z.back() + distribution_size( io_randomNumberGenerator ) );
+		}
+		return bounds;
+	}
+
+	// Every query is compared against testing every object
+	// (the IDs that a query outputs aren't in any particular order)
+	bool DoQueriesMatchBruteForce( const Physics::cBoundingVolumeHierarchy& i_tree, const sBounds& i_bounds, std::mt19937& io_randomNumberGenerator )
+	{
+		std::uniform_real_distribution<float> distribution_position( -s_worldExtent, s_worldExtent );
+		std::uniform_real_distribution<float> distribution_signed( -1.0f, 1.0f );
+		std::uniform_real_distribution<float> distribution_radius( 1.0f, 10.0f );
+		const auto getRandomPosition = [&]()
+		{
+			return Math::sVector( distribution_position( io_randomNumberGenerator ), distribution_position( io_randomNumberGenerator ),
+				distribution_position( io_randomNumberGenerator ) );
+		};
+		const auto count = i_bounds.GetCount();
+		// Queries that never find anything wouldn't test much
+		size_t hitCount = 0;
+		size_t objectCount_spheres = 0;
+		size_t objectCount_frustums = 0;
+		// Raycasts
+		for ( int i = 0; i < 200; ++i )
+		{
+			Math::sRay ray;
+			ray.origin = getRandomPosition();
+			ray.direction = Math::sVector( distribution_signed( io_randomNumberGenerator ), distribution_signed( io_randomNumberGenerator ),
+				distribution_signed( io_randomNumberGenerator ) );
+			constexpr auto maximumDistance = s_worldExtent * 2.0f;
+			auto hitDistance_expected = maximumDistance;
+			auto isHitExpected = false;
+			for ( size_t j = 0; j < count; ++j )
+			{
+				float hitDistance;
+				if ( Math::Raycast( ray, i_bounds.GetBox( j ), maximumDistance, hitDistance ) && ( !isHitExpected || ( hitDistance < hitDistance_expected ) ) )
+				{
+					hitDistance_expected = hitDistance;
+					isHitExpected = true;
+				}
+			}
+			uint32_t objectId;
+			float hitDistance;
+			const auto isHit = i_tree.Raycast( ray, maximumDistance, objectId, hitDistance );
+			if ( !EAE6320_TEST_CHECKF( ( isHit == isHitExpected ) && ( !isHit || ( hitDistance == hitDistance_expected ) ),
+				"Raycast %d is different than testing every object", i ) )
+			{
+				return false;
+			}
+			hitCount += isHit ? 1 : 0;
+		}
+		// Spheres
+		std::vector<uint32_t> objectIds, objectIds_expected;
+		for ( int i = 0; i < 50; ++i )
+		{
+			Math::sSphere sphere;
+			sphere.center = getRandomPosition();
+			sphere.radius = distribution_radius( io_randomNumberGenerator );
+			objectIds_expected.clear();
+			for ( size_t j = 0; j < count; ++j )
+			{
+				if ( Math::IsOverlapping( i_bounds.GetBox( j ), sphere ) )
+				{
+					objectIds_expected.push_back( static_cast<uint32_t>( j ) );
+				}
+			}
+			i_tree.FindOverlaps( sphere, objectIds );
+			std::sort( objectIds.begin(), objectIds.end() );
+			if ( !EAE6320_TEST_CHECKF( objectIds == objectIds_expected, "Sphere %d found %zu objects instead of %zu",
+				i, objectIds.size(), objectIds_expected.size() ) )
+			{
+				return false;
+			}
+			objectCount_spheres += objectIds.size();
+		}
+		// Frustums
+		const auto transform_cameraToProjected = Math::cMatrix_transformation::CreateCameraToProjectedTransform_perspective(
+			1.0f, 1.0f, 0.1f, s_worldExtent );
+		for ( int i = 0; i < 20; ++i )
+		{
+			const Math::cMatrix_transformation transform_cameraToWorld(
+				Math::cQuaternion( distribution_signed( io_randomNumberGenerator ) * 3.0f, Math::sVector( 0.0f, 1.0f, 0.0f ) ), getRandomPosition() );
+			const auto frustum = Math::sFrustum::CreateFromTransform(
+				transform_cameraToProjected * Math::cMatrix_transformation::CreateWorldToCameraTransform( transform_cameraToWorld ) );
+			objectIds_expected.clear();
+			for ( size_t j = 0; j < count; ++j )
+			{
+				if ( Math::IsOverlapping( frustum, i_bounds.GetBox( j ) ) )
+				{
+					objectIds_expected.push_back( static_cast<uint32_t>( j ) );
+				}
+			}
+			i_tree.FindOverlaps( frustum, objectIds );
+			std::sort( objectIds.begin(), objectIds.end() );
+			if ( !EAE6320_TEST_CHECKF( objectIds == objectIds_expected, "Frustum %d found %zu objects instead of %zu",
+				i, objectIds.size(), objectIds_expected.size() ) )
+			{
+				return false;
+			}
+			objectCount_frustums += objectIds.size();
+		}
+		return EAE6320_TEST_CHECKF( ( hitCount > 0 ) && ( objectCount_spheres > 0 ) && ( objectCount_frustums > 0 ),
+			"The queries found %zu hits, %zu objects in spheres, and %zu objects in frustums", hitCount, objectCount_spheres, objectCount_frustums );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cBoundingVolumeHierarchy_Build_MatchesBruteForce )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	const auto bounds = CreateBounds( 5000, randomNumberGenerator );
+	Physics::cBoundingVolumeHierarchy tree;
+	tree.Build( bounds.GetMinimums(), bounds.GetMaximums(), bounds.GetCount() );
+	EAE6320_TEST_CHECK( tree.GetObjectCount() == bounds.GetCount() );
+	DoQueriesMatchBruteForce( tree, bounds, randomNumberGenerator );
+}
+
+EAE6320_TEST( cBoundingVolumeHierarchy_Refit_MatchesBruteForce )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	auto bounds = CreateBounds( 5000, randomNumberGenerator );
+	Physics::cBoundingVolumeHierarchy tree;
+	tree.Build( bounds.GetMinimums(), bounds.GetMaximums(), bounds.GetCount() );
+	// Move every object
+	std::uniform_real_distribution<float> distribution( -3.0f, 3.0f );
+	for ( size_t i = 0; i < bounds.GetCount(); ++i )
+	{
+		bounds.Move( i, Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+			distribution( randomNumberGenerator ) ) );
+	}
+	tree.Refit( bounds.GetMinimums(), bounds.GetMaximums() );
+	DoQueriesMatchBruteForce( tree, bounds, randomNumberGenerator );
+}
+
+EAE6320_TEST( cBoundingVolumeHierarchy_RebuildDegradedSubtrees_MatchesBruteForce )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	auto bounds = CreateBounds( 5000, randomNumberGenerator );
+	Physics::cBoundingVolumeHierarchy tree;
+	tree.Build( bounds.GetMinimums(), bounds.GetMaximums(), bounds.GetCount() );
+	// Move some objects far enough that the boxes containing them grow a lot
+	std::uniform_real_distribution<float> distribution( -20.0f, 20.0f );
+	for ( size_t i = 0; i < bounds.GetCount(); i += 7 )
+	{
+		bounds.Move( i, Math::sVector( distribution( randomNumberGenerator ), 0.0f, 0.0f ) );
+	}
+	tree.Refit( bounds.GetMinimums(), bounds.GetMaximums() );
+	EAE6320_TEST_CHECK( tree.RebuildDegradedSubtrees( 1.5f ) > 0 );
+	DoQueriesMatchBruteForce( tree, bounds, randomNumberGenerator );
+}
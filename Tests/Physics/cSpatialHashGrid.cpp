@@ -0,0 +1,119 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <Engine/Math/sVector.h>
+#include <Engine/Physics/cSpatialHashGrid.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	struct sBounds
+	{
+		std::vector<float> minimum_x, minimum_y, minimum_z;
+		std::vector<float> maximum_x, maximum_y, maximum_z;
+
+		size_t GetCount() const { return minimum_x.size(); }
+		Math::BatchTransforms::sConstVectorSpans GetMinimums() const { return { minimum_x.data(), minimum_y.data(), minimum_z.data() }; }
+		Math::BatchTransforms::sConstVectorSpans GetMaximums() const { return { maximum_x.data(), maximum_y.data(), maximum_z.data() }; }
+
+		void Add( const Math::sVector& i_minimum, const Math::sVector& i_maximum )
+		{
+			minimum_x.push_back( i_minimum.x ); minimum_y.push_back( i_minimum.y ); minimum_z.push_back( i_minimum.z );
+			maximum_x.push_back( i_maximum.x ); maximum_y.push_back( i_maximum.y ); maximum_z.push_back( i_maximum.z );
+		}
+	};
+
+	// Every object is spread out randomly,
+	// and every object whose index is a multiple of the given number is much bigger than the others
+	sBounds CreateBounds( const size_t i_count, const size_t i_oversizedInterval )
+	{
+		std::mt19937 randomNumberGenerator( 0 );
+		std::uniform_real_distribution<float> distribution_position( -20.0f, 20.0f );
+		std::uniform_real_distribution<float> distribution_size( 0.1f, 1.5f );
+		std::uniform_real_distribution<float> distribution_size_oversized( 5.0f, 40.0f );
+		sBounds bounds;
+		for ( size_t i = 0; i < i_count; ++i )
+		{
+			const Math::sVector minimum( distribution_position( randomNumberGenerator ), distribution_position( randomNumberGenerator ),
+				distribution_position( randomNumberGenerator ) );
+			auto& distribution = ( ( i % i_oversizedInterval ) == 0 ) ? distribution_size_oversized : distribution_size;
+			const Math::sVector size( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+				distribution( randomNumberGenerator ) );
+			bounds.Add( minimum, minimum + size );
+		}
+		return bounds;
+	}
+
+	std::vector<Physics::sOverlappingPair> FindOverlappingPairs_bruteForce( const sBounds& i_bounds )
+	{
+		std::vector<Physics::sOverlappingPair> pairs;
+		const auto count = i_bounds.GetCount();
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			for ( uint32_t j = i + 1; j < count; ++j )
+			{
+				if ( ( i_bounds.minimum_x[i] <= i_bounds.maximum_x[j] ) && ( i_bounds.maximum_x[i] >= i_bounds.minimum_x[j] )
+					&& ( i_bounds.minimum_y[i] <= i_bounds.maximum_y[j] ) && ( i_bounds.maximum_y[i] >= i_bounds.minimum_y[j] )
+					&& ( i_bounds.minimum_z[i] <= i_bounds.maximum_z[j] ) && ( i_bounds.maximum_z[i] >= i_bounds.minimum_z[j] ) )
+				{
+					pairs.emplace_back( i, j );
+				}
+			}
+		}
+		return pairs;
+	}
+
+	bool DoesGridMatchBruteForce( const sBounds& i_bounds, const float i_cellSize )
+	{
+		Physics::cSpatialHashGrid grid( i_cellSize );
+		std::vector<Physics::sOverlappingPair> pairs;
+		grid.FindOverlappingPairs( i_bounds.GetMinimums(), i_bounds.GetMaximums(), i_bounds.GetCount(), pairs );
+		std::sort( pairs.begin(), pairs.end() );
+		const auto pairs_expected = FindOverlappingPairs_bruteForce( i_bounds );
+		return EAE6320_TEST_CHECKF( pairs == pairs_expected, "The grid found %zu pairs instead of %zu", pairs.size(), pairs_expected.size() );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cSpatialHashGrid_FindOverlappingPairs_MatchesBruteForce )
+{
+	DoesGridMatchBruteForce( CreateBounds( 3000, 3001 ), 2.0f );
+}
+
+EAE6320_TEST( cSpatialHashGrid_FindOverlappingPairs_TestsOversizedObjectsAgainstEverything )
+{
+	// A tenth of the objects touch more than the maximum number of cells
+	// (and so some pairs are two oversized objects)
+	DoesGridMatchBruteForce( CreateBounds( 3000, 10 ), 2.0f );
+	// Every object is oversized
+	DoesGridMatchBruteForce( CreateBounds( 500, 1 ), 2.0f );
+	// An object as big as the world
+	{
+		auto bounds = CreateBounds( 1000, 1001 );
+		bounds.Add( Math::sVector( -1.0e30f, -1.0e30f, -1.0e30f ), Math::sVector( 1.0e30f, 1.0e30f, 1.0e30f ) );
+		DoesGridMatchBruteForce( bounds, 2.0f );
+	}
+}
+
+EAE6320_TEST( cSpatialHashGrid_FindOverlappingPairs_PutsObjectsUpToTheMaximumInTheGrid )
+{
+	// An object that touches exactly the maximum number of cells is still put into the grid
+	// (4 x 4 x 4 cells)
+	static_assert( Physics::cSpatialHashGrid::MaximumCellCountPerObject == 64, "This test assumes a maximum of 64 cells" );
+	sBounds bounds;
+	bounds.Add( Math::sVector( 0.5f, 0.5f, 0.5f ), Math::sVector( 3.5f, 3.5f, 3.5f ) );
+	bounds.Add( Math::sVector( 3.0f, 3.0f, 3.0f ), Math::sVector( 3.2f, 3.2f, 3.2f ) );
+	bounds.Add( Math::sVector( 5.0f, 5.0f, 5.0f ), Math::sVector( 5.2f, 5.2f, 5.2f ) );
+	DoesGridMatchBruteForce( bounds, 1.0f );
+}
@@ -0,0 +1,233 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <Engine/Physics/cSweepAndPrune.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// This keeps its own copy of every object's bounds
+	// so that the pairs that the broadphase finds can be compared with a brute-force search
+	struct sScene
+	{
+		Physics::cSweepAndPrune broadphase;
+		struct sObject
+		{
+			Math::sAxisAlignedBox bounds;
+			Physics::cSweepAndPrune::tProxyId proxyId = Physics::cSweepAndPrune::InvalidProxyId;
+		};
+		// The index of an object is its user ID
+		std::vector<sObject> objects;
+
+		bool IsAdded( const uint32_t i_userId ) const { return objects[i_userId].proxyId != Physics::cSweepAndPrune::InvalidProxyId; }
+
+		void Add( const uint32_t i_userId, const Math::sAxisAlignedBox& i_bounds )
+		{
+			if ( i_userId >= objects.size() )
+			{
+				objects.resize( i_userId + 1 );
+			}
+			objects[i_userId].bounds = i_bounds;
+			objects[i_userId].proxyId = broadphase.AddProxy( i_bounds, i_userId );
+		}
+		void Move( const uint32_t i_userId, const Math::sAxisAlignedBox& i_bounds )
+		{
+			objects[i_userId].bounds = i_bounds;
+			broadphase.UpdateProxy( objects[i_userId].proxyId, i_bounds );
+		}
+		void Remove( const uint32_t i_userId )
+		{
+			broadphase.RemoveProxy( objects[i_userId].proxyId );
+			objects[i_userId].proxyId = Physics::cSweepAndPrune::InvalidProxyId;
+		}
+	};
+
+	// Boxes that touch exactly are overlapping
+	std::vector<Physics::sOverlappingPair> FindOverlappingPairs_bruteForce( const sScene& i_scene )
+	{
+		std::vector<Physics::sOverlappingPair> pairs;
+		const auto count = static_cast<uint32_t>( i_scene.objects.size() );
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			if ( !i_scene.IsAdded( i ) )
+			{
+				continue;
+			}
+			const auto& bounds_i = i_scene.objects[i].bounds;
+			for ( auto j = i + 1; j < count; ++j )
+			{
+				if ( !i_scene.IsAdded( j ) )
+				{
+					continue;
+				}
+				const auto& bounds_j = i_scene.objects[j].bounds;
+				if ( ( bounds_i.minimum.x <= bounds_j.maximum.x ) && ( bounds_i.maximum.x >= bounds_j.minimum.x )
+					&& ( bounds_i.minimum.y <= bounds_j.maximum.y ) && ( bounds_i.maximum.y >= bounds_j.minimum.y )
+					&& ( bounds_i.minimum.z <= bounds_j.maximum.z ) && ( bounds_i.maximum.z >= bounds_j.minimum.z ) )
+				{
+					pairs.emplace_back( i, j );
+				}
+			}
+		}
+		return pairs;
+	}
+
+	bool DoesBroadphaseMatchBruteForce( sScene& io_scene, std::vector<Physics::sOverlappingPair>& io_pairs )
+	{
+		io_scene.broadphase.FindOverlappingPairs( io_pairs );
+		std::sort( io_pairs.begin(), io_pairs.end() );
+		const auto pairs_expected = FindOverlappingPairs_bruteForce( io_scene );
+		return EAE6320_TEST_CHECKF( io_pairs == pairs_expected, "The broadphase found %zu pairs instead of %zu", io_pairs.size(), pairs_expected.size() );
+	}
+
+	// Positions and sizes are multiples of a quarter
+	// so that many boxes touch exactly, and some boxes have no extent along one or more axes
+	Math::sAxisAlignedBox CreateRandomBounds( std::mt19937& io_randomNumberGenerator )
+	{
+		std::uniform_int_distribution<int> distribution_position( -40, 40 );
+		std::uniform_int_distribution<int> distribution_size( 0, 6 );
+		const Math::sVector minimum( distribution_position( io_randomNumberGenerator ) * 0.25f,
+			distribution_position( io_randomNumberGenerator ) * 0.25f, distribution_position( io_randomNumberGenerator ) * 0.25f );
+		const Math::sVector size( distribution_size( io_randomNumberGenerator ) * 0.25f,
+			distribution_size( io_randomNumberGenerator ) * 0.25f, distribution_size( io_randomNumberGenerator ) * 0.25f );
+		return { minimum, minimum + size };
+	}
+
+	Math::sAxisAlignedBox CreateBounds( const Math::sVector& i_minimum, const Math::sVector& i_maximum )
+	{
+		return { i_minimum, i_maximum };
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cSweepAndPrune_FindOverlappingPairs_MatchesBruteForce )
+{
+	std::mt19937 randomNumberGenerator( 0 );
+	sScene scene;
+	std::vector<Physics::sOverlappingPair> pairs;
+	constexpr uint32_t objectCount = 400;
+	for ( uint32_t i = 0; i < objectCount; ++i )
+	{
+		scene.Add( i, CreateRandomBounds( randomNumberGenerator ) );
+	}
+	if ( !DoesBroadphaseMatchBruteForce( scene, pairs ) )
+	{
+		return;
+	}
+	// Each frame some objects move a little (past a few neighbors), some are teleported,
+	// some are removed, and some that were removed are added again
+	// (which reuses the proxy IDs of removed objects)
+	std::uniform_int_distribution<uint32_t> distribution_object( 0, objectCount - 1 );
+	std::uniform_int_distribution<int> distribution_operation( 0, 9 );
+	std::uniform_int_distribution<int> distribution_offset( -2, 2 );
+	for ( int frame = 0; frame < 100; ++frame )
+	{
+		for ( int operation = 0; operation < 40; ++operation )
+		{
+			const auto userId = distribution_object( randomNumberGenerator );
+			const auto operationType = distribution_operation( randomNumberGenerator );
+			if ( !scene.IsAdded( userId ) )
+			{
+				if ( operationType < 5 )
+				{
+					scene.Add( userId, CreateRandomBounds( randomNumberGenerator ) );
+				}
+			}
+			else if ( operationType < 6 )
+			{
+				const Math::sVector offset( distribution_offset( randomNumberGenerator ) * 0.25f,
+					distribution_offset( randomNumberGenerator ) * 0.25f, distribution_offset( randomNumberGenerator ) * 0.25f );
+				const auto& bounds = scene.objects[userId].bounds;
+				scene.Move( userId, CreateBounds( bounds.minimum + offset, bounds.maximum + offset ) );
+			}
+			else if ( operationType < 8 )
+			{
+				scene.Move( userId, CreateRandomBounds( randomNumberGenerator ) );
+			}
+			else
+			{
+				scene.Remove( userId );
+			}
+		}
+		if ( !DoesBroadphaseMatchBruteForce( scene, pairs ) )
+		{
+			return;
+		}
+	}
+	// Everything is removed and added again
+	for ( uint32_t i = 0; i < objectCount; ++i )
+	{
+		if ( scene.IsAdded( i ) )
+		{
+			scene.Remove( i );
+		}
+	}
+	if ( !DoesBroadphaseMatchBruteForce( scene, pairs ) || !EAE6320_TEST_CHECK( scene.broadphase.GetProxyCount() == 0 ) )
+	{
+		return;
+	}
+	for ( uint32_t i = 0; i < objectCount; ++i )
+	{
+		scene.Add( i, CreateRandomBounds( randomNumberGenerator ) );
+	}
+	DoesBroadphaseMatchBruteForce( scene, pairs );
+	EAE6320_TEST_CHECK( scene.broadphase.GetProxyCount() == objectCount );
+}
+
+EAE6320_TEST( cSweepAndPrune_FindOverlappingPairs_FindsBoxesThatTouchExactly )
+{
+	sScene scene;
+	std::vector<Physics::sOverlappingPair> pairs;
+	// Faces that touch along each axis
+	scene.Add( 0, CreateBounds( Math::sVector( 0.0f, 0.0f, 0.0f ), Math::sVector( 1.0f, 1.0f, 1.0f ) ) );
+	scene.Add( 1, CreateBounds( Math::sVector( 1.0f, 0.0f, 0.0f ), Math::sVector( 2.0f, 1.0f, 1.0f ) ) );
+	scene.Add( 2, CreateBounds( Math::sVector( 0.0f, 1.0f, 0.0f ), Math::sVector( 1.0f, 2.0f, 1.0f ) ) );
+	scene.Add( 3, CreateBounds( Math::sVector( 0.0f, 0.0f, 1.0f ), Math::sVector( 1.0f, 1.0f, 2.0f ) ) );
+	// A corner that touches
+	scene.Add( 4, CreateBounds( Math::sVector( -1.0f, -1.0f, -1.0f ), Math::sVector( 0.0f, 0.0f, 0.0f ) ) );
+	// Boxes with the same minimum x
+	// (which the sort can put in either order)
+	scene.Add( 5, CreateBounds( Math::sVector( 1.0f, 5.0f, 5.0f ), Math::sVector( 1.5f, 6.0f, 6.0f ) ) );
+	scene.Add( 6, CreateBounds( Math::sVector( 1.0f, 6.0f, 5.0f ), Math::sVector( 3.0f, 7.0f, 6.0f ) ) );
+	// A box that misses by a tiny gap
+	scene.Add( 7, CreateBounds( Math::sVector( 2.0f + 1.0e-6f, 0.0f, 0.0f ), Math::sVector( 3.0f, 1.0f, 1.0f ) ) );
+	if ( !DoesBroadphaseMatchBruteForce( scene, pairs ) )
+	{
+		return;
+	}
+	EAE6320_TEST_CHECKF( pairs.size() == 8, "There are %zu pairs instead of 8", pairs.size() );
+	// Moving a box so that it exactly touches another one finds the new pair
+	scene.Move( 7, CreateBounds( Math::sVector( 2.0f, 0.0f, 0.0f ), Math::sVector( 3.0f, 1.0f, 1.0f ) ) );
+	DoesBroadphaseMatchBruteForce( scene, pairs );
+}
+
+EAE6320_TEST( cSweepAndPrune_FindOverlappingPairs_FindsBoxesWithNoExtent )
+{
+	sScene scene;
+	std::vector<Physics::sOverlappingPair> pairs;
+	// Two points in the same place
+	scene.Add( 0, CreateBounds( Math::sVector( 1.0f, 1.0f, 1.0f ), Math::sVector( 1.0f, 1.0f, 1.0f ) ) );
+	scene.Add( 1, CreateBounds( Math::sVector( 1.0f, 1.0f, 1.0f ), Math::sVector( 1.0f, 1.0f, 1.0f ) ) );
+	// A point on the face of a box
+	scene.Add( 2, CreateBounds( Math::sVector( 1.0f, 0.0f, 0.0f ), Math::sVector( 2.0f, 2.0f, 2.0f ) ) );
+	// A flat box that crosses the others
+	scene.Add( 3, CreateBounds( Math::sVector( -5.0f, 1.0f, -5.0f ), Math::sVector( 5.0f, 1.0f, 5.0f ) ) );
+	// A point that is nowhere near the others
+	scene.Add( 4, CreateBounds( Math::sVector( 9.0f, 9.0f, 9.0f ), Math::sVector( 9.0f, 9.0f, 9.0f ) ) );
+	if ( !DoesBroadphaseMatchBruteForce( scene, pairs ) )
+	{
+		return;
+	}
+	EAE6320_TEST_CHECKF( pairs.size() == 6, "There are %zu pairs instead of 6", pairs.size() );
+}
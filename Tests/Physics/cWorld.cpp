@@ -0,0 +1,868 @@
+// Include Files
+//==============
+
+#include <Tests/Test.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Physics/cWorld.h>
+#include <random>
+#include <vector>
+
+// Helper Definitions
+//===================
+
+namespace
+{
+	using namespace eae6320;
+
+	// The header of a snapshot is these words
+	// (followed by every slot as a body index and an ID, the unused slot indices, every body's slot index, and then the float arrays)
+	enum eSnapshotHeaderWord : size_t
+	{
+		BodyCount, AwakeBodyCount, SlotCount, UnusedSlotIndexCount,
+		SnapshotHeaderWordCount
+	};
+	constexpr size_t s_snapshotWordSize = sizeof( uint32_t );
+
+	// These are only used by the tests of invalid snapshots and deltas
+#ifndef EAE6320_ASSERTS_AREENABLED
+	uint32_t GetWord( const std::vector<uint8_t>& i_snapshot, const size_t i_wordIndex )
+	{
+		uint32_t word;
+		memcpy( &word, i_snapshot.data() + ( i_wordIndex * s_snapshotWordSize ), sizeof( word ) );
+		return word;
+	}
+	void SetWord( std::vector<uint8_t>& io_snapshot, const size_t i_wordIndex, const uint32_t i_word )
+	{
+		memcpy( io_snapshot.data() + ( i_wordIndex * s_snapshotWordSize ), &i_word, sizeof( i_word ) );
+	}
+#endif
+
+	std::vector<uint8_t> TakeSnapshot( const Physics::cWorld& i_world )
+	{
+		std::vector<uint8_t> snapshot( i_world.GetSnapshotSize() );
+		EAE6320_TEST_CHECK( i_world.TakeSnapshot( snapshot.data(), snapshot.size() ) );
+		return snapshot;
+	}
+
+	// This creates a world with moving and still bodies
+	// and then removes some of them so that there are unused slots
+	void CreateWorld( const size_t i_bodyCount, Physics::cWorld& o_world, std::vector<Physics::cWorld::cBodyHandle>& o_handles )
+	{
+		EAE6320_TEST_CHECK( o_world.Initialize() );
+		std::mt19937 randomNumberGenerator( 0 );
+		std::uniform_real_distribution<float> distribution( -1.0f, 1.0f );
+		o_handles.resize( i_bodyCount );
+		for ( size_t i = 0; i < i_bodyCount; ++i )
+		{
+			Physics::sRigidBodyState state;
+			state.position = Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+				distribution( randomNumberGenerator ) );
+			if ( ( i % 4 ) == 0 )
+			{
+				state.velocity = Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+					distribution( randomNumberGenerator ) );
+				state.angularSpeed = 3.0f;
+			}
+			EAE6320_TEST_CHECK( o_world.AddBody( state, o_handles[i] ) );
+		}
+		for ( int i = 0; i < 60; ++i )
+		{
+			o_world.Update( 1.0f / 60.0f );
+		}
+		for ( size_t i = 1; i < i_bodyCount; i += 7 )
+		{
+			EAE6320_TEST_CHECK( o_world.RemoveBody( o_handles[i] ) );
+		}
+	}
+
+	void CleanUpWorld( Physics::cWorld& io_world, std::vector<Physics::cWorld::cBodyHandle>& io_handles )
+	{
+		for ( auto& handle : io_handles )
+		{
+			if ( io_world.IsValid( handle ) )
+			{
+				EAE6320_TEST_CHECK( io_world.RemoveBody( handle ) );
+			}
+		}
+		EAE6320_TEST_CHECK( io_world.CleanUp() );
+	}
+
+	// Sleeping
+	//---------
+
+	// The time of every update is exact in binary
+	// (so that the time that a body has been still adds up to exactly the time until it sleeps)
+	constexpr float s_secondCountPerUpdate = 0.125f;
+	constexpr int s_updateCountUntilSleep = 4;
+
+	void InitializeSleepingWorld( Physics::cWorld& o_world )
+	{
+		EAE6320_TEST_CHECK( o_world.Initialize() );
+		auto sleepSettings = o_world.GetSleepSettings();
+		sleepSettings.secondCountUntilSleep = s_secondCountPerUpdate * s_updateCountUntilSleep;
+		o_world.SetSleepSettings( sleepSettings );
+	}
+
+	Physics::cWorld::cBodyHandle AddBody( Physics::cWorld& io_world, const Math::sVector& i_position, const Math::sVector& i_velocity = Math::sVector() )
+	{
+		Physics::sRigidBodyState state;
+		state.position = i_position;
+		state.velocity = i_velocity;
+		Physics::cWorld::cBodyHandle handle;
+		EAE6320_TEST_CHECK( io_world.AddBody( state, handle ) );
+		return handle;
+	}
+
+	// The handles are linked one after the other
+	void AddChainContacts( Physics::cWorld& io_world, const std::vector<Physics::cWorld::cBodyHandle>& i_handles )
+	{
+		for ( size_t i = 1; i < i_handles.size(); ++i )
+		{
+			io_world.AddContact( i_handles[i - 1], i_handles[i] );
+		}
+	}
+
+	size_t CountAwakeBodies( const Physics::cWorld& i_world, const std::vector<Physics::cWorld::cBodyHandle>& i_handles )
+	{
+		size_t awakeBodyCount = 0;
+		for ( const auto handle : i_handles )
+		{
+			if ( i_world.IsAwake( handle ) )
+			{
+				++awakeBodyCount;
+			}
+		}
+		return awakeBodyCount;
+	}
+
+	// The world's count must match what its bodies report
+	// (which is only true if the awake bodies are the ones at the start of the arrays)
+	bool AreAwakeBodiesCounted( const Physics::cWorld& i_world, const std::vector<Physics::cWorld::cBodyHandle>& i_handles )
+	{
+		const auto awakeBodyCount = CountAwakeBodies( i_world, i_handles );
+		return EAE6320_TEST_CHECKF( ( i_world.GetBodyCount() == i_handles.size() ) && ( i_world.GetAwakeBodyCount() == awakeBodyCount )
+			&& ( i_world.GetSleepingBodyCount() == ( i_handles.size() - awakeBodyCount ) ),
+			"The world counts %zu of %zu bodies as awake but %zu of %zu say that they are awake",
+			i_world.GetAwakeBodyCount(), i_world.GetBodyCount(), awakeBodyCount, i_handles.size() );
+	}
+}
+
+// Tests
+//======
+
+EAE6320_TEST( cWorld_Update_MatchesRigidBodyState )
+{
+	Physics::cWorld world;
+	EAE6320_TEST_CHECK( world.Initialize() );
+	// Sleeping bodies aren't integrated
+	{
+		auto sleepSettings = world.GetSleepSettings();
+		sleepSettings.isEnabled = false;
+		world.SetSleepSettings( sleepSettings );
+	}
+	// The count isn't a multiple of four so that the bodies after the last SIMD group are also tested
+	constexpr size_t bodyCount = 1003;
+	std::vector<Physics::sRigidBodyState> states( bodyCount );
+	std::vector<Physics::cWorld::cBodyHandle> handles( bodyCount );
+	{
+		std::mt19937 randomNumberGenerator( 0 );
+		std::uniform_real_distribution<float> distribution( -10.0f, 10.0f );
+		const auto getRandomVector = [&]()
+		{
+			return Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+				distribution( randomNumberGenerator ) );
+		};
+		for ( size_t i = 0; i < bodyCount; ++i )
+		{
+			auto& state = states[i];
+			state.position = getRandomVector();
+			state.velocity = getRandomVector();
+			state.acceleration = getRandomVector();
+			state.orientation = Math::cQuaternion( distribution( randomNumberGenerator ), getRandomVector().GetNormalized() );
+			state.angularVelocity_axis_local = getRandomVector().GetNormalized();
+			state.angularSpeed = distribution( randomNumberGenerator );
+			EAE6320_TEST_CHECK( world.AddBody( state, handles[i] ) );
+		}
+	}
+
+	for ( int i = 0; i < 120; ++i )
+	{
+		const auto secondCountToIntegrate = ( i % 2 ) == 0 ? ( 1.0f / 60.0f ) : ( 1.0f / 30.0f );
+		world.Update( secondCountToIntegrate );
+		for ( auto& state : states )
+		{
+			state.Update( secondCountToIntegrate );
+		}
+	}
+	for ( size_t i = 0; i < bodyCount; ++i )
+	{
+		// The position and velocity are calculated the same way and so they must be identical
+		const auto position = world.GetPosition( handles[i] );
+		const auto velocity = world.GetVelocity( handles[i] );
+		if ( !EAE6320_TEST_CHECKF( ( position == states[i].position ) && ( velocity == states[i].velocity ),
+			"Body %zu's position or velocity is different", i ) )
+		{
+			break;
+		}
+		// The orientation is calculated with the fast sine and cosine approximations
+		const auto orientation = world.GetOrientation( handles[i] );
+		const auto cosAngleBetween = std::abs( Math::Dot( orientation, states[i].orientation ) );
+		if ( !EAE6320_TEST_CHECKF( cosAngleBetween > 0.99999f, "Body %zu's orientation is different (the cosine is %f)", i, cosAngleBetween ) )
+		{
+			break;
+		}
+	}
+
+	for ( auto& handle : handles )
+	{
+		EAE6320_TEST_CHECK( world.RemoveBody( handle ) );
+	}
+	EAE6320_TEST_CHECK( world.CleanUp() );
+}
+
+EAE6320_TEST( cWorld_Update_IsIdenticalForEveryThreadCount )
+{
+	// There are enough bodies for every worker thread to be given a range
+	// (and the count isn't a multiple of a range's alignment so that the last range is different)
+	constexpr size_t bodyCount = ( Physics::cWorld::MinimumBodyCountPerThread * 8 ) + 3;
+	std::vector<uint8_t> snapshot_singleThread;
+	for ( const auto workerThreadCount : { 0u, 1u, 2u, 3u, 7u } )
+	{
+		Physics::cWorld world;
+		EAE6320_TEST_CHECK( world.Initialize( workerThreadCount ) );
+		std::vector<Physics::cWorld::cBodyHandle> handles( bodyCount );
+		{
+			std::mt19937 randomNumberGenerator( 0 );
+			std::uniform_real_distribution<float> distribution( -1.0f, 1.0f );
+			for ( size_t i = 0; i < bodyCount; ++i )
+			{
+				// Half of the bodies are still so that some go to sleep
+				Physics::sRigidBodyState state;
+				state.position = Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+					distribution( randomNumberGenerator ) );
+				if ( ( i % 2 ) == 0 )
+				{
+					state.velocity = Math::sVector( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+						distribution( randomNumberGenerator ) );
+					state.acceleration = Math::sVector( 0.0f, distribution( randomNumberGenerator ), 0.0f );
+					state.angularSpeed = 3.0f * distribution( randomNumberGenerator );
+				}
+				EAE6320_TEST_CHECK( world.AddBody( state, handles[i] ) );
+			}
+		}
+		const auto secondCountToSimulate = world.GetSleepSettings().secondCountUntilSleep * 2.0f;
+		for ( auto secondCount = 0.0f; secondCount < secondCountToSimulate; secondCount += ( 1.0f / 60.0f ) )
+		{
+			world.Update( 1.0f / 60.0f );
+		}
+		// A snapshot contains every body's state and whether it is awake
+		const auto snapshot = TakeSnapshot( world );
+		if ( workerThreadCount == 0 )
+		{
+			snapshot_singleThread = snapshot;
+			EAE6320_TEST_CHECK( ( world.GetAwakeBodyCount() > 0 ) && ( world.GetAwakeBodyCount() < bodyCount ) );
+		}
+		else
+		{
+			EAE6320_TEST_CHECKF( snapshot == snapshot_singleThread, "The world is different with %u worker threads", workerThreadCount );
+		}
+		CleanUpWorld( world, handles );
+	}
+}
+
+EAE6320_TEST( cWorld_RestoreSnapshot_RollsBack )
+{
+	Physics::cWorld world;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	CreateWorld( 1000, world, handles );
+	const auto snapshot = TakeSnapshot( world );
+	std::vector<Physics::sRigidBodyState> states;
+	for ( const auto handle : handles )
+	{
+		if ( world.IsValid( handle ) )
+		{
+			states.push_back( world.GetBodyState( handle ) );
+		}
+	}
+
+	// Change the world and then roll it back
+	const auto handle_removed = handles[0];
+	EAE6320_TEST_CHECK( world.RemoveBody( handles[0] ) );
+	Physics::cWorld::cBodyHandle handle_added;
+	EAE6320_TEST_CHECK( world.AddBody( Physics::sRigidBodyState(), handle_added ) );
+	for ( int i = 0; i < 30; ++i )
+	{
+		world.Update( 1.0f / 60.0f );
+	}
+	EAE6320_TEST_CHECK( world.RestoreSnapshot( snapshot.data(), snapshot.size() ) );
+	handles[0] = handle_removed;
+	EAE6320_TEST_CHECK( world.IsValid( handle_removed ) );
+	EAE6320_TEST_CHECK( !world.IsValid( handle_added ) );
+	size_t stateIndex = 0;
+	for ( const auto handle : handles )
+	{
+		if ( world.IsValid( handle ) )
+		{
+			const auto state = world.GetBodyState( handle );
+			EAE6320_TEST_CHECK( memcmp( &state, &states[stateIndex++], sizeof( state ) ) == 0 );
+		}
+	}
+	EAE6320_TEST_CHECK( stateIndex == states.size() );
+	EAE6320_TEST_CHECK( TakeSnapshot( world ) == snapshot );
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_SnapshotDelta_RoundTrips )
+{
+	Physics::cWorld world;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	CreateWorld( 1000, world, handles );
+	const auto snapshot_base = TakeSnapshot( world );
+	world.Update( 1.0f / 60.0f );
+	Physics::cWorld::cBodyHandle handle_added;
+	EAE6320_TEST_CHECK( world.AddBody( Physics::sRigidBodyState(), handle_added ) );
+	handles.push_back( handle_added );
+	const auto snapshot = TakeSnapshot( world );
+
+	std::vector<uint8_t> delta, snapshot_decoded;
+	EAE6320_TEST_CHECK( Physics::cWorld::EncodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(),
+		snapshot.data(), snapshot.size(), delta ) );
+	EAE6320_TEST_CHECK( delta.size() < snapshot.size() );
+	EAE6320_TEST_CHECK( Physics::cWorld::DecodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(),
+		delta.data(), delta.size(), snapshot_decoded ) );
+	EAE6320_TEST_CHECK( snapshot_decoded == snapshot );
+	// A delta can also be encoded without a base
+	EAE6320_TEST_CHECK( Physics::cWorld::EncodeSnapshotDelta( nullptr, 0, snapshot.data(), snapshot.size(), delta ) );
+	EAE6320_TEST_CHECK( Physics::cWorld::DecodeSnapshotDelta( nullptr, 0, delta.data(), delta.size(), snapshot_decoded ) );
+	EAE6320_TEST_CHECK( snapshot_decoded == snapshot );
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_Update_PutsAStillBodyToSleepOnlyAfterTheTimeUntilSleep )
+{
+	Physics::cWorld world;
+	InitializeSleepingWorld( world );
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	handles.push_back( AddBody( world, Math::sVector( 1.0f, 2.0f, 3.0f ) ) );
+	handles.push_back( AddBody( world, Math::sVector(), Math::sVector( 0.0f, 1.0f, 0.0f ) ) );
+	for ( int i = 1; i < s_updateCountUntilSleep; ++i )
+	{
+		world.Update( s_secondCountPerUpdate );
+		EAE6320_TEST_CHECKF( world.IsAwake( handles[0] ), "A still body was put to sleep after %d updates", i );
+	}
+	world.Update( s_secondCountPerUpdate );
+	EAE6320_TEST_CHECK( !world.IsAwake( handles[0] ) );
+	// A moving body never sleeps
+	EAE6320_TEST_CHECK( world.IsAwake( handles[1] ) );
+	AreAwakeBodiesCounted( world, handles );
+	// A sleeping body doesn't move
+	world.Update( s_secondCountPerUpdate );
+	EAE6320_TEST_CHECK( world.GetPosition( handles[0] ) == Math::sVector( 1.0f, 2.0f, 3.0f ) );
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_Update_PutsAnIslandToSleepOnlyWhenEveryBodyIsStill )
+{
+	Physics::cWorld world;
+	InitializeSleepingWorld( world );
+	// The last body in the chain is moving and the others are still
+	constexpr size_t bodyCount = 5;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	for ( size_t i = 0; i < bodyCount; ++i )
+	{
+		handles.push_back( AddBody( world, Math::sVector( static_cast<float>( i ), 0.0f, 0.0f ) ) );
+	}
+	world.SetVelocity( handles.back(), Math::sVector( 1.0f, 0.0f, 0.0f ) );
+	// The still bodies stay awake for much longer than the time until sleep
+	// because they are linked to the moving body
+	for ( int i = 0; i < ( s_updateCountUntilSleep * 3 ); ++i )
+	{
+		AddChainContacts( world, handles );
+		world.Update( s_secondCountPerUpdate );
+		if ( !EAE6320_TEST_CHECKF( CountAwakeBodies( world, handles ) == bodyCount, "%zu of %zu bodies linked to a moving body are awake",
+			CountAwakeBodies( world, handles ), bodyCount ) )
+		{
+			break;
+		}
+	}
+	// Once the moving body stops the island sleeps all at once
+	// when the last body has been still for the time until sleep
+	world.SetVelocity( handles.back(), Math::sVector() );
+	for ( int i = 1; i < s_updateCountUntilSleep; ++i )
+	{
+		AddChainContacts( world, handles );
+		world.Update( s_secondCountPerUpdate );
+		EAE6320_TEST_CHECKF( CountAwakeBodies( world, handles ) == bodyCount, "%zu of %zu bodies in an island are awake %d updates after it stopped",
+			CountAwakeBodies( world, handles ), bodyCount, i );
+	}
+	AddChainContacts( world, handles );
+	world.Update( s_secondCountPerUpdate );
+	EAE6320_TEST_CHECKF( CountAwakeBodies( world, handles ) == 0, "%zu of %zu bodies in a still island are awake",
+		CountAwakeBodies( world, handles ), bodyCount );
+	AreAwakeBodiesCounted( world, handles );
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_Update_WakesAnIslandWhenAMovingBodyTouchesIt )
+{
+	Physics::cWorld world;
+	InitializeSleepingWorld( world );
+	constexpr size_t bodyCount = 4;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	for ( size_t i = 0; i < bodyCount; ++i )
+	{
+		handles.push_back( AddBody( world, Math::sVector( static_cast<float>( i ), 0.0f, 0.0f ) ) );
+	}
+	for ( int i = 0; i < s_updateCountUntilSleep; ++i )
+	{
+		AddChainContacts( world, handles );
+		world.Update( s_secondCountPerUpdate );
+	}
+	if ( !EAE6320_TEST_CHECK( CountAwakeBodies( world, handles ) == 0 ) )
+	{
+		CleanUpWorld( world, handles );
+		return;
+	}
+	// A moving body touches the end of the chain
+	auto handle_moving = AddBody( world, Math::sVector( -1.0f, 0.0f, 0.0f ), Math::sVector( 1.0f, 0.0f, 0.0f ) );
+	AddChainContacts( world, handles );
+	world.AddContact( handle_moving, handles.front() );
+	world.Update( s_secondCountPerUpdate );
+	EAE6320_TEST_CHECKF( CountAwakeBodies( world, handles ) == bodyCount, "%zu of %zu bodies in an island that a moving body touched are awake",
+		CountAwakeBodies( world, handles ), bodyCount );
+	// The woken bodies wait the full time again before they sleep
+	// (even after the moving body has stopped touching them)
+	for ( int i = 1; i < s_updateCountUntilSleep; ++i )
+	{
+		AddChainContacts( world, handles );
+		world.Update( s_secondCountPerUpdate );
+		EAE6320_TEST_CHECK( CountAwakeBodies( world, handles ) == bodyCount );
+	}
+	AddChainContacts( world, handles );
+	world.Update( s_secondCountPerUpdate );
+	EAE6320_TEST_CHECK( CountAwakeBodies( world, handles ) == 0 );
+	handles.push_back( handle_moving );
+	AreAwakeBodiesCounted( world, handles );
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_SetVelocity_WakeUp_WakeABodyAndResetItsTime )
+{
+	Physics::cWorld world;
+	InitializeSleepingWorld( world );
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	handles.push_back( AddBody( world, Math::sVector() ) );
+	const auto handle = handles.front();
+	const auto putToSleep = [&world, handle]()
+	{
+		for ( int i = 0; i < s_updateCountUntilSleep; ++i )
+		{
+			world.Update( s_secondCountPerUpdate );
+		}
+		return EAE6320_TEST_CHECK( !world.IsAwake( handle ) );
+	};
+	// A body that is woken up must be still for the full time again before it sleeps
+	const auto isTimeUntilSleepReset = [&world, handle]( const char* const i_functionName )
+	{
+		for ( int i = 1; i < s_updateCountUntilSleep; ++i )
+		{
+			world.Update( s_secondCountPerUpdate );
+			if ( !EAE6320_TEST_CHECKF( world.IsAwake( handle ), "A body woken by %s went back to sleep after %d updates", i_functionName, i ) )
+			{
+				return false;
+			}
+		}
+		world.Update( s_secondCountPerUpdate );
+		return EAE6320_TEST_CHECKF( !world.IsAwake( handle ), "A body woken by %s didn't go back to sleep", i_functionName );
+	};
+	const auto& sleepSettings = world.GetSleepSettings();
+
+	// Motion below the thresholds doesn't wake a body
+	if ( putToSleep() )
+	{
+		world.SetVelocity( handle, Math::sVector( sleepSettings.linearSpeedThreshold * 0.5f, 0.0f, 0.0f ) );
+		world.SetAcceleration( handle, Math::sVector( 0.0f, sleepSettings.accelerationThreshold * 0.5f, 0.0f ) );
+		world.SetAngularVelocity( handle, Math::sVector( 0.0f, 0.0f, 1.0f ), sleepSettings.angularSpeedThreshold * 0.5f );
+		EAE6320_TEST_CHECK( !world.IsAwake( handle ) );
+		world.SetVelocity( handle, Math::sVector() );
+		world.SetAcceleration( handle, Math::sVector() );
+		world.SetAngularVelocity( handle, Math::sVector( 0.0f, 1.0f, 0.0f ), 0.0f );
+	}
+	// Motion above the thresholds wakes a body
+	// (and the motion is stopped again so that the body can go back to sleep)
+	if ( putToSleep() )
+	{
+		world.SetVelocity( handle, Math::sVector( 1.0f, 0.0f, 0.0f ) );
+		EAE6320_TEST_CHECK( world.IsAwake( handle ) );
+		world.SetVelocity( handle, Math::sVector() );
+		isTimeUntilSleepReset( "SetVelocity()" );
+	}
+	if ( world.IsAwake( handle ) || putToSleep() )
+	{
+		world.SetAcceleration( handle, Math::sVector( 0.0f, -9.8f, 0.0f ) );
+		EAE6320_TEST_CHECK( world.IsAwake( handle ) );
+		world.SetAcceleration( handle, Math::sVector() );
+		isTimeUntilSleepReset( "SetAcceleration()" );
+	}
+	if ( world.IsAwake( handle ) || putToSleep() )
+	{
+		world.SetAngularVelocity( handle, Math::sVector( 0.0f, 1.0f, 0.0f ), 1.0f );
+		EAE6320_TEST_CHECK( world.IsAwake( handle ) );
+		world.SetAngularVelocity( handle, Math::sVector( 0.0f, 1.0f, 0.0f ), 0.0f );
+		isTimeUntilSleepReset( "SetAngularVelocity()" );
+	}
+	if ( world.IsAwake( handle ) || putToSleep() )
+	{
+		world.WakeUp( handle );
+		EAE6320_TEST_CHECK( world.IsAwake( handle ) );
+		isTimeUntilSleepReset( "WakeUp()" );
+	}
+	// Waking up a body that is already awake resets its time too
+	{
+		world.WakeUp( handle );
+		for ( int i = 1; i < s_updateCountUntilSleep; ++i )
+		{
+			world.Update( s_secondCountPerUpdate );
+		}
+		world.WakeUp( handle );
+		isTimeUntilSleepReset( "WakeUp() while it was awake" );
+	}
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_AddBody_RemoveBody_KeepTheAwakeBodiesCounted )
+{
+	Physics::cWorld world;
+	InitializeSleepingWorld( world );
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	// Every body's position is unique and so it shows whether a handle still refers to the right body.
+	// Every third body moves and never sleeps.
+	std::vector<Math::sVector> positions;
+	std::vector<bool> areMoving;
+	float nextPosition = 0.0f;
+	const auto addBody = [&]()
+	{
+		const auto isMoving = ( handles.size() % 3 ) == 0;
+		nextPosition += 1.0f;
+		const Math::sVector position( nextPosition, 0.0f, 0.0f );
+		handles.push_back( AddBody( world, position, isMoving ? Math::sVector( 0.0f, 1.0f, 0.0f ) : Math::sVector() ) );
+		positions.push_back( position );
+		areMoving.push_back( isMoving );
+	};
+	const auto removeBody = [&]( const size_t i_index )
+	{
+		EAE6320_TEST_CHECK( world.RemoveBody( handles[i_index] ) );
+		handles.erase( handles.begin() + i_index );
+		positions.erase( positions.begin() + i_index );
+		areMoving.erase( areMoving.begin() + i_index );
+	};
+	// Adding and removing bodies doesn't change whether any other body is awake or where it is
+	const auto areOtherBodiesUnchanged = [&]( const std::vector<bool>& i_wereAwake )
+	{
+		for ( size_t i = 0; i < std::min( i_wereAwake.size(), handles.size() ); ++i )
+		{
+			if ( !EAE6320_TEST_CHECKF( world.IsAwake( handles[i] ) == i_wereAwake[i], "Adding or removing a body changed whether body %zu is awake", i )
+				|| !EAE6320_TEST_CHECKF( world.GetPosition( handles[i] ).x == positions[i].x, "Adding or removing a body changed which body handle %zu refers to", i ) )
+			{
+				return false;
+			}
+		}
+		return AreAwakeBodiesCounted( world, handles );
+	};
+	const auto getAreAwake = [&]()
+	{
+		std::vector<bool> areAwake;
+		for ( const auto handle : handles )
+		{
+			areAwake.push_back( world.IsAwake( handle ) );
+		}
+		return areAwake;
+	};
+
+	std::mt19937 randomNumberGenerator( 0 );
+	for ( int i = 0; i < 100; ++i )
+	{
+		addBody();
+	}
+	for ( int round = 0; round < 50; ++round )
+	{
+		// Some of the still bodies fall asleep
+		const auto updateCount = randomNumberGenerator() % ( s_updateCountUntilSleep + 1 );
+		for ( unsigned int j = 0; j < updateCount; ++j )
+		{
+			world.Update( s_secondCountPerUpdate );
+			for ( size_t k = 0; k < handles.size(); ++k )
+			{
+				positions[k] = world.GetPosition( handles[k] );
+				if ( areMoving[k] && !EAE6320_TEST_CHECKF( world.IsAwake( handles[k] ), "A moving body is asleep" ) )
+				{
+					CleanUpWorld( world, handles );
+					return;
+				}
+			}
+		}
+		if ( !AreAwakeBodiesCounted( world, handles ) )
+		{
+			break;
+		}
+		// Remove random bodies (both awake and sleeping) and add new ones
+		const auto removeCount = randomNumberGenerator() % 10;
+		for ( unsigned int j = 0; ( j < removeCount ) && !handles.empty(); ++j )
+		{
+			const auto wereAwake = getAreAwake();
+			const size_t index = randomNumberGenerator() % handles.size();
+			auto wereAwake_afterRemoving = wereAwake;
+			wereAwake_afterRemoving.erase( wereAwake_afterRemoving.begin() + index );
+			removeBody( index );
+			if ( !areOtherBodiesUnchanged( wereAwake_afterRemoving ) )
+			{
+				CleanUpWorld( world, handles );
+				return;
+			}
+		}
+		const auto addCount = randomNumberGenerator() % 10;
+		for ( unsigned int j = 0; j < addCount; ++j )
+		{
+			const auto wereAwake = getAreAwake();
+			addBody();
+			if ( !EAE6320_TEST_CHECK( world.IsAwake( handles.back() ) ) || !areOtherBodiesUnchanged( wereAwake ) )
+			{
+				CleanUpWorld( world, handles );
+				return;
+			}
+		}
+	}
+	// Only awake bodies are integrated,
+	// and so if the counts are consistent every moving body moves and every sleeping body doesn't
+	{
+		const auto wereAwake = getAreAwake();
+		world.Update( s_secondCountPerUpdate );
+		for ( size_t k = 0; k < handles.size(); ++k )
+		{
+			const auto hasMoved = world.GetPosition( handles[k] ) != positions[k];
+			EAE6320_TEST_CHECKF( hasMoved == areMoving[k], "Body %zu (which is %s) %s", k, wereAwake[k] ? "awake" : "asleep", hasMoved ? "moved" : "didn't move" );
+		}
+	}
+
+	CleanUpWorld( world, handles );
+}
+
+// Invalid input asserts (like an invalid file does) before the failure is returned,
+// and so these can only be tested when asserts are compiled out
+#ifndef EAE6320_ASSERTS_AREENABLED
+
+EAE6320_TEST( cWorld_DecodeSnapshotDelta_RejectsTruncatedDeltas )
+{
+	Physics::cWorld world;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	CreateWorld( 200, world, handles );
+	const auto snapshot_base = TakeSnapshot( world );
+	world.Update( 1.0f / 60.0f );
+	const auto snapshot = TakeSnapshot( world );
+	std::vector<uint8_t> delta, snapshot_decoded;
+	EAE6320_TEST_CHECK( Physics::cWorld::EncodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(),
+		snapshot.data(), snapshot.size(), delta ) );
+
+	for ( size_t deltaSize = 0; deltaSize < delta.size(); ++deltaSize )
+	{
+		// The truncated delta is copied so that reading past its end would be detected by tools like AddressSanitizer
+		const std::vector<uint8_t> delta_truncated( delta.begin(), delta.begin() + deltaSize );
+		if ( !EAE6320_TEST_CHECKF( !Physics::cWorld::DecodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(),
+			delta_truncated.data(), delta_truncated.size(), snapshot_decoded ), "A delta truncated to %zu bytes was decoded", deltaSize ) )
+		{
+			break;
+		}
+		EAE6320_TEST_CHECK( snapshot_decoded.empty() );
+	}
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_DecodeSnapshotDelta_RejectsOversizedDeltas )
+{
+	std::vector<uint8_t> snapshot_decoded;
+	// The word count is the first variable-length integer
+	const auto decodeWordCount = [&snapshot_decoded]( uint64_t i_wordCount )
+	{
+		std::vector<uint8_t> delta;
+		while ( i_wordCount >= 0x80 )
+		{
+			delta.push_back( static_cast<uint8_t>( i_wordCount | 0x80 ) );
+			i_wordCount >>= 7;
+		}
+		delta.push_back( static_cast<uint8_t>( i_wordCount ) );
+		// A single run of words that are the same as the (empty) base
+		delta.push_back( 0x7f );
+		delta.push_back( 0 );
+		return Physics::cWorld::DecodeSnapshotDelta( nullptr, 0, delta.data(), delta.size(), snapshot_decoded );
+	};
+	// These would overflow the size in bytes
+	EAE6320_TEST_CHECK( !decodeWordCount( UINT64_MAX ) );
+	EAE6320_TEST_CHECK( !decodeWordCount( ( UINT64_MAX / s_snapshotWordSize ) + 1 ) );
+	EAE6320_TEST_CHECK( !decodeWordCount( UINT64_C( 1 ) << 62 ) );
+	// This is bigger than the snapshot of a world with every possible body
+	EAE6320_TEST_CHECK( !decodeWordCount( UINT64_C( 1 ) << 32 ) );
+	EAE6320_TEST_CHECK( snapshot_decoded.empty() );
+	EAE6320_TEST_CHECK( snapshot_decoded.capacity() < 1024 * 1024 );
+	// A variable-length integer that is longer than a size_t can hold
+	{
+		const std::vector<uint8_t> delta( 32, 0xff );
+		EAE6320_TEST_CHECK( !Physics::cWorld::DecodeSnapshotDelta( nullptr, 0, delta.data(), delta.size(), snapshot_decoded ) );
+	}
+}
+
+EAE6320_TEST( cWorld_DecodeSnapshotDelta_HandlesRandomDeltas )
+{
+	Physics::cWorld world;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	CreateWorld( 100, world, handles );
+	const auto snapshot_base = TakeSnapshot( world );
+	world.Update( 1.0f / 60.0f );
+	std::vector<uint8_t> delta_valid, snapshot_decoded;
+	{
+		const auto snapshot = TakeSnapshot( world );
+		EAE6320_TEST_CHECK( Physics::cWorld::EncodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(),
+			snapshot.data(), snapshot.size(), delta_valid ) );
+	}
+
+	std::mt19937 randomNumberGenerator( 0 );
+	for ( int i = 0; i < 20000; ++i )
+	{
+		// Half of the deltas are completely random and half are valid deltas with random bytes changed
+		std::vector<uint8_t> delta;
+		if ( ( i % 2 ) == 0 )
+		{
+			delta.resize( randomNumberGenerator() % 64 );
+			for ( auto& byte : delta )
+			{
+				byte = static_cast<uint8_t>( randomNumberGenerator() );
+			}
+		}
+		else
+		{
+			delta = delta_valid;
+			const auto changeCount = 1 + ( randomNumberGenerator() % 4 );
+			for ( unsigned int j = 0; j < changeCount; ++j )
+			{
+				delta[randomNumberGenerator() % delta.size()] = static_cast<uint8_t>( randomNumberGenerator() );
+			}
+		}
+		// Decoding can succeed (a random delta can be valid),
+		// but then the snapshot must be the size that the delta says
+		// and restoring it must either fail or leave the world usable
+		if ( Physics::cWorld::DecodeSnapshotDelta( snapshot_base.data(), snapshot_base.size(), delta.data(), delta.size(), snapshot_decoded ) )
+		{
+			EAE6320_TEST_CHECK( ( snapshot_decoded.size() % s_snapshotWordSize ) == 0 );
+			if ( world.RestoreSnapshot( snapshot_decoded.data(), snapshot_decoded.size() ) )
+			{
+				world.Update( 1.0f / 60.0f );
+				for ( const auto handle : handles )
+				{
+					if ( world.IsValid( handle ) )
+					{
+						world.GetBodyState( handle );
+					}
+				}
+				EAE6320_TEST_CHECK( TakeSnapshot( world ).size() == world.GetSnapshotSize() );
+			}
+		}
+		else
+		{
+			EAE6320_TEST_CHECK( snapshot_decoded.empty() );
+		}
+	}
+
+	CleanUpWorld( world, handles );
+}
+
+EAE6320_TEST( cWorld_RestoreSnapshot_RejectsInconsistentSnapshots )
+{
+	Physics::cWorld world;
+	std::vector<Physics::cWorld::cBodyHandle> handles;
+	CreateWorld( 100, world, handles );
+	const auto snapshot_valid = TakeSnapshot( world );
+	const auto bodyCount = GetWord( snapshot_valid, BodyCount );
+	const auto slotCount = GetWord( snapshot_valid, SlotCount );
+	const auto unusedSlotIndexCount = GetWord( snapshot_valid, UnusedSlotIndexCount );
+	EAE6320_TEST_CHECK( ( bodyCount > 1 ) && ( unusedSlotIndexCount > 1 ) );
+	const size_t wordIndex_slots = SnapshotHeaderWordCount;
+	const auto wordIndex_unusedSlotIndices = wordIndex_slots + ( slotCount * 2 );
+	const auto wordIndex_slotIndices = wordIndex_unusedSlotIndices + unusedSlotIndexCount;
+	const auto slotIndex_body0 = GetWord( snapshot_valid, wordIndex_slotIndices + 0 );
+	const auto slotIndex_unused0 = GetWord( snapshot_valid, wordIndex_unusedSlotIndices + 0 );
+
+	// The world must not change when a snapshot is rejected
+	const auto snapshot_beforeRestoring = TakeSnapshot( world );
+	const auto checkRejected = [&]( const std::vector<uint8_t>& i_snapshot, const char* const i_description )
+	{
+		EAE6320_TEST_CHECKF( !world.RestoreSnapshot( i_snapshot.data(), i_snapshot.size() ), "A snapshot with %s was restored", i_description );
+		EAE6320_TEST_CHECKF( TakeSnapshot( world ) == snapshot_beforeRestoring, "Rejecting a snapshot with %s changed the world", i_description );
+	};
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_slotIndices + 0, slotCount );
+		checkRejected( snapshot, "a body's slot index out of range" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_slotIndices + 1, slotIndex_body0 );
+		checkRejected( snapshot, "two bodies in the same slot" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_slots + ( slotIndex_body0 * 2 ), 1 );
+		checkRejected( snapshot, "a slot that refers to the wrong body" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_slots + ( slotIndex_body0 * 2 ), bodyCount + 5 );
+		checkRejected( snapshot, "a slot's body index out of range" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_unusedSlotIndices + 0, slotCount + 1 );
+		checkRejected( snapshot, "an unused slot index out of range" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_unusedSlotIndices + 0, slotIndex_body0 );
+		checkRejected( snapshot, "an unused slot that is used by a body" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_unusedSlotIndices + 1, slotIndex_unused0 );
+		checkRejected( snapshot, "an unused slot listed twice" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, wordIndex_slots + ( slotIndex_body0 * 2 ) + 1, 0x10000 );
+		checkRejected( snapshot, "an ID that is too big" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		SetWord( snapshot, AwakeBodyCount, bodyCount + 1 );
+		checkRejected( snapshot, "more awake bodies than bodies" );
+	}
+	{
+		auto snapshot = snapshot_valid;
+		snapshot.resize( snapshot.size() - s_snapshotWordSize );
+		checkRejected( snapshot, "a missing word" );
+	}
+	// The unmodified snapshot is still valid
+	EAE6320_TEST_CHECK( world.RestoreSnapshot( snapshot_valid.data(), snapshot_valid.size() ) );
+
+	CleanUpWorld( world, handles );
+}
+
+#endif	// EAE6320_ASSERTS_AREENABLED
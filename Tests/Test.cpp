@@ -0,0 +1,98 @@
+// Include Files
+//==============
+
+#include "Test.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	struct sTest
+	{
+		const char* name;
+		eae6320::Tests::fTest function;
+	};
+
+	// This is a function so that tests can be registered from any file during static initialization
+	std::vector<sTest>& GetTests()
+	{
+		static std::vector<sTest> tests;
+		return tests;
+	}
+
+	unsigned int s_failedCheckCount = 0;
+}
+
+// Interface
+//==========
+
+bool eae6320::Tests::Register( const char* const i_name, const fTest i_function )
+{
+	GetTests().push_back( sTest{ i_name, i_function } );
+	return true;
+}
+
+bool eae6320::Tests::Check( const bool i_condition, const char* const i_file, const unsigned int i_lineNumber, const char* const i_condition_text )
+{
+	if ( !i_condition )
+	{
+		++s_failedCheckCount;
+		fprintf( stderr, "%s(%u): Check failed: %s\n", i_file, i_lineNumber, i_condition_text );
+	}
+	return i_condition;
+}
+
+bool eae6320::Tests::CheckF( const bool i_condition, const char* const i_file, const unsigned int i_lineNumber, const char* const i_message, ... )
+{
+	if ( !i_condition )
+	{
+		++s_failedCheckCount;
+		fprintf( stderr, "%s(%u): Check failed: ", i_file, i_lineNumber );
+		va_list insertions;
+		va_start( insertions, i_message );
+		vfprintf( stderr, i_message, insertions );
+		va_end( insertions );
+		fprintf( stderr, "\n" );
+	}
+	return i_condition;
+}
+
+// Entry Point
+//============
+
+// The only argument is an optional part of a name,
+// and then only the tests whose names contain it are run
+int main( int i_argumentCount, char** i_arguments )
+{
+	const char* const filter = ( i_argumentCount > 1 ) ? i_arguments[1] : nullptr;
+	unsigned int failedTestCount = 0;
+	for ( const auto& test : GetTests() )
+	{
+		if ( filter && !std::strstr( test.name, filter ) )
+		{
+			continue;
+		}
+		const auto failedCheckCount_beforeTest = s_failedCheckCount;
+		test.function();
+		const auto hasTestPassed = s_failedCheckCount == failedCheckCount_beforeTest;
+		if ( !hasTestPassed )
+		{
+			++failedTestCount;
+		}
+		printf( "[%s] %s\n", hasTestPassed ? "Passed" : "FAILED", test.name );
+		fflush( stdout );
+	}
+	if ( failedTestCount > 0 )
+	{
+		printf( "%u tests failed\n", failedTestCount );
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,49 @@
+/*
+	This file provides a minimal framework for testing engine code
+
+	A test is a function that checks conditions:
+		EAE6320_TEST( MyTest )
+		{
+			EAE6320_TEST_CHECK( 1 + 1 == 2 );
+			EAE6320_TEST_CHECKF( x < y, "%f isn't less than %f", x, y );
+		}
+
+	A failed check is reported and the test keeps running
+	(a check can be used as a condition to stop early, e.g. "if ( !EAE6320_TEST_CHECK( ... ) ) return;").
+	Every module's tests are built into their own program,
+	which runs every test and returns a failure if any check failed.
+*/
+
+#ifndef EAE6320_TESTS_TEST_H
+#define EAE6320_TESTS_TEST_H
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Tests
+	{
+		using fTest = void (*)();
+
+		bool Register( const char* const i_name, const fTest i_function );
+
+		// These are called by the check macros
+		bool Check( const bool i_condition, const char* const i_file, const unsigned int i_lineNumber, const char* const i_condition_text );
+		bool CheckF( const bool i_condition, const char* const i_file, const unsigned int i_lineNumber, const char* const i_message, ... );
+	}
+}
+
+// This declares the function of a test and registers it when the program starts
+#define EAE6320_TEST( i_name )	\
+	static void i_name();	\
+	static const bool s_isRegistered_ ## i_name = eae6320::Tests::Register( #i_name, i_name );	\
+	static void i_name()
+
+// These evaluate to whether the condition was true
+#define EAE6320_TEST_CHECK( i_condition )	\
+	eae6320::Tests::Check( static_cast<bool>( i_condition ), __FILE__, __LINE__, #i_condition )
+#define EAE6320_TEST_CHECKF( i_condition, ... )	\
+	eae6320::Tests::CheckF( static_cast<bool>( i_condition ), __FILE__, __LINE__, __VA_ARGS__ )
+
+#endif	// EAE6320_TESTS_TEST_H
@@ -4,6 +4,7 @@
 #include "cMeshBuilder.h"
 
 #include <algorithm>
+#include <cmath>
 #include <codecvt>
 #include <Engine/Graphics/TextureFormats.h>
 #include <Engine/Math/Functions.h>
@@ -36,6 +37,7 @@ eae6320::cResult eae6320::Assets::cMeshBuilder::Build (const std::vector<std::st
 #endif
 	m_indexCount = m_indexVec.size();
 	m_vertexCount = m_meshVec.size(); // mesh vector contains all the vertex info, bad naming
+	const auto bounds = CalculateBounds(m_meshVec);
 
 	FILE *pFile;
 	std::string filePath = m_path_target;
@@ -47,6 +49,9 @@ eae6320::cResult eae6320::Assets::cMeshBuilder::Build (const std::vector<std::st
 	eae6320::Graphics::VertexFormats::sMesh * p_vertexVec = &m_meshVec[0];
 	uint16_t * p_indexVec = &m_indexVec[0];
 
+	// The bounds come first so that the counts that follow stay aligned
+	fwrite(&bounds, sizeof(bounds), 1, pFile);
+
 	fwrite(p_vertexCount, sizeof(size_t), 1, pFile);
 	fwrite(p_vertexVec, sizeof(eae6320::Graphics::VertexFormats::sMesh), m_meshVec.size(), pFile);
 
@@ -342,6 +347,43 @@ eae6320::cResult eae6320::Assets::cMeshBuilder::LoadMeshValues(lua_State& io_lua
 }
 
 
+eae6320::Graphics::sMeshBounds eae6320::Assets::cMeshBuilder::CalculateBounds(
+	const std::vector<eae6320::Graphics::VertexFormats::sMesh> & i_meshVec) {
+	eae6320::Graphics::sMeshBounds bounds;
+	if (i_meshVec.empty()) {
+		return bounds;
+	}
+
+	// The box is the minimum and maximum of every vertex
+	for (int j = 0; j < 3; j++) {
+		bounds.boxMinimum[j] = bounds.boxMaximum[j] = (&i_meshVec[0].x)[j];
+	}
+	for (const auto& vertex : i_meshVec) {
+		const float position[3] = { vertex.x, vertex.y, vertex.z };
+		for (int j = 0; j < 3; j++) {
+			bounds.boxMinimum[j] = std::min(bounds.boxMinimum[j], position[j]);
+			bounds.boxMaximum[j] = std::max(bounds.boxMaximum[j], position[j]);
+		}
+	}
+
+	// The sphere is centered on the box,
+	// and its radius is the distance to the farthest vertex
+	// (which is never larger than half of the box's diagonal and is usually smaller)
+	for (int j = 0; j < 3; j++) {
+		bounds.sphereCenter[j] = (bounds.boxMinimum[j] + bounds.boxMaximum[j]) * 0.5f;
+	}
+	float radiusSquared = 0.0f;
+	for (const auto& vertex : i_meshVec) {
+		const auto dx = vertex.x - bounds.sphereCenter[0];
+		const auto dy = vertex.y - bounds.sphereCenter[1];
+		const auto dz = vertex.z - bounds.sphereCenter[2];
+		radiusSquared = std::max(radiusSquared, (dx * dx) + (dy * dy) + (dz * dz));
+	}
+	bounds.sphereRadius = std::sqrt(radiusSquared);
+
+	return bounds;
+}
+
 // table should be at -1 when this function is called
 void eae6320::Assets::cMeshBuilder::readIndexValueFromLua(lua_State & io_luaState, std::vector<uint16_t> & indexVec, int numIndex) {
 	for (int i = 1; i <= numIndex / 3; i++) {
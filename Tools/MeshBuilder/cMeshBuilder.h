@@ -10,6 +10,7 @@ This class builds hardware-ready meshes
 
 #include <Tools/AssetBuildLibrary/cbBuilder.h>
 #include <Engine/Graphics/cMesh.h>
+#include <Engine/Graphics/sMeshBounds.h>
 
 // Class Declaration
 //==================
@@ -47,6 +48,10 @@ namespace eae6320
 
 			static void readIndexValueFromLua(lua_State & io_luaState, std::vector<uint16_t> & indexVec, int numIndex);
 
+			// The bounds are calculated from the vertex positions
+			// (after any platform-specific changes have been made to the vertices)
+			static eae6320::Graphics::sMeshBounds CalculateBounds(const std::vector<eae6320::Graphics::VertexFormats::sMesh> & i_meshVec);
+
 		};
 	}
 }